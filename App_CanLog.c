@@ -0,0 +1,282 @@
+/**********************************************************************************************************************
+ * \file App_CanLog.c
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "App_CanLog.h"
+#include "App_Config.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "Asclin/Std/IfxAsclin.h"
+#include "Stm/Std/IfxStm.h"
+#include "IfxCpu.h"
+#include "Src/Std/IfxSrc.h"
+
+#if APP_CANLOG_ENABLE != 0
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define APP_CANLOG_TX_FIFO_SIZE     16
+#define APP_CANLOG_NODE_MASK_ALL    0xFFU
+
+/* Statistics at their not cached alias, they are shared by all cores */
+#define APP_CANLOG_STATS            ((AppCanLogStats *)IPC_NOT_CACHED(&g_appCanLogStats))
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+IPC_MPSC_RING_DEFINE(appCanLog, AppCanLogRecord, APP_CANLOG_RING_DEPTH)
+
+typedef struct
+{
+    AppCanLogBatchHeader            header;
+    AppCanLogRecord                 record[APP_CANLOG_BATCH_RECORDS];
+} AppCanLogBatch;
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+/* Records of all cores on their way to CPU0, in the not cached LMU segment */
+#if defined(__TASKING__)
+#pragma section farbss "lmubss_nc"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".lmubss_nc" aw
+#endif
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) static appCanLogRing g_appCanLogRing;
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) AppCanLogStats       g_appCanLogStats;
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+/* Log task, the batch it assembles and the stream buffer to the TX ISR, in the DSPR of CPU0 */
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu0"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu0" aw
+#endif
+static StackType_t          g_appCanLogTaskStack[CPU0_CANLOG_TASK_STACK];
+static StaticTask_t         g_appCanLogTaskTcb;
+static StaticStreamBuffer_t g_appCanLogStreamCtrl;
+static uint8                g_appCanLogStreamStorage[APP_CANLOG_STREAM_SIZE + 1];
+static AppCanLogBatch       g_appCanLogBatch;
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+static StreamBufferHandle_t g_appCanLogStream;
+static volatile boolean     g_appCanLogTxActive;      /* TX FIFO refilled by the ISR, owned by CPU0 */
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Atomic increment, from any core */
+static void appCanLogCount(volatile uint32 *counter)
+{
+    uint32 old;
+
+    do
+    {
+        old = *counter;
+    } while (__cmpAndSwap((unsigned int volatile *)counter, old + 1, old) != old);
+}
+
+/* Called by the gateway ISR of any core for every frame it takes from an Rx FIFO, before the frame is released.
+ * Copies the frame once from the message RAM into a record and pushes it, never waits.
+ */
+void appCanLogFrame(uint8 node, Ifx_CAN_RXMSG *element)
+{
+    AppCanLogRecord record;
+
+    if ((APP_CANLOG_STATS->nodeMask & (1U << node)) == 0)
+    {
+        return;
+    }
+
+    appCanLogEncodeRecord(&record, node, element, IfxStm_getLower(&MODULE_STM0));
+
+    if (appCanLogPush(&g_appCanLogRing, &record) == FALSE)
+    {
+        appCanLogCount(&APP_CANLOG_STATS->dropped);
+    }
+}
+
+/* Moves bytes from the stream buffer into the TX FIFO, CPU0 with the TX interrupt masked. Returns the bytes moved. */
+static uint32 appCanLogTxFill(BaseType_t *woken)
+{
+    Ifx_ASCLIN *asclin = APP_CANLOG_ASCLIN;
+    uint8       bytes[APP_CANLOG_TX_FIFO_SIZE];
+    uint32      room   = APP_CANLOG_TX_FIFO_SIZE - IfxAsclin_getTxFifoFillLevel(asclin);
+    uint32      count  = (uint32)xStreamBufferReceiveFromISR(g_appCanLogStream, bytes, room, woken);
+
+    if (count > 0)
+    {
+        (void)IfxAsclin_write8(asclin, bytes, count);
+        APP_CANLOG_STATS->txBytes += count;
+    }
+
+    return count;
+}
+
+/* TX FIFO drained to its interrupt level: refill it, stop when the stream buffer is empty */
+IFX_INTERRUPT(appCanLogTxIsr, 0, ISR_PRIORITY_CANLOG_TX)
+{
+    BaseType_t woken = pdFALSE;
+
+    IfxAsclin_clearTxFifoFillLevelFlag(APP_CANLOG_ASCLIN);
+
+    if (appCanLogTxFill(&woken) == 0)
+    {
+        g_appCanLogTxActive = FALSE;
+    }
+
+    portYIELD_FROM_ISR(woken);
+}
+
+/* Starts the transmission if the TX ISR is idle, log task */
+static void appCanLogTxKick(void)
+{
+    BaseType_t woken = pdFALSE;
+
+    taskENTER_CRITICAL();
+
+    if ((g_appCanLogTxActive == FALSE) && (appCanLogTxFill(&woken) != 0))
+    {
+        g_appCanLogTxActive = TRUE;
+    }
+
+    taskEXIT_CRITICAL();
+}
+
+/* ASCLIN0 as 8N1 transmitter, TX FIFO interrupt on CPU0 (sequence of IfxAsclin_Asc_initModule()) */
+static void appCanLogInitAsclin(void)
+{
+    Ifx_ASCLIN            *asclin = APP_CANLOG_ASCLIN;
+    volatile Ifx_SRC_SRCR *src    = IfxAsclin_getSrcPointerTx(asclin);
+
+    IfxAsclin_enableModule(asclin);
+    IfxAsclin_setClockSource(asclin, IfxAsclin_ClockSource_noClock);
+    IfxAsclin_setFrameMode(asclin, IfxAsclin_FrameMode_initialise);
+    IfxAsclin_setPrescaler(asclin, 1);
+    IfxAsclin_setClockSource(asclin, IfxAsclin_ClockSource_ascFastClock);
+    (void)IfxAsclin_setBitTiming(asclin, APP_CANLOG_BAUDRATE, IfxAsclin_OversamplingFactor_16,
+                                 IfxAsclin_SamplePointPosition_8, IfxAsclin_SamplesPerBit_three);
+    IfxAsclin_setClockSource(asclin, IfxAsclin_ClockSource_noClock);
+    IfxAsclin_setStopBit(asclin, IfxAsclin_StopBit_1);
+    IfxAsclin_setDataLength(asclin, IfxAsclin_DataLength_8);
+    IfxAsclin_setTxFifoInletWidth(asclin, IfxAsclin_TxFifoInletWidth_1);
+    IfxAsclin_setTxFifoInterruptLevel(asclin, IfxAsclin_TxFifoInterruptLevel_0);
+    IfxAsclin_setFrameMode(asclin, IfxAsclin_FrameMode_asc);
+
+    IfxAsclin_initTxPin(&APP_CANLOG_TX_PIN, IfxPort_OutputMode_pushPull, IfxPort_PadDriver_cmosAutomotiveSpeed1);
+
+    IfxAsclin_setClockSource(asclin, IfxAsclin_ClockSource_ascFastClock);
+    IfxAsclin_disableAllFlags(asclin);
+    IfxAsclin_clearAllFlags(asclin);
+    IfxAsclin_enableTxFifoFillLevelFlag(asclin, TRUE);
+    IfxAsclin_enableTxFifoOutlet(asclin, TRUE);
+    IfxAsclin_flushTxFifo(asclin);
+
+    IfxSrc_init(src, IfxSrc_Tos_cpu0, ISR_PRIORITY_CANLOG_TX);
+    IfxSrc_enable(src);
+}
+
+/* Pops up to one batch of records, returns the record count */
+static uint32 appCanLogFillBatch(void)
+{
+    AppCanLogBatch *batch = &g_appCanLogBatch;
+    uint32          count = 0;
+
+    while ((count < APP_CANLOG_BATCH_RECORDS) && (appCanLogPop(&g_appCanLogRing, &batch->record[count]) != FALSE))
+    {
+        count++;
+    }
+
+    if (count > 0)
+    {
+        appCanLogEncodeHeader(&batch->header, count, APP_CANLOG_STATS->batches, APP_CANLOG_STATS->dropped);
+    }
+
+    return count;
+}
+
+/* Log task: every period all queued records, in batches. A batch goes into the stream buffer only as a whole, so
+ * the log task waits for room instead of splitting it; meanwhile the ring takes up the new frames.
+ */
+static void task_cpu0_canlog(void *arg)
+{
+    TickType_t release = xTaskGetTickCount();
+    uint32     count;
+
+    (void)arg;
+
+    while (1)
+    {
+        vTaskDelayUntil(&release, pdMS_TO_TICKS(CPU0_CANLOG_TASK_PERIOD));
+
+        while ((count = appCanLogFillBatch()) != 0)
+        {
+            size_t size = sizeof(AppCanLogBatchHeader) + (count * sizeof(AppCanLogRecord));
+
+            while (xStreamBufferSpacesAvailable(g_appCanLogStream) < size)
+            {
+                APP_CANLOG_STATS->streamWaits++;
+                appCanLogTxKick();
+                vTaskDelay(1);
+            }
+
+            (void)xStreamBufferSend(g_appCanLogStream, &g_appCanLogBatch, size, 0);
+            APP_CANLOG_STATS->records += count;
+            APP_CANLOG_STATS->batches++;
+            appCanLogTxKick();
+        }
+    }
+}
+
+/* Sets up the transport and the log task and enables the hook, CPU0 init task before the gateway starts */
+void app_canlog_start(void)
+{
+    g_appCanLogStream = xStreamBufferCreateStatic(APP_CANLOG_STREAM_SIZE, 1, g_appCanLogStreamStorage,
+                                                  &g_appCanLogStreamCtrl);
+
+    appCanLogInitAsclin();
+
+    (void)xTaskCreateStatic(task_cpu0_canlog, "CPU0 CANLOG", CPU0_CANLOG_TASK_STACK, NULL, CPU0_CANLOG_TASK_PRIORITY,
+                            g_appCanLogTaskStack, &g_appCanLogTaskTcb);
+
+    APP_CANLOG_STATS->nodeMask = APP_CANLOG_NODE_MASK_ALL;
+}
+#endif /* APP_CANLOG_ENABLE */
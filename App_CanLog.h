@@ -0,0 +1,191 @@
+/**********************************************************************************************************************
+ * \file App_CanLog.h
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef APP_CANLOG_H_
+#define APP_CANLOG_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCan_reg.h"
+#include "App_IpcRing.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* CAN frame log, streamed to a host over ASCLIN0.
+ *
+ * The gateway ISRs of all cores copy every received frame once, straight from the message RAM, into a fixed layout
+ * record and push it into a lock-free MPSC ring in the not cached LMU. Nothing in that path waits: when the ring is
+ * full the record is dropped and counted. A low priority task on CPU0 pops the records into batches and writes the
+ * batches into a stream buffer, the ASCLIN0 transmit ISR drains the stream buffer into the TX FIFO.
+ *
+ * Byte stream on the wire (all words little endian), a sequence of batches:
+ *   batch header (16 bytes)
+ *     word 0  magic      APP_CANLOG_MAGIC, bytes 'C' 'L' 'G' '1'
+ *     word 1  info       version (bits 7..0) | record size (bits 15..8) | record count (bits 31..16)
+ *     word 2  sequence   batch number, +1 per batch
+ *     word 3  dropped    records dropped since start, all cores (the ring was full)
+ *   count records (32 bytes each)
+ *     word 0  timestamp  STM0 lower word when the gateway picked the frame up (100 MHz, wraps after ~43 s)
+ *     word 1  id         R0 of the Rx element: ID (bits 28..0, standard IDs in bits 28..18), RTR (29), XTD (30),
+ *                        ESI (31)
+ *     byte 8  node       source node (0..3 = CAN0 node 0..3, 4..7 = CAN1 node 0..3)
+ *     byte 9  flags      APP_CANLOG_FLAG_xxx
+ *     byte 10 dlc        DLC as received
+ *     byte 11 length     payload bytes stored in data (at most APP_CANLOG_DATA_SIZE)
+ *     byte 12 data       first bytes of the payload, the rest of the 20 bytes is undefined
+ * A reader finds the first batch by scanning for the magic with a plausible info word and checks the magic of every
+ * following batch (at 16 + count * 32 bytes after the previous one) to resynchronise after a lost byte. The dropped
+ * counter and gaps in the sequence tell a lossy log from a complete one.
+ *
+ * tools/canlog reads such a log on the host (canlogdump).
+ *
+ * APP_CANLOG_ENABLE 0 removes the hook from the gateway and the task.
+ */
+#define APP_CANLOG_ENABLE           1
+
+#define APP_CANLOG_MAGIC            0x31474C43U                 /* "CLG1" in memory order                            */
+#define APP_CANLOG_VERSION          1
+#define APP_CANLOG_DATA_SIZE        20                          /* Payload bytes per record, multiple of 4           */
+#define APP_CANLOG_RING_DEPTH       256                         /* Records between the ISRs and the task, power of 2 */
+#define APP_CANLOG_BATCH_RECORDS    16                          /* Records per batch at most                         */
+#define APP_CANLOG_STREAM_SIZE      2048                        /* Stream buffer, ~22 ms at 921600 baud              */
+
+/* Batch header info word of a batch of count records */
+#define APP_CANLOG_INFO(count)      (APP_CANLOG_VERSION | ((uint32)sizeof(AppCanLogRecord) << 8) | ((uint32)(count) << 16))
+
+/* Record flags */
+#define APP_CANLOG_FLAG_FD          0x01U                       /* CAN FD frame (FDF)                                */
+#define APP_CANLOG_FLAG_BRS         0x02U                       /* Bit rate switch                                   */
+#define APP_CANLOG_FLAG_TRUNCATED   0x04U                       /* Payload longer than APP_CANLOG_DATA_SIZE          */
+
+/* Transport: ASCLIN0 on the USB/UART bridge of the board, 8N1, transmit only */
+#define APP_CANLOG_ASCLIN           (&MODULE_ASCLIN0)
+#define APP_CANLOG_TX_PIN           IfxAsclin0_TX_P14_0_OUT
+#define APP_CANLOG_BAUDRATE         921600
+#define ISR_PRIORITY_CANLOG_TX      3                           /* ASCLIN0 TX FIFO refill on CPU0, below the doorbell */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32                          timestamp;       /* STM0 lower word                                              */
+    uint32                          id;              /* R0 of the Rx element                                         */
+    uint8                           node;            /* Source node                                                  */
+    uint8                           flags;           /* APP_CANLOG_FLAG_xxx                                          */
+    uint8                           dlc;             /* DLC as received                                              */
+    uint8                           length;          /* Payload bytes in data                                        */
+    uint32                          data[APP_CANLOG_DATA_SIZE / 4];
+} AppCanLogRecord;
+
+typedef struct
+{
+    uint32                          magic;           /* APP_CANLOG_MAGIC                                             */
+    uint32                          info;            /* Version | record size << 8 | record count << 16              */
+    uint32                          sequence;        /* Batch number                                                 */
+    uint32                          dropped;         /* Records dropped since start                                  */
+} AppCanLogBatchHeader;
+
+/* The wire format is the memory image of these structures */
+typedef char AppCanLogRecordSizeCheck[(sizeof(AppCanLogRecord) == 32) ? 1 : -1];
+typedef char AppCanLogHeaderSizeCheck[(sizeof(AppCanLogBatchHeader) == 16) ? 1 : -1];
+
+typedef struct
+{
+    volatile uint32                 nodeMask;        /* Nodes logged (bit n: node n), 0 until app_canlog_start()     */
+    volatile uint32                 dropped;         /* Records dropped, ring full (all cores)                       */
+    uint32                          records;         /* Records written to the stream (log task)                     */
+    uint32                          batches;         /* Batches written to the stream                                */
+    uint32                          streamWaits;     /* Log task waited for room in the stream buffer (link too slow)*/
+    uint32                          txBytes;         /* Bytes written to the TX FIFO                                 */
+} AppCanLogStats;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Inline Functions--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Record of a frame, copied once from its Rx element in the message RAM. Shared with the host tests, which decode
+ * the records with the host reader (tools/canlog).
+ */
+IFX_INLINE void appCanLogEncodeRecord(AppCanLogRecord *record, uint8 node, Ifx_CAN_RXMSG *element, uint32 timestamp)
+{
+    /* Payload bytes per DLC, classic frames stop at 8 */
+    static const uint8 dlcLength[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+    const uint32      *payload       = &((const uint32 *)element)[2];
+    uint32             length;
+    uint32             i;
+
+    record->timestamp = timestamp;
+    record->id        = element->R0.U;
+    record->node      = node;
+    record->dlc       = (uint8)element->R1.B.DLC;
+    record->flags     = 0;
+
+    if (element->R1.B.FDF != 0)
+    {
+        record->flags |= APP_CANLOG_FLAG_FD;
+        record->flags |= (element->R1.B.BRS != 0) ? APP_CANLOG_FLAG_BRS : 0;
+        length         = dlcLength[record->dlc];
+    }
+    else
+    {
+        length = (element->R0.B.RTR != 0) ? 0 : ((record->dlc > 8) ? 8 : record->dlc);
+    }
+
+    if (length > APP_CANLOG_DATA_SIZE)
+    {
+        record->flags |= APP_CANLOG_FLAG_TRUNCATED;
+        length         = APP_CANLOG_DATA_SIZE;
+    }
+
+    record->length = (uint8)length;
+
+    for (i = 0; i < ((length + 3) / 4); i++)
+    {
+        record->data[i] = payload[i];
+    }
+}
+
+/* Header of a batch of count records */
+IFX_INLINE void appCanLogEncodeHeader(AppCanLogBatchHeader *header, uint32 count, uint32 sequence, uint32 dropped)
+{
+    header->magic    = APP_CANLOG_MAGIC;
+    header->info     = APP_CANLOG_INFO(count);
+    header->sequence = sequence;
+    header->dropped  = dropped;
+}
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+void app_canlog_start(void);
+void appCanLogFrame(uint8 node, Ifx_CAN_RXMSG *element);
+
+extern AppCanLogStats g_appCanLogStats;
+
+#endif /* APP_CANLOG_H_ */
@@ -34,6 +34,7 @@
 #include "Ifx_Types.h"
 #include "IfxPort_PinMap.h"
 #include "Port/Io/IfxPort_Io.h"
+#include "App_IpcRing.h"
 
 #include <stdio.h>
 #include <stdbool.h>
@@ -51,7 +52,7 @@
 
 /* System-wide Configuration */
 #define BUTTON_DEBOUNCE_COUNT   (5)                /* Number of consecutive readings for debouncing                */
-#define LED2_BLINK_PERIOD_US    (500000)           /* LED2 blink half period CPU1 turn on at twice period    */
+#define LED2_BLINK_PERIOD_MS    (500)              /* LED2 blink half period CPU1 turn on at twice period    */
 
 /* System-wide Boolean Flags */
 extern volatile bool BUTTON_PRESSED_FLAG;
@@ -61,16 +62,56 @@ extern volatile uint32_t cpu1_loop_count;
 extern volatile uint32_t cpu2_loop_count;
 extern volatile uint32_t led_process_count;
 
-/* CPU tick counters */
+/* CPU tick counters (CPU1/CPU2 1ms ticks) */
 extern uint32_t cpu1_tick_counter;
 extern uint32_t cpu2_tick_counter;
 
 /* Inter-CPU Communication Flags */
-extern volatile bool LED_PROCESS_ACTIVE;
 extern volatile bool CPU1_EXECUTION_PROCESS;
 extern volatile bool CPU2_EXECUTION_PROCESS;
-extern volatile bool CPU1_DATA_READY;
-extern volatile bool CPU2_DATA_READY;
+
+/* Inter-CPU Messages, sent through the lock-free inbox ring of the receiving CPU */
+typedef enum
+{
+    APP_MSG_LED_PROCESS = 0,                       /* CPU0 -> CPU1/CPU2: value = LED2 process active (button)      */
+    APP_MSG_LED2_ON                                /* CPU1 -> CPU2: LED2 switched on, value = cpu1_loop_count      */
+} AppCpuMsgId;
+
+typedef struct
+{
+    uint32 id;                                     /* AppCpuMsgId                                                  */
+    uint32 value;                                  /* Message specific value                                       */
+} AppCpuMsg;
+
+#define APP_CPU_INBOX_DEPTH     (8)                /* Messages per CPU inbox (power of two)                        */
+
+/* MPSC ring type appCpuInboxRing with appCpuInboxPush() (any CPU) and appCpuInboxPop() (receiving CPU) */
+IPC_MPSC_RING_DEFINE(appCpuInbox, AppCpuMsg, APP_CPU_INBOX_DEPTH)
+
+extern appCpuInboxRing g_cpu1Inbox;
+extern appCpuInboxRing g_cpu2Inbox;
+
+/* Boot benchmark: STM0 lower word (100MHz) per core, the load of a core follows from its idle time in
+ * g_ipcNotifyStats. On CPU0 schedulerStart - mainEntry includes the wait for CPU1/CPU2 at the sync event,
+ * firstTask - schedulerStart is the start of the kernel (idle and timer task, timer queue, first timer task run).
+ */
+typedef enum
+{
+    APP_BOOT_MAIN_ENTRY = 0,                       /* Entry of coreN_main                                          */
+    APP_BOOT_SCHEDULER_START,                      /* Hand over to the scheduler (or the bare-metal idle loop)     */
+    APP_BOOT_FIRST_TASK                            /* First application task of the scheduler running              */
+} AppCoreBootStage;
+
+typedef struct
+{
+    uint32 mainEntry;                              /* APP_BOOT_MAIN_ENTRY                                          */
+    uint32 schedulerStart;                         /* APP_BOOT_SCHEDULER_START                                     */
+    uint32 firstTask;                              /* APP_BOOT_FIRST_TASK, 0: bare-metal core                      */
+} AppCoreBootType;
+
+extern AppCoreBootType g_appCoreBoot[IPC_NUM_CORES];
+
+void app_core_boot_stamp(AppCoreBootStage stage);
 
 
 /*********************************************************************************************************************/
@@ -82,37 +123,119 @@ extern volatile bool CPU2_DATA_READY;
 
 /* CPU0 Semaphores */
 extern SemaphoreHandle_t g_cpu0InitSem;
-extern SemaphoreHandle_t g_cpu0TickSem;
 
 /* CPU0 Application Functions */
 void app_cpu0_led1(void);
 void app_cpu0_button(void);
 
 /* CPU0 Task Functions */
-void task_cpu0_init(void *arg);                    /* CPU0 initialization task running at 1ms                     */
-void task_cpu0_1ms(void *arg);                     /* CPU0 1ms placeholder task                                    */
-void task_cpu0_10ms(void *arg);                    /* CPU0 10ms placeholder task                                   */
-void task_cpu0_100ms(void *arg);                   /* CPU0 100ms placeholder task                                  */
-void task_cpu0_1000ms(void *arg);                  /* CPU0 1000ms placeholder task                                 */
-
+void task_cpu0_init(void *arg);                    /* CPU0 initialization task, starts the periodic tasks          */
+
+/* CPU0 Periodic Jobs, one release per period of their periodic task */
+void job_cpu0_1ms(void);                           /* CPU0 1ms job: gateway container tick                         */
+void job_cpu0_10ms(void);                          /* CPU0 10ms job: button handling                               */
+void job_cpu0_100ms(void);                         /* CPU0 100ms job: LED1 control                                 */
+void job_cpu0_1000ms(void);                        /* CPU0 1000ms placeholder job                                  */
+
+/* Release and deadline statistics of a periodic task */
+typedef struct
+{
+    TickType_t release;                            /* Latest release, kernel ticks                                 */
+    uint32     releases;                           /* Jobs run                                                     */
+    uint32     deadlineMisses;                     /* Jobs finished after release + deadline                       */
+    uint32     overruns;                           /* Releases already due when the previous job finished          */
+    uint32     jitterMax;                          /* Largest start deviation from the nominal period, STM ticks   */
+    uint32     execMax;                            /* Longest job execution, STM ticks                             */
+} AppPeriodicTaskStats;
+
+/* Periodic task, declared in a task table (App_Periodic.c). Releases are drift free (vTaskDelayUntil() on the release
+ * time, phased by the offset), a job that finishes later than release + deadline counts as deadline miss. Stack and
+ * TCB are static, in the DSPR of the core.
+ */
+typedef struct
+{
+    void                (*job)(void);              /* Job run once per release                                     */
+    const char           *name;                    /* Task name                                                    */
+    uint32                periodMs;                /* Release period                                               */
+    uint32                offsetMs;                /* First release, relative to the start of the periodic tasks   */
+    uint32                deadlineMs;              /* Relative deadline, <= period                                 */
+    uint16                stack;                   /* Stack depth in words                                         */
+    UBaseType_t           priority;                /* Rate monotonic: the shorter the period, the higher           */
+    StackType_t          *stackBuffer;             /* Stack, stack words                                           */
+    StaticTask_t         *taskBuffer;              /* TCB                                                          */
+    AppPeriodicTaskStats *stats;                   /* Statistics, written by the task                              */
+} AppPeriodicTaskCfg;
+
+#define CPU0_PERIODIC_TASK_COUNT    (4)
+
+extern AppPeriodicTaskStats g_cpu0PeriodicStats[CPU0_PERIODIC_TASK_COUNT];
+
+/* Create the periodic tasks of a task table on the calling core, their offsets count from now */
+void app_periodic_start(const AppPeriodicTaskCfg *table, uint32 count);
+void app_cpu0_periodic_start(void);
+
+/* Context switch microbenchmark (CPU0_SWITCH_BENCH): every second a burst of task notifications from a low priority
+ * task wakes a higher priority task, which takes the CCNT cycles from the give to the return of its
+ * ulTaskNotifyTake(). This covers the yield syscall, the scheduler and the CSA switch of the port.
+ */
+typedef struct
+{
+    uint32 samples;                                /* Switches measured                                            */
+    uint32 cyclesLast;                             /* Latest switch latency                                        */
+    uint32 cyclesMin;                              /* Shortest switch latency                                      */
+    uint32 cyclesMax;                              /* Longest switch latency                                       */
+    uint32 cyclesAvg;                              /* Mean switch latency of the latest burst                      */
+} AppSwitchBenchStats;
+
+extern AppSwitchBenchStats g_cpu0SwitchBench;
+
+void app_cpu0_switch_bench_start(void);
 
 /* CPU0 Configuration */
-#define CPU0_INIT_TASK_PRIORITY     (2)            /* Priority for CPU0 init task                                  */
+#define CPU0_INIT_TASK_PRIORITY     (2)            /* Priority for CPU0 init task, below all periodic tasks        */
 #define CPU0_INIT_TASK_STACK        (configMINIMAL_STACK_SIZE)  /* Stack size for CPU0 init task            */
-#define CPU0_1MS_TASK_PRIORITY      (3)            /* Priority for CPU0 1ms task                                   */
+#define CPU0_1MS_TASK_PRIORITY      (6)            /* Priority for CPU0 1ms task                                   */
+#define CPU0_1MS_TASK_OFFSET        (0)            /* First release of CPU0 1ms task [ms]                          */
 #define CPU0_1MS_TASK_STACK         (configMINIMAL_STACK_SIZE)  /* Stack size for CPU0 1ms task             */
-#define CPU0_10MS_TASK_PRIORITY     (4)            /* Priority for CPU0 10ms task                                  */
+#define CPU0_10MS_TASK_PRIORITY     (5)            /* Priority for CPU0 10ms task                                  */
+#define CPU0_10MS_TASK_OFFSET       (1)            /* First release of CPU0 10ms task [ms]                         */
 #define CPU0_10MS_TASK_STACK        (configMINIMAL_STACK_SIZE)  /* Stack size for CPU0 10ms task            */
-#define CPU0_100MS_TASK_PRIORITY    (5)            /* Priority for CPU0 100ms task                                 */
+#define CPU0_100MS_TASK_PRIORITY    (4)            /* Priority for CPU0 100ms task                                 */
+#define CPU0_100MS_TASK_OFFSET      (2)            /* First release of CPU0 100ms task [ms]                        */
 #define CPU0_100MS_TASK_STACK       (configMINIMAL_STACK_SIZE)  /* Stack size for CPU0 100ms task           */
-#define CPU0_1000MS_TASK_PRIORITY   (6)            /* Priority for CPU0 1000ms task                                */
+#define CPU0_1000MS_TASK_PRIORITY   (3)            /* Priority for CPU0 1000ms task                                */
+#define CPU0_1000MS_TASK_OFFSET     (3)            /* First release of CPU0 1000ms task [ms]                       */
 #define CPU0_1000MS_TASK_STACK      (configMINIMAL_STACK_SIZE)  /* Stack size for CPU0 1000ms task          */
+#define CPU0_SWITCH_BENCH           (0)            /* 1: run the context switch microbenchmark                     */
+#define CPU0_SWITCH_BENCH_PRIORITY  (1)            /* Sending task, the receiving task runs one priority higher    */
+#define CPU0_SWITCH_BENCH_STACK     (configMINIMAL_STACK_SIZE)  /* Stack size for the benchmark tasks       */
+#define CPU0_SWITCH_BENCH_BURST     (64)           /* Switches measured per burst, one burst per second            */
+#define CPU0_CANLOG_TASK_PRIORITY   (1)            /* CAN log task (App_CanLog.c), lowest, it must never delay work */
+#define CPU0_CANLOG_TASK_PERIOD     (10)           /* Batches are flushed every period [ms]                        */
+#define CPU0_CANLOG_TASK_STACK      (configMINIMAL_STACK_SIZE)  /* Stack size for the CAN log task          */
 
 /*********************************************************************************************************************/
 /*---------------------------------------------- CPU1/CPU2 Section -----------------------------------------------*/
 /*********************************************************************************************************************/
-/* CPU1 and CPU2 run bare-metal with LED2 control functions */
+/* CPU1 and CPU2 run bare-metal with LED2 control functions. They sleep in WAIT between their 1ms tick interrupt,
+ * the doorbell interrupt of their inbox and the CAN gateway interrupts.
+ * With configPER_CORE_SCHEDULER they run their own FreeRTOS scheduler instead: a 1ms task and an inbox task, the
+ * doorbell ISR bridges the inbox ring into a local queue.
+ */
+void app_cpu1_init(void);
 void app_cpu1_led2on(void);
+void app_cpu2_init(void);
 void app_cpu2_led2off(void);
 
+#if configPER_CORE_SCHEDULER != 0
+boolean appCpuInboxBridgeFromISR(appCpuInboxRing *inbox, QueueHandle_t queue, BaseType_t *woken);
+#endif
+
+/* CPU1/CPU2 Configuration */
+#define ISR_PRIORITY_APP_TICK       5              /* 1ms STM compare 0 tick of CPU1/CPU2, above the doorbell ISR  */
+#define CPU12_1MS_TASK_PRIORITY     (4)            /* 1ms task, above the inbox task (never preempted by it)       */
+#define CPU12_1MS_TASK_STACK        (configMINIMAL_STACK_SIZE)  /* Stack size for CPU1/CPU2 1ms task        */
+#define CPU12_INBOX_TASK_PRIORITY   (3)            /* Inbox task                                                   */
+#define CPU12_INBOX_TASK_STACK      (configMINIMAL_STACK_SIZE)  /* Stack size for CPU1/CPU2 inbox task      */
+
 #endif /* APP_CONFIG_H_ */
@@ -32,8 +32,11 @@
 #include "task.h"
 #include "semphr.h"
 #include "Port/Io/IfxPort_Io.h"
+#include "Stm/Std/IfxStm.h"
+#include "IfxCpu.h"
 #include "App_Config.h"
 #include "MULTICAN_GW_TX_FIFO.h"
+#include "App_CanLog.h"
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -70,18 +73,80 @@ uint32_t cpu1_tick_counter = 0;
 uint32_t cpu2_tick_counter = 0;
 
 /* Sequential execution control variables */
-volatile bool LED_PROCESS_ACTIVE = false;
 volatile bool CPU1_EXECUTION_PROCESS = false;
-volatile bool CPU1_DATA_READY = false;
 volatile bool CPU2_EXECUTION_PROCESS = false;
-volatile bool CPU2_DATA_READY = false;
+
+/* LED2 process state, owned by CPU0, and the state last delivered to the CPU1/CPU2 inboxes */
+static bool led_process_active = false;
+static bool led_process_sent_cpu1 = false;
+static bool led_process_sent_cpu2 = false;
+
+/* CPU1/CPU2 inboxes and the boot time stamps of all cores, in the not cached LMU segment */
+#if defined(__TASKING__)
+#pragma section farbss "lmubss_nc"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".lmubss_nc" aw
+#endif
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) appCpuInboxRing g_cpu1Inbox;
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) appCpuInboxRing g_cpu2Inbox;
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) AppCoreBootType g_appCoreBoot[IPC_NUM_CORES];
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
 
 /* Button handling function */
 
 
 /* Global semaphores for CPU0 */
 SemaphoreHandle_t g_cpu0InitSem = NULL;
-SemaphoreHandle_t g_cpu0TickSem = NULL;
+
+/* Stacks and TCBs of the CPU0 tasks, in the DSPR of CPU0 */
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu0"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu0" aw
+#endif
+static StackType_t  cpu0_1ms_stack[CPU0_1MS_TASK_STACK];
+static StackType_t  cpu0_10ms_stack[CPU0_10MS_TASK_STACK];
+static StackType_t  cpu0_100ms_stack[CPU0_100MS_TASK_STACK];
+static StackType_t  cpu0_1000ms_stack[CPU0_1000MS_TASK_STACK];
+static StaticTask_t cpu0_periodic_tcb[CPU0_PERIODIC_TASK_COUNT];
+#if CPU0_SWITCH_BENCH != 0
+static StackType_t  cpu0_switch_bench_stack[2][CPU0_SWITCH_BENCH_STACK];
+static StaticTask_t cpu0_switch_bench_tcb[2];
+#endif
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+/* Release and deadline statistics of the periodic tasks */
+AppPeriodicTaskStats g_cpu0PeriodicStats[CPU0_PERIODIC_TASK_COUNT];
+
+/* CPU0 periodic task table, rate monotonic priorities */
+static const AppPeriodicTaskCfg cpu0_periodic_tasks[CPU0_PERIODIC_TASK_COUNT] = {
+    /* job              name           period  offset                   deadline stack                   priority                   stack buffer       TCB                    statistics              */
+    {job_cpu0_1ms,    "CPU0 1MS",    1,      CPU0_1MS_TASK_OFFSET,    1,       CPU0_1MS_TASK_STACK,    CPU0_1MS_TASK_PRIORITY,    cpu0_1ms_stack,    &cpu0_periodic_tcb[0], &g_cpu0PeriodicStats[0]},
+    {job_cpu0_10ms,   "CPU0 10MS",   10,     CPU0_10MS_TASK_OFFSET,   10,      CPU0_10MS_TASK_STACK,   CPU0_10MS_TASK_PRIORITY,   cpu0_10ms_stack,   &cpu0_periodic_tcb[1], &g_cpu0PeriodicStats[1]},
+    {job_cpu0_100ms,  "CPU0 100MS",  100,    CPU0_100MS_TASK_OFFSET,  100,     CPU0_100MS_TASK_STACK,  CPU0_100MS_TASK_PRIORITY,  cpu0_100ms_stack,  &cpu0_periodic_tcb[2], &g_cpu0PeriodicStats[2]},
+    {job_cpu0_1000ms, "CPU0 1000MS", 1000,   CPU0_1000MS_TASK_OFFSET, 1000,    CPU0_1000MS_TASK_STACK, CPU0_1000MS_TASK_PRIORITY, cpu0_1000ms_stack, &cpu0_periodic_tcb[3], &g_cpu0PeriodicStats[3]},
+};
+
+#if CPU0_SWITCH_BENCH != 0
+/* Context switch latency, CCNT cycles */
+AppSwitchBenchStats g_cpu0SwitchBench;
+
+/* CCNT at the give of the sending task, and the receiving task */
+static volatile uint32 cpu0_switch_bench_give;
+static TaskHandle_t    cpu0_switch_bench_receiver;
+#endif
 
 /*********************************************************************************************************************/
 /*---------------------------------------------Function Implementations----------------------------------------------*/
@@ -92,6 +157,8 @@ void task_cpu0_init(void *arg)
 {
     static bool initialized = false;
     
+    app_core_boot_stamp(APP_BOOT_FIRST_TASK);
+
     while (1)
     {
         /* Wait for CPU0 init semaphore */
@@ -104,7 +171,7 @@ void task_cpu0_init(void *arg)
             if (!initialized)
             {
                 /* Initialize LED process control */
-                LED_PROCESS_ACTIVE = false;        /* Process starts active */
+                led_process_active = false;        /* Process starts inactive */
                 BUTTON_PRESSED_FLAG = IfxPort_State_high;       /* No button press initially */
                          
                 /* Initialize BUTTON0 */
@@ -118,12 +185,22 @@ void task_cpu0_init(void *arg)
                 IfxPort_setPinMode(LED_2.port, LED_2.pinIndex, IfxPort_Mode_outputPushPullGeneral);
                 IfxPort_setPinState(LED_2.port, LED_2.pinIndex, IfxPort_State_high);
                 
-                /* Initialize MultiCAN Gateway FIFO demo for TC375 */
-                //initMultican();
+#if APP_CANLOG_ENABLE != 0
+                /* CAN log first, so it sees the first frames the gateway forwards */
+                app_canlog_start();
+#endif
+
+                /* Initialize MCMCAN gateway (all enabled CAN0/CAN1 nodes) */
+                initMultican();
 
                 initialized = true;
-                xSemaphoreGive(g_cpu0TickSem);
 
+                /* Hardware is ready, release the periodic tasks */
+                app_cpu0_periodic_start();
+
+#if CPU0_SWITCH_BENCH != 0
+                app_cpu0_switch_bench_start();
+#endif
             }
         }
         
@@ -132,89 +209,110 @@ void task_cpu0_init(void *arg)
     }
 }
 
-/* CPU0 1ms placeholder task */
-void task_cpu0_1ms(void *arg)
+/* Create the periodic tasks of the CPU0 task table */
+void app_cpu0_periodic_start(void)
 {
+    app_periodic_start(cpu0_periodic_tasks, CPU0_PERIODIC_TASK_COUNT);
+}
+
+#if CPU0_SWITCH_BENCH != 0
+/* Receiving task of the switch benchmark: wakes up on the give of the sending task and takes the latency */
+static void task_cpu0_switch_bench_receive(void *arg)
+{
+    (void)arg;
+
     while (1)
     {
-        /* Wait for CPU0 tick semaphore */
-        if (xSemaphoreTake(g_cpu0TickSem, portMAX_DELAY) == pdTRUE)
+        uint32 cycles;
+
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        cycles = IfxCpu_getClockCounter() - cpu0_switch_bench_give;
+
+        g_cpu0SwitchBench.cyclesLast = cycles;
+        g_cpu0SwitchBench.samples++;
+
+        if ((cycles < g_cpu0SwitchBench.cyclesMin) || (g_cpu0SwitchBench.cyclesMin == 0))
         {
-            cpu0_1ms_count++;
-            /* USER FUNCTIONS */
+            g_cpu0SwitchBench.cyclesMin = cycles;
+        }
 
-            /* Give semaphore back before finishing */
-            xSemaphoreGive(g_cpu0TickSem);
+        if (cycles > g_cpu0SwitchBench.cyclesMax)
+        {
+            g_cpu0SwitchBench.cyclesMax = cycles;
         }
-        
-        /* Task period: 1ms */
-        vTaskDelay(pdMS_TO_TICKS(1));
     }
 }
 
-/* CPU0 10ms task - Button handling moved here */
-void task_cpu0_10ms(void *arg)
+/* Sending task of the switch benchmark: one burst per second, each give switches to the receiving task at once */
+static void task_cpu0_switch_bench_send(void *arg)
 {
+    (void)arg;
+
+    /* CCNT runs from appTraceInit() when the trace recorder is built in, start it otherwise */
+    IfxCpu_setPerformanceCountersEnableBit(1);
+
     while (1)
     {
-        /* Wait for CPU0 tick semaphore */
-        if (xSemaphoreTake(g_cpu0TickSem, portMAX_DELAY) == pdTRUE)
+        uint32 sum = 0;
+        uint32 i;
+
+        vTaskDelay(pdMS_TO_TICKS(1000));
+
+        for (i = 0; i < CPU0_SWITCH_BENCH_BURST; i++)
         {
-            cpu0_10ms_count++;
-            
-            /* USER FUNCTIONS */
-            app_cpu0_button();
-            
-            /* Give semaphore back before finishing */
-            xSemaphoreGive(g_cpu0TickSem);
+            cpu0_switch_bench_give = IfxCpu_getClockCounter();
+            xTaskNotifyGive(cpu0_switch_bench_receiver);
+            sum += g_cpu0SwitchBench.cyclesLast;
         }
-        
-        /* Task period: 10ms */
-        vTaskDelay(pdMS_TO_TICKS(10));
+
+        g_cpu0SwitchBench.cyclesAvg = sum / CPU0_SWITCH_BENCH_BURST;
     }
 }
 
-/* CPU0 100ms placeholder task */
-void task_cpu0_100ms(void *arg)
+/* Create the two tasks of the context switch benchmark */
+void app_cpu0_switch_bench_start(void)
 {
-    while (1)
-    {
-        /* Wait for CPU0 tick semaphore */
-        if (xSemaphoreTake(g_cpu0TickSem, portMAX_DELAY) == pdTRUE)
-        {
-            cpu0_100ms_count++;
+    cpu0_switch_bench_receiver = xTaskCreateStatic(task_cpu0_switch_bench_receive, "CPU0 SW RX",
+                                                   CPU0_SWITCH_BENCH_STACK, NULL, CPU0_SWITCH_BENCH_PRIORITY + 1,
+                                                   cpu0_switch_bench_stack[0], &cpu0_switch_bench_tcb[0]);
+    (void)xTaskCreateStatic(task_cpu0_switch_bench_send, "CPU0 SW TX", CPU0_SWITCH_BENCH_STACK, NULL,
+                            CPU0_SWITCH_BENCH_PRIORITY, cpu0_switch_bench_stack[1], &cpu0_switch_bench_tcb[1]);
+}
+#endif
 
-            /* USER FUNCTIONS */
-            app_cpu0_led1();
+/* CPU0 1ms job */
+void job_cpu0_1ms(void)
+{
+    cpu0_1ms_count++;
 
-            /* Give semaphore back before finishing */
-            xSemaphoreGive(g_cpu0TickSem);
-        }
-        
-        /* Task period: 100ms */
-        vTaskDelay(pdMS_TO_TICKS(100));
-    }
+    /* USER FUNCTIONS */
+    canGatewayContainerTick();
 }
 
-/* CPU0 1000ms task - Button functionality */
-void task_cpu0_1000ms(void *arg)
+/* CPU0 10ms job - Button handling */
+void job_cpu0_10ms(void)
 {
-    while (1)
-    {
-        /* Wait for CPU0 tick semaphore */
-        if (xSemaphoreTake(g_cpu0TickSem, portMAX_DELAY) == pdTRUE)
-        {
-            cpu0_1000ms_count++;
+    cpu0_10ms_count++;
 
-            /* USER FUNCTIONS */
+    /* USER FUNCTIONS */
+    app_cpu0_button();
+}
 
-            /* Give semaphore back before finishing */
-            xSemaphoreGive(g_cpu0TickSem);
-        }
-        
-        /* Task period: 1000ms */
-        vTaskDelay(pdMS_TO_TICKS(1000));
-    }
+/* CPU0 100ms job */
+void job_cpu0_100ms(void)
+{
+    cpu0_100ms_count++;
+
+    /* USER FUNCTIONS */
+    app_cpu0_led1();
+}
+
+/* CPU0 1000ms placeholder job */
+void job_cpu0_1000ms(void)
+{
+    cpu0_1000ms_count++;
+
+    /* USER FUNCTIONS */
 }
 
 /* Required FreeRTOS callback for CPU0, called in case of a stack overflow */
@@ -228,6 +326,8 @@ void vApplicationStackOverflowHook_CPU0(TaskHandle_t xTask, char *pcTaskName)
 
 void app_cpu0_button(void)
 {
+    AppCpuMsg msg;
+
     BUTTON_PRESSED_FLAG = !(IfxPort_getPinState(BUTTON_0.port, BUTTON_0.pinIndex));
 
     if (BUTTON_PRESSED_FLAG == true)  // Button pressed
@@ -240,7 +340,7 @@ void app_cpu0_button(void)
         if (button_debounce_count >= BUTTON_DEBOUNCE_COUNT && !button_already_pressed)
         {
             // Only toggle ONCE per button press
-            LED_PROCESS_ACTIVE = !LED_PROCESS_ACTIVE;
+            led_process_active = !led_process_active;
             button_already_pressed = true;
         }
     }
@@ -249,10 +349,44 @@ void app_cpu0_button(void)
         button_debounce_count = 0;
         button_already_pressed = false;  // Allow next press
     }
+
+    /* Deliver a state change to CPU1 and CPU2, retried on the next poll while an inbox is full */
+    msg.id    = APP_MSG_LED_PROCESS;
+    msg.value = led_process_active;
+
+    if (led_process_sent_cpu1 != led_process_active && appCpuInboxPush(&g_cpu1Inbox, &msg))
+    {
+        led_process_sent_cpu1 = led_process_active;
+    }
+
+    if (led_process_sent_cpu2 != led_process_active && appCpuInboxPush(&g_cpu2Inbox, &msg))
+    {
+        led_process_sent_cpu2 = led_process_active;
+    }
 }
 
 
 
+/* Boot time stamp of the executing core: main entry, the hand over to its scheduler / idle loop or its first task */
+void app_core_boot_stamp(AppCoreBootStage stage)
+{
+    AppCoreBootType *boot = (AppCoreBootType *)IPC_NOT_CACHED(&g_appCoreBoot[IfxCpu_getCoreIndex()]);
+    uint32           now  = IfxStm_getLower(&MODULE_STM0);
+
+    if (stage == APP_BOOT_FIRST_TASK)
+    {
+        boot->firstTask = now;
+    }
+    else if (stage == APP_BOOT_SCHEDULER_START)
+    {
+        boot->schedulerStart = now;
+    }
+    else
+    {
+        boot->mainEntry = now;
+    }
+}
+
 /* Toggle LED1 - always active */
 void app_cpu0_led1(void)
 {
@@ -29,7 +29,11 @@
 /*-----------------------------------------------------Includes------------------------------------------------------*/
 /*********************************************************************************************************************/
 #include "Port/Io/IfxPort_Io.h"
+#include "Stm/Std/IfxStm.h"
 #include "App_Config.h"
+#include "MULTICAN_GW_TX_FIFO.h"
+#include "task.h"
+#include "queue.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -38,19 +42,173 @@
 /*********************************************************************************************************************/
 extern uint32_t cpu1_tick_counter;
 
-/* CPU1 LED2 ON control with local process management */
+/* LED2 process state as last received from CPU0 */
+static bool led_process_active = false;
+
+#if configPER_CORE_SCHEDULER != 0
+/* Local queue of the CPU1 inbox, and the bridge stopped on a full queue */
+static QueueHandle_t    cpu1_inbox_queue = NULL;
+static volatile boolean cpu1_inbox_stalled = FALSE;
+
+/* Stacks, TCBs and inbox queue of the CPU1 tasks, in the DSPR of CPU1 */
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu1"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu1" aw
+#endif
+static StackType_t   cpu1_1ms_stack[CPU12_1MS_TASK_STACK];
+static StackType_t   cpu1_inbox_stack[CPU12_INBOX_TASK_STACK];
+static StaticTask_t  cpu1_1ms_tcb;
+static StaticTask_t  cpu1_inbox_tcb;
+static StaticQueue_t cpu1_inbox_queue_buffer;
+static uint8         cpu1_inbox_queue_storage[APP_CPU_INBOX_DEPTH * sizeof(AppCpuMsg)];
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+#else
+/* STM1 ticks per 1ms tick */
+static uint32 cpu1_tick_ticks;
+#endif
+
+/* CPU1 inbox message: process on/off from CPU0 */
+static void app_cpu1_message(const AppCpuMsg *msg)
+{
+    if (msg->id == APP_MSG_LED_PROCESS)
+    {
+        led_process_active = (msg->value != 0);
+    }
+}
+
+#if configPER_CORE_SCHEDULER != 0
+/* CPU1 inbox handler, runs in the doorbell ISR: bridge the inbox ring into the local queue */
+static void app_cpu1_inbox(void)
+{
+    BaseType_t woken = pdFALSE;
+
+    cpu1_inbox_stalled = appCpuInboxBridgeFromISR(&g_cpu1Inbox, cpu1_inbox_queue, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/* CPU1 inbox task */
+static void task_cpu1_inbox(void *arg)
+{
+    AppCpuMsg msg;
+
+    while (1)
+    {
+        if (xQueueReceive(cpu1_inbox_queue, &msg, portMAX_DELAY) == pdTRUE)
+        {
+            app_cpu1_message(&msg);
+
+            /* The queue has room again, ring the own doorbell to move what the bridge left in the ring */
+            if (cpu1_inbox_stalled)
+            {
+                cpu1_inbox_stalled = FALSE;
+                ipcNotify(1);
+            }
+        }
+    }
+}
+
+/* CPU1 1ms task: LED2 ON control and the container time trigger of the gateway nodes owned by CPU1 */
+static void task_cpu1_1ms(void *arg)
+{
+    TickType_t lastWake = xTaskGetTickCount();
+
+    app_core_boot_stamp(APP_BOOT_FIRST_TASK);
+
+    while (1)
+    {
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(1));
+
+        cpu1_tick_counter++;
+        app_cpu1_led2on();
+        canGatewayContainerTick();
+    }
+}
+
+/* CPU1 tasks and inbox doorbell, the FreeRTOS tick of CPU1 runs on STM1 compare 0 */
+void app_cpu1_init(void)
+{
+    cpu1_inbox_queue = xQueueCreateStatic(APP_CPU_INBOX_DEPTH, sizeof(AppCpuMsg), cpu1_inbox_queue_storage,
+                                          &cpu1_inbox_queue_buffer);
+
+    (void)xTaskCreateStatic(task_cpu1_1ms, "CPU1 1MS", CPU12_1MS_TASK_STACK, NULL, CPU12_1MS_TASK_PRIORITY,
+                            cpu1_1ms_stack, &cpu1_1ms_tcb);
+    (void)xTaskCreateStatic(task_cpu1_inbox, "CPU1 INBOX", CPU12_INBOX_TASK_STACK, NULL, CPU12_INBOX_TASK_PRIORITY,
+                            cpu1_inbox_stack, &cpu1_inbox_tcb);
+
+    ipcNotifyInit(app_cpu1_inbox);
+    ipcRingAttach(&g_cpu1Inbox.ctrl);
+}
+#else
+/* CPU1 inbox handler, runs in the doorbell ISR */
+static void app_cpu1_inbox(void)
+{
+    AppCpuMsg msg;
+
+    while (appCpuInboxPop(&g_cpu1Inbox, &msg))
+    {
+        app_cpu1_message(&msg);
+    }
+}
+
+/* CPU1 1ms tick (STM1 compare 0) and inbox doorbell */
+void app_cpu1_init(void)
+{
+    IfxStm_CompareConfig compareConfig;
+
+    cpu1_tick_ticks = (uint32)IfxStm_getTicksFromMilliseconds(&MODULE_STM1, 1);
+
+    IfxStm_initCompareConfig(&compareConfig);
+    compareConfig.comparator          = IfxStm_Comparator_0;
+    compareConfig.comparatorInterrupt = IfxStm_ComparatorInterrupt_ir0;
+    compareConfig.compareOffset       = IfxStm_ComparatorOffset_0;
+    compareConfig.compareSize         = IfxStm_ComparatorSize_32Bits;
+    compareConfig.ticks               = cpu1_tick_ticks;
+    compareConfig.triggerPriority     = ISR_PRIORITY_APP_TICK;
+    compareConfig.typeOfService       = IfxSrc_Tos_cpu1;
+    IfxStm_initCompare(&MODULE_STM1, &compareConfig);
+
+    ipcNotifyInit(app_cpu1_inbox);
+    ipcRingAttach(&g_cpu1Inbox.ctrl);
+}
+#endif
+
+/* CPU1 LED2 ON control with local process management, runs every 1ms (tick ISR or 1ms task) */
 void app_cpu1_led2on(void)
 {
+    AppCpuMsg msg;
+
     /* CPU1 LED2 ON control - Turn ON every full second (when counter hits multiples of LED2_BLINK_PERIOD*2) */
-    if (LED_PROCESS_ACTIVE && (cpu1_tick_counter % (LED2_BLINK_PERIOD_US * 2)) == 0)
+    if (led_process_active && (cpu1_tick_counter % (LED2_BLINK_PERIOD_MS * 2)) == 0)
     {
         /* CPU1 turns LED2 ON for 500ms */
         IfxPort_setPinState(LED_2.port, LED_2.pinIndex, IfxPort_State_low);
         cpu1_loop_count++;
         
-        /* Signal CPU2 to prepare for OFF cycle */
-        CPU1_DATA_READY = true;
-        CPU2_DATA_READY = false;
+        /* Signal CPU2 to prepare for OFF cycle, wakes CPU2 through its inbox doorbell */
+        msg.id    = APP_MSG_LED2_ON;
+        msg.value = cpu1_loop_count;
+        (void)appCpuInboxPush(&g_cpu2Inbox, &msg);
         led_process_count++;
     }
 }
+
+#if configPER_CORE_SCHEDULER == 0
+/* CPU1 1ms tick ISR: LED2 ON control and the container time trigger of the gateway nodes owned by CPU1 */
+IFX_INTERRUPT(app_cpu1_tick_isr, 1, ISR_PRIORITY_APP_TICK)
+{
+    IfxStm_clearCompareFlag(&MODULE_STM1, IfxStm_Comparator_0);
+    IfxStm_increaseCompare(&MODULE_STM1, IfxStm_Comparator_0, cpu1_tick_ticks);
+
+    cpu1_tick_counter++;
+    APP_TRACE_TICK_EVENT(cpu1_tick_counter);
+    app_cpu1_led2on();
+    canGatewayContainerTick();
+}
+#endif
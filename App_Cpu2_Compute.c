@@ -29,7 +29,11 @@
 /*-----------------------------------------------------Includes------------------------------------------------------*/
 /*********************************************************************************************************************/
 #include "Port/Io/IfxPort_Io.h"
+#include "Stm/Std/IfxStm.h"
 #include "App_Config.h"
+#include "MULTICAN_GW_TX_FIFO.h"
+#include "task.h"
+#include "queue.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -38,19 +42,176 @@
 /*********************************************************************************************************************/
 extern uint32_t cpu2_tick_counter;
 
-/* CPU2 LED2 OFF control with timing coordination */
+/* LED2 process state as last received from CPU0, and a LED2 ON from CPU1 still to be switched off */
+static bool led_process_active = false;
+static bool led2_on_pending = false;
+
+#if configPER_CORE_SCHEDULER != 0
+/* Local queue of the CPU2 inbox, and the bridge stopped on a full queue */
+static QueueHandle_t    cpu2_inbox_queue = NULL;
+static volatile boolean cpu2_inbox_stalled = FALSE;
+
+/* Stacks, TCBs and inbox queue of the CPU2 tasks, in the DSPR of CPU2 */
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu2"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu2" aw
+#endif
+static StackType_t   cpu2_1ms_stack[CPU12_1MS_TASK_STACK];
+static StackType_t   cpu2_inbox_stack[CPU12_INBOX_TASK_STACK];
+static StaticTask_t  cpu2_1ms_tcb;
+static StaticTask_t  cpu2_inbox_tcb;
+static StaticQueue_t cpu2_inbox_queue_buffer;
+static uint8         cpu2_inbox_queue_storage[APP_CPU_INBOX_DEPTH * sizeof(AppCpuMsg)];
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+#else
+/* STM2 ticks per 1ms tick */
+static uint32 cpu2_tick_ticks;
+#endif
+
+/* CPU2 inbox message: process on/off from CPU0 and LED2 ON from CPU1 */
+static void app_cpu2_message(const AppCpuMsg *msg)
+{
+    if (msg->id == APP_MSG_LED_PROCESS)
+    {
+        led_process_active = (msg->value != 0);
+    }
+    else if (msg->id == APP_MSG_LED2_ON)
+    {
+        led2_on_pending = true;
+    }
+}
+
+#if configPER_CORE_SCHEDULER != 0
+/* CPU2 inbox handler, runs in the doorbell ISR: bridge the inbox ring into the local queue */
+static void app_cpu2_inbox(void)
+{
+    BaseType_t woken = pdFALSE;
+
+    cpu2_inbox_stalled = appCpuInboxBridgeFromISR(&g_cpu2Inbox, cpu2_inbox_queue, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/* CPU2 inbox task, lower priority than the 1ms task so it never interrupts app_cpu2_led2off() */
+static void task_cpu2_inbox(void *arg)
+{
+    AppCpuMsg msg;
+
+    while (1)
+    {
+        if (xQueueReceive(cpu2_inbox_queue, &msg, portMAX_DELAY) == pdTRUE)
+        {
+            app_cpu2_message(&msg);
+
+            /* The queue has room again, ring the own doorbell to move what the bridge left in the ring */
+            if (cpu2_inbox_stalled)
+            {
+                cpu2_inbox_stalled = FALSE;
+                ipcNotify(2);
+            }
+        }
+    }
+}
+
+/* CPU2 1ms task: LED2 OFF control and the container time trigger of the gateway nodes owned by CPU2 */
+static void task_cpu2_1ms(void *arg)
+{
+    TickType_t lastWake = xTaskGetTickCount();
+
+    app_core_boot_stamp(APP_BOOT_FIRST_TASK);
+
+    while (1)
+    {
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(1));
+
+        cpu2_tick_counter++;
+        app_cpu2_led2off();
+        canGatewayContainerTick();
+    }
+}
+
+/* CPU2 tasks and inbox doorbell, the FreeRTOS tick of CPU2 runs on STM2 compare 0 */
+void app_cpu2_init(void)
+{
+    cpu2_inbox_queue = xQueueCreateStatic(APP_CPU_INBOX_DEPTH, sizeof(AppCpuMsg), cpu2_inbox_queue_storage,
+                                          &cpu2_inbox_queue_buffer);
+
+    (void)xTaskCreateStatic(task_cpu2_1ms, "CPU2 1MS", CPU12_1MS_TASK_STACK, NULL, CPU12_1MS_TASK_PRIORITY,
+                            cpu2_1ms_stack, &cpu2_1ms_tcb);
+    (void)xTaskCreateStatic(task_cpu2_inbox, "CPU2 INBOX", CPU12_INBOX_TASK_STACK, NULL, CPU12_INBOX_TASK_PRIORITY,
+                            cpu2_inbox_stack, &cpu2_inbox_tcb);
+
+    ipcNotifyInit(app_cpu2_inbox);
+    ipcRingAttach(&g_cpu2Inbox.ctrl);
+}
+#else
+/* CPU2 inbox handler, runs in the doorbell ISR */
+static void app_cpu2_inbox(void)
+{
+    AppCpuMsg msg;
+
+    while (appCpuInboxPop(&g_cpu2Inbox, &msg))
+    {
+        app_cpu2_message(&msg);
+    }
+}
+
+/* CPU2 1ms tick (STM2 compare 0) and inbox doorbell */
+void app_cpu2_init(void)
+{
+    IfxStm_CompareConfig compareConfig;
+
+    cpu2_tick_ticks = (uint32)IfxStm_getTicksFromMilliseconds(&MODULE_STM2, 1);
+
+    IfxStm_initCompareConfig(&compareConfig);
+    compareConfig.comparator          = IfxStm_Comparator_0;
+    compareConfig.comparatorInterrupt = IfxStm_ComparatorInterrupt_ir0;
+    compareConfig.compareOffset       = IfxStm_ComparatorOffset_0;
+    compareConfig.compareSize         = IfxStm_ComparatorSize_32Bits;
+    compareConfig.ticks               = cpu2_tick_ticks;
+    compareConfig.triggerPriority     = ISR_PRIORITY_APP_TICK;
+    compareConfig.typeOfService       = IfxSrc_Tos_cpu2;
+    IfxStm_initCompare(&MODULE_STM2, &compareConfig);
+
+    ipcNotifyInit(app_cpu2_inbox);
+    ipcRingAttach(&g_cpu2Inbox.ctrl);
+}
+#endif
+
+/* CPU2 LED2 OFF control with timing coordination, runs every 1ms (tick ISR or 1ms task), never preempted by the
+ * inbox handler
+ */
 void app_cpu2_led2off(void)
 {
     /* CPU2 LED2 OFF control - Turn OFF after 500ms delay from CPU1 ON signal */
-    if (LED_PROCESS_ACTIVE && CPU1_DATA_READY && (cpu2_tick_counter % LED2_BLINK_PERIOD_US) == 0)
+    if (led_process_active && led2_on_pending && (cpu2_tick_counter % LED2_BLINK_PERIOD_MS) == 0)
     {
         /* CPU2 turns LED2 OFF after 500ms delay */
         IfxPort_setPinState(LED_2.port, LED_2.pinIndex, IfxPort_State_high);
         cpu2_loop_count++;
         
-        /* Signal cycle complete */
-        CPU2_DATA_READY = true;
-        CPU1_DATA_READY = false;
+        /* Cycle complete */
+        led2_on_pending = false;
         led_process_count++;
     }
 }
+
+#if configPER_CORE_SCHEDULER == 0
+/* CPU2 1ms tick ISR: LED2 OFF control and the container time trigger of the gateway nodes owned by CPU2 */
+IFX_INTERRUPT(app_cpu2_tick_isr, 2, ISR_PRIORITY_APP_TICK)
+{
+    IfxStm_clearCompareFlag(&MODULE_STM2, IfxStm_Comparator_0);
+    IfxStm_increaseCompare(&MODULE_STM2, IfxStm_Comparator_0, cpu2_tick_ticks);
+
+    cpu2_tick_counter++;
+    APP_TRACE_TICK_EVENT(cpu2_tick_counter);
+    app_cpu2_led2off();
+    canGatewayContainerTick();
+}
+#endif
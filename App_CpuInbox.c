@@ -0,0 +1,59 @@
+/**********************************************************************************************************************
+ * \file App_CpuInbox.c
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "App_Config.h"
+#include "queue.h"
+
+#if configPER_CORE_SCHEDULER != 0
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Inbox to local queue bridge of CPU1/CPU2, runs in the doorbell ISR of the receiving core. Moves messages while the
+ * queue has room, the rest stays in the ring (producers see it full). Returns TRUE when it stopped on a full queue.
+ */
+boolean appCpuInboxBridgeFromISR(appCpuInboxRing *inbox, QueueHandle_t queue, BaseType_t *woken)
+{
+    AppCpuMsg msg;
+
+    while (xQueueIsQueueFullFromISR(queue) == pdFALSE)
+    {
+        if (!appCpuInboxPop(inbox, &msg))
+        {
+            return FALSE;
+        }
+
+        (void)xQueueSendFromISR(queue, &msg, woken);
+    }
+
+    return TRUE;
+}
+
+#endif /* configPER_CORE_SCHEDULER */
@@ -0,0 +1,114 @@
+/**********************************************************************************************************************
+ * \file App_Heap.c
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "App_Heap.h"
+#include "App_IpcRing.h"
+#include "FreeRTOS.h"
+
+#if configHEAP_PER_CORE_REGIONS != 0
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu0"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu0" aw
+#endif
+IFX_ALIGN(8) static uint8 g_appHeapCpu0[APP_HEAP_CPU0_SIZE];
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu1"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu1" aw
+#endif
+IFX_ALIGN(8) static uint8 g_appHeapCpu1[APP_HEAP_CPU1_SIZE];
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu2"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu2" aw
+#endif
+IFX_ALIGN(8) static uint8 g_appHeapCpu2[APP_HEAP_CPU2_SIZE];
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+#if defined(__TASKING__)
+#pragma section farbss "lmubss_nc"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".lmubss_nc" aw
+#endif
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) static uint8 g_appHeapLmu[APP_HEAP_LMU_SIZE];
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Hands the regions to heap_5, once on CPU0 before the first allocation of any core */
+void app_heap_init(void)
+{
+    /* One region per group, heap_5 only needs ascending addresses within a group */
+    const HeapRegion_t regions[] = {
+        {g_appHeapCpu2,                            APP_HEAP_CPU2_SIZE},
+        {g_appHeapCpu1,                            APP_HEAP_CPU1_SIZE},
+        {g_appHeapCpu0,                            APP_HEAP_CPU0_SIZE},
+        {(uint8 *)IPC_NOT_CACHED(g_appHeapLmu),    APP_HEAP_LMU_SIZE},
+        {NULL,                                     0}
+    };
+
+    vPortDefineHeapRegions(regions);
+}
+
+#endif /* configHEAP_PER_CORE_REGIONS */
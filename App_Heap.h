@@ -0,0 +1,62 @@
+/**********************************************************************************************************************
+ * \file App_Heap.h
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef APP_HEAP_H_
+#define APP_HEAP_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Heap regions of heap_5 with configHEAP_PER_CORE_REGIONS.
+ *
+ * One region in the DSPR of every core and one in the LMU. pvPortMalloc() serves a task from the DSPR of the core it
+ * runs on (single cycle, no bus traffic) and falls back to the LMU when that is exhausted. Memory mainly used by
+ * another core, e.g. a buffer filled by CPU0 and processed on CPU1, is taken with pvPortMallocGroup(1, size), memory
+ * used by several cores with pvPortMallocGroup(APP_HEAP_SHARED, size). The LMU region is registered at its not
+ * cached alias, like the IPC rings.
+ *
+ * The DSPR regions are given at their global addresses (0x70000000/0x60000000/0x50000000), so a block stays valid
+ * when its pointer is passed to another core. Only the DSPR of CPU2 (96K) is tight, see configTOTAL_HEAP_SIZE.
+ */
+#define APP_HEAP_CPU0_SIZE          (32U * 1024U)
+#define APP_HEAP_CPU1_SIZE          (32U * 1024U)
+#define APP_HEAP_CPU2_SIZE          (16U * 1024U)
+#define APP_HEAP_LMU_SIZE           (32U * 1024U)
+
+/* Group of the LMU region, the group of a DSPR region is its core id */
+#define APP_HEAP_SHARED             3
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+void app_heap_init(void);
+
+#endif /* APP_HEAP_H_ */
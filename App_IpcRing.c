@@ -0,0 +1,324 @@
+/**********************************************************************************************************************
+ * \file App_IpcRing.c
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "App_IpcRing.h"
+#include "IfxCpu.h"
+#include "Stm/Std/IfxStm.h"
+#include "App_Trace.h"
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Wake-up statistics, written by the producer cores (postTime) and the woken core, in the not cached LMU segment */
+#if defined(__TASKING__)
+#pragma section farbss "lmubss_nc"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".lmubss_nc" aw
+#endif
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) IpcNotifyStatsType g_ipcNotifyStats[IPC_NUM_CORES];
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static const IfxSrc_Tos g_ipcCoreTos[IPC_NUM_CORES] = {IfxSrc_Tos_cpu0, IfxSrc_Tos_cpu1, IfxSrc_Tos_cpu2};
+
+/* Doorbell handler of each core, registered by ipcNotifyInit() */
+static IpcNotifyHandler g_ipcNotifyHandler[IPC_NUM_CORES];
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Wake the consumer core of a ring after a commit, if it attached to the ring */
+static void ipcRingNotify(IpcRingCtrl *ctrl)
+{
+    uint32 notifyCore;
+
+    /* the commit must be visible before notifyCore is read, see ipcRingAttach() */
+    IPC_BARRIER();
+    notifyCore = ctrl->notifyCore;
+
+    if (notifyCore != 0)
+    {
+        ipcNotify(notifyCore - 1);
+    }
+}
+
+/* SPSC producer: slot for the next element, NULL_PTR (and the overflow status set) if the ring is full.
+ * The slot belongs to the producer until ipcSpscCommit().
+ */
+void *ipcSpscReserve(IpcRingCtrl *ctrl, void *slots, uint32 depth, uint32 slotSize)
+{
+    uint32 head = ctrl->head;
+
+    if ((head - ctrl->tail) >= depth)
+    {
+        ipcSwapMask(&ctrl->status, IPC_RING_STATUS_OVERFLOW, IPC_RING_STATUS_OVERFLOW);
+        return NULL_PTR;
+    }
+
+    return (uint8 *)slots + ((head & (depth - 1)) * slotSize);
+}
+
+/* SPSC producer: publish the slot returned by ipcSpscReserve() */
+void ipcSpscCommit(IpcRingCtrl *ctrl)
+{
+    /* the slot must be complete before the new head makes it visible to the consumer */
+    IPC_BARRIER();
+    ctrl->head = ctrl->head + 1;
+
+    ipcRingNotify(ctrl);
+}
+
+/* SPSC consumer: oldest element, NULL_PTR if the ring is empty. The slot stays valid until ipcSpscRelease(). */
+void *ipcSpscPeek(IpcRingCtrl *ctrl, void *slots, uint32 depth, uint32 slotSize)
+{
+    uint32 tail = ctrl->tail;
+
+    if (ctrl->head == tail)
+    {
+        return NULL_PTR;
+    }
+
+    /* read the slot only after the head which published it */
+    IPC_BARRIER();
+
+    return (uint8 *)slots + ((tail & (depth - 1)) * slotSize);
+}
+
+/* SPSC consumer: hand the slot returned by ipcSpscPeek() back to the producer */
+void ipcSpscRelease(IpcRingCtrl *ctrl)
+{
+    /* all reads of the slot must be done before the producer may overwrite it */
+    IPC_BARRIER();
+    ctrl->tail = ctrl->tail + 1;
+}
+
+/* MPSC producer: claim the next position with CMPSWAP on head. A slot is free for the position pos when its turn is
+ * the lap of pos (pos & ~(depth - 1)), published when it is lap + 1 and returned by the consumer as lap + depth,
+ * the lap of its next use. Returns the slot (position in *pos) or NULL_PTR (and the overflow status set) if the
+ * ring is full.
+ */
+void *ipcMpscReserve(IpcRingCtrl *ctrl, void *slots, uint32 depth, uint32 slotSize, uint32 *pos)
+{
+    uint32  head = ctrl->head;
+    uint8  *slot;
+    sint32  diff;
+
+    for (;;)
+    {
+        slot = (uint8 *)slots + ((head & (depth - 1)) * slotSize);
+        diff = (sint32)(*(volatile uint32 *)slot - (head & ~(depth - 1)));
+
+        if (diff == 0)
+        {
+            uint32 seen = __cmpAndSwap((unsigned int volatile *)&ctrl->head, head + 1, head);
+
+            if (seen == head)
+            {
+                *pos = head;
+                return slot;
+            }
+
+            head = seen;                             /* another producer took the position */
+        }
+        else if (diff < 0)
+        {
+            /* the consumer still holds the slot from the previous lap */
+            ipcSwapMask(&ctrl->status, IPC_RING_STATUS_OVERFLOW, IPC_RING_STATUS_OVERFLOW);
+            return NULL_PTR;
+        }
+        else
+        {
+            head = ctrl->head;                       /* slot already published for head, head is stale */
+        }
+    }
+}
+
+/* MPSC producer: publish the slot of position pos */
+void ipcMpscCommit(IpcRingCtrl *ctrl, volatile uint32 *turn, uint32 pos, uint32 depth)
+{
+    /* the message must be complete before the turn hands it to the consumer */
+    IPC_BARRIER();
+    *turn = (pos & ~(depth - 1)) + 1;
+
+    ipcRingNotify(ctrl);
+}
+
+/* MPSC consumer: oldest element (the slot starts with its turn word), NULL_PTR if the ring is empty or the next
+ * position is claimed but not yet published.
+ */
+void *ipcMpscPeek(IpcRingCtrl *ctrl, void *slots, uint32 depth, uint32 slotSize)
+{
+    uint32  tail = ctrl->tail;
+    uint8  *slot = (uint8 *)slots + ((tail & (depth - 1)) * slotSize);
+
+    if (*(volatile uint32 *)slot != ((tail & ~(depth - 1)) + 1))
+    {
+        return NULL_PTR;
+    }
+
+    /* read the message only after the turn which published it */
+    IPC_BARRIER();
+
+    return slot;
+}
+
+/* MPSC consumer: hand the slot returned by ipcMpscPeek() back to the producers, for the next lap */
+void ipcMpscRelease(IpcRingCtrl *ctrl, volatile uint32 *turn, uint32 depth)
+{
+    uint32 tail = ctrl->tail;
+
+    /* all reads of the message must be done before a producer may claim the slot again */
+    IPC_BARRIER();
+    *turn      = (tail & ~(depth - 1)) + depth;
+    ctrl->tail = tail + 1;
+}
+
+/* Read and clear the IPC_RING_STATUS_* bits of a ring in one atomic access */
+uint32 ipcRingTakeStatus(IpcRingCtrl *ctrl)
+{
+    IpcRingCtrl *nc = (IpcRingCtrl *)IPC_NOT_CACHED(ctrl);
+
+    return ipcSwapMask(&nc->status, 0, 0xFFFFFFFFU);
+}
+
+/* Consumer: wake the calling core on every commit to the ring. Called after ipcNotifyInit(); the doorbell is rung
+ * once here, as a producer which committed before it saw notifyCore did not ring it.
+ */
+void ipcRingAttach(IpcRingCtrl *ctrl)
+{
+    IpcRingCtrl *nc   = (IpcRingCtrl *)IPC_NOT_CACHED(ctrl);
+    uint32       core = (uint32)IfxCpu_getCoreIndex();
+
+    nc->notifyCore = core + 1;
+
+    /* notifyCore must be visible before the ring is read again by the doorbell handler */
+    IPC_BARRIER();
+    ipcNotify(core);
+}
+
+/* Route the doorbell of the calling core to it, handler runs in its doorbell ISR */
+void ipcNotifyInit(IpcNotifyHandler handler)
+{
+    uint32                 core = (uint32)IfxCpu_getCoreIndex();
+    volatile Ifx_SRC_SRCR *src  = IPC_NOTIFY_SRC(core);
+
+    g_ipcNotifyHandler[core] = handler;
+
+    IfxSrc_init(src, g_ipcCoreTos[core], ISR_PRIORITY_IPC_NOTIFY);
+    IfxSrc_enable(src);
+}
+
+/* Wake exactly one core: set the service request of its doorbell */
+void ipcNotify(uint32 core)
+{
+    IpcNotifyStatsType *stats = (IpcNotifyStatsType *)IPC_NOT_CACHED(&g_ipcNotifyStats[core]);
+
+    stats->postTime = IfxStm_getLower(&MODULE_STM0);
+    IfxSrc_setRequest(IPC_NOTIFY_SRC(core));
+}
+
+/* Sleep in WAIT until the next interrupt of the calling core (doorbell, timer or peripheral), the interrupt is
+ * served before WAIT returns. The time spent here is the idle time of the core.
+ */
+void ipcNotifyIdle(void)
+{
+    IpcNotifyStatsType *stats = (IpcNotifyStatsType *)IPC_NOT_CACHED(&g_ipcNotifyStats[IfxCpu_getCoreIndex()]);
+    boolean             enabled;
+
+    stats->idleStart  = IfxStm_getLower(&MODULE_STM0);
+    stats->idleActive = TRUE;
+
+#if defined(__TASKING__)
+    __asm("wait");
+#elif defined(__HIGHTEC__) || defined(__tricore__) || defined(__TRICORE__)
+    __asm__ __volatile__ ("wait" : : : "memory");
+#else
+    /* no WAIT (host tests): the stand-in of IfxCpu.h returns once an interrupt of the core was served */
+    hostCpuWait();
+#endif
+
+    /* Not accounted yet unless a task ran in between (ipcNotifyIdleEnd() from the switch) */
+    enabled = IfxCpu_disableInterrupts();
+    ipcNotifyIdleEnd();
+    IfxCpu_restoreInterrupts(enabled);
+}
+
+/* End of the idle time of the calling core: from ipcNotifyIdle() once WAIT returned, or from the context switch when
+ * the interrupt that woke the core readied a task (traceTASK_SWITCHED_OUT with configPER_CORE_SCHEDULER). That task
+ * runs before WAIT returns, its time is not idle time. Runs with interrupts disabled.
+ */
+void ipcNotifyIdleEnd(void)
+{
+    IpcNotifyStatsType *stats = (IpcNotifyStatsType *)IPC_NOT_CACHED(&g_ipcNotifyStats[IfxCpu_getCoreIndex()]);
+
+    if (stats->idleActive)
+    {
+        stats->idleActive = FALSE;
+        stats->idleCount++;
+        stats->idleTicks += IfxStm_getLower(&MODULE_STM0) - stats->idleStart;
+    }
+}
+
+/* Doorbell ISR of a core: wake-up statistics, then the registered handler */
+static void ipcNotifyIsr(uint32 core)
+{
+    IpcNotifyStatsType *stats   = (IpcNotifyStatsType *)IPC_NOT_CACHED(&g_ipcNotifyStats[core]);
+    uint32              latency = IfxStm_getLower(&MODULE_STM0) - stats->postTime;
+
+    APP_TRACE_ISR_ENTER_EVENT();
+
+    stats->wakeups++;
+    stats->wakeLatency = latency;
+
+    if (latency > stats->wakeLatencyMax)
+    {
+        stats->wakeLatencyMax = latency;
+    }
+
+    if (g_ipcNotifyHandler[core] != NULL_PTR)
+    {
+        g_ipcNotifyHandler[core]();
+    }
+
+    APP_TRACE_ISR_EXIT_EVENT();
+}
+
+/* Interrupt Service Routines (ISR) of the doorbells, one per core */
+IFX_INTERRUPT(ipcNotifyIsrCpu0, 0, ISR_PRIORITY_IPC_NOTIFY) { ipcNotifyIsr(0); }
+IFX_INTERRUPT(ipcNotifyIsrCpu1, 1, ISR_PRIORITY_IPC_NOTIFY) { ipcNotifyIsr(1); }
+IFX_INTERRUPT(ipcNotifyIsrCpu2, 2, ISR_PRIORITY_IPC_NOTIFY) { ipcNotifyIsr(2); }
@@ -0,0 +1,259 @@
+/**********************************************************************************************************************
+ * \file App_IpcRing.h
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef APP_IPCRING_H_
+#define APP_IPCRING_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu_Intrinsics.h"
+#include "Src/Std/IfxSrc.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Lock-free rings for messages between the cores.
+ *
+ * A ring is a control block (head, tail and status, each on its own cache line) followed by a power of two number
+ * of slots. head and tail run freely and wrap modulo 2^32; the slot of a position is (position & (depth - 1)).
+ * - SPSC (single producer, single consumer): the producer owns head, the consumer owns tail. A slot is published by
+ *   a DSYNC followed by the head write, and returned by a DSYNC followed by the tail write.
+ * - MPSC (multiple producers, single consumer): the producers claim a position with CMPSWAP on head, every slot
+ *   carries a turn word telling whether it is free for the current lap, published, or still held by the consumer.
+ * A zero filled ring is an empty ring of either kind, rings in .bss need no init call.
+ *
+ * A consumer core which sleeps instead of polling attaches to its rings with ipcRingAttach(): every commit then
+ * wakes exactly that core through its doorbell (general purpose service request GPSR1<core>), whose ISR runs the
+ * handler registered with ipcNotifyInit(). Rings nobody attached to (e.g. the CAN gateway rings, which ring the
+ * CAN node interrupts themselves) only pay one DSYNC for this.
+ *
+ * The rings are shared by cores without data cache coherency: define them 32 byte aligned in the not cached LMU
+ * segment (TASKING: #pragma section farbss "lmubss_nc", HighTec: #pragma section ".lmubss_nc" aw). Both linker
+ * files link that section at the not cached alias 0xB0000000, so the startup clear never leaves dirty lines in the
+ * data cache of CPU0 which a later eviction would write over the rings. Every access goes through IPC_NOT_CACHED().
+ */
+#define IPC_CACHE_LINE_SIZE         32                          /* TC3xx data cache line in bytes                    */
+#define IPC_RING_STATUS_OVERFLOW    0x00000001U                 /* A producer found the ring full (sticky)           */
+
+/* Not cached alias of an LMU address (0x9xxxxxxx -> 0xBxxxxxxx, 0xBxxxxxxx stays). The host tests define it as the
+ * address itself.
+ */
+#ifndef IPC_NOT_CACHED
+#define IPC_NOT_CACHED(address)     ((void *)((uint32)(address) | 0x20000000U))
+#endif
+
+#define IPC_NUM_CORES               3                           /* CPU0, CPU1, CPU2                                  */
+#define ISR_PRIORITY_IPC_NOTIFY     4                           /* Doorbell ISR of every core (plain literal)        */
+
+/* Doorbell of a core: GPSR group 1, service request <core>. Group 0 carries the FreeRTOS context switch requests. */
+#define IPC_NOTIFY_SRC(core)        (&MODULE_SRC.GPSR.GPSR[1].SR[(core)])
+
+/* Orders the slot accesses against the head/tail/turn write which hands the slot to the other side */
+#define IPC_BARRIER()               __dsync()
+
+/* Typed SPSC ring of depth elements of type: defines the type name##Ring and the inline functions
+ *   type *name##Reserve(ring), name##Commit(ring)        producer, zero copy (NULL_PTR: ring full)
+ *   const type *name##Peek(ring), name##Release(ring)    consumer, zero copy (NULL_PTR: ring empty)
+ *   boolean name##Push(ring, const type *), name##Pop(ring, type *)   copying variants
+ */
+#define IPC_SPSC_RING_DEFINE(name, type, depth)                                                                       \
+    typedef struct                                                                                                    \
+    {                                                                                                                 \
+        IpcRingCtrl ctrl;                                                                                             \
+        type        slot[(depth)];                                                                                    \
+    } name##Ring;                                                                                                     \
+    typedef char name##RingDepthCheck[(((depth) & ((depth) - 1)) == 0) ? 1 : -1];                                    \
+    IFX_INLINE type *name##Reserve(name##Ring *ring)                                                                  \
+    {                                                                                                                 \
+        name##Ring *nc = (name##Ring *)IPC_NOT_CACHED(ring);                                                          \
+        return (type *)ipcSpscReserve(&nc->ctrl, nc->slot, (depth), sizeof(type));                                    \
+    }                                                                                                                 \
+    IFX_INLINE void name##Commit(name##Ring *ring)                                                                    \
+    {                                                                                                                 \
+        ipcSpscCommit(&((name##Ring *)IPC_NOT_CACHED(ring))->ctrl);                                                   \
+    }                                                                                                                 \
+    IFX_INLINE const type *name##Peek(name##Ring *ring)                                                               \
+    {                                                                                                                 \
+        name##Ring *nc = (name##Ring *)IPC_NOT_CACHED(ring);                                                          \
+        return (const type *)ipcSpscPeek(&nc->ctrl, nc->slot, (depth), sizeof(type));                                 \
+    }                                                                                                                 \
+    IFX_INLINE void name##Release(name##Ring *ring)                                                                   \
+    {                                                                                                                 \
+        ipcSpscRelease(&((name##Ring *)IPC_NOT_CACHED(ring))->ctrl);                                                  \
+    }                                                                                                                 \
+    IFX_INLINE boolean name##Push(name##Ring *ring, const type *msg)                                                  \
+    {                                                                                                                 \
+        type *slot = name##Reserve(ring);                                                                             \
+        if (slot == NULL_PTR)                                                                                         \
+        {                                                                                                             \
+            return FALSE;                                                                                             \
+        }                                                                                                             \
+        *slot = *msg;                                                                                                 \
+        name##Commit(ring);                                                                                           \
+        return TRUE;                                                                                                  \
+    }                                                                                                                 \
+    IFX_INLINE boolean name##Pop(name##Ring *ring, type *msg)                                                         \
+    {                                                                                                                 \
+        const type *slot = name##Peek(ring);                                                                          \
+        if (slot == NULL_PTR)                                                                                         \
+        {                                                                                                             \
+            return FALSE;                                                                                             \
+        }                                                                                                             \
+        *msg = *slot;                                                                                                 \
+        name##Release(ring);                                                                                          \
+        return TRUE;                                                                                                  \
+    }
+
+/* Typed MPSC ring of depth elements of type: defines the types name##Slot, name##Ring and the inline functions
+ *   boolean name##Push(ring, const type *)     any core, FALSE: ring full
+ *   boolean name##Pop(ring, type *)            consumer core only, FALSE: ring empty
+ */
+#define IPC_MPSC_RING_DEFINE(name, type, depth)                                                                       \
+    typedef struct                                                                                                    \
+    {                                                                                                                 \
+        volatile uint32 turn;                                                                                         \
+        type            msg;                                                                                          \
+    } name##Slot;                                                                                                     \
+    typedef struct                                                                                                    \
+    {                                                                                                                 \
+        IpcRingCtrl ctrl;                                                                                             \
+        name##Slot  slot[(depth)];                                                                                    \
+    } name##Ring;                                                                                                     \
+    typedef char name##RingDepthCheck[(((depth) & ((depth) - 1)) == 0) ? 1 : -1];                                    \
+    IFX_INLINE boolean name##Push(name##Ring *ring, const type *msg)                                                  \
+    {                                                                                                                 \
+        name##Ring *nc = (name##Ring *)IPC_NOT_CACHED(ring);                                                          \
+        uint32      pos;                                                                                              \
+        name##Slot *slot = (name##Slot *)ipcMpscReserve(&nc->ctrl, nc->slot, (depth), sizeof(name##Slot), &pos);      \
+        if (slot == NULL_PTR)                                                                                         \
+        {                                                                                                             \
+            return FALSE;                                                                                             \
+        }                                                                                                             \
+        slot->msg = *msg;                                                                                             \
+        ipcMpscCommit(&nc->ctrl, &slot->turn, pos, (depth));                                                          \
+        return TRUE;                                                                                                  \
+    }                                                                                                                 \
+    IFX_INLINE boolean name##Pop(name##Ring *ring, type *msg)                                                         \
+    {                                                                                                                 \
+        name##Ring *nc = (name##Ring *)IPC_NOT_CACHED(ring);                                                          \
+        name##Slot *slot = (name##Slot *)ipcMpscPeek(&nc->ctrl, nc->slot, (depth), sizeof(name##Slot));              \
+        if (slot == NULL_PTR)                                                                                         \
+        {                                                                                                             \
+            return FALSE;                                                                                             \
+        }                                                                                                             \
+        *msg = slot->msg;                                                                                             \
+        ipcMpscRelease(&nc->ctrl, &slot->turn, (depth));                                                              \
+        return TRUE;                                                                                                  \
+    }
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Ring control block, head and tail are written by different cores and each sit on a cache line of their own */
+typedef struct
+{
+    volatile uint32                 head;            /* Next position to write (producers)                           */
+    uint32                          headPad[(IPC_CACHE_LINE_SIZE / 4) - 1];
+    volatile uint32                 tail;            /* Next position to read (consumer)                             */
+    uint32                          tailPad[(IPC_CACHE_LINE_SIZE / 4) - 1];
+    volatile uint32                 status;          /* IPC_RING_STATUS_* bits, set by SWAPMSK                       */
+    volatile uint32                 notifyCore;      /* Consumer core + 1 woken on every commit, 0: consumer polls   */
+    uint32                          statusPad[(IPC_CACHE_LINE_SIZE / 4) - 2];
+} IpcRingCtrl;
+
+/* Doorbell handler of a core, runs in its doorbell ISR and drains the rings the core attached to */
+typedef void (*IpcNotifyHandler)(void);
+
+/* Wake-up statistics of a core, times in STM ticks (STM0 time base, all cores) */
+typedef struct
+{
+    volatile uint32                 postTime;        /* STM0 time of the latest ipcNotify() to the core              */
+    uint32                          wakeups;         /* Doorbell ISRs run                                            */
+    uint32                          wakeLatency;     /* Latest ipcNotify() to doorbell ISR entry                     */
+    uint32                          wakeLatencyMax;  /* Longest ipcNotify() to doorbell ISR entry                    */
+    uint32                          idleCount;       /* WAITs executed in ipcNotifyIdle()                            */
+    uint32                          idleTicks;       /* Time spent in WAIT, including the ISR that woke the core     */
+    uint32                          idleStart;       /* Entry of the current WAIT                                    */
+    volatile boolean                idleActive;      /* In ipcNotifyIdle(), the idle time is not accounted yet       */
+} IpcNotifyStatsType;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Inline Functions--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Atomic masked swap (SWAPMSK.W): *address = (value & mask) | (*address & ~mask), returns the previous content */
+IFX_INLINE uint32 ipcSwapMask(volatile uint32 *address, uint32 value, uint32 mask)
+{
+#if defined(__TASKING__)
+    return (uint32)__swapmskw((volatile unsigned int *)address, (unsigned int)value, (unsigned int)mask);
+#elif defined(__HIGHTEC__) || defined(__tricore__) || defined(__TRICORE__)
+    __extension__ unsigned long long reg64 = value | ((unsigned long long)mask << 32);
+
+    __asm__ __volatile__ ("swapmsk.w [%[addr]]0, %A[reg]"
+                          : [reg] "+d" (reg64)
+                          : [addr] "a" (address)
+                          : "memory");
+    return (uint32)reg64;
+#else
+    /* no SWAPMSK (host tests): the same update with a CMPSWAP loop */
+    uint32 old = *address;
+
+    for (;;)
+    {
+        uint32 seen = __cmpAndSwap((unsigned int volatile *)address, (value & mask) | (old & ~mask), old);
+
+        if (seen == old)
+        {
+            return old;
+        }
+
+        old = seen;
+    }
+#endif
+}
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+void  *ipcSpscReserve(IpcRingCtrl *ctrl, void *slots, uint32 depth, uint32 slotSize);
+void   ipcSpscCommit(IpcRingCtrl *ctrl);
+void  *ipcSpscPeek(IpcRingCtrl *ctrl, void *slots, uint32 depth, uint32 slotSize);
+void   ipcSpscRelease(IpcRingCtrl *ctrl);
+void  *ipcMpscReserve(IpcRingCtrl *ctrl, void *slots, uint32 depth, uint32 slotSize, uint32 *pos);
+void   ipcMpscCommit(IpcRingCtrl *ctrl, volatile uint32 *turn, uint32 pos, uint32 depth);
+void  *ipcMpscPeek(IpcRingCtrl *ctrl, void *slots, uint32 depth, uint32 slotSize);
+void   ipcMpscRelease(IpcRingCtrl *ctrl, volatile uint32 *turn, uint32 depth);
+uint32 ipcRingTakeStatus(IpcRingCtrl *ctrl);
+void   ipcRingAttach(IpcRingCtrl *ctrl);
+void   ipcNotifyInit(IpcNotifyHandler handler);
+void   ipcNotify(uint32 core);
+void   ipcNotifyIdle(void);
+void   ipcNotifyIdleEnd(void);
+
+extern IpcNotifyStatsType g_ipcNotifyStats[IPC_NUM_CORES];
+
+#endif /* APP_IPCRING_H_ */
@@ -0,0 +1,109 @@
+/**********************************************************************************************************************
+ * \file App_Periodic.c
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "Stm/Std/IfxStm.h"
+#include "App_Config.h"
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Body of every periodic task, the argument is its entry of the task table */
+static void task_app_periodic(void *arg)
+{
+    const AppPeriodicTaskCfg *cfg       = (const AppPeriodicTaskCfg *)arg;
+    AppPeriodicTaskStats     *stats     = cfg->stats;
+    const TickType_t          period    = pdMS_TO_TICKS(cfg->periodMs);
+    const uint32              periodStm = (uint32)IfxStm_getTicksFromMilliseconds(&MODULE_STM0, cfg->periodMs);
+    uint32                    lastStart = 0;
+
+    while (1)
+    {
+        uint32 start;
+        uint32 end;
+
+        /* Drift free: the next release is the previous release plus the period, not now plus the period. The first
+         * release of a task without offset is due at once, that is no overrun.
+         */
+        if ((xTaskDelayUntil(&stats->release, period) == pdFALSE) && (stats->releases > 0))
+        {
+            stats->overruns++;
+        }
+
+        start = IfxStm_getLower(&MODULE_STM0);
+
+        if (stats->releases > 0)
+        {
+            uint32 interval = start - lastStart;
+            uint32 jitter   = (interval > periodStm) ? (interval - periodStm) : (periodStm - interval);
+
+            if (jitter > stats->jitterMax)
+            {
+                stats->jitterMax = jitter;
+            }
+        }
+
+        lastStart = start;
+
+        cfg->job();
+
+        end = IfxStm_getLower(&MODULE_STM0);
+        stats->releases++;
+
+        if ((end - start) > stats->execMax)
+        {
+            stats->execMax = end - start;
+        }
+
+        if ((xTaskGetTickCount() - stats->release) > pdMS_TO_TICKS(cfg->deadlineMs))
+        {
+            stats->deadlineMisses++;
+        }
+    }
+}
+
+/* Create the periodic tasks of a task table on the calling core, their offsets count from now */
+void app_periodic_start(const AppPeriodicTaskCfg *table, uint32 count)
+{
+    TickType_t start = xTaskGetTickCount();
+    uint32     i;
+
+    for (i = 0; i < count; i++)
+    {
+        const AppPeriodicTaskCfg *cfg = &table[i];
+
+        /* xTaskDelayUntil() adds the period to the release first */
+        cfg->stats->release = start + pdMS_TO_TICKS(cfg->offsetMs) - pdMS_TO_TICKS(cfg->periodMs);
+
+        (void)xTaskCreateStatic(task_app_periodic, cfg->name, cfg->stack, (void *)cfg, cfg->priority,
+                                cfg->stackBuffer, cfg->taskBuffer);
+    }
+}
@@ -0,0 +1,239 @@
+/**********************************************************************************************************************
+ * \file App_Pool.c
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "App_Pool.h"
+#include "IfxCpu.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define APP_POOL_INDEX_MASK         0x0000FFFFU
+#define APP_POOL_TAG_STEP           0x00010000U
+
+/* Head with the same tag advanced by one step and a new index + 1 */
+#define APP_POOL_HEAD(head, link)   ((((head) + APP_POOL_TAG_STEP) & ~APP_POOL_INDEX_MASK) | (link))
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+/* Blocks and free lists, in the not cached LMU segment */
+#if defined(__TASKING__)
+#pragma section farbss "lmubss_nc"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".lmubss_nc" aw
+#endif
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) static AppPoolCtrl g_appPoolCtrl[APP_POOL_CLASS_COUNT];
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) static uint8       g_appPool16[APP_POOL_16_COUNT * APP_POOL_16_SIZE];
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) static uint8       g_appPool64[APP_POOL_64_COUNT * APP_POOL_64_SIZE];
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) static uint8       g_appPool256[APP_POOL_256_COUNT * APP_POOL_256_SIZE];
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) static uint8       g_appPool1536[APP_POOL_1536_COUNT * APP_POOL_1536_SIZE];
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+const AppPoolClass g_appPoolClass[APP_POOL_CLASS_COUNT] = {
+    {APP_POOL_16_SIZE,   APP_POOL_16_COUNT,   g_appPool16,   &g_appPoolCtrl[0]},
+    {APP_POOL_64_SIZE,   APP_POOL_64_COUNT,   g_appPool64,   &g_appPoolCtrl[1]},
+    {APP_POOL_256_SIZE,  APP_POOL_256_COUNT,  g_appPool256,  &g_appPoolCtrl[2]},
+    {APP_POOL_1536_SIZE, APP_POOL_1536_COUNT, g_appPool1536, &g_appPoolCtrl[3]},
+};
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Atomic add, returns the new value */
+static uint32 appPoolAdd(volatile uint32 *counter, uint32 value)
+{
+    uint32 old = *counter;
+
+    for (;;)
+    {
+        uint32 seen = __cmpAndSwap((unsigned int volatile *)counter, old + value, old);
+
+        if (seen == old)
+        {
+            return old + value;
+        }
+
+        old = seen;
+    }
+}
+
+/* Atomic maximum */
+static void appPoolMax(volatile uint32 *maximum, uint32 value)
+{
+    uint32 old = *maximum;
+
+    while (value > old)
+    {
+        uint32 seen = __cmpAndSwap((unsigned int volatile *)maximum, value, old);
+
+        if (seen == old)
+        {
+            break;
+        }
+
+        old = seen;
+    }
+}
+
+/* Take one block of a class: the free list first, then a block never handed out. NULL_PTR: class empty. */
+static void *appPoolTake(const AppPoolClass *cls)
+{
+    AppPoolCtrl *ctrl    = (AppPoolCtrl *)IPC_NOT_CACHED(cls->ctrl);
+    uint8       *storage = (uint8 *)IPC_NOT_CACHED(cls->storage);
+    uint32       head    = ctrl->head;
+    uint32       carved;
+
+    while ((head & APP_POOL_INDEX_MASK) != 0)
+    {
+        uint8 *block = &storage[((head & APP_POOL_INDEX_MASK) - 1) * cls->blockSize];
+        uint32 next  = *(volatile uint32 *)block;    /* may be stale, then the tag makes the CMPSWAP fail */
+        uint32 seen  = __cmpAndSwap((unsigned int volatile *)&ctrl->head, APP_POOL_HEAD(head, next), head);
+
+        if (seen == head)
+        {
+            return block;
+        }
+
+        head = seen;
+    }
+
+    carved = ctrl->carved;
+
+    while (carved < cls->blockCount)
+    {
+        uint32 seen = __cmpAndSwap((unsigned int volatile *)&ctrl->carved, carved + 1, carved);
+
+        if (seen == carved)
+        {
+            return &storage[carved * cls->blockSize];
+        }
+
+        carved = seen;
+    }
+
+    return NULL_PTR;
+}
+
+/* Allocate from the smallest class of size bytes or more up to class last, an empty class spills into the next */
+static void *appPoolAllocUpTo(uint32 size, uint32 last)
+{
+    uint32 i;
+
+    for (i = 0; i <= last; i++)
+    {
+        const AppPoolClass *cls = &g_appPoolClass[i];
+
+        if (size <= cls->blockSize)
+        {
+            AppPoolCtrl *ctrl  = (AppPoolCtrl *)IPC_NOT_CACHED(cls->ctrl);
+            void        *block = appPoolTake(cls);
+
+            if (block != NULL_PTR)
+            {
+                appPoolMax(&ctrl->inUseMax, appPoolAdd(&ctrl->inUse, 1));
+                (void)appPoolAdd(&ctrl->allocs, 1);
+                return block;
+            }
+
+            (void)appPoolAdd(&ctrl->failures, 1);
+        }
+    }
+
+    return NULL_PTR;
+}
+
+/* Allocate a block of at least size bytes (8 byte aligned, not cached alias). NULL_PTR: no class can serve it. */
+void *appPoolAlloc(uint32 size)
+{
+    return appPoolAllocUpTo(size, APP_POOL_CLASS_COUNT - 1);
+}
+
+/* pvPortMalloc() front end: small requests only, the frame classes above APP_POOL_MALLOC_MAX stay for frames */
+void *appPoolMalloc(uint32 size)
+{
+    uint32 last = 0;
+
+    while ((last < (APP_POOL_CLASS_COUNT - 1)) && (g_appPoolClass[last + 1].blockSize <= APP_POOL_MALLOC_MAX))
+    {
+        last++;
+    }
+
+    return (size <= APP_POOL_MALLOC_MAX) ? appPoolAllocUpTo(size, last) : NULL_PTR;
+}
+
+/* Return a block to its class. FALSE: the address is no pool block, nothing done. */
+boolean appPoolFree(void *block)
+{
+    uint32 address = (uint32)IPC_NOT_CACHED(block);
+    uint32 i;
+
+    for (i = 0; i < APP_POOL_CLASS_COUNT; i++)
+    {
+        const AppPoolClass *cls   = &g_appPoolClass[i];
+        uint32              start = (uint32)IPC_NOT_CACHED(cls->storage);
+
+        if ((address >= start) && (address < (start + (cls->blockCount * cls->blockSize))))
+        {
+            AppPoolCtrl *ctrl = (AppPoolCtrl *)IPC_NOT_CACHED(cls->ctrl);
+            uint32       link = ((address - start) / cls->blockSize) + 1;
+            uint32       head = ctrl->head;
+
+            for (;;)
+            {
+                uint32 seen;
+
+                *(volatile uint32 *)(start + ((link - 1) * cls->blockSize)) = head & APP_POOL_INDEX_MASK;
+                IPC_BARRIER();
+                seen = __cmpAndSwap((unsigned int volatile *)&ctrl->head, APP_POOL_HEAD(head, link), head);
+
+                if (seen == head)
+                {
+                    break;
+                }
+
+                head = seen;
+            }
+
+            (void)appPoolAdd(&ctrl->inUse, (uint32)-1);
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
@@ -0,0 +1,99 @@
+/**********************************************************************************************************************
+ * \file App_Pool.h
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef APP_POOL_H_
+#define APP_POOL_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "App_IpcRing.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Fixed size block pools for frame buffers.
+ *
+ * Every size class is an array of equal blocks with a free list in front of it. Allocation and release are O(1) and
+ * lock-free: the list head holds the block index + 1 (bits 15..0, 0: list empty) and a tag (bits 31..16) which
+ * every push and pop increments, both swap the head with CMPSWAP, so a pop racing with a pop and push of the same
+ * block on another core or in a nested ISR fails its CMPSWAP instead of corrupting the list (ABA). The link of a
+ * free block is kept in its first word. Blocks never handed out yet are carved from the end of the array with a
+ * second counter, so a zero filled pool is a valid empty pool and needs no init call.
+ *
+ * Callable from any task or ISR on any core. The pools live in the not cached LMU segment and blocks are handed out
+ * at their not cached alias, so a frame can be passed to another core without cache maintenance.
+ */
+#define APP_POOL_CLASS_COUNT        4
+
+/* Size classes: CAN frames, CAN FD frames, small messages and kernel objects, Ethernet frames */
+#define APP_POOL_16_SIZE            16
+#define APP_POOL_16_COUNT           64
+#define APP_POOL_64_SIZE            64
+#define APP_POOL_64_COUNT           64
+#define APP_POOL_256_SIZE           256
+#define APP_POOL_256_COUNT          16
+#define APP_POOL_1536_SIZE          1536
+#define APP_POOL_1536_COUNT         4
+
+/* Largest request pvPortMalloc() hands to the pools with configUSE_APP_POOL_MALLOC, larger ones go to the heap */
+#define APP_POOL_MALLOC_MAX         APP_POOL_256_SIZE
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Free list and statistics of one size class, on a cache line of its own */
+typedef struct
+{
+    volatile uint32                 head;            /* Tag (bits 31..16) | index + 1 of the first free block        */
+    volatile uint32                 carved;          /* Blocks taken from the array so far                           */
+    volatile uint32                 inUse;           /* Blocks allocated                                             */
+    volatile uint32                 inUseMax;        /* High water mark of inUse                                     */
+    volatile uint32                 allocs;          /* Successful allocations                                       */
+    volatile uint32                 failures;        /* Allocations which found the class empty                      */
+    uint32                          pad[(IPC_CACHE_LINE_SIZE / 4) - 6];
+} AppPoolCtrl;
+
+/* Size class, sorted by block size */
+typedef struct
+{
+    uint32                          blockSize;       /* Bytes per block, multiple of 8                               */
+    uint32                          blockCount;      /* Blocks in the class, at most 0xFFFF                          */
+    uint8                          *storage;         /* blockCount * blockSize bytes                                 */
+    AppPoolCtrl                    *ctrl;
+} AppPoolClass;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+void   *appPoolAlloc(uint32 size);
+boolean appPoolFree(void *block);
+void   *appPoolMalloc(uint32 size);
+
+extern const AppPoolClass g_appPoolClass[APP_POOL_CLASS_COUNT];
+
+#endif /* APP_POOL_H_ */
@@ -0,0 +1,92 @@
+/**********************************************************************************************************************
+ * \file App_Trace.c
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "App_Trace.h"
+#include "IfxCpu.h"
+
+#if configUSE_APP_TRACE != 0
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* One ring per core in the DSPR of that core: recording is a local store, the debugger reads all three */
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu0"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu0" aw
+#endif
+static AppTraceRing g_appTraceRingCpu0;
+#if defined(__TASKING__)
+#pragma section farbss restore
+#pragma section farbss "bss_cpu1"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#pragma section ".bss_cpu1" aw
+#endif
+static AppTraceRing g_appTraceRingCpu1;
+#if defined(__TASKING__)
+#pragma section farbss restore
+#pragma section farbss "bss_cpu2"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#pragma section ".bss_cpu2" aw
+#endif
+static AppTraceRing g_appTraceRingCpu2;
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+/* Ring of each core by core index, the entry point of the trace reader */
+AppTraceRing *const g_appTraceRing[APP_TRACE_NUM_CORES] = {&g_appTraceRingCpu0, &g_appTraceRingCpu1,
+                                                           &g_appTraceRingCpu2};
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Start the clock counter (CCNT) of the executing core and open its ring. Called first thing by every core. */
+void appTraceInit(void)
+{
+    AppTraceRing *ring = g_appTraceRing[IfxCpu_getCoreIndex()];
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+
+    ring->head       = 0;
+    ring->depth      = APP_TRACE_DEPTH;
+    ring->cpuClockHz = configCPU_CLOCK_HZ;
+    ring->magic      = APP_TRACE_MAGIC;
+}
+
+#endif /* configUSE_APP_TRACE */
@@ -0,0 +1,165 @@
+/**********************************************************************************************************************
+ * \file App_Trace.h
+ * \copyright Copyright (C) Infineon Technologies AG 2023
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef APP_TRACE_H_
+#define APP_TRACE_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu_Intrinsics.h"
+#include "IfxCpu_reg.h"
+#include "FreeRTOSConfig.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Binary event trace of the kernel and the gateway ISRs.
+ *
+ * Every core records into its own ring in its own DSPR, so a record is a handful of local stores: no lock, no bus
+ * access to another core. Nested ISRs of the same core are kept apart by masking interrupts for the three stores of
+ * a record, which also keeps the events of a ring in timestamp order. The ring overwrites its oldest events; head
+ * counts all events written, so a reader tells the lost ones from (head - depth).
+ *
+ * Event record (8 bytes, little endian):
+ *   word 0  timestamp  CCNT of the recording core (CPU clock, 31 bit, wraps after ~7 s at 300 MHz)
+ *   word 1  info       event id (bits 31..24) | argument (bits 23..0)
+ * The rings are located through g_appTraceRing[] (magic APP_TRACE_MAGIC, depth, head, events) and read from a
+ * memory dump of the debugger. CCNT is private to each core and stands still while the core sleeps in WAIT: the
+ * reader anchors the events to the APP_TRACE_TICK records (tick count in the argument) and uses CCNT for the time
+ * since the latest tick, which also unfolds the CCNT wrap and lines the cores up on the common tick.
+ *
+ * configUSE_APP_TRACE 0 compiles every hook to nothing.
+ */
+#define APP_TRACE_NUM_CORES             3                           /* CPU0, CPU1, CPU2                              */
+#define APP_TRACE_DEPTH                 512                         /* Events per core, power of two (4K of DSPR)    */
+#define APP_TRACE_MAGIC                 0x54524331U                 /* "TRC1", marks an initialised ring             */
+
+/* Event ids (info bits 31..24) and their argument (info bits 23..0) */
+#define APP_TRACE_TASK_SWITCHED_IN      0x01U   /* Task number (uxTCBNumber) of the task now running                  */
+#define APP_TRACE_TASK_CREATE           0x02U   /* Task number of the new task                                        */
+#define APP_TRACE_TICK                  0x03U   /* Tick count, low 24 bits                                            */
+#define APP_TRACE_ISR_ENTER             0x04U   /* Priority of the ISR (ICR.CCPN)                                     */
+#define APP_TRACE_ISR_EXIT              0x05U   /* Priority of the ISR                                                */
+#define APP_TRACE_IDLE_BEGIN            0x06U   /* 0, tickless idle: the core goes to sleep                           */
+#define APP_TRACE_IDLE_END              0x07U   /* 0, tickless idle: the core woke up                                 */
+#define APP_TRACE_QUEUE_SEND            0x10U   /* Queue (or semaphore) id: address bits 23..0 of the queue           */
+#define APP_TRACE_QUEUE_SEND_FAILED     0x11U
+#define APP_TRACE_QUEUE_RECEIVE         0x12U
+#define APP_TRACE_QUEUE_RECEIVE_FAILED  0x13U
+#define APP_TRACE_QUEUE_SEND_ISR        0x14U
+#define APP_TRACE_QUEUE_SEND_ISR_FAILED 0x15U
+#define APP_TRACE_QUEUE_RECEIVE_ISR     0x16U
+#define APP_TRACE_QUEUE_RECEIVE_ISR_FAILED 0x17U
+#define APP_TRACE_QUEUE_BLOCK_SEND      0x18U   /* The task blocks on a full queue                                    */
+#define APP_TRACE_QUEUE_BLOCK_RECEIVE   0x19U   /* The task blocks on an empty queue                                  */
+
+#define APP_TRACE_ARG_MASK              0x00FFFFFFU
+#define APP_TRACE_QUEUE_ID(queue)       ((uint32)(queue) & APP_TRACE_ARG_MASK)
+
+#if configUSE_APP_TRACE != 0
+/* ISR entry and exit, for the ISRs worth seeing in the trace (the kernel has no hook for them) */
+#define APP_TRACE_ISR_ENTER_EVENT()     appTraceEvent(APP_TRACE_ISR_ENTER, __mfcr(CPU_ICR) & 0xFFU)
+#define APP_TRACE_ISR_EXIT_EVENT()      appTraceEvent(APP_TRACE_ISR_EXIT, __mfcr(CPU_ICR) & 0xFFU)
+/* Tick of a core without scheduler (bare-metal 1 ms ISR), the anchor of its CCNT timestamps */
+#define APP_TRACE_TICK_EVENT(count)     appTraceEvent(APP_TRACE_TICK, (uint32)(count))
+
+/* FreeRTOS trace hooks */
+#define traceISR_ENTER()                        APP_TRACE_ISR_ENTER_EVENT()
+#define traceISR_EXIT()                         APP_TRACE_ISR_EXIT_EVENT()
+#define traceTASK_SWITCHED_IN()                 appTraceEvent(APP_TRACE_TASK_SWITCHED_IN, pxCurrentTCB->uxTCBNumber)
+#define traceTASK_CREATE(pxNewTCB)              appTraceEvent(APP_TRACE_TASK_CREATE, (pxNewTCB)->uxTCBNumber)
+#define traceTASK_INCREMENT_TICK(xTickCount)    appTraceEvent(APP_TRACE_TICK, (uint32)(xTickCount))
+#define traceLOW_POWER_IDLE_BEGIN()             appTraceEvent(APP_TRACE_IDLE_BEGIN, 0)
+#define traceLOW_POWER_IDLE_END()               appTraceEvent(APP_TRACE_IDLE_END, 0)
+#define traceQUEUE_SEND(pxQueue)                appTraceEvent(APP_TRACE_QUEUE_SEND, APP_TRACE_QUEUE_ID(pxQueue))
+#define traceQUEUE_SEND_FAILED(pxQueue)         appTraceEvent(APP_TRACE_QUEUE_SEND_FAILED, APP_TRACE_QUEUE_ID(pxQueue))
+#define traceQUEUE_RECEIVE(pxQueue)             appTraceEvent(APP_TRACE_QUEUE_RECEIVE, APP_TRACE_QUEUE_ID(pxQueue))
+#define traceQUEUE_RECEIVE_FAILED(pxQueue)      appTraceEvent(APP_TRACE_QUEUE_RECEIVE_FAILED, APP_TRACE_QUEUE_ID(pxQueue))
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)       appTraceEvent(APP_TRACE_QUEUE_SEND_ISR, APP_TRACE_QUEUE_ID(pxQueue))
+#define traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue) \
+    appTraceEvent(APP_TRACE_QUEUE_SEND_ISR_FAILED, APP_TRACE_QUEUE_ID(pxQueue))
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)    appTraceEvent(APP_TRACE_QUEUE_RECEIVE_ISR, APP_TRACE_QUEUE_ID(pxQueue))
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED(pxQueue) \
+    appTraceEvent(APP_TRACE_QUEUE_RECEIVE_ISR_FAILED, APP_TRACE_QUEUE_ID(pxQueue))
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)    appTraceEvent(APP_TRACE_QUEUE_BLOCK_SEND, APP_TRACE_QUEUE_ID(pxQueue))
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) appTraceEvent(APP_TRACE_QUEUE_BLOCK_RECEIVE, APP_TRACE_QUEUE_ID(pxQueue))
+#else
+#define APP_TRACE_ISR_ENTER_EVENT()
+#define APP_TRACE_ISR_EXIT_EVENT()
+#define APP_TRACE_TICK_EVENT(count)
+#endif
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32                          timestamp;       /* CCNT of the recording core                                   */
+    uint32                          info;            /* Event id (bits 31..24) | argument (bits 23..0)               */
+} AppTraceEvent;
+
+/* Trace ring of one core, in the DSPR of that core */
+typedef struct
+{
+    uint32                          magic;           /* APP_TRACE_MAGIC once appTraceInit() ran on the core          */
+    uint32                          depth;           /* APP_TRACE_DEPTH                                              */
+    volatile uint32                 head;            /* Events written, wraps modulo 2^32                            */
+    uint32                          cpuClockHz;      /* CCNT frequency, for the reader                               */
+    AppTraceEvent                   event[APP_TRACE_DEPTH];
+} AppTraceRing;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+void appTraceInit(void);
+
+extern AppTraceRing *const g_appTraceRing[APP_TRACE_NUM_CORES];
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Inline Functions--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Record one event into the ring of the executing core. Callable from any context, interrupts enabled or not. */
+IFX_INLINE void appTraceEvent(uint32 id, uint32 arg)
+{
+    AppTraceRing  *ring = g_appTraceRing[__mfcr(CPU_CORE_ID) & 0x7U];
+    AppTraceEvent *slot;
+    uint32         icr  = __mfcr(CPU_ICR);
+
+    __disable();
+    slot            = &ring->event[ring->head & (APP_TRACE_DEPTH - 1)];
+    slot->timestamp = __mfcr(CPU_CCNT);
+    slot->info      = (id << 24) | (arg & APP_TRACE_ARG_MASK);
+    ring->head      = ring->head + 1;
+
+    if ((icr & 0x8000U) != 0)                       /* ICR.IE */
+    {
+        __enable();
+    }
+}
+
+#endif /* APP_TRACE_H_ */
@@ -1,19 +1,52 @@
 #ifndef FREERTOS_CONFIG_H
 #define FREERTOS_CONFIG_H
 
+/* Build option: 0 = FreeRTOS on CPU0 only, CPU1/CPU2 run bare-metal.
+ * 1 = every core boots its own scheduler instance: the kernel data and the heap are linked at the core local DSPR
+ * alias (one private copy per core), the tick runs on the STM of the executing core. */
+#ifndef configPER_CORE_SCHEDULER    /* Defined by the build otherwise (host tests of one core instance) */
+#define configPER_CORE_SCHEDULER                   0
+#endif
+
 #define configUSE_PREEMPTION                       1
-#define configUSE_IDLE_HOOK                        0
+#define configUSE_IDLE_HOOK                        configPER_CORE_SCHEDULER
 
 #define configCPU_CLOCK_HZ                         ( ( unsigned long ) 300000000UL )
 #define configTICK_RATE_HZ                         ( ( TickType_t ) 1000UL )
+#define configUSE_TICKLESS_IDLE                    1
 
+#ifndef configMAX_PRIORITIES    /* Defined by the build otherwise (host benchmark of the task selection) */
 #define configMAX_PRIORITIES                       ( 10 )
+#endif
+/* Ready priorities as a bitmap, the highest one is found with CLZ in O(1) whatever configMAX_PRIORITIES (<= 32).
+ * 0: generic linear scan from the top ready priority down */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+#endif
+/* 1: the port keeps the cycles of vTaskSwitchContext() per core in xPortSwitchContextStats[] */
+#define configPORT_SWITCH_CONTEXT_STATS            0
 #define configMINIMAL_STACK_SIZE                   ( ( unsigned short ) 256 )
-#define configTOTAL_HEAP_SIZE                      ( ( size_t ) ( 64U * 1024U ) )
+/* 1: tasks, queues and semaphores of the application and the kernel are created from static buffers in the DSPR
+ * of their core, the heap only serves objects created at run time */
+#define configSUPPORT_STATIC_ALLOCATION            1
+#define configSUPPORT_DYNAMIC_ALLOCATION           1
+/* With configPER_CORE_SCHEDULER one heap per core, it has to fit into the 96K DSPR of CPU2 next to its stacks and
+ * CSA */
+#define configTOTAL_HEAP_SIZE                      ( ( size_t ) ( 16U * 1024U ) )
 #define configMAX_TASK_NAME_LEN                    ( 16 )
+/* 1: pvPortMalloc() serves requests up to APP_POOL_MALLOC_MAX from the fixed block pools of App_Pool.h, in O(1)
+ * and freeable, larger requests go to the heap */
+#define configUSE_APP_POOL_MALLOC                  0
+/* 1: heap_5 with one heap in the DSPR of every core and a shared one in the LMU (App_Heap.c), pvPortMalloc() serves
+ * the calling core from its own DSPR. Requires heap_5.c instead of heap_1.c in the build, configTOTAL_HEAP_SIZE is
+ * then unused */
+#define configHEAP_PER_CORE_REGIONS                0
 
 #define configENABLE_BACKWARD_COMPATIBILITY        0
-#define configUSE_TRACE_FACILITY                   0
+/* Event trace recorder (App_Trace.h): 1 records context switches, ticks, queue operations and the instrumented ISRs
+ * into a binary ring per core, 0 compiles every trace hook to nothing */
+#define configUSE_APP_TRACE                        1
+#define configUSE_TRACE_FACILITY                   configUSE_APP_TRACE
 #define configUSE_16_BIT_TICKS                     0
 #define configIDLE_SHOULD_YIELD                    0
 #define configUSE_MALLOC_FAILED_HOOK               0
@@ -66,13 +99,31 @@
 #ifdef configCONTEXT_SRC
 #undef configCONTEXT_SRC
 #endif
+#if configPER_CORE_SCHEDULER != 0
+/* Resolved at run time, the same kernel image runs on every core */
+#define configCPU_NR                        portGET_CORE_ID()
+#else
 #define configCPU_NR                        0
+#endif
 #define configPROVIDE_SYSCALL_TRAP          0
 #define configSYSCALL_CALL_DEPTH            2
 #define configSTM                           ( ( uint32_t * ) (0xF0001000 + configCPU_NR*0x100 ) )
 #define configSTM_SRC                       ( ( uint32_t * ) (0xF0038300 + configCPU_NR*0x8) )
 #define configSTM_CLOCK_HZ                  ( 100000000 )
 #define configSTM_DEBUG                     ( 1 )
-#define configCONTEXT_SRC                   ( ( uint32_t * ) 0xF0038990 )
+#define configCONTEXT_SRC                   ( ( uint32_t * ) (0xF0038990 + configCPU_NR*0x8) )
+
+#if configPER_CORE_SCHEDULER != 0
+/* Kernel data section, linked at the core local DSPR alias 0xD0000000 */
+#define PRIVILEGED_DATA                     __attribute__( ( section( ".bss.kernel_local" ) ) )
+
+/* The idle hook sleeps in ipcNotifyIdle(). A task readied by the interrupt that woke the core is switched in before
+ * WAIT returns, so the idle time of the core ends when the idle task is switched out */
+#include "App_IpcRing.h"
+#define traceTASK_SWITCHED_OUT()            ipcNotifyIdleEnd()
+#endif
+
+/* Trace hooks of the event trace recorder */
+#include "App_Trace.h"
 
 #endif /* FREERTOS_CONFIG_H */
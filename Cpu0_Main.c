@@ -40,6 +40,7 @@
 #include "IfxScuWdt.h"
 
 #include "App_Config.h"
+#include "App_Heap.h"
 #include "FreeRTOS.h"
 #include "task.h"
 
@@ -51,8 +52,88 @@ IFX_ALIGN(4) IfxCpu_syncEvent g_cpuSyncEvent = 0;
 
 uint8_t cpu0_main_count = 0;
 
+/* Stacks and TCBs of the idle and timer task of one scheduler instance */
+typedef struct
+{
+    StaticTask_t idleTcb;
+    StaticTask_t timerTcb;
+    StackType_t  idleStack[configMINIMAL_STACK_SIZE];
+    StackType_t  timerStack[configTIMER_TASK_STACK_DEPTH];
+} AppKernelTaskMemory;
+
+/* Statically allocated kernel objects of CPU0, in the DSPR of CPU0 */
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu0"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu0" aw
+#endif
+static StackType_t         cpu0_init_stack[CPU0_INIT_TASK_STACK];
+static StaticTask_t        cpu0_init_tcb;
+static StaticSemaphore_t   cpu0_init_sem_buffer;
+static AppKernelTaskMemory cpu0_kernel_tasks;
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+#if configPER_CORE_SCHEDULER != 0
+/* Idle and timer task of the scheduler instances of CPU1/CPU2, each in the DSPR of its core */
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu1"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu1" aw
+#endif
+static AppKernelTaskMemory cpu1_kernel_tasks;
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+#if defined(__TASKING__)
+#pragma section farbss "bss_cpu2"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".bss_cpu2" aw
+#endif
+static AppKernelTaskMemory cpu2_kernel_tasks;
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+static AppKernelTaskMemory * const app_kernel_tasks[IPC_NUM_CORES] = {
+    &cpu0_kernel_tasks, &cpu1_kernel_tasks, &cpu2_kernel_tasks
+};
+#else
+static AppKernelTaskMemory * const app_kernel_tasks[1] = {&cpu0_kernel_tasks};
+#endif
+
 void core0_main(void)
 {
+    app_core_boot_stamp(APP_BOOT_MAIN_ENTRY);
+
+#if configUSE_APP_TRACE != 0
+    appTraceInit();
+#endif
+
+#if configPER_CORE_SCHEDULER != 0
+    /* Local kernel data of CPU0, before the first kernel call */
+    vPortInitCoreData();
+#endif
+
+#if configHEAP_PER_CORE_REGIONS != 0
+    /* heap_5 regions of all cores, before the first allocation */
+    app_heap_init();
+#endif
+
     IfxCpu_enableInterrupts();
     
     cpu0_main_count++; //Step No. 1
@@ -66,8 +147,7 @@ void core0_main(void)
     cpu0_main_count++; //Step No. 2
 
     /* Create init semaphores for each CPU0 */
-    g_cpu0InitSem = xSemaphoreCreateBinary();
-    g_cpu0TickSem = xSemaphoreCreateBinary();
+    g_cpu0InitSem = xSemaphoreCreateBinaryStatic(&cpu0_init_sem_buffer);
 
     cpu0_main_count++; //Step No. 3
 
@@ -79,15 +159,12 @@ void core0_main(void)
 
 
     /* Create init task on CPU0 */
-    xTaskCreate(task_cpu0_init, "INIT CPU0", CPU0_INIT_TASK_STACK, NULL, CPU0_INIT_TASK_PRIORITY, NULL);
+    (void)xTaskCreateStatic(task_cpu0_init, "INIT CPU0", CPU0_INIT_TASK_STACK, NULL, CPU0_INIT_TASK_PRIORITY,
+                            cpu0_init_stack, &cpu0_init_tcb);
     
     cpu0_main_count++; //Step No. 5
 
-    /* Create placeholder tasks on CPU0 */
-    xTaskCreate(task_cpu0_1ms, "CPU0 1MS", CPU0_1MS_TASK_STACK, NULL, CPU0_1MS_TASK_PRIORITY, NULL);
-    xTaskCreate(task_cpu0_10ms, "CPU0 10MS", CPU0_10MS_TASK_STACK, NULL, CPU0_10MS_TASK_PRIORITY, NULL);
-    xTaskCreate(task_cpu0_100ms, "CPU0 100MS", CPU0_100MS_TASK_STACK, NULL, CPU0_100MS_TASK_PRIORITY, NULL);
-    xTaskCreate(task_cpu0_1000ms, "CPU0 1000MS", CPU0_1000MS_TASK_STACK, NULL, CPU0_1000MS_TASK_PRIORITY, NULL);
+    /* The periodic tasks of CPU0 are created from the task table by the init task (app_cpu0_periodic_start()) */
     
     cpu0_main_count++; //Step No. 6
 
@@ -102,6 +179,7 @@ void core0_main(void)
     cpu0_main_count++; //Step No. 7
 
     /* Start the scheduler */
+    app_core_boot_stamp(APP_BOOT_SCHEDULER_START);
     vTaskStartScheduler();
     
     cpu0_main_count++; //Step No. 8
@@ -125,3 +203,36 @@ void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName)
         __nop();
     }
 }
+
+/* Required FreeRTOS callbacks with static allocation: idle and timer task of the scheduler instance of the calling
+ * core
+ */
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer,
+                                   uint32_t *pulIdleTaskStackSize)
+{
+    AppKernelTaskMemory *memory = app_kernel_tasks[configCPU_NR];
+
+    *ppxIdleTaskTCBBuffer   = &memory->idleTcb;
+    *ppxIdleTaskStackBuffer = memory->idleStack;
+    *pulIdleTaskStackSize   = configMINIMAL_STACK_SIZE;
+}
+
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer,
+                                    uint32_t *pulTimerTaskStackSize)
+{
+    AppKernelTaskMemory *memory = app_kernel_tasks[configCPU_NR];
+
+    *ppxTimerTaskTCBBuffer   = &memory->timerTcb;
+    *ppxTimerTaskStackBuffer = memory->timerStack;
+    *pulTimerTaskStackSize   = configTIMER_TASK_STACK_DEPTH;
+}
+
+#if configUSE_IDLE_HOOK != 0
+/* FreeRTOS idle hook, shared by the scheduler instances of all cores: sleep in WAIT until the next interrupt, the
+ * idle time per core is accumulated in g_ipcNotifyStats
+ */
+void vApplicationIdleHook(void)
+{
+    ipcNotifyIdle();
+}
+#endif
@@ -29,11 +29,23 @@
 #include "IfxScuWdt.h"
 #include "Port/Io/IfxPort_Io.h"
 #include "App_Config.h"
+#include "task.h"
 
 extern IfxCpu_syncEvent g_cpuSyncEvent;
 
 void core1_main(void)
 {
+    app_core_boot_stamp(APP_BOOT_MAIN_ENTRY);
+
+#if configUSE_APP_TRACE != 0
+    appTraceInit();
+#endif
+
+#if configPER_CORE_SCHEDULER != 0
+    /* Local kernel data of CPU1, the C startup code only initialises CPU0 */
+    vPortInitCoreData();
+#endif
+
     IfxCpu_enableInterrupts();
     
     /* !!WATCHDOG1 IS DISABLED HERE!!
@@ -45,13 +57,20 @@ void core1_main(void)
     IfxCpu_emitEvent(&g_cpuSyncEvent);
     IfxCpu_waitEvent(&g_cpuSyncEvent, 1);
     
-    /* Main bare-metal loop - CPU1 now runs without FreeRTOS */
+    /* 1ms tick (or tasks) and inbox doorbell of CPU1 */
+    app_cpu1_init();
+    app_core_boot_stamp(APP_BOOT_SCHEDULER_START);
+
+#if configPER_CORE_SCHEDULER != 0
+    /* Scheduler instance of CPU1: tick on STM1 compare 0, context switch through its own GPSR */
+    vTaskStartScheduler();
+#endif
+
+    /* Main bare-metal loop - CPU1 now runs without FreeRTOS and sleeps until its next interrupt: the 1ms tick, the
+     * inbox doorbell or one of the CAN gateway nodes it owns
+     */
     while(1)
     {
-        cpu1_tick_counter++;
-        app_cpu1_led2on();
-
-        /* Simple delay */
-        __nop();
+        ipcNotifyIdle();
     }
 }
@@ -29,11 +29,23 @@
 #include "IfxScuWdt.h"
 #include "Port/Io/IfxPort_Io.h"
 #include "App_Config.h"
+#include "task.h"
 
 extern IfxCpu_syncEvent g_cpuSyncEvent;
 
 void core2_main(void)
 {
+    app_core_boot_stamp(APP_BOOT_MAIN_ENTRY);
+
+#if configUSE_APP_TRACE != 0
+    appTraceInit();
+#endif
+
+#if configPER_CORE_SCHEDULER != 0
+    /* Local kernel data of CPU2, the C startup code only initialises CPU0 */
+    vPortInitCoreData();
+#endif
+
     IfxCpu_enableInterrupts();
     
     /* !!WATCHDOG2 IS DISABLED HERE!!
@@ -45,13 +57,20 @@ void core2_main(void)
     IfxCpu_emitEvent(&g_cpuSyncEvent);
     IfxCpu_waitEvent(&g_cpuSyncEvent, 1);
     
-    /* Main bare-metal loop - CPU2 now runs without FreeRTOS */
+    /* 1ms tick (or tasks) and inbox doorbell of CPU2 */
+    app_cpu2_init();
+    app_core_boot_stamp(APP_BOOT_SCHEDULER_START);
+
+#if configPER_CORE_SCHEDULER != 0
+    /* Scheduler instance of CPU2: tick on STM2 compare 0, context switch through its own GPSR */
+    vTaskStartScheduler();
+#endif
+
+    /* Main bare-metal loop - CPU2 now runs without FreeRTOS and sleeps until its next interrupt: the 1ms tick, the
+     * inbox doorbell or one of the CAN gateway nodes it owns
+     */
     while(1)
     {
-        cpu2_tick_counter++;
-        app_cpu2_led2off();
-        
-        /* Simple delay */
-        __nop();
+        ipcNotifyIdle();
     }
 }
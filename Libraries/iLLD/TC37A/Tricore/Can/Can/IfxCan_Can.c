@@ -48,10 +48,138 @@
 
 #include "IfxCan_Can.h"
 
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the number of consecutive free Tx FIFO/Queue slots starting at the put index
+ * \param node CAN Node handle
+ * \param putIndex Returns the put index (first free slot)
+ * \return Number of free slots, 1 at most in Tx Queue mode
+ */
+IFX_STATIC uint8 IfxCan_Can_getTxFifoQueueFreeSlots(IfxCan_Can_Node *node, IfxCan_TxBufferId *putIndex);
+
+/** \brief Returns the Tx FIFO slot following the given one, wrapping around at the end of the Tx FIFO
+ * \param node CAN Node handle
+ * \param bufferId Tx FIFO slot
+ * \return Next Tx FIFO slot
+ */
+IFX_STATIC IfxCan_TxBufferId IfxCan_Can_getNextTxFifoSlot(IfxCan_Can_Node *node, IfxCan_TxBufferId bufferId);
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+IfxCan_Status IfxCan_Can_forwardMessage(IfxCan_Can_Node *node, Ifx_CAN_RXMSG *rxBufferElement, uint32 messageId)
+{
+    IfxCan_Status     status = IfxCan_Status_ok;
+    IfxCan_TxBufferId bufferId;
+    Ifx_CAN_TXMSG    *txBufferElement;
+
+    if (IfxCan_Node_isTxFifoQueueFull(node->node) != FALSE)
+    {                       /* no free Tx FIFO/Queue element, e.g. due to busy bus, BUS-OFF or others */
+        status = IfxCan_Status_notSentBusy;
+    }
+    else
+    {
+        /* get the Tx FIFO/Queue element address */
+        bufferId        = IfxCan_Node_getTxFifoQueuePutIndex(node->node);
+        txBufferElement = IfxCan_Node_getTxBufferElementAddress(node->node, node->messageRAM.baseAddress, node->messageRAM.txBuffersStartAddress, bufferId);
+
+        /* copy header words and data section (ID, RTR, XTD, ESI, DLC, BRS, FDF, DBx) */
+        IfxCan_Node_copyRxElementToTxElement(rxBufferElement, txBufferElement);
+
+        /* rewrite message Id only if requested, ID length of the received frame is kept */
+        if (messageId != IFXCAN_CAN_MESSAGE_ID_UNCHANGED)
+        {
+            IfxCan_Node_setMsgId(txBufferElement, messageId, (IfxCan_MessageIdLength)txBufferElement->T0.B.XTD);
+        }
+
+        /*set transmit request */
+        IfxCan_Node_setTxBufferAddRequest(node->node, bufferId);
+    }
+
+    return status;
+}
+
+
+uint8 IfxCan_Can_forwardMessages(IfxCan_Can_Node *node, Ifx_CAN_RXMSG **rxBufferElements, const uint32 *messageIds, uint8 count)
+{
+    uint8             accepted;
+    uint32            addRequestMask = 0;
+    IfxCan_TxBufferId bufferId;
+    Ifx_CAN_TXMSG    *txBufferElement;
+    uint8             freeSlots      = IfxCan_Can_getTxFifoQueueFreeSlots(node, &bufferId);
+
+    if (count > freeSlots)
+    {
+        count = freeSlots;
+    }
+
+    for (accepted = 0; accepted < count; accepted++)
+    {
+        txBufferElement = IfxCan_Node_getTxBufferElementAddress(node->node, node->messageRAM.baseAddress, node->messageRAM.txBuffersStartAddress, bufferId);
+
+        /* copy header words and data section (ID, RTR, XTD, ESI, DLC, BRS, FDF, DBx) */
+        IfxCan_Node_copyRxElementToTxElement(rxBufferElements[accepted], txBufferElement);
+
+        /* rewrite message Id only if requested, ID length of the received frame is kept */
+        if ((messageIds != NULL_PTR) && (messageIds[accepted] != IFXCAN_CAN_MESSAGE_ID_UNCHANGED))
+        {
+            IfxCan_Node_setMsgId(txBufferElement, messageIds[accepted], (IfxCan_MessageIdLength)txBufferElement->T0.B.XTD);
+        }
+
+        addRequestMask |= (1U << bufferId);
+        bufferId        = IfxCan_Can_getNextTxFifoSlot(node, bufferId);
+    }
+
+    /*set transmit requests of all copied elements at once */
+    if (addRequestMask != 0)
+    {
+        IfxCan_Node_setTxBufferAddRequestMask(node->node, addRequestMask);
+    }
+
+    return accepted;
+}
+
+
+IFX_STATIC IfxCan_TxBufferId IfxCan_Can_getNextTxFifoSlot(IfxCan_Can_Node *node, IfxCan_TxBufferId bufferId)
+{
+    uint8 firstSlot = IfxCan_Node_getDedicatedTxBuffersNumber(node->node);
+    uint8 nextSlot  = (uint8)bufferId + 1;
+
+    if (nextSlot >= (firstSlot + IfxCan_Node_getTxFifoQueueSize(node->node)))
+    {
+        nextSlot = firstSlot;
+    }
+
+    return (IfxCan_TxBufferId)nextSlot;
+}
+
+
+IFX_STATIC uint8 IfxCan_Can_getTxFifoQueueFreeSlots(IfxCan_Can_Node *node, IfxCan_TxBufferId *putIndex)
+{
+    uint8 freeSlots;
+
+    *putIndex = IfxCan_Node_getTxFifoQueuePutIndex(node->node);
+
+    if (IfxCan_Node_isTxFifoQueueFull(node->node) != FALSE)
+    {
+        freeSlots = 0;
+    }
+    else if (IfxCan_Node_isTxQueueMode(node->node) != FALSE)
+    {                       /* free Tx Queue slots are not necessarily consecutive */
+        freeSlots = 1;
+    }
+    else
+    {
+        freeSlots = IfxCan_Node_getTxFifoFreeLevel(node->node);
+    }
+
+    return freeSlots;
+}
+
+
 void IfxCan_Can_initMessage(IfxCan_Message *message)
 {
     const IfxCan_Message defaultMessage = {
@@ -866,6 +994,77 @@ void IfxCan_Can_readMessage(IfxCan_Can_Node *node, IfxCan_Message *message, uint
 }
 
 
+uint8 IfxCan_Can_readMessages(IfxCan_Can_Node *node, IfxCan_RxFifo rxFifo, IfxCan_Message *messages, uint32 data[][IFXCAN_CAN_MESSAGE_DATA_WORDS], uint8 maxMessages)
+{
+    uint8             count;
+    uint8             fillLevel;
+    uint8             fifoSize;
+    IfxCan_RxBufferId getIndex;
+    IfxCan_RxBufferId bufferId = IfxCan_RxBufferId_0;
+    Ifx_CAN_RXMSG    *rxBufferElement;
+
+    /* take a single snapshot of the FIFO state */
+    if (rxFifo == IfxCan_RxFifo_0)
+    {
+        fillLevel = IfxCan_Node_getRxFifo0FillLevel(node->node);
+        getIndex  = IfxCan_Node_getRxFifo0GetIndex(node->node);
+        fifoSize  = IfxCan_Node_getRxFifo0Size(node->node);
+    }
+    else
+    {
+        fillLevel = IfxCan_Node_getRxFifo1FillLevel(node->node);
+        getIndex  = IfxCan_Node_getRxFifo1GetIndex(node->node);
+        fifoSize  = IfxCan_Node_getRxFifo1Size(node->node);
+    }
+
+    if (fillLevel > maxMessages)
+    {
+        fillLevel = maxMessages;
+    }
+
+    for (count = 0; count < fillLevel; count++)
+    {
+        /* elements are stored consecutively from the get index, wrapping at the FIFO size */
+        bufferId = (IfxCan_RxBufferId)((getIndex + count) % fifoSize);
+
+        if (rxFifo == IfxCan_RxFifo_0)
+        {
+            rxBufferElement = IfxCan_Node_getRxFifo0ElementAddress(node->node, node->messageRAM.baseAddress, node->messageRAM.rxFifo0StartAddress, bufferId);
+        }
+        else
+        {
+            rxBufferElement = IfxCan_Node_getRxFifo1ElementAddress(node->node, node->messageRAM.baseAddress, node->messageRAM.rxFifo1StartAddress, bufferId);
+        }
+
+        messages[count].messageId       = IfxCan_Node_getMesssageId(rxBufferElement);
+        messages[count].messageIdLength = (IfxCan_MessageIdLength)rxBufferElement->R0.B.XTD;
+        messages[count].dataLengthCode  = (IfxCan_DataLengthCode)IfxCan_Node_getDataLengthCode(rxBufferElement);
+        messages[count].frameMode       = IfxCan_Node_getFrameMode(rxBufferElement);
+        messages[count].bufferNumber    = bufferId;
+        messages[count].readFromRxFifo0 = (rxFifo == IfxCan_RxFifo_0) ? TRUE : FALSE;
+        messages[count].readFromRxFifo1 = (rxFifo == IfxCan_RxFifo_1) ? TRUE : FALSE;
+
+        /* read data */
+        IfxCan_Node_readData(rxBufferElement, messages[count].dataLengthCode, data[count]);
+    }
+
+    /* acknowledging the last element releases all elements read before it */
+    if (count > 0)
+    {
+        if (rxFifo == IfxCan_RxFifo_0)
+        {
+            IfxCan_Node_setRxFifo0AcknowledgeIndex(node->node, bufferId);
+        }
+        else
+        {
+            IfxCan_Node_setRxFifo1AcknowledgeIndex(node->node, bufferId);
+        }
+    }
+
+    return count;
+}
+
+
 IfxCan_Status IfxCan_Can_sendMessage(IfxCan_Can_Node *node, IfxCan_Message *message, uint32 *data)
 {
     IfxCan_Status     status   = IfxCan_Status_ok;
@@ -926,6 +1125,71 @@ IfxCan_Status IfxCan_Can_sendMessage(IfxCan_Can_Node *node, IfxCan_Message *mess
 }
 
 
+uint8 IfxCan_Can_sendMessages(IfxCan_Can_Node *node, IfxCan_Message *messages, uint32 data[][IFXCAN_CAN_MESSAGE_DATA_WORDS], uint8 count)
+{
+    uint8             accepted;
+    uint32            addRequestMask = 0;
+    IfxCan_TxBufferId bufferId;
+    Ifx_CAN_TXMSG    *txBufferElement;
+    IfxCan_Message   *message;
+    uint8             freeSlots      = IfxCan_Can_getTxFifoQueueFreeSlots(node, &bufferId);
+
+    if (count > freeSlots)
+    {
+        count = freeSlots;
+    }
+
+    for (accepted = 0; accepted < count; accepted++)
+    {
+        message         = &messages[accepted];
+        txBufferElement = IfxCan_Node_getTxBufferElementAddress(node->node, node->messageRAM.baseAddress, node->messageRAM.txBuffersStartAddress, bufferId);
+
+        /* start from clean header words, the slot may hold an older frame */
+        txBufferElement->T0.U = 0;
+        txBufferElement->T1.U = 0;
+
+        /*set message Id (ID and XTD) */
+        IfxCan_Node_setMsgId(txBufferElement, message->messageId, message->messageIdLength);
+
+        /* set TX FIFO Event control (EFC) and Message Marker (MM) if Tx Event Fifo is chosen */
+        if (message->txEventFifoControl == TRUE)
+        {
+            IfxCan_Node_setTxEventFifoCtrl(txBufferElement, message->txEventFifoControl);
+            IfxCan_Node_setMessageMarker(txBufferElement, bufferId);
+        }
+
+        /* set Remote Transmit request if selected (RTR)*/
+        IfxCan_Node_setRemoteTransmitReq(txBufferElement, message->remoteTransmitRequest);
+
+        /* set Error State Indicator if selected (ESI)*/
+        if ((message->frameMode == IfxCan_FrameMode_fdLong) || (message->frameMode == IfxCan_FrameMode_fdLongAndFast))
+        {
+            IfxCan_Node_setErrStateIndicator(txBufferElement, message->errorStateIndicator);
+        }
+
+        /* set data length code (DLC) */
+        IfxCan_Node_setDataLength(txBufferElement, message->dataLengthCode);
+
+        /* write data (DBx) */
+        IfxCan_Node_writeTxBufData(txBufferElement, message->dataLengthCode, data[accepted]);
+
+        /* set CAN frame mode request (FDF and BRS) */
+        IfxCan_Node_setFrameModeReq(txBufferElement, message->frameMode);
+
+        addRequestMask |= (1U << bufferId);
+        bufferId        = IfxCan_Can_getNextTxFifoSlot(node, bufferId);
+    }
+
+    /*set transmit requests of all written messages at once */
+    if (addRequestMask != 0)
+    {
+        IfxCan_Node_setTxBufferAddRequestMask(node->node, addRequestMask);
+    }
+
+    return accepted;
+}
+
+
 void IfxCan_Can_setExtendedFilter(IfxCan_Can_Node *node, IfxCan_Filter *filter)
 {
     /* get the Extended filter element address */
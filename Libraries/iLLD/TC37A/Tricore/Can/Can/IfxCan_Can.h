@@ -557,6 +557,18 @@
 #include "Can/Std/IfxCan.h"
 #include "Scu/Std/IfxScuWdt.h"
 
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Message ID value to keep the ID of the received frame in IfxCan_Can_forwardMessage()
+ */
+#define IFXCAN_CAN_MESSAGE_ID_UNCHANGED (0xFFFFFFFFU)
+
+/** \brief Number of data words reserved per message in IfxCan_Can_readMessages() (64 byte CAN FD payload)
+ */
+#define IFXCAN_CAN_MESSAGE_DATA_WORDS   (16)
+
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
 /******************************************************************************/
@@ -832,6 +844,42 @@ IFX_INLINE boolean IfxCan_Can_isTxFifoQueueFull(IfxCan_Can_Node *node);
  */
 IFX_EXTERN void IfxCan_Can_initMessage(IfxCan_Message *message);
 
+/** \brief Forwards a received frame element into the Tx FIFO/Queue of a node without unpacking it
+ * The header words and the data section of the Rx element are copied as they are, the ID is only rewritten when
+ * messageId differs from IFXCAN_CAN_MESSAGE_ID_UNCHANGED (the ID length of the received frame is kept).
+ * The Rx element is not acknowledged, this is left to the caller so that several elements can be released at once.
+ * \param node CAN Node handle of the transmitting node
+ * \param rxBufferElement Rx Buffer / Rx FIFO Element of the received frame
+ * \param messageId New message ID or IFXCAN_CAN_MESSAGE_ID_UNCHANGED
+ * \return IfxCan_Status_ok if the frame was queued, IfxCan_Status_notSentBusy if the Tx FIFO/Queue is full
+ *
+ * Usage example:
+ * \code
+ *     Ifx_CAN_RXMSG    *element;
+ *     IfxCan_RxBufferId getIndex = IfxCan_Node_getRxFifo0GetIndex(srcNode.node);
+ *
+ *     element = IfxCan_Node_getRxFifo0ElementAddress(srcNode.node, srcNode.messageRAM.baseAddress, srcNode.messageRAM.rxFifo0StartAddress, getIndex);
+ *     IfxCan_Can_forwardMessage(&dstNode, element, IFXCAN_CAN_MESSAGE_ID_UNCHANGED);
+ *     IfxCan_Node_setRxFifo0AcknowledgeIndex(srcNode.node, getIndex);
+ * \endcode
+ *
+ */
+IFX_EXTERN IfxCan_Status IfxCan_Can_forwardMessage(IfxCan_Can_Node *node, Ifx_CAN_RXMSG *rxBufferElement, uint32 messageId);
+
+/** \brief Forwards several received frame elements into the Tx FIFO of a node with a single Tx buffer add request write
+ * Like IfxCan_Can_forwardMessage(); the elements are copied into consecutive Tx FIFO put slots and all of them are
+ * requested for transmission at once. Elements which do not fit into the Tx FIFO are not copied.
+ * The put index and free level are sampled without protection: calls for the same node must be serialized by the
+ * caller (e.g. not issued from interrupts which can preempt each other).
+ * \param node CAN Node handle of the transmitting node
+ * \param rxBufferElements Array of Rx Buffer / Rx FIFO Element pointers, in transmission order
+ * \param messageIds Array of new message IDs (or IFXCAN_CAN_MESSAGE_ID_UNCHANGED) per element, NULL_PTR keeps all IDs
+ * \param count Number of elements
+ * \return Number of elements accepted (the first n of the array)
+ *
+ */
+IFX_EXTERN uint8 IfxCan_Can_forwardMessages(IfxCan_Can_Node *node, Ifx_CAN_RXMSG **rxBufferElements, const uint32 *messageIds, uint8 count);
+
 /** \brief Reads the CAN received message
  * \param node CAN Node handle
  * \param message Structure for Message configuration filled with dummy values and will be relpaced by read values. see IfxCan_Can_initMessage
@@ -843,6 +891,26 @@ IFX_EXTERN void IfxCan_Can_initMessage(IfxCan_Message *message);
  */
 IFX_EXTERN void IfxCan_Can_readMessage(IfxCan_Can_Node *node, IfxCan_Message *message, uint32 *data);
 
+/** \brief Reads all CAN messages available in an Rx FIFO (up to maxMessages)
+ * The fill level and get index are read once, the elements are copied in FIFO order and only the index of the last
+ * copied element is acknowledged, which releases all copied elements with a single register write.
+ * \param node CAN Node handle
+ * \param rxFifo Rx FIFO to be read
+ * \param messages Array of at least maxMessages message structures, filled with the read values
+ * \param data Array of at least maxMessages data buffers (in words)
+ * \param maxMessages Maximum number of messages to be read
+ * \return Number of messages read
+ *
+ * Usage example:
+ * \code
+ *     IfxCan_Message messages[8];
+ *     uint32         data[8][IFXCAN_CAN_MESSAGE_DATA_WORDS];
+ *     uint8          count = IfxCan_Can_readMessages(&canNode, IfxCan_RxFifo_0, messages, data, 8);
+ * \endcode
+ *
+ */
+IFX_EXTERN uint8 IfxCan_Can_readMessages(IfxCan_Can_Node *node, IfxCan_RxFifo rxFifo, IfxCan_Message *messages, uint32 data[][IFXCAN_CAN_MESSAGE_DATA_WORDS], uint8 maxMessages);
+
 /** \brief Transmits the CAN message
  * \param node CAN Node handle
  * \param message Structure for Message configuration. see IfxCan_Can_initMessage
@@ -854,6 +922,30 @@ IFX_EXTERN void IfxCan_Can_readMessage(IfxCan_Can_Node *node, IfxCan_Message *me
  */
 IFX_EXTERN IfxCan_Status IfxCan_Can_sendMessage(IfxCan_Can_Node *node, IfxCan_Message *message, uint32 *data);
 
+/** \brief Transmits several CAN messages through the Tx FIFO/Queue with a single Tx buffer add request write
+ * The messages are written into consecutive Tx FIFO put slots (storeInTxFifoQueue and bufferNumber are ignored) and
+ * all of them are requested for transmission at once. In Tx Queue mode only one message is accepted per call.
+ * The put index and free level are sampled without protection: calls for the same node must be serialized by the
+ * caller (e.g. not issued from interrupts which can preempt each other).
+ * \param node CAN Node handle
+ * \param messages Array of message structures, in transmission order. see IfxCan_Can_initMessage
+ * \param data Array of data buffers (in words), one per message
+ * \param count Number of messages
+ * \return Number of messages accepted (the first n of the array), less than count if the Tx FIFO is full
+ *
+ * Usage example:
+ * \code
+ *     uint8 sent = IfxCan_Can_sendMessages(&canNode, messages, data, count);
+ *
+ *     if (sent < count)
+ *     {
+ *         // Tx FIFO full: retry messages[sent] .. messages[count - 1] later
+ *     }
+ * \endcode
+ *
+ */
+IFX_EXTERN uint8 IfxCan_Can_sendMessages(IfxCan_Can_Node *node, IfxCan_Message *messages, uint32 data[][IFXCAN_CAN_MESSAGE_DATA_WORDS], uint8 count);
+
 /** \} */
 
 /** \addtogroup IfxLld_Can_Can_Filter_Configuration_Functions
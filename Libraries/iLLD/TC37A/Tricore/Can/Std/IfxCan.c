@@ -70,6 +70,31 @@ void IfxCan_Node_clearRxBufferNewDataFlag(Ifx_CAN_N *node, IfxCan_RxBufferId rxB
 }
 
 
+void IfxCan_Node_copyRxElementToTxElement(Ifx_CAN_RXMSG *rxBufferElement, Ifx_CAN_TXMSG *txBufferElement)
+{
+    uint32  i;
+    uint32 *sourceAddress      = (uint32 *)rxBufferElement + 2;
+    uint32 *destinationAddress = (uint32 *)txBufferElement + 2;
+    uint32  r1                 = rxBufferElement->R1.U;
+    /* get number of data words from data length code (DLC) */
+    uint32  length             = IfxCan_Node_getDataLength((IfxCan_DataLengthCode)((r1 >> IFX_CAN_R1_DLC_OFF) & IFX_CAN_R1_DLC_MSK));
+
+    /* T0 has the same layout as R0 (ID, RTR, XTD, ESI) */
+    txBufferElement->T0.U = rxBufferElement->R0.U;
+
+    /* take over DLC, BRS and FDF only, Rx timestamp / filter index must not end up in EFC and MM */
+    txBufferElement->T1.U = r1 & ((IFX_CAN_R1_DLC_MSK << IFX_CAN_R1_DLC_OFF) |
+                                  (IFX_CAN_R1_BRS_MSK << IFX_CAN_R1_BRS_OFF) |
+                                  (IFX_CAN_R1_FDF_MSK << IFX_CAN_R1_FDF_OFF));
+
+    /* copy the data section of the Rx element into the data section of the Tx element */
+    for (i = 0; i < length; i++)
+    {
+        destinationAddress[i] = sourceAddress[i];
+    }
+}
+
+
 uint32 IfxCan_Node_getDataLength(IfxCan_DataLengthCode dataLengthCode)
 {
     uint32 numBytes;
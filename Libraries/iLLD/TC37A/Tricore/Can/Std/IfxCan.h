@@ -379,6 +379,14 @@ typedef enum
     IfxCan_RxBufferId_63     /**< \brief Rx buffer 63  */
 } IfxCan_RxBufferId;
 
+/** \brief Rx FIFO selection
+ */
+typedef enum
+{
+    IfxCan_RxFifo_0,  /**< \brief Rx FIFO 0 */
+    IfxCan_RxFifo_1   /**< \brief Rx FIFO 1 */
+} IfxCan_RxFifo;
+
 /** \brief Rx FIFO 0/1 operating mode\n
  * Description in Ifx_CAN.N[x].RXFyC.FyOM, (x= 0 to 3; y = 0, 1)
  */
@@ -805,6 +813,30 @@ IFX_EXTERN uint32 IfxCan_Node_getDataLengthInBytes(IfxCan_DataLengthCode dataLen
  */
 IFX_INLINE IfxCan_TxBufferId IfxCan_Node_getTxFifoQueuePutIndex(Ifx_CAN_N *node);
 
+/** \brief Returns the number of dedicated Tx buffers
+ * \param node Specifies the pointer to the CAN Node registers
+ * \return Number of dedicated Tx buffers
+ */
+IFX_INLINE uint8 IfxCan_Node_getDedicatedTxBuffersNumber(Ifx_CAN_N *node);
+
+/** \brief Returns Tx FIFO Free Level (number of consecutive free Tx FIFO elements, valid in Tx FIFO mode only)
+ * \param node Specifies the pointer to the CAN Node registers
+ * \return Free level
+ */
+IFX_INLINE uint8 IfxCan_Node_getTxFifoFreeLevel(Ifx_CAN_N *node);
+
+/** \brief Returns Tx FIFO/Queue Size
+ * \param node Specifies the pointer to the CAN Node registers
+ * \return Number of Tx FIFO/Queue elements
+ */
+IFX_INLINE uint8 IfxCan_Node_getTxFifoQueueSize(Ifx_CAN_N *node);
+
+/** \brief Returns whether the Tx FIFO/Queue is operated in Tx Queue mode
+ * \param node Specifies the pointer to the CAN Node registers
+ * \return TRUE: Tx Queue mode, FALSE: Tx FIFO mode
+ */
+IFX_INLINE boolean IfxCan_Node_isTxQueueMode(Ifx_CAN_N *node);
+
 /** \brief Returns the status of whether cancellation is finished on the selected Tx buffer
  * \param node Specifies the pointer to the CAN Node registers
  * \param txBufferId Tx Buffer number
@@ -826,6 +858,18 @@ IFX_INLINE boolean IfxCan_Node_isTxBufferRequestPending(Ifx_CAN_N *node, IfxCan_
  */
 IFX_INLINE boolean IfxCan_Node_isTxBufferTransmissionOccured(Ifx_CAN_N *node, IfxCan_TxBufferId txBufferId);
 
+/** \brief Returns the pending requests of all Tx buffers
+ * \param node Specifies the pointer to the CAN Node registers
+ * \return Bit mask of the Tx buffers with a pending transmission request (bit n = Tx buffer n)
+ */
+IFX_INLINE uint32 IfxCan_Node_getTxBufferRequestPendingMask(Ifx_CAN_N *node);
+
+/** \brief Returns the transmission occurred status of all Tx buffers
+ * \param node Specifies the pointer to the CAN Node registers
+ * \return Bit mask of the Tx buffers whose last requested transmission occurred (bit n = Tx buffer n)
+ */
+IFX_INLINE uint32 IfxCan_Node_getTxBufferTransmissionOccurredMask(Ifx_CAN_N *node);
+
 /** \brief Returns the status of Tx Fifo/Queue is full or not
  * \param node Specifies the pointer to the CAN Node registers
  * \return Status
@@ -940,6 +984,13 @@ IFX_INLINE void IfxCan_Node_setTransmitFifoQueueSize(Ifx_CAN_N *node, uint8 numb
  */
 IFX_INLINE void IfxCan_Node_setTxBufferAddRequest(Ifx_CAN_N *node, IfxCan_TxBufferId txBufferId);
 
+/** \brief Sets the Add Requests of several Tx buffers with one register write
+ * \param node Specifies the pointer to the CAN Node registers
+ * \param txBufferMask Bit mask of the Tx buffers (bit n = Tx buffer n)
+ * \return None
+ */
+IFX_INLINE void IfxCan_Node_setTxBufferAddRequestMask(Ifx_CAN_N *node, uint32 txBufferMask);
+
 /** \brief Sets the Cancellation Request for the selected Tx buffer
  * \param node Specifies the pointer to the CAN Node registers
  * \param txBufferId Tx Buffer number
@@ -947,6 +998,13 @@ IFX_INLINE void IfxCan_Node_setTxBufferAddRequest(Ifx_CAN_N *node, IfxCan_TxBuff
  */
 IFX_INLINE void IfxCan_Node_setTxBufferCancellationRequest(Ifx_CAN_N *node, IfxCan_TxBufferId txBufferId);
 
+/** \brief Sets the Cancellation Requests of several Tx buffers with one register write
+ * \param node Specifies the pointer to the CAN Node registers
+ * \param txBufferMask Bit mask of the Tx buffers (bit n = Tx buffer n)
+ * \return None
+ */
+IFX_INLINE void IfxCan_Node_setTxBufferCancellationRequestMask(Ifx_CAN_N *node, uint32 txBufferMask);
+
 /** \brief Sets Tx Buffer Data Field Size
  * \param node Specifies the pointer to the CAN Node registers
  * \param size Tx Buffer Data Field Size
@@ -1047,6 +1105,12 @@ IFX_INLINE uint8 IfxCan_Node_getRxFifo0FillLevel(Ifx_CAN_N *node);
  */
 IFX_INLINE IfxCan_RxBufferId IfxCan_Node_getRxFifo0GetIndex(Ifx_CAN_N *node);
 
+/** \brief Returns Rx FIFO 0 Size
+ * \param node Specifies the pointer to the CAN Node registers
+ * \return Number of Rx FIFO 0 elements
+ */
+IFX_INLINE uint8 IfxCan_Node_getRxFifo0Size(Ifx_CAN_N *node);
+
 /** \brief Returns Rx FIFO 1 Fill Level
  * \param node Specifies the pointer to the CAN Node registers
  * \return Fill level
@@ -1059,6 +1123,12 @@ IFX_INLINE uint8 IfxCan_Node_getRxFifo1FillLevel(Ifx_CAN_N *node);
  */
 IFX_INLINE IfxCan_RxBufferId IfxCan_Node_getRxFifo1GetIndex(Ifx_CAN_N *node);
 
+/** \brief Returns Rx FIFO 1 Size
+ * \param node Specifies the pointer to the CAN Node registers
+ * \return Number of Rx FIFO 1 elements
+ */
+IFX_INLINE uint8 IfxCan_Node_getRxFifo1Size(Ifx_CAN_N *node);
+
 /** \brief Sets Rx Buffer Data Field Size
  * \param node Specifies the pointer to the CAN Node registers
  * \param size Rx Buffer Data Field Size
@@ -1168,6 +1238,14 @@ IFX_INLINE void IfxCan_Node_setRxFifo1WatermarkLevel(Ifx_CAN_N *node, uint8 leve
  */
 IFX_EXTERN void IfxCan_Node_clearRxBufferNewDataFlag(Ifx_CAN_N *node, IfxCan_RxBufferId rxBufferId);
 
+/** \brief Copies a received frame element into a Tx buffer element without unpacking it.
+ * Header words (ID, RTR, XTD, ESI, DLC, BRS, FDF) and the data section are taken over as they are; EFC and MM are cleared.
+ * \param rxBufferElement Rx Buffer / Rx FIFO Element
+ * \param txBufferElement Tx Buffer / Tx FIFO Element
+ * \return None
+ */
+IFX_EXTERN void IfxCan_Node_copyRxElementToTxElement(Ifx_CAN_RXMSG *rxBufferElement, Ifx_CAN_TXMSG *txBufferElement);
+
 /** \brief Returns Rx Buffer Data Field Size in bytes
  * \param node Specifies the pointer to the CAN Node registers
  * \return Data field size
@@ -1967,6 +2045,12 @@ IFX_INLINE IfxCan_RxBufferId IfxCan_Node_getRxFifo0GetIndex(Ifx_CAN_N *node)
 }
 
 
+IFX_INLINE uint8 IfxCan_Node_getRxFifo0Size(Ifx_CAN_N *node)
+{
+    return node->RX.F0C.B.F0S;
+}
+
+
 IFX_INLINE uint8 IfxCan_Node_getRxFifo1FillLevel(Ifx_CAN_N *node)
 {
     return node->RX.F1S.B.F1FL;
@@ -1979,6 +2063,12 @@ IFX_INLINE IfxCan_RxBufferId IfxCan_Node_getRxFifo1GetIndex(Ifx_CAN_N *node)
 }
 
 
+IFX_INLINE uint8 IfxCan_Node_getRxFifo1Size(Ifx_CAN_N *node)
+{
+    return node->RX.F1C.B.F1S;
+}
+
+
 IFX_INLINE uint16 IfxCan_Node_getTXTSFromTxEventFifo(Ifx_CAN_TXEVENT *txEventFifoElement)
 {
     return (uint16)txEventFifoElement->E1.B.TXTS;
@@ -2027,12 +2117,36 @@ IFX_INLINE uint8 IfxCan_Node_getTxEventFifoWatermarkLevel(Ifx_CAN_N *node)
 }
 
 
+IFX_INLINE uint8 IfxCan_Node_getDedicatedTxBuffersNumber(Ifx_CAN_N *node)
+{
+    return node->TX.BC.B.NDTB;
+}
+
+
+IFX_INLINE uint8 IfxCan_Node_getTxFifoFreeLevel(Ifx_CAN_N *node)
+{
+    return node->TX.FQS.B.TFFL;
+}
+
+
 IFX_INLINE IfxCan_TxBufferId IfxCan_Node_getTxFifoQueuePutIndex(Ifx_CAN_N *node)
 {
     return (IfxCan_TxBufferId)node->TX.FQS.B.TFQPI;
 }
 
 
+IFX_INLINE uint8 IfxCan_Node_getTxFifoQueueSize(Ifx_CAN_N *node)
+{
+    return node->TX.BC.B.TFQS;
+}
+
+
+IFX_INLINE boolean IfxCan_Node_isTxQueueMode(Ifx_CAN_N *node)
+{
+    return node->TX.BC.B.TFQM;
+}
+
+
 IFX_INLINE boolean IfxCan_Node_isNodeSynchronized(Ifx_CAN_N *node)
 {
     return (boolean)((node->PSR.B.ACT != 0) ? 1 : 0);
@@ -2062,6 +2176,18 @@ IFX_INLINE boolean IfxCan_Node_isTxBufferTransmissionOccured(Ifx_CAN_N *node, If
 }
 
 
+IFX_INLINE uint32 IfxCan_Node_getTxBufferRequestPendingMask(Ifx_CAN_N *node)
+{
+    return node->TX.BRP.U;
+}
+
+
+IFX_INLINE uint32 IfxCan_Node_getTxBufferTransmissionOccurredMask(Ifx_CAN_N *node)
+{
+    return node->TX.BTO.U;
+}
+
+
 IFX_INLINE boolean IfxCan_Node_isTxEventFifoElementLost(Ifx_CAN_N *node)
 {
     return node->TX.EFS.B.TEFL;
@@ -2377,6 +2503,13 @@ IFX_INLINE void IfxCan_Node_setTxBufferAddRequest(Ifx_CAN_N *node, IfxCan_TxBuff
 }
 
 
+IFX_INLINE void IfxCan_Node_setTxBufferAddRequestMask(Ifx_CAN_N *node, uint32 txBufferMask)
+{
+    /* writing 0 to a TXBAR bit has no effect, no read-modify-write required */
+    node->TX.BAR.U = txBufferMask;
+}
+
+
 IFX_INLINE void IfxCan_Node_setTxBufferCancellationRequest(Ifx_CAN_N *node, IfxCan_TxBufferId txBufferId)
 {
     uint32 mask = (1U << txBufferId);
@@ -2384,6 +2517,13 @@ IFX_INLINE void IfxCan_Node_setTxBufferCancellationRequest(Ifx_CAN_N *node, IfxC
 }
 
 
+IFX_INLINE void IfxCan_Node_setTxBufferCancellationRequestMask(Ifx_CAN_N *node, uint32 txBufferMask)
+{
+    /* writing 0 to a TXBCR bit has no effect, no read-modify-write required */
+    node->TX.BCR.U = txBufferMask;
+}
+
+
 IFX_INLINE void IfxCan_Node_setTxBufferDataFieldSize(Ifx_CAN_N *node, IfxCan_DataFieldSize size)
 {
     node->TX.ESC.B.TBDS = size;
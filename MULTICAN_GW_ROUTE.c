@@ -0,0 +1,314 @@
+/********************************************************************************************************************
+ * \file MULTICAN_GW_ROUTE.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "MULTICAN_GW_ROUTE.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+/** \brief Routing table.
+ *
+ *  Per-ID routes override the pair of a received frame (destination node, ID rewrite, handler). The lists below are
+ *  expanded at compile time into constant lookup structures, no table is built or searched linearly at runtime:
+ *    - standard IDs: dense [srcNode][11-bit ID] route index table, one indexed load per frame
+ *    - extended IDs: key array sorted by (srcNode, 29-bit ID), binary search per frame
+ *
+ *  Entry: GW_xxx_ROUTE(srcNode, canId, dstNodeMask, newId, handler, transform)
+ *    - srcNode, canId:  plain literals (they also build the route names, so a duplicate route does not compile)
+ *    - dstNodeMask:     GW_NODE(n) bits of the nodes to forward to, GW_NO_DST for handler-only routes
+ *    - newId:           CAN ID on the destination node, GW_ID_UNCHANGED to keep the received ID
+ *    - handler:         gwRouteHandler called in the ISR before forwarding, NULL_PTR if none
+ *    - transform:       GW_XF_xxx() operation list applied to the frame before forwarding, NULL_PTR if none
+ *
+ *  The ID rewrite (newId) costs a single header store while the frame is copied to the frame pool, a transform is only
+ *  interpreted for routes which have one.
+ *
+ *  Note:
+ *    - Extended routes must be listed in ascending (srcNode, canId) order, canGatewayCheckRoutes() asserts this.
+ *    - Frames only reach the routing table if they are received: filtered (gwPairs) or accepted as non-matching
+ *      frames into Rx FIFO 1. Frames without a route follow their pair or the catch-all pair of the node.
+ *    - GW_ROUTE_TABLE_FILE, if defined, names a file that replaces both lists and the transforms they reference (the
+ *      host tests build the module with a generated table of several hundred routes).
+ */
+#ifdef GW_ROUTE_TABLE_FILE
+#include GW_ROUTE_TABLE_FILE
+#else
+#define GW_STD_ROUTE_TABLE(GW_STD_ROUTE)                                                                               \
+    GW_STD_ROUTE(0, 0x101, GW_NODE(1),              0x181,           NULL_PTR, NULL_PTR)      /* as 0x181           */ \
+    GW_STD_ROUTE(2, 0x202, GW_NODE(1) | GW_NODE(3), GW_ID_UNCHANGED, NULL_PTR, g_gwXfFdFrame) /* -> N1 and N3, FD   */
+
+#define GW_EXT_ROUTE_TABLE(GW_EXT_ROUTE)                                                                               \
+    GW_EXT_ROUTE(4, 0x18FEF100, GW_NODE(5), GW_ID_UNCHANGED, NULL_PTR, NULL_PTR) /* CAN1.N0 -> N1, catch-all frame */
+
+/* Route transforms referenced by the routing table */
+static const gwTransformOpType g_gwXfFdFrame[] = {  /* classic 8 byte frame -> CAN FD 12 byte frame with BRS       */
+    GW_XF_TO_FD(1),
+    GW_XF_DLC(9),                                   /* 12 data bytes                                                */
+    GW_XF_COPY(4, 0, 8),                            /* received bytes 0..7 -> bytes 4..11                           */
+    GW_XF_FILL(0, 4, 0x00),                         /* bytes 0..3: gateway header, cleared                          */
+    GW_XF_END()
+};
+#endif /* GW_ROUTE_TABLE_FILE */
+
+/* Route indices: standard routes first, extended routes follow */
+#define GW_STD_ROUTE_INDEX(src, id, dst, newId, handler, xf)    GW_STD_ROUTE_IDX_##src##_##id,
+#define GW_EXT_ROUTE_INDEX(src, id, dst, newId, handler, xf)    GW_EXT_ROUTE_IDX_##src##_##id,
+#define GW_ROUTE_ENTRY(src, id, dst, newId, handler, xf)        {src, dst, id, newId, handler, xf},
+#define GW_STD_ROUTE_SLOT(src, id, dst, newId, handler, xf)     [src][id] = GW_STD_ROUTE_IDX_##src##_##id + 1,
+#define GW_EXT_ROUTE_KEY(src, id, dst, newId, handler, xf)      ((uint32)(src) << 29) | (uint32)(id),
+
+enum
+{
+    GW_STD_ROUTE_TABLE(GW_STD_ROUTE_INDEX)
+    GW_NUM_STD_ROUTES
+};
+
+enum
+{
+    GW_EXT_ROUTE_TABLE(GW_EXT_ROUTE_INDEX)
+    GW_NUM_EXT_ROUTES
+};
+
+/* All routes, standard then extended (one spare entry keeps the array non-empty without routes) */
+static const gwRouteType g_gwRoutes[GW_NUM_STD_ROUTES + GW_NUM_EXT_ROUTES + 1] = {
+    GW_STD_ROUTE_TABLE(GW_ROUTE_ENTRY)
+    GW_EXT_ROUTE_TABLE(GW_ROUTE_ENTRY)
+    {GW_NO_NODE, GW_NO_DST, 0, GW_ID_UNCHANGED, NULL_PTR, NULL_PTR}
+};
+
+/* Dense standard ID route table: route index + 1, 0 = no route (all IDs not listed are zero initialized) */
+static const uint16 g_gwStdRouteIndex[NUMBER_OF_CAN_NODES][GW_STD_ID_COUNT] = {
+    GW_STD_ROUTE_TABLE(GW_STD_ROUTE_SLOT)
+};
+
+/* Extended ID route keys (srcNode << 29 | ID), ascending; key i belongs to route GW_NUM_STD_ROUTES + i */
+static const uint32 g_gwExtRouteKey[GW_NUM_EXT_ROUTES + 1] = {
+    GW_EXT_ROUTE_TABLE(GW_EXT_ROUTE_KEY)
+    0xFFFFFFFFU
+};
+
+/* Data bytes per DLC code, classic and CAN FD */
+static const uint8 g_gwDlcLength[GW_DLC_MAX + 1] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Map a received CAN ID of a source node to its route in constant time (standard IDs) or by binary search over the
+ * sorted extended route keys. Returns NULL_PTR if the ID has no route.
+ */
+const gwRouteType *canGatewayLookupRoute(uint8 srcNode, boolean extended, uint32 canId)
+{
+    const gwRouteType *route = NULL_PTR;
+
+    if (extended == FALSE)
+    {
+        uint16 routeIdx = g_gwStdRouteIndex[srcNode][canId & (GW_STD_ID_COUNT - 1)];
+
+        if (routeIdx != 0)
+        {
+            route = &g_gwRoutes[routeIdx - 1];
+        }
+    }
+    else
+    {
+        uint32 key  = ((uint32)srcNode << 29) | (canId & 0x1FFFFFFFU);
+        sint32 low  = 0;
+        sint32 high = (sint32)GW_NUM_EXT_ROUTES - 1;
+
+        while (low <= high)
+        {
+            sint32 mid = (low + high) / 2;
+
+            if (g_gwExtRouteKey[mid] == key)
+            {
+                route = &g_gwRoutes[GW_NUM_STD_ROUTES + mid];
+                break;
+            }
+            else if (g_gwExtRouteKey[mid] < key)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid - 1;
+            }
+        }
+    }
+
+    return route;
+}
+
+/* Data field words the payload operations from op on read or write */
+static uint32 gwTransformSpan(const gwTransformOpType *op)
+{
+    uint32 end = 0;
+    uint32 opEnd;
+
+    for ( ; op->code != GW_XF_OP_END; op++)
+    {
+        if (op->code == GW_XF_OP_COPY)
+        {
+            opEnd = ((uint32)op->arg0 > (uint32)op->arg1) ? (uint32)op->arg0 : (uint32)op->arg1;
+            opEnd = opEnd + op->arg2;
+        }
+        else if (op->code == GW_XF_OP_FILL)
+        {
+            opEnd = (uint32)op->arg0 + op->arg1;
+        }
+        else
+        {
+            opEnd = 0;
+        }
+
+        end = (opEnd > end) ? opEnd : end;
+    }
+
+    return (end + 3) / 4;
+}
+
+/* Apply a route transform to a received element in place, before it is copied to the destination egress queues.
+ * Header operations change DLC / FDF / BRS in R1, which the raw copy takes over into T1. Payload operations work on
+ * a copy of the data field: COPY reads the bytes as received, so operations of one transform never see each other's
+ * results and can reorder bytes freely; the result is written back once at the end. Only the words up to the last
+ * byte an operation reads or writes are copied (gwTransformSpan()), the rest of the data field is left as it is.
+ * Bytes behind the received DLC read as 0: message RAM there still holds an earlier frame.
+ * The element may be modified as it belongs to the software until the batch acknowledge of gwDrainRxFifo().
+ */
+void canGatewayApplyTransform(Ifx_CAN_RXMSG *element, const gwTransformOpType *op)
+{
+    uint32  rxData[(GW_DATA_FIELD_SIZE / 4)];
+    uint32  txData[(GW_DATA_FIELD_SIZE / 4)];
+    uint8  *rxBytes       = (uint8 *)rxData;
+    uint8  *txBytes       = (uint8 *)txData;
+    uint32 *payload       = (uint32 *)element + 2;
+    uint32  rxLength      = g_gwDlcLength[element->R1.B.DLC];
+    uint32  words         = 0;
+    boolean payloadLoaded = FALSE;
+    uint32  i;
+
+    for ( ; op->code != GW_XF_OP_END; op++)
+    {
+        if ((op->code >= GW_XF_OP_COPY) && (payloadLoaded == FALSE))
+        {
+            words = gwTransformSpan(op);
+
+            for (i = 0; i < words; i++)
+            {
+                rxData[i] = payload[i];
+            }
+
+            for (i = rxLength; i < (words * 4); i++)
+            {
+                rxBytes[i] = 0;
+            }
+
+            for (i = 0; i < words; i++)
+            {
+                txData[i] = rxData[i];
+            }
+
+            payloadLoaded = TRUE;
+        }
+
+        switch ((gwTransformOpCode)op->code)
+        {
+        case GW_XF_OP_DLC:
+            element->R1.B.DLC = op->arg0;
+            break;
+        case GW_XF_OP_TO_FD:
+            element->R1.B.FDF = 1;
+            element->R1.B.BRS = op->arg0;
+            break;
+        case GW_XF_OP_TO_CLASSIC:
+            element->R1.B.FDF = 0;
+            element->R1.B.BRS = 0;
+
+            if (element->R1.B.DLC > GW_DLC_CLASSIC_MAX)
+            {
+                element->R1.B.DLC = GW_DLC_CLASSIC_MAX;
+            }
+
+            break;
+        case GW_XF_OP_COPY:
+            for (i = 0; i < op->arg2; i++)
+            {
+                txBytes[op->arg0 + i] = rxBytes[op->arg1 + i];
+            }
+
+            break;
+        case GW_XF_OP_FILL:
+            for (i = 0; i < op->arg1; i++)
+            {
+                txBytes[op->arg0 + i] = op->arg2;
+            }
+
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (payloadLoaded != FALSE)
+    {
+        for (i = 0; i < words; i++)
+        {
+            payload[i] = txData[i];
+        }
+    }
+}
+
+/* Sanity checks of the routing table, called once by initMultican() before the gateway starts */
+void canGatewayCheckRoutes(void)
+{
+    uint32 i;
+
+    /* extended route keys must be sorted for the binary search */
+    for (i = 1; i < GW_NUM_EXT_ROUTES; i++)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, g_gwExtRouteKey[i - 1] < g_gwExtRouteKey[i]);
+    }
+
+    /* route transforms must stay inside the data field */
+    for (i = 0; i < (GW_NUM_STD_ROUTES + GW_NUM_EXT_ROUTES); i++)
+    {
+        const gwTransformOpType *op = g_gwRoutes[i].transform;
+
+        for ( ; (op != NULL_PTR) && (op->code != GW_XF_OP_END); op++)
+        {
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (op->code != GW_XF_OP_DLC) || (op->arg0 <= GW_DLC_MAX));
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (op->code != GW_XF_OP_COPY) ||
+                       (((op->arg0 + op->arg2) <= GW_DATA_FIELD_SIZE) &&
+                        ((op->arg1 + op->arg2) <= GW_DATA_FIELD_SIZE)));
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (op->code != GW_XF_OP_FILL) ||
+                       ((op->arg0 + op->arg1) <= GW_DATA_FIELD_SIZE));
+        }
+    }
+}
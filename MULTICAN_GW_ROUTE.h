@@ -0,0 +1,110 @@
+/********************************************************************************************************************
+ * \file MULTICAN_GW_ROUTE.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef MULTICAN_GW_ROUTE_H_
+#define MULTICAN_GW_ROUTE_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCan_reg.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Per-ID routing of the gateway: the routing table, its constant time lookup and the route transforms. Only works on
+ * Rx element images in memory, no peripheral access, so the module also builds for the host tests (tests/).
+ */
+                                                                /*            USER CONFIGURABLE VALUE                */
+                                                                /* ------------------------------------------------- */
+#define NUMBER_OF_CAN_NODES         8                           /* CAN0 nodes 0..3 followed by CAN1 nodes 0..3       */
+                                                                /* ------------------------------------------------- */
+
+#define GW_NODE(n)                  (1U << (n))                 /* Destination mask bit of gateway node n            */
+#define GW_NO_NODE                  0xFF                        /* Unused source node index                          */
+#define GW_NO_DST                   0x00                        /* Empty destination mask (route: handler only)      */
+#define GW_ID_UNCHANGED             0xFFFFFFFFU                 /* Route keeps the received CAN ID (the value of     */
+                                                                /* IFXCAN_CAN_MESSAGE_ID_UNCHANGED)                  */
+#define GW_STD_ID_COUNT             2048                        /* Dense route lookup table size for 11-bit IDs      */
+#define GW_DATA_FIELD_SIZE          64                          /* Payload bytes a transform may address             */
+#define GW_DLC_CLASSIC_MAX          8                           /* IfxCan_DataLengthCode_8, longest classic frame    */
+#define GW_DLC_MAX                  15                          /* IfxCan_DataLengthCode_64                          */
+
+/* Route transform operations, a transform is a GW_XF_END() terminated list of them (see gwTransformOpType).
+ * Payload offsets and lengths are in bytes, CAN data byte 0 is offset 0.
+ */
+#define GW_XF_END()                 {GW_XF_OP_END, 0, 0, 0}                 /* End of the transform                  */
+#define GW_XF_DLC(dlc)              {GW_XF_OP_DLC, (dlc), 0, 0}             /* Set the DLC code (0..15)              */
+#define GW_XF_TO_FD(brs)            {GW_XF_OP_TO_FD, (brs), 0, 0}           /* CAN FD frame, bit rate switch 0/1     */
+#define GW_XF_TO_CLASSIC()          {GW_XF_OP_TO_CLASSIC, 0, 0, 0}          /* Classic frame, DLC limited to 8       */
+#define GW_XF_COPY(dst, src, len)   {GW_XF_OP_COPY, (dst), (src), (len)}    /* Received bytes src.. -> dst..         */
+#define GW_XF_FILL(dst, len, value) {GW_XF_OP_FILL, (dst), (len), (value)}  /* Set bytes dst.. to a constant         */
+
+/*********************************************************************************************************************/
+/*--------------------------------------------------Data Structures--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Route transform operation codes. Header operations first, payload operations from GW_XF_OP_COPY on. */
+typedef enum
+{
+    GW_XF_OP_END = 0,                                /* End of the operation list                                    */
+    GW_XF_OP_DLC,                                    /* arg0: DLC code                                               */
+    GW_XF_OP_TO_FD,                                  /* arg0: BRS                                                    */
+    GW_XF_OP_TO_CLASSIC,                             /* no argument                                                  */
+    GW_XF_OP_COPY,                                   /* arg0: destination offset, arg1: source offset, arg2: length  */
+    GW_XF_OP_FILL                                    /* arg0: destination offset, arg1: length, arg2: value          */
+} gwTransformOpCode;
+
+/* One route transform operation (4 bytes, built with the GW_XF_xxx() macros) */
+typedef struct
+{
+    uint8                           code;            /* gwTransformOpCode                                            */
+    uint8                           arg0;
+    uint8                           arg1;
+    uint8                           arg2;
+} gwTransformOpType;
+
+/* Route handler, called from the gateway ISR for every received frame of the route (before it is forwarded) */
+typedef void (*gwRouteHandler)(uint8 srcNode, Ifx_CAN_RXMSG *element);
+
+typedef struct
+{
+    uint8                           srcNode;         /* Gateway node index the frame is received on                  */
+    uint8                           dstNodeMask;     /* GW_NODE(n) bits to forward to, GW_NO_DST: handler only       */
+    uint32                          canId;           /* Received CAN ID (11 or 29 bit)                               */
+    uint32                          newId;           /* CAN ID on the destination node or GW_ID_UNCHANGED            */
+    gwRouteHandler                  handler;         /* Optional handler, NULL_PTR if none                           */
+    const gwTransformOpType        *transform;       /* Optional DLC / frame format / payload transform, or NULL_PTR */
+} gwRouteType;
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------Function Prototypes-------------------------------------------------*/
+/*********************************************************************************************************************/
+const gwRouteType *canGatewayLookupRoute(uint8 srcNode, boolean extended, uint32 canId);
+void canGatewayApplyTransform(Ifx_CAN_RXMSG *element, const gwTransformOpType *op);
+void canGatewayCheckRoutes(void);
+
+#endif /* MULTICAN_GW_ROUTE_H_ */
@@ -4,430 +4,1933 @@
 *  PLATFORM    : Infineon TC375 (TriCore), FreeRTOS
 *  DESCRIPTION : Multi-pair CAN gateway configuration with multiple CAN ID filters per pair.
 *                Implements flexible compile-time gateway routing between CAN nodes with per-pair filter IDs.
-*                Each pair forwards filtered CAN IDs from source to destination node using dedicated message objects.
+*                Each pair forwards filtered CAN IDs from source to destination node through the MCMCAN
+*                (IfxCan_Can) Rx FIFOs and the priority scheduled dedicated Tx buffers of the nodes involved.
 *                Designed for automotive gateway, body, or domain controller use-cases (NXP/AUTOSAR style).
 *  AUTHOR      : [Your Name]
-*  VERSION     : 1.0
+*  VERSION     : 2.0
 *  COPYRIGHT   : (c) 2025, [Your Company]
 **********************************************************************************************************************
 *  CONFIGURATION OVERVIEW
 *  - Each gateway pair is defined by the MulticanGwPairConfig struct.
 *  - Each pair specifies:
-*      - Source CAN node index (srcNode)
-*      - Destination CAN node index (dstNode)
-*      - Base message object ID for source node (srcMsgObjId)
-*      - Message object ID for destination node (dstMsgObjId)
-*      - Number of valid CAN ID filters (numFilterIds)
-*      - Array of CAN IDs to filter (filterIds)
-*  - For each filter ID, a dedicated RX message object (MO) is created on the source node.
-*  - Filtered messages are forwarded to the destination node using the specified TX MO.
-*  - All pairs use MO 0 as the base for both source and destination for simplicity (safe due to node-local MO space).
+*      - Source CAN node index (srcNode, 0..3 = CAN0 node 0..3, 4..7 = CAN1 node 0..3)
+*      - Destination CAN node mask (dstNodeMask), one bit per node, several bits multicast the frame
+*      - Number of valid filter entries (numFilters)
+*      - Array of filter entries (filters): single ID, ID range, ID/mask or dual ID, standard or extended
+*  - For each filter entry, a standard or extended filter element on the source node stores the frame in Rx FIFO 0.
+*  - Frames matching no filter are accepted into Rx FIFO 1 of the source node (catch-all path).
+*  - Filter entries beyond the node's filter element capacity are matched in software on the catch-all path.
+*  - Optionally (gwBypass) the catch-all path of a node is moved by DMA straight into the Tx buffers of one
+*    destination node, the CPU is only interrupted every GW_BYPASS_WATERMARK frames.
+*  - The per-node gateway ISR drains both FIFOs and queues every frame into the egress queue of each destination node.
+*    The gateway ISRs of a CPU preempt each other; the state they share (frame pool, egress queues, cross-core queues,
+*    containers, moderation timer) is only touched in short critical sections of one frame or one scheduler pass.
+*  - Each node's egress queue is ordered by CAN ID priority and feeds the node's dedicated Tx buffers; a waiting frame
+*    of higher priority preempts the lowest priority loaded buffer by a cancellation request (no head-of-line blocking).
+*  - The pair of a filtered frame is found in O(1) from the filter index (FIDX) stored in the Rx FIFO element.
+*  - Every node is owned by one CPU (GW_NODEn_CORE), its interrupts are routed to that CPU; frames for a node of
+*    another CPU are handed over through lock-free queues in LMU RAM and the owner is woken by the node's interrupt.
 *  - This configuration is suitable for automotive gateway filtering and forwarding, and can be extended as needed.
 **********************************************************************************************************************/
 #include "MULTICAN_GW_TX_FIFO.h"
-#include "IfxMultican_Can.h"
-#include "IfxMultican.h"
+#include "Can/Can/IfxCan_Can.h"
 #include "IfxCpu.h"
+#include "App_Trace.h"
+#include "App_CanLog.h"
 
 
 /** \brief Gateway pair configuration table.
  *
  *  Each entry defines a CAN gateway routing pair:
- *    - srcNode:        Source CAN node index (0 = CAN0, 1 = CAN1, ...)
- *    - dstNode:        Destination CAN node index (forward to this node)
- *    - srcMsgObjId:    Base message object ID for source node (first RX MO for filters)
- *    - dstMsgObjId:    Message object ID for destination node (TX MO for forwarding)
- *    - numFilterIds:   Number of valid CAN ID filters for this pair
- *    - filterIds[]:    Array of CAN IDs to filter (each gets a dedicated RX MO)
+ *    - srcNode:        Source CAN node index (0 = CAN0 node 0, ... 4 = CAN1 node 0, ...)
+ *    - dstNodeMask:    Destination CAN nodes, GW_NODE(n) bits (one receive fans out to every node of the mask)
+ *    - numFilters:     Number of valid filter entries for this pair
+ *    - filters[]:      Filter entries, each gets one filter element (GW_FILTER_ID, _RANGE, _MASK, _DUAL and the
+ *                      GW_FILTER_EXT_xxx variants for 29-bit IDs)
  *
  *  Example:
- *    {0, 1, 0, 0, 2, {0x100, 0x101}}
- *    - CAN0 -> CAN1
- *    - RX MOs 0 & 1 on CAN0 filter 0x100, 0x101
- *    - TX MO 0 on CAN1 forwards filtered messages
+ *    {0, GW_NODE(1), 2, {GW_FILTER_ID(0x100), GW_FILTER_ID(0x101)}}
+ *    - CAN0 node 0 -> CAN0 node 1
+ *    - Standard filter elements on node 0 store 0x100, 0x101 in Rx FIFO 0
+ *    - Forwarded frames are queued into the egress queue of node 1
  *
  *  Note:
- *    - Each CAN node has its own MO space, so srcMsgObjId/dstMsgObjId can be the same across nodes.
- *    - Catch-all MOs for non-filtered IDs are created separately (not listed here).
+ *    - Filter elements are allocated per source node in table order, so pairs sharing a source node simply
+ *      continue the node's filter list.
+ *    - A range or mask entry takes a single filter element however many IDs it covers.
+ *    - Entries beyond GW_MAX_STD_FILTERS / GW_MAX_EXT_FILTERS of a node are not programmed into the hardware; their
+ *      frames arrive as non-matching frames in Rx FIFO 1 and are assigned to the pair by the software second stage
+ *      (up to GW_MAX_SW_FILTERS per node). g_multican.filterUsage[] reports the split per node.
+ *    - Frames not matching any filter follow the first pair of their source node (catch-all, Rx FIFO 1).
+ *    - GW_PAIR_TABLE_FILE, if defined, names a file that replaces this table, with NUM_GW_PAIRS defined to its size
+ *      (the host tests build the gateway with a table that overflows the filter element list of a node).
  */
+#ifdef GW_PAIR_TABLE_FILE
+#include GW_PAIR_TABLE_FILE
+#else
 const MulticanGwPairConfig gwPairs[NUM_GW_PAIRS] = {
-    {0, 1, 0, 0, 2, {0x100, 0x101}}, // CAN0->CAN1, RX MOs 0&1, TX MO 0, filter: 0x100, 0x101
-    {2, 3, 0, 0, 3, {0x200, 0x201, 0x202}}, // CAN2->CAN3, RX MOs 0,1,2, TX MO 0, filter: 0x200,0x201,0x202
-    {4, 5, 0, 0, 1, {0x300}} // CAN4->CAN5, RX MO 0, TX MO 0, filter: 0x300
+    {0, GW_NODE(1), 2, {GW_FILTER_ID(0x100), GW_FILTER_ID(0x101)}}, // CAN0.N0->CAN0.N1, filter: 0x100, 0x101
+    {2, GW_NODE(3), 2, {GW_FILTER_RANGE(0x200, 0x20F), GW_FILTER_DUAL(0x280, 0x290)}}, // CAN0.N2->CAN0.N3, filter: 0x200..0x20F, 0x280, 0x290
+    {4, GW_NODE(5) | GW_NODE(6) | GW_NODE(7), 2, {GW_FILTER_ID(0x300), GW_FILTER_EXT_MASK(0x18FF0000, 0x1FFF0000)}} // CAN1.N0->CAN1.N1/N2/N3 (multicast), filter: 0x300, 0x18FFxxxx
 };
+#endif /* GW_PAIR_TABLE_FILE */
 
-// Static message object handles for each filter MO
-IfxMultican_Can_MsgObj g_filteredSrcMsgObjs[NUM_GW_PAIRS][MAX_FILTER_IDS_PER_PAIR];
-// Catch-all message objects for non-filtered IDs (one per pair)
-IfxMultican_Can_MsgObj g_catchAllSrcMsgObjs[NUM_GW_PAIRS];
+/** \brief Container (frame aggregation) configuration table.
+ *
+ *  Each entry links a classic CAN node to a CAN FD node:
+ *    - classicNode:    classic frames forwarded from this node to fdNode (by a pair or a route) are packed as PDUs
+ *    - fdNode:         container frames are sent on this node; received container frames are unpacked to classicNode
+ *    - flushBytes:     size trigger, the container is sent once it holds this many bytes (a full container always is)
+ *    - flushTimeMs:    time trigger, the container is sent at most this long after its first PDU was packed
+ *    - containerId:    CAN ID of the container frame on fdNode
+ *    - urgentIdLimit:  priority trigger, a PDU with a CAN ID up to this value is sent with the container at once
+ *
+ *  Note:
+ *    - A classic 8 byte frame takes 13 container bytes, so up to 4 of them share one 64 byte CAN FD frame.
+ *    - Packed frames may overtake or fall behind frames forwarded to fdNode one by one (other IDs or CAN FD frames).
+ */
+const MulticanGwContainerConfig gwContainers[NUM_GW_CONTAINERS] = {
+    {0, 1, 48, 5, 0x7F0, 0x0FF} // CAN0.N0 classic frames -> CAN0.N1 container 0x7F0, 48 bytes / 5 ms / IDs <= 0x0FF
+};
+
+/** \brief DMA bypass configuration table.
+ *
+ *  Each entry moves all unfiltered traffic (Rx FIFO 1) of a source node to one destination node without CPU work per
+ *  frame: the Rx FIFO 1 new message request of the node triggers a DMA linked list which copies the element into a
+ *  dedicated Tx buffer of the destination node, requests its transmission and acknowledges the element.
+ *    - srcNode:        Source CAN node index, its catch-all pair, routes and second stage filters no longer apply to
+ *                      Rx FIFO 1 frames
+ *    - dstNode:        Destination CAN node index, gets GW_BYPASS_TX_BUFFERS dedicated Tx buffers behind its egress
+ *                      Tx buffers
+ *    - dmaChannel:     DMA channel of the linked list (also the service request number of the CAN request line)
+ *
+ *  Note:
+ *    - The bypass is best effort: a dedicated Tx buffer is reused GW_RX_FIFO1_SIZE frames later, so the destination
+ *      must keep up with the bulk traffic of the source.
+ *    - The watermark ISR (ISR_PRIORITY_GW_BYPASSn) only updates the node statistics.
+ *    - Bypass frames bypass the egress scheduler as well; the MCMCAN arbitrates them against the loaded egress Tx
+ *      buffers of the destination node by CAN ID.
+ */
+const MulticanGwBypassConfig gwBypass[NUM_GW_BYPASS] = {
+    {2, 3, IfxDma_ChannelId_10} // CAN0.N2 unfiltered traffic -> CAN0.N3 by DMA channel 10
+};
 
-// Forward declaration of shared ISR
-IFX_INTERRUPT(canGatewayIsr, 0, ISR_PRIORITY_CAN_RX);
+/** \brief Receive interrupt moderation table, indexed by gateway node index.
+ *
+ *  Each entry sets the initial moderation of one node:
+ *    - watermark:      Rx FIFO 0 fill level which starts the drain (Rx FIFO 1: limited to GW_RX_FIFO1_SIZE)
+ *    - timeoutUs:      upper bound in microseconds a frame waits in the Rx FIFOs when the watermark is not reached
+ *
+ *  A node with watermark > 1 takes one interrupt for the first frame of a batch (it starts the timeout and masks the
+ *  new message interrupts) and one for the drain at the watermark or the timeout, instead of one per frame.
+ *
+ *  Note:
+ *    - watermark 1 or timeoutUs 0 disables the moderation of the node (drain on every new frame).
+ *    - Keep watermark * frame time below the Rx FIFO depth reserve, the FIFO must not overflow before the drain.
+ *    - canGatewaySetRxModeration() changes both values at runtime.
+ */
+const MulticanGwRxModerationConfig gwRxModeration[NUMBER_OF_CAN_NODES] = {
+    {4, 500}, {4, 500}, {4, 500}, {4, 500}, // CAN0 nodes: drain every 4 frames, at most 500 us after the first
+    {4, 500}, {4, 500}, {4, 500}, {4, 500}  // CAN1 nodes
+};
 
+/* The per-ID routing table (routes and their transforms) is configured in MULTICAN_GW_ROUTE.c */
 
+/* MULTICAN_GW_ROUTE.h does not depend on the CAN driver, its constants must match the driver's */
+typedef char gwIdUnchangedCheck[(GW_ID_UNCHANGED == IFXCAN_CAN_MESSAGE_ID_UNCHANGED) ? 1 : -1];
+typedef char gwDlcCheck[((GW_DLC_CLASSIC_MAX == IfxCan_DataLengthCode_8) && (GW_DLC_MAX == IfxCan_DataLengthCode_64)) ? 1 : -1];
 
 /*********************************************************************************************************************/
 /*-------------------------------------------------Global variables--------------------------------------------------*/
 /*********************************************************************************************************************/
 multicanType g_multican;
-canCommunicationStatusType g_status = CanCommunicationStatus_Success;
-IfxPort_Pin_Config g_led1;
-uint8 g_currentCanMessage = 0;
-volatile uint8 g_isrRxCount = 0;                    /* Declared as volatile in order not to be optimized by compiler */
+
+/* Cross-core queues [producer core][consumer core], in LMU RAM so that all cores reach them at the same cost */
+#if defined(__TASKING__)
+#pragma section farbss "lmubss_nc"
+#endif
+#if defined(__HIGHTEC__)
+#pragma section ".lmubss_nc" aw
+#endif
+IFX_ALIGN(IPC_CACHE_LINE_SIZE) gwXcoreRing g_gwXcoreQueue[GW_NUM_CORES][GW_NUM_CORES];
+#if defined(__TASKING__)
+#pragma section farbss restore
+#endif
+#if defined(__HIGHTEC__)
+#pragma section
+#endif
+
+/* DMA bypass linked lists, GW_BYPASS_MOVES transaction control sets per Rx FIFO 1 element (32 byte aligned) */
+IFX_ALIGN(32) Ifx_DMA_CH g_gwBypassList[NUM_GW_BYPASS][GW_RX_FIFO1_SIZE][GW_BYPASS_MOVES];
 
 /*********************************************************************************************************************/
 /*--------------------------------------------Private Variables/Constants--------------------------------------------*/
 /*********************************************************************************************************************/
-const uint32 g_canInitialMessageData[2] = {0xDA7A0000, 0xBA5E0000};
-
 /* Node enable/disable configuration: 1 = enable, 0 = disable */
-const uint8_t canNodeEnabled[NUMBER_OF_CAN_NODES] = {1, 1, 0, 1, 1, 0, 1, 1}; // Example: enable nodes 0-3 only
+const uint8_t canNodeEnabled[NUMBER_OF_CAN_NODES] = {1, 1, 1, 1, 1, 1, 1, 1}; // All CAN0/CAN1 nodes enabled
+
+/* Interrupt priority of each node's gateway ISR, indexed by gateway node index */
+static const Ifx_Priority g_gwIsrPriority[NUMBER_OF_CAN_NODES] = {
+    ISR_PRIORITY_CAN_GW_NODE0, ISR_PRIORITY_CAN_GW_NODE1, ISR_PRIORITY_CAN_GW_NODE2, ISR_PRIORITY_CAN_GW_NODE3,
+    ISR_PRIORITY_CAN_GW_NODE4, ISR_PRIORITY_CAN_GW_NODE5, ISR_PRIORITY_CAN_GW_NODE6, ISR_PRIORITY_CAN_GW_NODE7
+};
+
+/* Watermark interrupt priority of each DMA bypass, indexed like gwBypass[] */
+static const Ifx_Priority g_gwBypassIsrPriority[NUM_GW_BYPASS] = {
+    ISR_PRIORITY_GW_BYPASS0
+};
+
+/* Core owning each node, indexed by gateway node index */
+static const uint8 g_gwNodeCore[NUMBER_OF_CAN_NODES] = {
+    GW_NODE0_CORE, GW_NODE1_CORE, GW_NODE2_CORE, GW_NODE3_CORE, GW_NODE4_CORE, GW_NODE5_CORE, GW_NODE6_CORE, GW_NODE7_CORE
+};
+
+/* Core taking the watermark interrupt of each DMA bypass, indexed like gwBypass[] */
+static const uint8 g_gwBypassCore[NUM_GW_BYPASS] = {
+    GW_BYPASS0_CORE
+};
+
+/* Interrupt service provider and STM (receive moderation timeouts) of each core */
+static const IfxSrc_Tos g_gwCoreTos[GW_NUM_CORES] = {IfxSrc_Tos_cpu0, IfxSrc_Tos_cpu1, IfxSrc_Tos_cpu2};
+static Ifx_STM *const   g_gwCoreStm[GW_NUM_CORES] = {&MODULE_STM0, &MODULE_STM1, &MODULE_STM2};
+
+/* Register values written by the DMA bypass linked lists */
+typedef struct
+{
+    uint32 rxFlagClear;                             /* IR value clearing the Rx FIFO 1 new message flag             */
+    uint32 txRequest[GW_BYPASS_TX_BUFFERS];         /* TXBAR value of bypass Tx buffer k                            */
+    uint32 rxAcknowledge[GW_RX_FIFO1_SIZE];         /* RXF1A value of Rx FIFO 1 element k                           */
+} gwBypassValueType;
+
+static gwBypassValueType g_gwBypassValue[NUM_GW_BYPASS];
+
+/* Transceiver pins of each node. NULL_PTR leaves the pins untouched, set them according to the shield board wiring */
+static IFX_CONST IfxCan_Can_Pins *g_canNodePins[NUMBER_OF_CAN_NODES] = {
+    NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR
+};
+
 
 /*********************************************************************************************************************/
 /*---------------------------------------------Function Implementations----------------------------------------------*/
 /*********************************************************************************************************************/
-/* Macro to define Interrupt Service Routine.
- * This macro:
- * - defines linker section as .intvec_tc<vector number>_<interrupt priority>.
- * - defines compiler specific attribute for the interrupt functions.
- * - defines the Interrupt service routine as ISR function.
- *
- * IFX_INTERRUPT(isr, vectabNum, priority)
- *  - isr: Name of the ISR function.
- *  - vectabNum: Vector table number.
- *  - priority: Interrupt priority. Refer Usage of interrupt macro for more details.
+/* Arbitration key of a Tx element: the frame with the lower key wins the CAN bus arbitration against the other.
+ * Bits 31..21: base ID (ID bits 28..18, the same position for 11 and 29 bit IDs), bit 20: RTR (standard) / SRR
+ * (extended, always recessive), bit 19: IDE, bits 18..1: ID extension, bit 0: RTR (extended).
  */
-IFX_INTERRUPT(canIsrRxHandler, 0, ISR_PRIORITY_CAN_RX);
+static uint32 gwArbitrationKey(Ifx_CAN_TXMSG *element)
+{
+    uint32 t0  = element->T0.U;
+    uint32 rtr = (t0 >> 29) & 1U;
+    uint32 key = (t0 & 0x1FFC0000U) << 3;
+
+    if (((t0 >> 30) & 1U) != 0)
+    {
+        key |= (1U << 20) | (1U << 19) | ((t0 & 0x0003FFFFU) << 1) | rtr;
+    }
+    else
+    {
+        key |= rtr << 20;
+    }
+
+    return key;
+}
 
-/* Interrupt Service Routine (ISR) called once the RX interrupt is generated.
- * Reads the received CAN message and in case of no errors, increments the counter to 
- * indicate number of successfully received CAN messages.
+/* Take a frame from the pool free list of a core. Returns GW_NO_FRAME if every frame of the core is in use.
+ * A frame only ever sits in egress queues of its own core's nodes, so every pool is touched by one core only. The
+ * gateway ISRs of a core preempt each other: the pool, the egress queues and the producer side of the cross-core
+ * queues of a core are only touched with the core's interrupts disabled, one frame submit (gwEgressSubmit() with the
+ * frame it submits) or one egress scheduler pass (gwEgressServiceNodes()) at a time.
  */
-void canIsrRxHandler(void)
+static uint8 gwFrameAlloc(uint8 core)
 {
-    IfxMultican_Status readStatus;
+    uint8 frame = g_multican.freeFrame[core];
 
-    /* Read the received CAN message and store the status of the operation */
-    readStatus = IfxMultican_Can_MsgObj_readMessage(&g_multican.canDstMsgObj, &g_multican.rxMsg[g_isrRxCount]);
-
-    /* If no new data has been received, report an error */
-    if(!(readStatus & IfxMultican_Status_newData))
+    if (frame != GW_NO_FRAME)
     {
-        g_status = CanCommunicationStatus_Error_noNewDataReceived;
+        g_multican.freeFrame[core]       = g_multican.frame[frame].nextFree;
+        g_multican.frame[frame].refCount = 0;
     }
 
-    /* If a new data has been received but with one message lost, report an error */
-    if(readStatus == IfxMultican_Status_newDataButOneLost)
+    return frame;
+}
+
+/* Drop one reference of a frame, the frame goes back to its pool once nobody holds it any more. */
+static void gwFrameRelease(uint8 frame)
+{
+    gwFrameType *entry = &g_multican.frame[frame];
+    uint8        core  = frame / GW_FRAME_POOL_SIZE;
+
+    if (entry->refCount > 0)
     {
-        g_status = CanCommunicationStatus_Error_newDataButOneLost;
+        entry->refCount--;
     }
 
-    /* If there was no error, increment the counter to indicate the number of successfully received CAN messages */
-    if(g_status == CanCommunicationStatus_Success)
+    if (entry->refCount == 0)
     {
-        g_isrRxCount++;
+        entry->nextFree            = g_multican.freeFrame[core];
+        g_multican.freeFrame[core] = frame;
     }
 }
 
-/* Function to initialize MULTICAN module, nodes and message objects related for this application use case */
-void initMultican(void)
+/* Copy a received element into a new pool frame of a core (same header rules as IfxCan_Can_forwardMessage()), with
+ * the CAN ID rewritten unless newId is GW_ID_UNCHANGED. Returns GW_NO_FRAME if the pool is exhausted.
+ */
+static uint8 gwFrameFromRxElement(uint8 core, Ifx_CAN_RXMSG *element, uint32 newId)
 {
-    uint8 currentCanNode;
+    uint8 frame = gwFrameAlloc(core);
 
-    /* ==========================================================================================
-     * CAN module configuration and initialization:
-     * ==========================================================================================
-     *  - load default CAN module configuration into configuration structure
-     *  - define the interrupt priority for both interrupt node pointers used in the example
-     *  - initialize CAN module with the modified configuration
-     * ==========================================================================================
-     */
-    IfxMultican_Can_initModuleConfig(&g_multican.canConfig, &MODULE_CAN);
+    if (frame != GW_NO_FRAME)
+    {
+        Ifx_CAN_TXMSG *image = &g_multican.frame[frame].element;
 
-    g_multican.canConfig.nodePointer[RX_INTERRUPT_SRC_ID].priority = ISR_PRIORITY_CAN_RX;
+        IfxCan_Node_copyRxElementToTxElement(element, image);
 
-    IfxMultican_Can_initModule(&g_multican.can, &g_multican.canConfig);
+        if (newId != GW_ID_UNCHANGED)
+        {
+            IfxCan_Node_setMsgId(image, newId, (IfxCan_MessageIdLength)image->T0.B.XTD);
+        }
+    }
 
-    /* ==========================================================================================
-     * Common CAN node configuration and initialization:
-     * ==========================================================================================
-     *  - load default CAN node configuration into configuration structure
-     *  - set CAN node in the "Loop-Back" mode (no external pins will be used)
-     * ==========================================================================================
-     */
-    IfxMultican_Can_Node_initConfig(&g_multican.canNodeConfig, &g_multican.can);
+    return frame;
+}
 
-    g_multican.canNodeConfig.loopBackMode = TRUE;
+/* Build a new pool frame of a core from an ID, a data length code and the payload bytes (DLC bytes are read from
+ * data). Returns GW_NO_FRAME if the pool is exhausted.
+ */
+static uint8 gwFrameFromData(uint8 core, uint32 messageId, boolean extended, IfxCan_DataLengthCode dlc, IfxCan_FrameMode frameMode, const uint8 *data)
+{
+    uint8 frame = gwFrameAlloc(core);
 
-    /* ==========================================================================================
-     * CAN node [0...3] configuration and initialization:
-     * ==========================================================================================
-     *  - assign node to CAN node "currentCanNode"
-     *  - initialize the CAN node "currentCanNode" with the modified configuration
-     * ==========================================================================================
-     */
-    for(currentCanNode = 0; currentCanNode < NUMBER_OF_CAN_NODES; currentCanNode++)
+    if (frame != GW_NO_FRAME)
     {
-        if (canNodeEnabled[currentCanNode]) {
+        Ifx_CAN_TXMSG *image  = &g_multican.frame[frame].element;
+        uint8         *bytes  = (uint8 *)((uint32 *)image + 2);
+        uint32         length = IfxCan_Node_getDataLengthInBytes(dlc);
+        uint32         i;
 
-            g_multican.canNodeConfig.nodeId = (IfxMultican_NodeId)currentCanNode;
+        image->T0.U = 0;
+        image->T1.U = 0;
+        IfxCan_Node_setMsgId(image, messageId, (extended != FALSE) ? IfxCan_MessageIdLength_extended : IfxCan_MessageIdLength_standard);
+        IfxCan_Node_setDataLength(image, dlc);
+        IfxCan_Node_setFrameModeReq(image, frameMode);
 
-            IfxMultican_Can_Node_init(&g_multican.canNode[currentCanNode], &g_multican.canNodeConfig);
-            
+        for (i = 0; i < length; i++)
+        {
+            bytes[i] = data[i];
         }
     }
 
-    /* =======================================================================================================
-     * Gateway source message object configuration and initialization:
-     * =======================================================================================================
-     *  - load default CAN message object configuration into configuration structure
-     *
-     *  - define the message object ID (each message object ID value should be unique)
-     *  - define the CAN message ID used during arbitration phase
-     *  - define the number of FIFO slave objects that is used as gateway DESTINATION object
-     *  - define the message object as a receive message object
-     *  - define the first slave object of the FIFO to be the first message object after TX FIFO base object
-     *
-     *  - enable gateway transfers (will define this message object as gateway source object)
-     *  - copy data length code of the gateway source object to a gateway destination object
-     *  - copy data content of the gateway source object to a gateway destination object
-     *  - do NOT copy identifier (ID) of the gateway source object to a gateway destination object
-     *  - enable setting TXRQ bit in the gateway destination object
-     *  - define the first slave object of the FIFO as the gateway destination object
-     *
-     *  - initialize the gateway source CAN message object with the modified configuration
-     * -------------------------------------------------------------------------------------------------------
-     * This CAN message object is assigned to CAN Node 0
-     * =======================================================================================================
-     */
-    // Loop over all gateway pairs and initialize their source and destination message objects
-    for (int i = 0; i < NUM_GW_PAIRS; i++) {
-        const MulticanGwPairConfig *pair = &gwPairs[i];
-        // 1. Filtered MOs (with RX interrupt enabled)
-        // For each filter ID, create a separate MO. Hardware does not support multiple arbitrary CAN IDs per MO.
-        // This loop creates one MO per filter ID, using a unique msgObjId for each.
-        for (int j = 0; j < pair->numFilterIds; j++) {
-            IfxMultican_Can_MsgObjConfig msgObjConfig;
-            IfxMultican_Can_MsgObj_initConfig(&msgObjConfig, &g_multican.canNode[pair->srcNode]);
-            msgObjConfig.msgObjId = pair->srcMsgObjId + j;
-            msgObjConfig.messageId = pair->filterIds[j];
-            msgObjConfig.frame = IfxMultican_Frame_receive;
-            msgObjConfig.gatewayConfig.enabled = TRUE;
-            msgObjConfig.gatewayConfig.copyDataLengthCode = TRUE;
-            msgObjConfig.gatewayConfig.copyData = TRUE;
-            msgObjConfig.gatewayConfig.copyId = FALSE;
-            msgObjConfig.gatewayConfig.enableTransmit = TRUE;
-            msgObjConfig.gatewayConfig.gatewayDstObjId = pair->dstMsgObjId;
-            msgObjConfig.rxInterrupt.enabled = TRUE;
-            msgObjConfig.rxInterrupt.srcId = RX_INTERRUPT_SRC_ID;
-            msgObjConfig.rxInterrupt.isrPriority = ISR_PRIORITY_CAN_RX;
-            IfxMultican_Can_MsgObj_init(&g_filteredSrcMsgObjs[i][j], &msgObjConfig);
-        }
-        // 2. Catch-all MO for non-filtered IDs (RX interrupt disabled, mask = 0 for all IDs not otherwise filtered)
-        IfxMultican_Can_MsgObjConfig catchAllConfig;
-        IfxMultican_Can_MsgObj_initConfig(&catchAllConfig, &g_multican.canNode[pair->srcNode]);
-        catchAllConfig.msgObjId = pair->srcMsgObjId + MAX_FILTER_IDS_PER_PAIR; // avoid overlap
-        catchAllConfig.messageId = 0; // Accept all IDs (with mask)
-        catchAllConfig.acceptanceMask = 0x0; // Accept all bits
-        catchAllConfig.frame = IfxMultican_Frame_receive;
-        catchAllConfig.gatewayConfig.enabled = TRUE;
-        catchAllConfig.gatewayConfig.copyDataLengthCode = TRUE;
-        catchAllConfig.gatewayConfig.copyData = TRUE;
-        catchAllConfig.gatewayConfig.copyId = FALSE;
-        catchAllConfig.gatewayConfig.enableTransmit = TRUE;
-        catchAllConfig.gatewayConfig.gatewayDstObjId = pair->dstMsgObjId;
-        catchAllConfig.rxInterrupt.enabled = FALSE; // No interrupt for catch-all
-        IfxMultican_Can_MsgObj_init(&g_catchAllSrcMsgObjs[i], &catchAllConfig);
-    }
-
-// Shared ISR implementation (iLLD style)
-// Shared ISR: handles only filtered IDs (catch-all MOs do not trigger interrupt)
-IFX_INTERRUPT(canGatewayIsr, 0, ISR_PRIORITY_CAN_RX)
+    return frame;
+}
+
+/* Insert a frame into the egress queue of a node, behind all waiting frames of the same or a higher priority so that
+ * the frames of one ID keep their order. A cancelled frame (requeue) goes in front of the frames of its own ID again,
+ * which were all received after it. Returns FALSE if the queue is full.
+ */
+static boolean gwEgressInsert(gwEgressType *egress, uint32 key, uint8 frame, boolean requeue)
 {
-    // Find which pair/filter triggered by reading interrupt status
-    for (int i = 0; i < NUM_GW_PAIRS; i++) {
-        const MulticanGwPairConfig *pair = &gwPairs[i];
-        for (int j = 0; j < pair->numFilterIds; j++) {
-            IfxMultican_Can_MsgObj *mo = &g_filteredSrcMsgObjs[i][j];
-            if (IfxMultican_Can_MsgObj_isRxPending(mo)) {
-                IfxMultican_Message rxMsg;
-                IfxMultican_Can_MsgObj_readMessage(mo, &rxMsg);
-                IfxMultican_Can_MsgObj_clearRxPending(mo);
-                // Confirm CAN ID matches pair->filterIds[j] (should always match)
-                if (rxMsg.messageId == pair->filterIds[j]) {
-                    // === Custom logic for filtered message (pair i, filter j) ===
-                    // Example: toggle LED, log, etc.
-                }
-                return;
-            }
+    uint8 pos;
+
+    if (egress->queued >= GW_EGRESS_QUEUE_SIZE)
+    {
+        return FALSE;
+    }
+
+    for (pos = egress->queued; pos > 0; pos--)
+    {
+        if ((egress->queue[pos - 1].key < key) || ((egress->queue[pos - 1].key == key) && (requeue == FALSE)))
+        {
+            break;
         }
+
+        egress->queue[pos] = egress->queue[pos - 1];
     }
-    // If we get here, the interrupt was not from a filtered MO (should not happen)
+
+    egress->queue[pos].key   = key;
+    egress->queue[pos].frame = frame;
+    egress->queued++;
+
+    return TRUE;
 }
 
+/* Producer side of a cross-core ring: copy a pool frame into the next slot for the nodes of dstNodeMask (all owned
+ * by dstCore) and publish it, then ring the gateway ISR of the first of these nodes on dstCore.
+ * Returns FALSE (counted in xcoreDropped) if the ring is full.
+ */
+static boolean gwXcoreSend(uint8 core, uint8 dstCore, uint8 frame, uint8 dstNodeMask)
+{
+    gwXcoreSlotType *slot  = gwXcoreReserve(&g_gwXcoreQueue[core][dstCore]);
+    Ifx_CAN_TXMSG   *image = &g_multican.frame[frame].element;
+    uint32           words;
+    uint32           j;
+    uint8            node;
+
+    if (slot == NULL_PTR)
+    {
+        g_multican.xcoreDropped[core][dstCore]++;
+        return FALSE;
+    }
 
-    /* =======================================================================================================
-     * Source standard message object configuration and initialization:
-     * =======================================================================================================
-     *  - load default CAN message object configuration into configuration structure
-     *
-     *  - define the message object ID (each message object ID value should be unique)
-     *  - define the CAN message ID used during arbitration phase (same as ID used for gateway source MO)
-     *  - define the message object as a transmit message object
-     *
-     *  - initialize the source standard CAN message object with the modified configuration
-     * -------------------------------------------------------------------------------------------------------
-     * This CAN message object is assigned to CAN Node 2
-     * =======================================================================================================
-     */
-    IfxMultican_Can_MsgObj_initConfig(&g_multican.canMsgObjConfig, &g_multican.canNode[2]);
+    words = 2 + IfxCan_Node_getDataLength((IfxCan_DataLengthCode)image->T1.B.DLC);
 
-    g_multican.canMsgObjConfig.msgObjId = SRC_MESSAGE_OBJECT_ID;
-    g_multican.canMsgObjConfig.messageId = SRC_MESSAGE_ID;
-    g_multican.canMsgObjConfig.frame = IfxMultican_Frame_transmit;
+    for (j = 0; j < words; j++)
+    {
+        ((uint32 *)&slot->element)[j] = ((uint32 *)image)[j];
+    }
 
-    IfxMultican_Can_MsgObj_init(&g_multican.canSrcMsgObj, &g_multican.canMsgObjConfig);
+    slot->dstNodeMask = dstNodeMask;
+    gwXcoreCommit(&g_gwXcoreQueue[core][dstCore]);
 
-    /* =======================================================================================================
-     * Destination standard message object configuration and initialization:
-     * =======================================================================================================
-     *  - load default CAN message object configuration into configuration structure
-     *
-     *  - define the message object ID (different than the ID used for source MO)
-     *  - define the CAN message ID used during arbitration phase (same as ID used for gateway destination MO)
-     *  - define the message object as a receive message object
-     *  - enable interrupt generation in case of CAN message reception
-     *  - define interrupt node pointer to be used
-     *
-     *  - initialize the destination standard CAN message object with the modified configuration
-     * -------------------------------------------------------------------------------------------------------
-     * This CAN message object is assigned to CAN Node 3
-     * =======================================================================================================
-     */
-    IfxMultican_Can_MsgObj_initConfig(&g_multican.canMsgObjConfig, &g_multican.canNode[3]);
+    node = 0;
+
+    while ((dstNodeMask & GW_NODE(node)) == 0)
+    {
+        node++;
+    }
 
-    g_multican.canMsgObjConfig.msgObjId = DST_MESSAGE_OBJECT_ID;
-    g_multican.canMsgObjConfig.messageId = DST_MESSAGE_ID;
-    g_multican.canMsgObjConfig.frame = IfxMultican_Frame_receive;
-    g_multican.canMsgObjConfig.rxInterrupt.enabled = TRUE;
-    g_multican.canMsgObjConfig.rxInterrupt.srcId = RX_INTERRUPT_SRC_ID;
+    IfxSrc_setRequest(g_multican.doorbell[node]);
 
-    IfxMultican_Can_MsgObj_init(&g_multican.canDstMsgObj, &g_multican.canMsgObjConfig);
+    return TRUE;
 }
 
-/* Function to initialize and transmit CAN messages.
- * Before a CAN message is transmitted, a number of CAN messages need to be initialized.
- * The user can change the number of CAN messages by modifying NUMBER_OF_CAN_MESSAGES macro value.
- * The TX messages (messages that are transmitted) are initialized with the combination of predefined
- * content and current CAN message value. The RX messages (messages where the received CAN data is stored)
- * are initialized with invalid ID, data and length value (after successful CAN transmission,
- * the values are replaced with the valid content). After each CAN message transmission, a code execution waits
- * until the received data has been read by the interrupt service routine.
+/* Hand a pool frame of a core to the egress queues of all enabled nodes of the destination mask. Every local queue
+ * taking the frame holds one reference, the nodes of each other core get one copy through the cross-core queue to
+ * that core. A frame no local queue took (or GW_NO_FRAME) counts as dropped on the local nodes concerned.
+ * Returns the mask of the nodes which took the frame; the local ones still have to be serviced by gwEgressService().
  */
-void transmitCanMessages(void)
+static uint8 gwEgressSubmit(uint8 core, uint8 frame, uint8 dstNodeMask)
 {
-    /* Invalidation of the RX messages */
-    for(g_currentCanMessage = 0; g_currentCanMessage < NUMBER_OF_CAN_MESSAGES; g_currentCanMessage++)
+    uint32 key      = (frame != GW_NO_FRAME) ? gwArbitrationKey(&g_multican.frame[frame].element) : 0;
+    uint8  accepted = 0;
+    uint8  remote;
+    uint8  node;
+    uint8  dstCore;
+
+    /* never touch nodes which are not initialized, nodes of other cores are reached through their queues */
+    dstNodeMask &= g_multican.nodeEnabledMask;
+    remote       = dstNodeMask & (uint8)~g_multican.coreNodeMask[core];
+    dstNodeMask &= g_multican.coreNodeMask[core];
+
+    for (dstCore = 0; (dstCore < GW_NUM_CORES) && (remote != 0); dstCore++)
     {
-        IfxMultican_Message_init(&g_multican.rxMsg[g_currentCanMessage],
-                                 INVALID_ID_VALUE,
-                                 INVALID_DATA_VALUE,
-                                 INVALID_DATA_VALUE,
-                                 INVALID_LENGTH_VALUE);
+        uint8 coreMask = remote & g_multican.coreNodeMask[dstCore];
+
+        if (coreMask == 0)
+        {
+            continue;
+        }
+
+        remote &= (uint8)~coreMask;
+
+        if (frame == GW_NO_FRAME)
+        {
+            g_multican.xcoreDropped[core][dstCore]++;
+        }
+        else if (gwXcoreSend(core, dstCore, frame, coreMask) != FALSE)
+        {
+            accepted |= coreMask;
+        }
     }
 
-    for(g_currentCanMessage = 0; g_currentCanMessage < NUMBER_OF_CAN_MESSAGES; g_currentCanMessage++)
+    for (node = 0; (node < NUMBER_OF_CAN_NODES) && (dstNodeMask != 0); node++)
     {
-        /* Initialization of the TX message */
-        IfxMultican_Message_init(&g_multican.txMsg,
-                                 SRC_MESSAGE_ID,
-                                 ( g_canInitialMessageData[0] | g_currentCanMessage ),
-                                 ( g_canInitialMessageData[1] | g_currentCanMessage ),
-                                 g_multican.canMsgObjConfig.control.messageLen);
-
-        /* Send the CAN message with the previously defined TX message content */
-        while(IfxMultican_Status_notSentBusy ==
-           IfxMultican_Can_MsgObj_sendMessage(&g_multican.canSrcMsgObj, &g_multican.txMsg))
+        if ((dstNodeMask & GW_NODE(node)) == 0)
         {
+            continue;
         }
 
-        /* Wait until previously transmitted data has been received in the destination message object
-         * and no error has been detected. If the code execution stops at this point, check the "g_status" variable.
-         */
-        while(g_isrRxCount == g_currentCanMessage)
+        dstNodeMask &= (uint8)~GW_NODE(node);
+
+        if ((frame != GW_NO_FRAME) && (gwEgressInsert(&g_multican.egress[node], key, frame, FALSE) != FALSE))
+        {
+            g_multican.frame[frame].refCount++;
+            accepted |= (uint8)GW_NODE(node);
+        }
+        else
         {
+            g_multican.stats[node].txDropped++;
         }
     }
+
+    if ((frame != GW_NO_FRAME) && ((accepted & g_multican.coreNodeMask[core]) == 0))
+    {
+        gwFrameRelease(frame);
+    }
+
+    return accepted;
 }
 
-/* Function to verify CAN messages.
- * After all the expected messages have been received, several checks are performed.
- * The current CUR pointer of the gateway source object is compared against expected CUR pointer value.
- * Similarly, the value of the gateway destination object (TX FIFO base object) is also checked.
- * Finally, the received data is compared to expected data and LED1 is turned on to indicate successful usage of
- * gateway and FIFO functionality of MultiCAN+ module.
+/* Egress scheduler of one node, a single non-blocking pass called from the gateway ISRs (never waits on the bus):
+ *   1. egress Tx buffers without pending request are done: transmitted frames are released, cancelled ones go back
+ *      into the queue (with a full queue the lowest priority frame of both is dropped)
+ *   2. free egress Tx buffers take the highest priority waiting frames, all requested with one TXBAR write
+ *   3. if the highest priority waiting frame still finds no free buffer but beats a loaded one, the lowest priority
+ *      loaded buffer is cancelled (one cancellation at a time); the cancellation finished interrupt runs the next pass
+ * Frames of one ID are never loaded into a lower buffer number than a pending frame of the same ID, as the MCMCAN
+ * sends equal IDs lowest buffer number first.
  */
-void verifyCanMessages(void)
+static void gwEgressService(uint8 node)
 {
-    Ifx_CAN_MO *hwObj;
-
-    /* Get the pointer to the gateway source object. */
-    hwObj = IfxMultican_MsgObj_getPointer(g_multican.can.mcan, GTW_SRC_MESSAGE_OBJECT_ID);
+    gwEgressType    *egress   = &g_multican.egress[node];
+    IfxCan_Can_Node *canNode  = &g_multican.canNode[node];
+    uint32           pending  = IfxCan_Node_getTxBufferRequestPendingMask(canNode->node);
+    uint32           occurred = IfxCan_Node_getTxBufferTransmissionOccurredMask(canNode->node);
+    uint32           finished = egress->busyMask & ~pending;
+    uint32           addMask  = 0;
+    uint32           bit;
+    uint8            worst;
+    uint8            k;
+    uint8            j;
 
-    /* Check if the CUR value does not match with the expected data in the gateway source object.
-     * If this is the case, an error should be reported.
-     */
-    if(EXPECTED_CUR_POINTER_VALUE != hwObj->FGPR.B.CUR)
+    for (k = 0; (k < GW_EGRESS_TX_BUFFERS) && (finished != 0); k++)
     {
-        g_status = CanCommunicationStatus_Error_notExpectedFifoCurPointer;
+        bit = 1U << k;
+
+        if ((finished & bit) == 0)
+        {
+            continue;
+        }
+
+        finished &= ~bit;
+
+        if ((occurred & bit) != 0)
+        {
+            gwFrameRelease(egress->txBuffer[k].frame);
+            g_multican.stats[node].txFrames++;
+        }
+        else
+        {
+            gwEgressEntryType *entry = &egress->txBuffer[k];
+
+            if ((egress->queued >= GW_EGRESS_QUEUE_SIZE) && (egress->queue[GW_EGRESS_QUEUE_SIZE - 1].key > entry->key))
+            {
+                /* full queue: its last (lowest priority) frame gives way to the cancelled one */
+                egress->queued--;
+                gwFrameRelease(egress->queue[egress->queued].frame);
+                g_multican.stats[node].txDropped++;
+            }
+
+            if (gwEgressInsert(egress, entry->key, entry->frame, TRUE) == FALSE)
+            {
+                gwFrameRelease(entry->frame);
+                g_multican.stats[node].txDropped++;
+            }
+        }
+
+        egress->busyMask   &= ~bit;
+        egress->cancelMask &= ~bit;
     }
 
-    /* Get the pointer to the gateway destination (TX FIFO base) object */
-    hwObj = IfxMultican_MsgObj_getPointer(g_multican.can.mcan, GTW_DST_MESSAGE_OBJECT_ID);
+    for (k = 0; (k < GW_EGRESS_TX_BUFFERS) && (egress->queued > 0); k++)
+    {
+        bit = 1U << k;
 
-    /* Check if the CUR value does not match with the expected data in the gateway destination object.
-     * If this is the case, an error should be reported.
-     */
-    if(EXPECTED_CUR_POINTER_VALUE != hwObj->FGPR.B.CUR)
+        if ((egress->busyMask & bit) != 0)
+        {
+            continue;
+        }
+
+        for (j = k + 1; j < GW_EGRESS_TX_BUFFERS; j++)
+        {
+            if (((egress->busyMask & (1U << j)) != 0) && (egress->txBuffer[j].key == egress->queue[0].key))
+            {
+                break;
+            }
+        }
+
+        if (j < GW_EGRESS_TX_BUFFERS)
+        {
+            /* a frame of the same ID is pending in a higher buffer number, keep the ID order */
+            break;
+        }
+
+        {
+            Ifx_CAN_TXMSG *image     = &g_multican.frame[egress->queue[0].frame].element;
+            Ifx_CAN_TXMSG *txElement = IfxCan_Node_getTxBufferElementAddress(canNode->node, canNode->messageRAM.baseAddress,
+                                                                             canNode->messageRAM.txBuffersStartAddress, (IfxCan_TxBufferId)k);
+            uint32         words     = 2 + IfxCan_Node_getDataLength((IfxCan_DataLengthCode)image->T1.B.DLC);
+
+            for (j = 0; j < words; j++)
+            {
+                ((uint32 *)txElement)[j] = ((uint32 *)image)[j];
+            }
+        }
+
+        egress->txBuffer[k] = egress->queue[0];
+        egress->queued--;
+
+        for (j = 0; j < egress->queued; j++)
+        {
+            egress->queue[j] = egress->queue[j + 1];
+        }
+
+        egress->busyMask |= bit;
+        addMask          |= bit;
+    }
+
+    if (addMask != 0)
     {
-        g_status = CanCommunicationStatus_Error_notExpectedFifoCurPointer;
+        IfxCan_Node_setTxBufferAddRequestMask(canNode->node, addMask);
     }
 
-    for(g_currentCanMessage = 0; g_currentCanMessage < NUMBER_OF_CAN_MESSAGES; g_currentCanMessage++)
+    if ((egress->queued > 0) && (egress->cancelMask == 0) && (egress->busyMask == ((1U << GW_EGRESS_TX_BUFFERS) - 1)))
     {
-        /* Check if the received message ID matches with the transmitted message ID.
-         * If this is the case, an error should be reported. Source standard message object and destination
-         * standard message object have different message ID configuration.
+        /* of several buffers with the worst key the highest number holds the newest frame of that ID: cancelling it
+         * keeps the ID order, the requeued frame goes out after the older ones still pending
          */
-        if(g_multican.rxMsg[g_currentCanMessage].id == SRC_MESSAGE_ID)
+        worst = 0;
+
+        for (k = 1; k < GW_EGRESS_TX_BUFFERS; k++)
         {
-            g_status = CanCommunicationStatus_Error_notExpectedMessageId;
-            break;
+            if (egress->txBuffer[k].key >= egress->txBuffer[worst].key)
+            {
+                worst = k;
+            }
         }
 
-        /* Check if the received message length does NOT match with the expected message length.
-         * If this is the case, an error should be reported.
-         */
-        if(g_multican.rxMsg[g_currentCanMessage].lengthCode != g_multican.canMsgObjConfig.control.messageLen)
+        if (egress->queue[0].key < egress->txBuffer[worst].key)
         {
-            g_status = CanCommunicationStatus_Error_notExpectedLengthCode;
-            break;
+            egress->cancelMask = 1U << worst;
+            IfxCan_Node_setTxBufferCancellationRequestMask(canNode->node, egress->cancelMask);
+            g_multican.stats[node].txPreempted++;
         }
+    }
+}
 
-        /* Finally, check if a received data does NOT match with the transmitted one
-         * If this is the case, an error should be reported.
-         */
-        if((g_multican.rxMsg[g_currentCanMessage].data[0] != (g_canInitialMessageData[0] | g_currentCanMessage)) ||
-            (g_multican.rxMsg[g_currentCanMessage].data[1] != (g_canInitialMessageData[1] | g_currentCanMessage)))
+/* Run the egress scheduler of every node of the mask (nodes of the calling core only), each pass with the core's
+ * interrupts disabled.
+ */
+static void gwEgressServiceNodes(uint8 nodeMask)
+{
+    boolean interruptState;
+    uint8   node;
+
+    for (node = 0; (node < NUMBER_OF_CAN_NODES) && (nodeMask != 0); node++)
+    {
+        if ((nodeMask & GW_NODE(node)) != 0)
         {
-            g_status = CanCommunicationStatus_Error_notExpectedData;
-            break;
+            nodeMask &= (uint8)~GW_NODE(node);
+
+            interruptState = IfxCpu_disableInterrupts();
+            gwEgressService(node);
+            IfxCpu_restoreInterrupts(interruptState);
+        }
+    }
+}
+
+/* Consumer side of the cross-core rings of a core: every frame other cores handed over is copied into a pool frame
+ * of this core and queued into the egress queues of its destination nodes, which are serviced once at the end. Each
+ * slot is returned to its producer as soon as it is copied.
+ * Every gateway ISR of the core consumes, so the single consumer of each ring is the core with its interrupts
+ * disabled: peek, submit and release of one slot never interleave with a nested ISR, which may take the next slot.
+ */
+static void gwXcoreReceive(uint8 core)
+{
+    const gwXcoreSlotType *slot;
+    uint8                  dstPending = 0;
+    boolean                interruptState;
+    uint8                  accepted;
+    uint8                  srcCore;
+    uint8                  frame;
+    uint8                  node;
+    uint32                 words;
+    uint32                 j;
+
+    for (srcCore = 0; srcCore < GW_NUM_CORES; srcCore++)
+    {
+        if (srcCore == core)
+        {
+            continue;
+        }
+
+        for ( ; ; )
+        {
+            interruptState = IfxCpu_disableInterrupts();
+            slot           = gwXcorePeek(&g_gwXcoreQueue[srcCore][core]);
+
+            if (slot == NULL_PTR)
+            {
+                IfxCpu_restoreInterrupts(interruptState);
+                break;
+            }
+
+            frame = gwFrameAlloc(core);
+
+            if (frame != GW_NO_FRAME)
+            {
+                words = 2 + IfxCan_Node_getDataLength((IfxCan_DataLengthCode)slot->element.T1.B.DLC);
+
+                for (j = 0; j < words; j++)
+                {
+                    ((uint32 *)&g_multican.frame[frame].element)[j] = ((uint32 *)&slot->element)[j];
+                }
+            }
+
+            accepted    = gwEgressSubmit(core, frame, slot->dstNodeMask);
+            dstPending |= accepted;
+            gwXcoreRelease(&g_gwXcoreQueue[srcCore][core]);
+
+            for (node = 0; (node < NUMBER_OF_CAN_NODES) && (accepted != 0); node++)
+            {
+                if ((accepted & GW_NODE(node)) != 0)
+                {
+                    accepted &= (uint8)~GW_NODE(node);
+                    g_multican.stats[node].xcoreFrames++;
+                }
+            }
+
+            IfxCpu_restoreInterrupts(interruptState);
         }
     }
 
-    /* If there was no error, turn on the LED1 to indicate correctness of the received messages */
-    if(g_status == CanCommunicationStatus_Success)
+    gwEgressServiceNodes(dstPending);
+}
+
+/* Smallest CAN FD data length code holding the given number of bytes (up to 64). */
+static IfxCan_DataLengthCode gwContainerDlc(uint8 length)
+{
+    IfxCan_DataLengthCode dlc;
+
+    if (length <= 8)
+    {
+        dlc = (IfxCan_DataLengthCode)length;
+    }
+    else if (length <= 24)
+    {
+        dlc = (IfxCan_DataLengthCode)(6 + ((length + 3) / 4));
+    }
+    else
+    {
+        dlc = (IfxCan_DataLengthCode)(11 + ((length + 15) / 16));
+    }
+
+    return dlc;
+}
+
+/* Send the packed PDUs of a container as one CAN FD frame (BRS) on its CAN FD node and start a new container.
+ * The frame only carries the used bytes, rounded up to the next CAN FD length; the padding is zero. Runs on the core
+ * of the classic node, which owns the packing state, with its interrupts disabled; the sent container is counted on
+ * the classic node.
+ */
+static void gwFlushContainer(uint8 containerIdx)
+{
+    const MulticanGwContainerConfig *config = &gwContainers[containerIdx];
+    gwContainerStateType            *state  = &g_multican.container[containerIdx];
+    gwNodeStatsType                 *stats  = &g_multican.stats[config->classicNode];
+    uint8                            core   = g_gwNodeCore[config->classicNode];
+    uint8                            frame;
+    uint8                            accepted;
+    uint32                           i;
+
+    if (state->used <= GW_CONTAINER_HEADER_SIZE)
+    {
+        return;
+    }
+
+    frame    = gwFrameFromData(core, config->containerId, (config->containerId > 0x7FF) ? TRUE : FALSE, gwContainerDlc(state->used),
+                               IfxCan_FrameMode_fdLongAndFast, (uint8 *)state->data);
+    accepted = gwEgressSubmit(core, frame, GW_NODE(config->fdNode));
+
+    if (accepted != 0)
+    {
+        stats->containerFrames++;
+        stats->containerPdus += ((uint8 *)state->data)[0];
+        gwEgressServiceNodes(accepted & g_multican.coreNodeMask[core]);
+    }
+
+    for (i = 0; i < IFXCAN_CAN_MESSAGE_DATA_WORDS; i++)
+    {
+        state->data[i] = 0;
+    }
+
+    state->used  = GW_CONTAINER_HEADER_SIZE;
+    state->ageMs = 0;
+}
+
+/* Pack a classic frame as PDU into every container of its source node whose CAN FD node is in the destination mask.
+ * Returns the destination mask without these CAN FD nodes. The container is sent first if the PDU does not fit
+ * (size), and right after the PDU if the PDU is urgent (priority) or the flush size is reached. Each PDU is packed
+ * with the core's interrupts disabled, canGatewayContainerTick() flushes the same containers.
+ */
+static uint8 gwPackContainers(uint8 srcNode, Ifx_CAN_RXMSG *element, uint8 dstNodeMask, uint32 newId)
+{
+    uint32  payload[2];
+    uint32  messageId;
+    uint32  header;
+    boolean interruptState;
+    uint8   length;
+    uint8   i;
+    uint8   k;
+
+    /* CAN FD frames do not fit the classic PDU format, remote frames carry no payload to pack */
+    if ((element->R1.B.FDF != 0) || (element->R0.B.RTR != 0))
+    {
+        return dstNodeMask;
+    }
+
+    messageId  = (newId != GW_ID_UNCHANGED) ? newId : IfxCan_Node_getMesssageId(element);
+    header     = (messageId & 0x1FFFFFFFU) | ((uint32)element->R0.B.XTD << 31);
+    length     = (uint8)((element->R1.B.DLC > 8) ? 8 : element->R1.B.DLC);
+    payload[0] = ((uint32 *)element)[2];
+    payload[1] = ((uint32 *)element)[3];
+
+    for (i = 0; i < NUM_GW_CONTAINERS; i++)
     {
-        IfxPort_setPinLow(g_led1.port, g_led1.pinIndex);
+        const MulticanGwContainerConfig *config = &gwContainers[i];
+        gwContainerStateType            *state  = &g_multican.container[i];
+        uint8                           *bytes  = (uint8 *)state->data;
+
+        if ((config->classicNode != srcNode) || ((dstNodeMask & g_multican.nodeEnabledMask & GW_NODE(config->fdNode)) == 0))
+        {
+            continue;
+        }
+
+        dstNodeMask    &= (uint8)~GW_NODE(config->fdNode);
+        interruptState  = IfxCpu_disableInterrupts();
+
+        if ((state->used + GW_CONTAINER_PDU_HEADER + length) > GW_DATA_FIELD_SIZE)
+        {
+            gwFlushContainer(i);
+        }
+
+        bytes[state->used + 0] = (uint8)header;
+        bytes[state->used + 1] = (uint8)(header >> 8);
+        bytes[state->used + 2] = (uint8)(header >> 16);
+        bytes[state->used + 3] = (uint8)(header >> 24);
+        bytes[state->used + 4] = length;
+        state->used           += GW_CONTAINER_PDU_HEADER;
+
+        for (k = 0; k < length; k++)
+        {
+            bytes[state->used + k] = ((uint8 *)payload)[k];
+        }
+
+        state->used += length;
+        bytes[0]++;
+
+        if ((messageId <= config->urgentIdLimit) || (state->used >= config->flushBytes))
+        {
+            gwFlushContainer(i);
+        }
+
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+
+    return dstNodeMask;
+}
+
+/* Unpack a received container frame: returns FALSE if the frame is no container of its node. Otherwise the PDUs are
+ * queued as classic frames on the classic node of the container, in container order, and the node is serviced once
+ * for all of them (or gets them through its cross-core queue). Parsing stops at the first PDU which does not fit into
+ * the received frame.
+ */
+static boolean gwUnpackContainer(uint8 srcNode, Ifx_CAN_RXMSG *element, boolean extended, uint32 canId)
+{
+    uint32  rxData[IFXCAN_CAN_MESSAGE_DATA_WORDS];
+    uint8  *bytes    = (uint8 *)rxData;
+    uint8   core     = g_gwNodeCore[srcNode];
+    uint8   accepted = 0;
+    boolean interruptState;
+    uint32  words;
+    uint32  length;
+    uint32  header;
+    uint32  pos;
+    uint8   frame;
+    uint8   count;
+    uint8   dlc;
+    uint8   i;
+    uint8   k;
+
+    for (i = 0; i < NUM_GW_CONTAINERS; i++)
+    {
+        const MulticanGwContainerConfig *config = &gwContainers[i];
+
+        if ((config->fdNode != srcNode) || (config->containerId != canId) ||
+            ((config->containerId > 0x7FF) != (extended != FALSE)) ||
+            ((g_multican.nodeEnabledMask & GW_NODE(config->classicNode)) == 0))
+        {
+            continue;
+        }
+
+        words  = IfxCan_Node_getDataLength((IfxCan_DataLengthCode)element->R1.B.DLC);
+        length = IfxCan_Node_getDataLengthInBytes((IfxCan_DataLengthCode)element->R1.B.DLC);
+
+        for (k = 0; k < words; k++)
+        {
+            rxData[k] = ((uint32 *)element)[2 + k];
+        }
+
+        pos   = GW_CONTAINER_HEADER_SIZE;
+        count = 0;
+
+        while ((count < bytes[0]) && (count < GW_CONTAINER_MAX_PDUS) && ((pos + GW_CONTAINER_PDU_HEADER) <= length))
+        {
+            header = (uint32)bytes[pos] | ((uint32)bytes[pos + 1] << 8) | ((uint32)bytes[pos + 2] << 16) |
+                     ((uint32)bytes[pos + 3] << 24);
+            dlc    = bytes[pos + 4];
+            pos   += GW_CONTAINER_PDU_HEADER;
+
+            if ((dlc > 8) || ((pos + dlc) > length))
+            {
+                break;
+            }
+
+            interruptState = IfxCpu_disableInterrupts();
+            frame          = gwFrameFromData(core, header & 0x1FFFFFFFU, ((header >> 31) != 0) ? TRUE : FALSE, (IfxCan_DataLengthCode)dlc,
+                                             IfxCan_FrameMode_standard, &bytes[pos]);
+            accepted      |= gwEgressSubmit(core, frame, GW_NODE(config->classicNode));
+            IfxCpu_restoreInterrupts(interruptState);
+
+            pos += dlc;
+            count++;
+        }
+
+        gwEgressServiceNodes(accepted & g_multican.coreNodeMask[core]);
+
+        g_multican.stats[srcNode].containerFrames++;
+        g_multican.stats[srcNode].containerPdus += count;
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/* Time trigger of the containers, called every millisecond on every core (CPU0: 1ms task, CPU1 / CPU2: 1ms tick ISR or 1ms task).
+ * Each core only ages the containers whose classic node it owns. Runs with the core's interrupts disabled, its
+ * gateway ISRs pack into the same containers.
+ */
+void canGatewayContainerTick(void)
+{
+    uint8   core           = (uint8)IfxCpu_getCoreIndex();
+    boolean interruptState = IfxCpu_disableInterrupts();
+    uint8   i;
+
+    for (i = 0; i < NUM_GW_CONTAINERS; i++)
+    {
+        gwContainerStateType *state = &g_multican.container[i];
+
+        if (g_gwNodeCore[gwContainers[i].classicNode] != core)
+        {
+            continue;
+        }
+
+        if (state->used > GW_CONTAINER_HEADER_SIZE)
+        {
+            state->ageMs++;
+
+            if (state->ageMs >= gwContainers[i].flushTimeMs)
+            {
+                gwFlushContainer(i);
+            }
+        }
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+/* Check a received CAN ID against one filter entry, with the semantic of the equivalent filter element. */
+static boolean gwFilterMatch(const MulticanGwFilter *filter, boolean extended, uint32 canId)
+{
+    boolean match = FALSE;
+
+    if ((filter->extended != 0) == (extended != FALSE))
+    {
+        switch ((IfxCan_FilterType)filter->type)
+        {
+        case IfxCan_FilterType_range:
+            match = ((canId >= filter->id1) && (canId <= filter->id2)) ? TRUE : FALSE;
+            break;
+        case IfxCan_FilterType_dualId:
+            match = ((canId == filter->id1) || (canId == filter->id2)) ? TRUE : FALSE;
+            break;
+        case IfxCan_FilterType_classic:
+            match = ((canId & filter->id2) == (filter->id1 & filter->id2)) ? TRUE : FALSE;
+            break;
+        default:
+            break;
+        }
+    }
+
+    return match;
+}
+
+/* Software second stage of a non-matching frame: the first overflow filter entry of the source node matching the ID
+ * selects the pair (same first-match order as the filter element list). Returns GW_NO_PAIR if none matches.
+ */
+static uint8 gwSecondStageFilter(uint8 srcNode, boolean extended, uint32 canId)
+{
+    uint8 i;
+
+    for (i = 0; i < g_multican.filterUsage[srcNode].swFilters; i++)
+    {
+        if (gwFilterMatch(g_multican.swFilter[srcNode][i].filter, extended, canId) != FALSE)
+        {
+            return g_multican.swFilter[srcNode][i].pairIdx;
+        }
+    }
+
+    return GW_NO_PAIR;
+}
+
+/* Queue a burst of received elements into the egress queues of their destination nodes.
+ * Every element is copied once from the source Rx FIFO into a pool frame, which the egress queues of all destinations
+ * of its mask share (multicast); the frame returns to the pool when its last destination has sent or dropped it.
+ * The Rx elements are released by the batch acknowledge of gwDrainRxFifo() right after. Frames that do not fit into a
+ * full egress queue are dropped instead of stalling the source. Each destination node is serviced once per burst,
+ * i.e. one TXBAR write per destination node and burst. Destinations owned by another core get a copy through the
+ * cross-core queue and are serviced by their own core. Only the submit of one frame runs with the core's interrupts
+ * disabled, a higher priority gateway ISR can forward its own frames between two elements of the burst.
+ */
+static void gwForwardBurst(uint8 srcNode, Ifx_CAN_RXMSG **elements, const uint8 *dstNodeMask, const uint32 *newId, uint8 count)
+{
+    uint8   core       = g_gwNodeCore[srcNode];
+    uint8   dstPending = 0;
+    boolean interruptState;
+    uint8   i;
+
+    g_multican.stats[srcNode].rxFrames += count;
+
+    for (i = 0; i < count; i++)
+    {
+        if ((dstNodeMask[i] & g_multican.nodeEnabledMask) != 0)
+        {
+            interruptState  = IfxCpu_disableInterrupts();
+            dstPending     |= gwEgressSubmit(core, gwFrameFromRxElement(core, elements[i], newId[i]), dstNodeMask[i]);
+            IfxCpu_restoreInterrupts(interruptState);
+        }
+    }
+
+    gwEgressServiceNodes(dstPending & g_multican.coreNodeMask[core]);
+}
+
+/* Drain one Rx FIFO of a source node in a single batch.
+ * Fill level and get index are sampled once, the elements are forwarded in FIFO order straight from the message RAM
+ * and only the last one is acknowledged, which releases the whole batch with one register write (same drain
+ * semantics as IfxCan_Can_readMessages(), without copying the frames out of the message RAM).
+ * A frame with a route follows its route, any other frame its pair (filter index) or the catch-all pair. Container
+ * frames are unpacked, classic frames towards a container's CAN FD node are packed into the container.
+ */
+static void gwDrainRxFifo(uint8 srcNode, IfxCan_RxFifo rxFifo)
+{
+    IfxCan_Can_Node   *node = &g_multican.canNode[srcNode];
+    Ifx_CAN_RXMSG     *elements[GW_RX_FIFO0_SIZE];
+    uint8              dstNodeMask[GW_RX_FIFO0_SIZE];
+    uint32             newId[GW_RX_FIFO0_SIZE];
+    const gwRouteType *route;
+    Ifx_CAN_RXMSG     *element;
+    IfxCan_RxBufferId  getIndex;
+    IfxCan_RxBufferId  bufferId = IfxCan_RxBufferId_0;
+    boolean            extended;
+    uint8              fillLevel;
+    uint8              count;
+    uint32             canId;
+    uint8              pairIdx;
+
+    if (rxFifo == IfxCan_RxFifo_0)
+    {
+        fillLevel = IfxCan_Node_getRxFifo0FillLevel(node->node);
+        getIndex  = IfxCan_Node_getRxFifo0GetIndex(node->node);
+    }
+    else
+    {
+        fillLevel = IfxCan_Node_getRxFifo1FillLevel(node->node);
+        getIndex  = IfxCan_Node_getRxFifo1GetIndex(node->node);
+    }
+
+    /* remaining elements (if Rx FIFO 1 is ever made deeper than Rx FIFO 0) are taken by the next ISR run */
+    if (fillLevel > GW_RX_FIFO0_SIZE)
+    {
+        fillLevel = GW_RX_FIFO0_SIZE;
+    }
+
+    for (count = 0; count < fillLevel; count++)
+    {
+        if (rxFifo == IfxCan_RxFifo_0)
+        {
+            bufferId = (IfxCan_RxBufferId)((getIndex + count) % GW_RX_FIFO0_SIZE);
+            element  = IfxCan_Node_getRxFifo0ElementAddress(node->node, node->messageRAM.baseAddress,
+                                                            node->messageRAM.rxFifo0StartAddress, bufferId);
+        }
+        else
+        {
+            bufferId = (IfxCan_RxBufferId)((getIndex + count) % GW_RX_FIFO1_SIZE);
+            element  = IfxCan_Node_getRxFifo1ElementAddress(node->node, node->messageRAM.baseAddress,
+                                                            node->messageRAM.rxFifo1StartAddress, bufferId);
+        }
+
+        extended        = (element->R0.B.XTD != 0) ? TRUE : FALSE;
+        canId           = IfxCan_Node_getMesssageId(element);
+        elements[count] = element;
+
+#if APP_CANLOG_ENABLE != 0
+        /* Logged as received, before a container is unpacked or a transform changes the element */
+        appCanLogFrame(srcNode, element);
+#endif
+
+        if (gwUnpackContainer(srcNode, element, extended, canId) != FALSE)
+        {
+            /* container frame: its PDUs have been sent on the classic node, the container itself is consumed */
+            dstNodeMask[count] = GW_NO_DST;
+            newId[count]       = GW_ID_UNCHANGED;
+            continue;
+        }
+
+        route = canGatewayLookupRoute(srcNode, extended, canId);
+
+        if (route != NULL_PTR)
+        {
+            if (route->handler != NULL_PTR)
+            {
+                route->handler(srcNode, element);
+            }
+
+            if (route->transform != NULL_PTR)
+            {
+                canGatewayApplyTransform(element, route->transform);
+            }
+
+            dstNodeMask[count] = route->dstNodeMask;
+            newId[count]       = route->newId;
+        }
+        else
+        {
+            if (rxFifo == IfxCan_RxFifo_0)
+            {
+                /* filtered frame: the filter index selects the pair */
+                if (extended != FALSE)
+                {
+                    pairIdx = g_multican.extFilterPair[srcNode][element->R1.B.FIDX % GW_MAX_EXT_FILTERS];
+                }
+                else
+                {
+                    pairIdx = g_multican.stdFilterPair[srcNode][element->R1.B.FIDX % GW_MAX_STD_FILTERS];
+                }
+            }
+            else
+            {
+                /* non-matching frame: overflow filter entries first, then the catch-all pair of the source node */
+                pairIdx = gwSecondStageFilter(srcNode, extended, canId);
+
+                if (pairIdx == GW_NO_PAIR)
+                {
+                    pairIdx = g_multican.catchAllPair[srcNode];
+                }
+            }
+
+            dstNodeMask[count] = (pairIdx != GW_NO_PAIR) ? gwPairs[pairIdx].dstNodeMask : GW_NO_DST;
+            newId[count]       = GW_ID_UNCHANGED;
+        }
+
+        /* destinations reached through a container take the frame as a PDU instead */
+        dstNodeMask[count] = gwPackContainers(srcNode, element, dstNodeMask[count], newId[count]);
+    }
+
+    if (count > 0)
+    {
+        gwForwardBurst(srcNode, elements, dstNodeMask, newId, count);
+
+        if (rxFifo == IfxCan_RxFifo_0)
+        {
+            IfxCan_Node_setRxFifo0AcknowledgeIndex(node->node, bufferId);
+        }
+        else
+        {
+            IfxCan_Node_setRxFifo1AcknowledgeIndex(node->node, bufferId);
+        }
+    }
+}
+
+/* Drain Rx FIFO 0 (filtered) and Rx FIFO 1 (catch-all) of a source node and end its moderation batch: the timeout
+ * is disarmed and the new message interrupts are unmasked again, so the next frame starts the next batch.
+ * Rx FIFO 1 of a DMA bypassed node belongs to its DMA linked list and is not touched.
+ */
+static void gwRxDrain(uint8 srcNode)
+{
+    IfxCan_Can_Node *node   = &g_multican.canNode[srcNode];
+    boolean          bypass = ((g_multican.bypassNodeMask & GW_NODE(srcNode)) != 0) ? TRUE : FALSE;
+    uint8            core   = g_gwNodeCore[srcNode];
+    boolean          interruptState;
+
+    IfxCan_Node_clearInterruptFlag(node->node, IfxCan_Interrupt_rxFifo0WatermarkReached);
+    IfxCan_Node_clearInterruptFlag(node->node, IfxCan_Interrupt_rxFifo0NewMessage);
+    gwDrainRxFifo(srcNode, IfxCan_RxFifo_0);
+
+    if (bypass == FALSE)
+    {
+        IfxCan_Node_clearInterruptFlag(node->node, IfxCan_Interrupt_rxFifo1WatermarkReached);
+        IfxCan_Node_clearInterruptFlag(node->node, IfxCan_Interrupt_rxFifo1NewMessage);
+        gwDrainRxFifo(srcNode, IfxCan_RxFifo_1);
+    }
+
+    /* the masks are shared with the other gateway ISRs and the moderation timeout of the core */
+    interruptState                  = IfxCpu_disableInterrupts();
+    g_multican.rxArmedMask[core]   &= (uint8)~GW_NODE(srcNode);
+    g_multican.rxExpiredMask[core] &= (uint8)~GW_NODE(srcNode);
+    IfxCpu_restoreInterrupts(interruptState);
+    g_multican.stats[srcNode].rxDrains++;
+
+    IfxCan_Node_enableInterrupt(node->node, IfxCan_Interrupt_rxFifo0NewMessage);
+
+    if (bypass == FALSE)
+    {
+        IfxCan_Node_enableInterrupt(node->node, IfxCan_Interrupt_rxFifo1NewMessage);
+    }
+}
+
+/* Program the moderation compare of a core to the earliest deadline of its armed nodes. Nodes whose deadline has
+ * passed, also while the compare is written (the STM compare only matches on equality), are moved to the expired mask
+ * and their gateway ISR is raised: a node is only ever drained by its own ISR, never by the timeout or another node's
+ * ISR. Called with the core's interrupts disabled.
+ */
+static void gwRxScheduleTimeout(uint8 core)
+{
+    Ifx_STM *stm = g_gwCoreStm[core];
+    uint32   now;
+    uint32   next;
+    sint32   remaining;
+    sint32   earliest;
+    uint8    node;
+
+    for ( ; ; )
+    {
+        now      = IfxStm_getLower(stm);
+        earliest = 0x7FFFFFFF;
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            if ((g_multican.rxArmedMask[core] & GW_NODE(node)) == 0)
+            {
+                continue;
+            }
+
+            remaining = (sint32)(g_multican.rxModeration[node].deadline - now);
+
+            if (remaining <= 0)
+            {
+                g_multican.stats[node].rxTimeouts++;
+                g_multican.rxArmedMask[core]   &= (uint8)~GW_NODE(node);
+                g_multican.rxExpiredMask[core] |= (uint8)GW_NODE(node);
+                IfxSrc_setRequest(g_multican.doorbell[node]);
+            }
+            else if (remaining < earliest)
+            {
+                earliest = remaining;
+            }
+        }
+
+        if (g_multican.rxArmedMask[core] == 0)
+        {
+            return;
+        }
+
+        next = now + (uint32)earliest;
+        IfxStm_updateCompare(stm, GW_RX_MODERATION_CMP, next);
+
+        if ((sint32)(next - IfxStm_getLower(stm)) > 0)
+        {
+            return;
+        }
+    }
+}
+
+/* First frame of a moderated batch: start the node's timeout and mask its new message interrupts until the drain. */
+static void gwRxArm(uint8 srcNode)
+{
+    IfxCan_Can_Node    *node       = &g_multican.canNode[srcNode];
+    gwRxModerationType *moderation = &g_multican.rxModeration[srcNode];
+    uint8               core       = g_gwNodeCore[srcNode];
+    boolean             interruptState;
+
+    IfxCan_Node_disableInterrupt(node->node, IfxCan_Interrupt_rxFifo0NewMessage);
+
+    /* Rx FIFO 1 new message requests of a DMA bypassed node keep feeding the DMA */
+    if ((g_multican.bypassNodeMask & GW_NODE(srcNode)) == 0)
+    {
+        IfxCan_Node_disableInterrupt(node->node, IfxCan_Interrupt_rxFifo1NewMessage);
+    }
+
+    interruptState                = IfxCpu_disableInterrupts();
+    moderation->deadline          = IfxStm_getLower(g_gwCoreStm[core]) + moderation->timeoutTicks;
+    g_multican.rxArmedMask[core] |= (uint8)GW_NODE(srcNode);
+
+    gwRxScheduleTimeout(core);
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+/* Forwarding engine of one node, called by its gateway ISR on the core owning the node. Frames other cores handed
+ * over to this core are queued first. A watermark, an expired timeout (or, without moderation, any new frame) drains
+ * the Rx FIFOs; the first frame of a moderated batch only starts the timeout. Finally the egress scheduler of the node
+ * runs for its finished (transmitted or cancelled) Tx buffers.
+ * The gateway ISRs of a core have different priorities (the SRPN of an interrupt is unique per core) and preempt each
+ * other. The Rx FIFOs and interrupt flags of the node belong to its own ISR; the frame pool, the egress queues and
+ * Tx buffers of the destination nodes, the cross-core queues and the moderation masks of the core are shared and
+ * only touched with the core's interrupts disabled, for one frame or one egress scheduler pass at a time.
+ */
+void canGatewayForward(uint8 srcNode)
+{
+    IfxCan_Can_Node *node   = &g_multican.canNode[srcNode];
+    boolean          bypass = ((g_multican.bypassNodeMask & GW_NODE(srcNode)) != 0) ? TRUE : FALSE;
+    uint8            core   = g_gwNodeCore[srcNode];
+    boolean          interruptState;
+    boolean          watermarkReached;
+    boolean          newMessage;
+
+    APP_TRACE_ISR_ENTER_EVENT();
+
+    IfxCan_Node_clearInterruptFlag(node->node, IfxCan_Interrupt_transmissionCompleted);
+    IfxCan_Node_clearInterruptFlag(node->node, IfxCan_Interrupt_transmissionCancellationFinished);
+
+    gwXcoreReceive(core);
+
+    watermarkReached = IfxCan_Node_getInterruptFlagStatus(node->node, IfxCan_Interrupt_rxFifo0WatermarkReached);
+    newMessage       = IfxCan_Node_getInterruptFlagStatus(node->node, IfxCan_Interrupt_rxFifo0NewMessage);
+
+    if (bypass == FALSE)
+    {
+        watermarkReached |= IfxCan_Node_getInterruptFlagStatus(node->node, IfxCan_Interrupt_rxFifo1WatermarkReached);
+        newMessage       |= IfxCan_Node_getInterruptFlagStatus(node->node, IfxCan_Interrupt_rxFifo1NewMessage);
+    }
+
+    if ((watermarkReached != FALSE) || ((g_multican.rxExpiredMask[core] & GW_NODE(srcNode)) != 0) ||
+        ((newMessage != FALSE) && (g_multican.rxModeration[srcNode].watermark <= 1)))
+    {
+        gwRxDrain(srcNode);
+    }
+    else if ((newMessage != FALSE) && ((g_multican.rxArmedMask[core] & GW_NODE(srcNode)) == 0))
+    {
+        gwRxArm(srcNode);
+    }
+
+    interruptState = IfxCpu_disableInterrupts();
+    gwEgressService(srcNode);
+    IfxCpu_restoreInterrupts(interruptState);
+
+    APP_TRACE_ISR_EXIT_EVENT();
+}
+
+/* Change the receive moderation of a node at runtime (see gwRxModeration[] for the values), from task context.
+ * A new timeout is one word the gateway ISR reads when it starts the next batch, any core may set it. A new watermark
+ * is written in configuration change mode, which takes the node off the bus while it waits for the INIT handshake:
+ * this only runs on the core owning the node with its interrupts enabled (a task or the idle loop, never an ISR). The
+ * node's interrupt line is disabled meanwhile and its Rx FIFOs are drained first; the other gateway ISRs of the core
+ * keep running. The line is requested once enabled again, its ISR requeues the Tx buffer requests the change reset.
+ * Returns FALSE for a disabled node, for a watermark change from another core or with interrupts disabled, and for a
+ * watermark change on a DMA bypass source node, where resetting Rx FIFO 1 would put the linked list out of step with
+ * the FIFO.
+ */
+boolean canGatewaySetRxModeration(uint8 node, uint8 watermark, uint16 timeoutUs)
+{
+    gwRxModerationType    *moderation;
+    volatile Ifx_SRC_SRCR *doorbell;
+    Ifx_CAN_N             *sfr;
+
+    if ((node >= NUMBER_OF_CAN_NODES) || ((g_multican.nodeEnabledMask & GW_NODE(node)) == 0))
+    {
+        return FALSE;
+    }
+
+    moderation = &g_multican.rxModeration[node];
+
+    if ((timeoutUs == 0) || (watermark < 1))
+    {
+        watermark = 1;
+    }
+
+    if (watermark > GW_RX_FIFO0_SIZE)
+    {
+        watermark = GW_RX_FIFO0_SIZE;
+    }
+
+    if (watermark != moderation->watermark)
+    {
+        if (((g_multican.bypassNodeMask & GW_NODE(node)) != 0) || (IfxCpu_getCoreIndex() != g_gwNodeCore[node]) ||
+            (IfxCpu_areInterruptsEnabled() == FALSE))
+        {
+            return FALSE;
+        }
+
+        doorbell = g_multican.doorbell[node];
+        sfr      = g_multican.canNode[node].node;
+
+        IfxSrc_disable(doorbell);
+        gwRxDrain(node);
+
+        IfxCan_Node_enableConfigurationChange(sfr);
+        IfxCan_Node_setRxFifo0WatermarkLevel(sfr, (watermark > 1) ? watermark : 0);
+        IfxCan_Node_setRxFifo1WatermarkLevel(sfr, (watermark > 1) ? ((watermark < GW_RX_FIFO1_SIZE) ? watermark : GW_RX_FIFO1_SIZE) : 0);
+        IfxCan_Node_disableConfigurationChange(sfr);
+
+        moderation->watermark = watermark;
+
+        IfxSrc_enable(doorbell);
+        IfxSrc_setRequest(doorbell);
+    }
+
+    moderation->timeoutTicks = (uint32)IfxStm_getTicksFromMicroseconds(g_gwCoreStm[g_gwNodeCore[node]], timeoutUs);
+
+    return TRUE;
+}
+
+/* Build and start the DMA linked list of one bypass.
+ * Per Rx FIFO 1 element k of the source node the list holds GW_BYPASS_MOVES transaction control sets:
+ *   0: clear the Rx FIFO 1 new message flag, so the next frame raises a new DMA request
+ *   1: copy element k (header words and data field) into bypass Tx buffer k of the destination node
+ *   2: request the transmission of bypass Tx buffer k (TXBAR)
+ *   3: acknowledge element k, which hands it back to the hardware
+ * Sets 1..3 start as soon as they are loaded (SCH), set 0 waits for the next DMA request. Every request moves exactly
+ * one frame, so the circular list stays in step with the Rx FIFO 1 get index. Set 0 of every GW_BYPASS_WATERMARK-th
+ * element raises the channel interrupt when it is loaded (SIT), i.e. after GW_BYPASS_WATERMARK frames.
+ * The Rx element header is copied raw: the R1 bits which are the Rx timestamp and filter index become reserved bits
+ * and the message marker of the Tx element, which are unused as no Tx event FIFO is configured (EFC = 0).
+ * Bypass Tx buffer k is dedicated Tx buffer GW_EGRESS_TX_BUFFERS + k, behind the buffers of the egress scheduler.
+ * Addresses are taken from the gateway message RAM layout, so the list is in place before the nodes leave init mode.
+ */
+static void gwInitBypass(uint8 bypassIdx)
+{
+    const MulticanGwBypassConfig *bypass   = &gwBypass[bypassIdx];
+    gwBypassValueType            *value    = &g_gwBypassValue[bypassIdx];
+    Ifx_CAN                      *srcCan   = g_multican.can[bypass->srcNode / CAN_NODES_PER_MODULE].can;
+    Ifx_CAN                      *dstCan   = g_multican.can[bypass->dstNode / CAN_NODES_PER_MODULE].can;
+    Ifx_CAN_N                    *srcSfr   = IfxCan_getNodePointer(srcCan, (IfxCan_NodeId)(bypass->srcNode % CAN_NODES_PER_MODULE));
+    Ifx_CAN_N                    *dstSfr   = IfxCan_getNodePointer(dstCan, (IfxCan_NodeId)(bypass->dstNode % CAN_NODES_PER_MODULE));
+    uint32                        rxFifo1  = (uint32)srcCan + ((bypass->srcNode % CAN_NODES_PER_MODULE) * GW_NODE_RAM_SIZE) + GW_RAM_RX_FIFO1_OFFSET;
+    uint32                        txBuffer = (uint32)dstCan + ((bypass->dstNode % CAN_NODES_PER_MODULE) * GW_NODE_RAM_SIZE) + GW_RAM_TX_BUFFERS_OFFSET;
+    IfxCpu_Id                     coreId   = IfxCpu_getCoreId();
+    IfxDma_Dma_ChannelConfig      cfg;
+    uint8                         k;
+    uint8                         move;
+
+    value->rxFlagClear = 1U << IfxCan_Interrupt_rxFifo1NewMessage;
+
+    for (k = 0; k < GW_RX_FIFO1_SIZE; k++)
+    {
+        value->txRequest[k]     = 1U << (GW_EGRESS_TX_BUFFERS + k);
+        value->rxAcknowledge[k] = k;
+    }
+
+    IfxDma_Dma_initChannelConfig(&cfg, &g_multican.dma);
+    cfg.channelId                     = (IfxDma_ChannelId)bypass->dmaChannel;
+    cfg.requestMode                   = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+    cfg.operationMode                 = IfxDma_ChannelOperationMode_continuous;
+    cfg.moveSize                      = IfxDma_ChannelMoveSize_32bit;
+    cfg.shadowControl                 = IfxDma_ChannelShadow_linkedList;
+    cfg.hardwareRequestEnabled        = TRUE;
+    cfg.channelInterruptPriority      = g_gwBypassIsrPriority[bypassIdx];
+    cfg.channelInterruptTypeOfService = g_gwCoreTos[g_gwBypassCore[bypassIdx]];
+
+    for (k = 0; k < GW_RX_FIFO1_SIZE; k++)
+    {
+        for (move = 0; move < GW_BYPASS_MOVES; move++)
+        {
+            Ifx_DMA_CH *next = (move < (GW_BYPASS_MOVES - 1)) ? &g_gwBypassList[bypassIdx][k][move + 1]
+                               : &g_gwBypassList[bypassIdx][(k + 1) % GW_RX_FIFO1_SIZE][0];
+
+            switch (move)
+            {
+            case 0:
+                cfg.sourceAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &value->rxFlagClear);
+                cfg.destinationAddress = (uint32)&srcSfr->IR.U;
+                cfg.transferCount      = 1;
+                break;
+            case 1:
+                cfg.sourceAddress      = rxFifo1 + (k * GW_ELEMENT_SIZE);
+                cfg.destinationAddress = txBuffer + ((GW_EGRESS_TX_BUFFERS + k) * GW_ELEMENT_SIZE);
+                cfg.transferCount      = GW_ELEMENT_SIZE / 4;
+                break;
+            case 2:
+                cfg.sourceAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &value->txRequest[k]);
+                cfg.destinationAddress = (uint32)&dstSfr->TX.BAR.U;
+                cfg.transferCount      = 1;
+                break;
+            default:
+                cfg.sourceAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &value->rxAcknowledge[k]);
+                cfg.destinationAddress = (uint32)&srcSfr->RX.F1A.U;
+                cfg.transferCount      = 1;
+                break;
+            }
+
+            cfg.shadowAddress = IFXCPU_GLB_ADDR_DSPR(coreId, next);
+
+            if ((k == 0) && (move == 0))
+            {
+                IfxDma_Dma_initChannel(&g_multican.bypassChannel[bypassIdx], &cfg);
+            }
+
+            IfxDma_Dma_initLinkedListEntry((void *)&g_gwBypassList[bypassIdx][k][move], &cfg);
+
+            if (move != 0)
+            {
+                g_gwBypassList[bypassIdx][k][move].CHCSR.B.SCH = 1;
+            }
+            else if ((k % GW_BYPASS_WATERMARK) == 0)
+            {
+                g_gwBypassList[bypassIdx][k][move].CHCSR.B.SIT = 1;
+            }
+        }
+    }
+}
+
+/* DMA bypass watermark: GW_BYPASS_WATERMARK more frames of the source node have been moved. */
+static void gwBypassWatermark(uint8 bypassIdx)
+{
+    IfxDma_Dma_Channel *channel = &g_multican.bypassChannel[bypassIdx];
+    gwNodeStatsType    *stats   = &g_multican.stats[gwBypass[bypassIdx].srcNode];
+
+    IfxDma_Dma_clearChannelInterrupt(channel);
+    stats->bypassFrames += GW_BYPASS_WATERMARK;
+
+    if (IfxDma_getChannelTransactionRequestLost(channel->dma, channel->channelId) != FALSE)
+    {
+        IfxDma_clearChannelTransactionRequestLost(channel->dma, channel->channelId);
+        stats->bypassLost++;
+    }
+}
+
+/* Receive moderation timeout of a core: hands its nodes whose timeout has expired to their gateway ISRs */
+static void gwRxTimeout(uint8 core)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    IfxStm_clearCompareFlag(g_gwCoreStm[core], GW_RX_MODERATION_CMP);
+    gwRxScheduleTimeout(core);
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+/* Interrupt Service Routines (ISR) called for a new frame or a reached watermark in Rx FIFO 0 or Rx FIFO 1 of a node,
+ * for its finished Tx buffers and for frames handed over by other cores. Each node has its own interrupt line and ISR
+ * in the vector table of its core, so every ISR only forwards the traffic of its own source node.
+ */
+IFX_INTERRUPT(canGatewayIsrNode0, GW_NODE0_CORE, ISR_PRIORITY_CAN_GW_NODE0) { canGatewayForward(0); }
+IFX_INTERRUPT(canGatewayIsrNode1, GW_NODE1_CORE, ISR_PRIORITY_CAN_GW_NODE1) { canGatewayForward(1); }
+IFX_INTERRUPT(canGatewayIsrNode2, GW_NODE2_CORE, ISR_PRIORITY_CAN_GW_NODE2) { canGatewayForward(2); }
+IFX_INTERRUPT(canGatewayIsrNode3, GW_NODE3_CORE, ISR_PRIORITY_CAN_GW_NODE3) { canGatewayForward(3); }
+IFX_INTERRUPT(canGatewayIsrNode4, GW_NODE4_CORE, ISR_PRIORITY_CAN_GW_NODE4) { canGatewayForward(4); }
+IFX_INTERRUPT(canGatewayIsrNode5, GW_NODE5_CORE, ISR_PRIORITY_CAN_GW_NODE5) { canGatewayForward(5); }
+IFX_INTERRUPT(canGatewayIsrNode6, GW_NODE6_CORE, ISR_PRIORITY_CAN_GW_NODE6) { canGatewayForward(6); }
+IFX_INTERRUPT(canGatewayIsrNode7, GW_NODE7_CORE, ISR_PRIORITY_CAN_GW_NODE7) { canGatewayForward(7); }
+
+/* DMA bypass watermark ISRs, one per gwBypass[] entry */
+IFX_INTERRUPT(gwBypassIsr0, GW_BYPASS0_CORE, ISR_PRIORITY_GW_BYPASS0) { gwBypassWatermark(0); }
+
+/* Receive moderation timeout ISRs, one per core (STM compare 1 of the core) */
+IFX_INTERRUPT(gwRxTimeoutIsrCpu0, 0, ISR_PRIORITY_GW_RX_TIMEOUT) { gwRxTimeout(0); }
+IFX_INTERRUPT(gwRxTimeoutIsrCpu1, 1, ISR_PRIORITY_GW_RX_TIMEOUT) { gwRxTimeout(1); }
+IFX_INTERRUPT(gwRxTimeoutIsrCpu2, 2, ISR_PRIORITY_GW_RX_TIMEOUT) { gwRxTimeout(2); }
+
+/* Function to initialize MCMCAN modules, nodes and filter elements related for this application use case */
+void initMultican(void)
+{
+    uint8 currentCanNode;
+    uint8 stdFilterCount[NUMBER_OF_CAN_NODES] = {0};
+    uint8 extFilterCount[NUMBER_OF_CAN_NODES] = {0};
+
+    /* ==========================================================================================
+     * CAN module configuration and initialization:
+     * ==========================================================================================
+     *  - load default CAN module configuration into configuration structure
+     *  - initialize CAN0 and CAN1 modules (nodes 0..3 and 4..7 of the gateway)
+     * ==========================================================================================
+     */
+    IfxCan_Can_initModuleConfig(&g_multican.canConfig, &MODULE_CAN0);
+    IfxCan_Can_initModule(&g_multican.can[0], &g_multican.canConfig);
+
+    IfxCan_Can_initModuleConfig(&g_multican.canConfig, &MODULE_CAN1);
+    IfxCan_Can_initModule(&g_multican.can[1], &g_multican.canConfig);
+
+    /* ==========================================================================================
+     * Routing tables:
+     * ==========================================================================================
+     *  - every filter element of a source node maps back to its pair (FIDX -> pair)
+     *  - filter entries beyond the node's filter element capacity go to the software second stage
+     *  - the first pair of a source node also takes the node's non-matching frames
+     *  - pairs with a disabled source node or without any enabled destination node are skipped
+     * ==========================================================================================
+     */
+    g_multican.nodeEnabledMask = 0;
+
+    for (int c = 0; c < GW_NUM_CORES; c++)
+    {
+        g_multican.coreNodeMask[c] = 0;
+    }
+
+    for (currentCanNode = 0; currentCanNode < NUMBER_OF_CAN_NODES; currentCanNode++)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, g_gwNodeCore[currentCanNode] < GW_NUM_CORES);
+
+        if (canNodeEnabled[currentCanNode])
+        {
+            g_multican.nodeEnabledMask |= (uint8)GW_NODE(currentCanNode);
+            g_multican.coreNodeMask[g_gwNodeCore[currentCanNode]] |= (uint8)GW_NODE(currentCanNode);
+        }
+
+        g_multican.catchAllPair[currentCanNode] = GW_NO_PAIR;
+        g_multican.filterUsage[currentCanNode].swFilters = 0;
+
+        for (int j = 0; j < GW_MAX_STD_FILTERS; j++)
+        {
+            g_multican.stdFilterPair[currentCanNode][j] = GW_NO_PAIR;
+        }
+
+        for (int j = 0; j < GW_MAX_EXT_FILTERS; j++)
+        {
+            g_multican.extFilterPair[currentCanNode][j] = GW_NO_PAIR;
+        }
+    }
+
+    for (int i = 0; i < NUM_GW_PAIRS; i++)
+    {
+        const MulticanGwPairConfig *pair = &gwPairs[i];
+
+        if (!canNodeEnabled[pair->srcNode] || ((pair->dstNodeMask & g_multican.nodeEnabledMask) == 0))
+        {
+            continue;
+        }
+
+        if (g_multican.catchAllPair[pair->srcNode] == GW_NO_PAIR)
+        {
+            g_multican.catchAllPair[pair->srcNode] = (uint8)i;
+        }
+
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, pair->numFilters <= MAX_FILTERS_PER_PAIR);
+
+        for (int j = 0; j < pair->numFilters; j++)
+        {
+            const MulticanGwFilter *entry = &pair->filters[j];
+            gwFilterUsageType      *usage = &g_multican.filterUsage[pair->srcNode];
+
+            if ((entry->extended != 0) && (extFilterCount[pair->srcNode] < GW_MAX_EXT_FILTERS))
+            {
+                g_multican.extFilterPair[pair->srcNode][extFilterCount[pair->srcNode]++] = (uint8)i;
+            }
+            else if ((entry->extended == 0) && (stdFilterCount[pair->srcNode] < GW_MAX_STD_FILTERS))
+            {
+                g_multican.stdFilterPair[pair->srcNode][stdFilterCount[pair->srcNode]++] = (uint8)i;
+            }
+            else
+            {
+                /* filter element list full: match the entry in software on the catch-all path */
+                IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, usage->swFilters < GW_MAX_SW_FILTERS);
+                g_multican.swFilter[pair->srcNode][usage->swFilters].filter  = entry;
+                g_multican.swFilter[pair->srcNode][usage->swFilters].pairIdx = (uint8)i;
+                usage->swFilters++;
+            }
+        }
+    }
+
+    /* filter RAM usage report */
+    for (currentCanNode = 0; currentCanNode < NUMBER_OF_CAN_NODES; currentCanNode++)
+    {
+        gwFilterUsageType *usage = &g_multican.filterUsage[currentCanNode];
+
+        usage->stdElements      = stdFilterCount[currentCanNode];
+        usage->extElements      = extFilterCount[currentCanNode];
+        usage->ramBytesUsed     = (uint16)((usage->stdElements * 4) + (usage->extElements * 8));
+        usage->ramBytesReserved = (uint16)((GW_MAX_STD_FILTERS * 4) + (GW_MAX_EXT_FILTERS * 8));
+    }
+
+    /* extended route keys sorted, route transforms inside the data field */
+    canGatewayCheckRoutes();
+
+    /* containers start empty */
+    for (int i = 0; i < NUM_GW_CONTAINERS; i++)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, gwContainers[i].flushBytes <= GW_DATA_FIELD_SIZE);
+
+        for (int j = 0; j < IFXCAN_CAN_MESSAGE_DATA_WORDS; j++)
+        {
+            g_multican.container[i].data[j] = 0;
+        }
+
+        g_multican.container[i].used  = GW_CONTAINER_HEADER_SIZE;
+        g_multican.container[i].ageMs = 0;
+    }
+
+    /* frame pool free list of every core (frame indices stay below GW_NO_FRAME), empty egress and cross-core queues */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (GW_NUM_CORES * GW_FRAME_POOL_SIZE) <= GW_NO_FRAME);
+
+    for (int c = 0; c < GW_NUM_CORES; c++)
+    {
+        for (int i = 0; i < GW_FRAME_POOL_SIZE; i++)
+        {
+            int frame = (c * GW_FRAME_POOL_SIZE) + i;
+
+            g_multican.frame[frame].refCount = 0;
+            g_multican.frame[frame].nextFree = (uint8)((i + 1 < GW_FRAME_POOL_SIZE) ? (frame + 1) : GW_NO_FRAME);
+        }
+
+        g_multican.freeFrame[c] = (uint8)(c * GW_FRAME_POOL_SIZE);
+
+        for (int j = 0; j < GW_NUM_CORES; j++)
+        {
+            gwXcoreRing *ring = (gwXcoreRing *)IPC_NOT_CACHED(&g_gwXcoreQueue[c][j]);
+
+            ring->ctrl.head               = 0;
+            ring->ctrl.tail               = 0;
+            ring->ctrl.status             = 0;
+            g_multican.xcoreDropped[c][j] = 0;
+        }
+    }
+
+    for (currentCanNode = 0; currentCanNode < NUMBER_OF_CAN_NODES; currentCanNode++)
+    {
+        g_multican.egress[currentCanNode].queued     = 0;
+        g_multican.egress[currentCanNode].busyMask   = 0;
+        g_multican.egress[currentCanNode].cancelMask = 0;
+    }
+
+    /* receive moderation: initial values, timeouts on STM compare 1 of the owning core (32 bit, compare 0 stays with
+     * the FreeRTOS tick)
+     */
+    for (currentCanNode = 0; currentCanNode < NUMBER_OF_CAN_NODES; currentCanNode++)
+    {
+        gwRxModerationType *moderation = &g_multican.rxModeration[currentCanNode];
+
+        moderation->watermark      = gwRxModeration[currentCanNode].watermark;
+        moderation->timeoutTicks   = (uint32)IfxStm_getTicksFromMicroseconds(g_gwCoreStm[g_gwNodeCore[currentCanNode]],
+                                                                             gwRxModeration[currentCanNode].timeoutUs);
+        moderation->deadline       = 0;
+
+        if ((moderation->watermark < 1) || (gwRxModeration[currentCanNode].timeoutUs == 0))
+        {
+            moderation->watermark = 1;
+        }
+
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, moderation->watermark <= GW_RX_FIFO0_SIZE);
+    }
+
+    for (int c = 0; c < GW_NUM_CORES; c++)
+    {
+        IfxStm_CompareConfig compareConfig;
+
+        g_multican.rxArmedMask[c]   = 0;
+        g_multican.rxExpiredMask[c] = 0;
+
+        if (g_multican.coreNodeMask[c] == 0)
+        {
+            continue;
+        }
+
+        IfxStm_initCompareConfig(&compareConfig);
+        compareConfig.comparator          = GW_RX_MODERATION_CMP;
+        compareConfig.comparatorInterrupt = IfxStm_ComparatorInterrupt_ir1;
+        compareConfig.compareOffset       = IfxStm_ComparatorOffset_0;
+        compareConfig.compareSize         = IfxStm_ComparatorSize_32Bits;
+        compareConfig.ticks               = 0x7FFFFFFF;
+        compareConfig.triggerPriority     = ISR_PRIORITY_GW_RX_TIMEOUT;
+        compareConfig.typeOfService       = g_gwCoreTos[c];
+        IfxStm_initCompare(g_gwCoreStm[c], &compareConfig);
+    }
+
+    /* ==========================================================================================
+     * DMA bypass configuration:
+     * ==========================================================================================
+     *  - the linked list of every bypass is built and its channel enabled before the nodes start,
+     *    so no Rx FIFO 1 request of the source node can get lost
+     *  - bypasses with a disabled source or destination node are skipped
+     * ==========================================================================================
+     */
+    {
+        IfxDma_Dma_Config dmaConfig;
+
+        IfxDma_Dma_initModuleConfig(&dmaConfig, &MODULE_DMA);
+        IfxDma_Dma_initModule(&g_multican.dma, &dmaConfig);
+    }
+
+    g_multican.bypassNodeMask = 0;
+    g_multican.bypassTxMask   = 0;
+
+    for (int i = 0; i < NUM_GW_BYPASS; i++)
+    {
+        const MulticanGwBypassConfig *bypass = &gwBypass[i];
+
+        if (!canNodeEnabled[bypass->srcNode] || !canNodeEnabled[bypass->dstNode])
+        {
+            continue;
+        }
+
+        /* Rx FIFO 1 of the node is no longer seen by the CPU, so no second stage filter could ever match */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, g_multican.filterUsage[bypass->srcNode].swFilters == 0);
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, bypass->dmaChannel > 0);
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, g_gwBypassCore[i] == g_gwNodeCore[bypass->srcNode]);
+
+        gwInitBypass((uint8)i);
+
+        g_multican.bypassNodeMask |= (uint8)GW_NODE(bypass->srcNode);
+        g_multican.bypassTxMask   |= (uint8)GW_NODE(bypass->dstNode);
+    }
+
+    /* ==========================================================================================
+     * CAN node [0...7] configuration and initialization:
+     * ==========================================================================================
+     *  - every node transmits and receives (it may be source and destination of different pairs)
+     *  - Rx FIFO 0 takes filtered frames, Rx FIFO 1 the non-matching ones, dedicated Tx buffers the
+     *    forwarded ones (loaded by the egress scheduler, transmission completed / cancellation finished
+     *    interrupts on the node's own line)
+     *  - each node gets its own slice of the module message RAM and its own interrupt line / ISR,
+     *    routed to the core owning the node (GW_NODEn_CORE)
+     *  - moderated nodes also raise their ISR at the Rx FIFO watermarks (wati group, same line)
+     *  - a DMA bypass source routes its Rx FIFO 1 requests to the DMA channel on a second line,
+     *    a DMA bypass destination gets further dedicated Tx buffers behind the egress ones, without
+     *    transmission interrupt
+     * ==========================================================================================
+     */
+    for (currentCanNode = 0; currentCanNode < NUMBER_OF_CAN_NODES; currentCanNode++)
+    {
+        if (canNodeEnabled[currentCanNode])
+        {
+            uint8      module    = currentCanNode / CAN_NODES_PER_MODULE;
+            uint8      localNode = currentCanNode % CAN_NODES_PER_MODULE;
+            uint16     ramOffset = (uint16)(localNode * GW_NODE_RAM_SIZE);
+
+            IfxCan_Can_initNodeConfig(&g_multican.canNodeConfig, &g_multican.can[module]);
+
+            g_multican.canNodeConfig.nodeId                                     = (IfxCan_NodeId)localNode;
+            g_multican.canNodeConfig.frame.type                                 = IfxCan_FrameType_transmitAndReceive;
+            g_multican.canNodeConfig.frame.mode                                 = IfxCan_FrameMode_fdLongAndFast;
+            g_multican.canNodeConfig.pins                                       = g_canNodePins[currentCanNode];
+
+            g_multican.canNodeConfig.txConfig.txMode                            = IfxCan_TxMode_dedicatedBuffers;
+            g_multican.canNodeConfig.txConfig.dedicatedTxBuffersNumber          = GW_EGRESS_TX_BUFFERS;
+
+            if ((g_multican.bypassTxMask & GW_NODE(currentCanNode)) != 0)
+            {
+                g_multican.canNodeConfig.txConfig.dedicatedTxBuffersNumber     += GW_BYPASS_TX_BUFFERS;
+            }
+
+            g_multican.canNodeConfig.txConfig.txFifoQueueSize                   = 0;
+            g_multican.canNodeConfig.txConfig.txBufferDataFieldSize             = IfxCan_DataFieldSize_64;
+
+            g_multican.canNodeConfig.rxConfig.rxMode                            = IfxCan_RxMode_sharedAll;
+            g_multican.canNodeConfig.rxConfig.rxFifo0DataFieldSize              = IfxCan_DataFieldSize_64;
+            g_multican.canNodeConfig.rxConfig.rxFifo1DataFieldSize              = IfxCan_DataFieldSize_64;
+            g_multican.canNodeConfig.rxConfig.rxFifo0Size                       = GW_RX_FIFO0_SIZE;
+            g_multican.canNodeConfig.rxConfig.rxFifo1Size                       = GW_RX_FIFO1_SIZE;
+
+            if (g_multican.rxModeration[currentCanNode].watermark > 1)
+            {
+                g_multican.canNodeConfig.rxConfig.rxFifo0WatermarkLevel         = g_multican.rxModeration[currentCanNode].watermark;
+                g_multican.canNodeConfig.rxConfig.rxFifo1WatermarkLevel         = (uint8)((g_multican.rxModeration[currentCanNode].watermark < GW_RX_FIFO1_SIZE) ?
+                                                                                           g_multican.rxModeration[currentCanNode].watermark : GW_RX_FIFO1_SIZE);
+            }
+
+            g_multican.canNodeConfig.filterConfig.messageIdLength               = IfxCan_MessageIdLength_both;
+            g_multican.canNodeConfig.filterConfig.standardListSize              = stdFilterCount[currentCanNode];
+            g_multican.canNodeConfig.filterConfig.extendedListSize              = extFilterCount[currentCanNode];
+            g_multican.canNodeConfig.filterConfig.standardFilterForNonMatchingFrames = IfxCan_NonMatchingFrame_acceptToRxFifo1;
+            g_multican.canNodeConfig.filterConfig.extendedFilterForNonMatchingFrames = IfxCan_NonMatchingFrame_acceptToRxFifo1;
+
+            g_multican.canNodeConfig.messageRAM.standardFilterListStartAddress  = ramOffset + GW_RAM_STD_FILTER_OFFSET;
+            g_multican.canNodeConfig.messageRAM.extendedFilterListStartAddress  = ramOffset + GW_RAM_EXT_FILTER_OFFSET;
+            g_multican.canNodeConfig.messageRAM.rxFifo0StartAddress             = ramOffset + GW_RAM_RX_FIFO0_OFFSET;
+            g_multican.canNodeConfig.messageRAM.rxFifo1StartAddress             = ramOffset + GW_RAM_RX_FIFO1_OFFSET;
+            g_multican.canNodeConfig.messageRAM.rxBuffersStartAddress           = ramOffset + GW_RAM_UNUSED_OFFSET;
+            g_multican.canNodeConfig.messageRAM.txEventFifoStartAddress         = ramOffset + GW_RAM_UNUSED_OFFSET;
+            g_multican.canNodeConfig.messageRAM.txBuffersStartAddress           = ramOffset + GW_RAM_TX_BUFFERS_OFFSET;
+
+            g_multican.canNodeConfig.interruptConfig.rxFifo0NewMessageEnabled   = TRUE;
+            g_multican.canNodeConfig.interruptConfig.rxFifo1NewMessageEnabled   = TRUE;
+            g_multican.canNodeConfig.interruptConfig.rxf0n.priority             = g_gwIsrPriority[currentCanNode];
+            g_multican.canNodeConfig.interruptConfig.rxf0n.interruptLine        = (IfxCan_InterruptLine)localNode;
+            g_multican.canNodeConfig.interruptConfig.rxf0n.typeOfService        = g_gwCoreTos[g_gwNodeCore[currentCanNode]];
+            g_multican.canNodeConfig.interruptConfig.rxf1n.priority             = g_gwIsrPriority[currentCanNode];
+            g_multican.canNodeConfig.interruptConfig.rxf1n.interruptLine        = (IfxCan_InterruptLine)localNode;
+            g_multican.canNodeConfig.interruptConfig.rxf1n.typeOfService        = g_gwCoreTos[g_gwNodeCore[currentCanNode]];
+            g_multican.canNodeConfig.interruptConfig.rxFifo0WatermarkEnabled    = TRUE;
+            g_multican.canNodeConfig.interruptConfig.rxFifo1WatermarkEnabled    = TRUE;
+            g_multican.canNodeConfig.interruptConfig.wati.priority              = g_gwIsrPriority[currentCanNode];
+            g_multican.canNodeConfig.interruptConfig.wati.interruptLine         = (IfxCan_InterruptLine)localNode;
+            g_multican.canNodeConfig.interruptConfig.wati.typeOfService         = g_gwCoreTos[g_gwNodeCore[currentCanNode]];
+            g_multican.canNodeConfig.interruptConfig.transmissionCompletedEnabled            = TRUE;
+            g_multican.canNodeConfig.interruptConfig.transmissionCancellationFinishedEnabled = TRUE;
+            g_multican.canNodeConfig.interruptConfig.traco.priority             = g_gwIsrPriority[currentCanNode];
+            g_multican.canNodeConfig.interruptConfig.traco.interruptLine        = (IfxCan_InterruptLine)localNode;
+            g_multican.canNodeConfig.interruptConfig.traco.typeOfService        = g_gwCoreTos[g_gwNodeCore[currentCanNode]];
+
+            for (int i = 0; i < NUM_GW_BYPASS; i++)
+            {
+                if ((gwBypass[i].srcNode == currentCanNode) && ((g_multican.bypassNodeMask & GW_NODE(currentCanNode)) != 0))
+                {
+                    g_multican.canNodeConfig.interruptConfig.rxf1n.priority      = gwBypass[i].dmaChannel;
+                    g_multican.canNodeConfig.interruptConfig.rxf1n.interruptLine = (IfxCan_InterruptLine)(localNode + GW_BYPASS_LINE_OFFSET);
+                    g_multican.canNodeConfig.interruptConfig.rxf1n.typeOfService = IfxSrc_Tos_dma;
+                    /* Rx FIFO 1 belongs to the DMA, gwRxDrain() never clears its watermark flag */
+                    g_multican.canNodeConfig.interruptConfig.rxFifo1WatermarkEnabled = FALSE;
+                    g_multican.canNodeConfig.rxConfig.rxFifo1WatermarkLevel          = 0;
+                }
+            }
+
+            IfxCan_Can_initNode(&g_multican.canNode[currentCanNode], &g_multican.canNodeConfig);
+
+            /* other cores and the moderation timeout ring the node's gateway ISR through its interrupt line */
+            g_multican.doorbell[currentCanNode] = IfxCan_getSrcPointer(g_multican.can[module].can, (IfxCan_InterruptLine)localNode);
+
+            /* egress buffers report finished cancellations, the bypass buffers are not seen by the CPU at all */
+            for (int k = 0; k < GW_EGRESS_TX_BUFFERS; k++)
+            {
+                IfxCan_Node_enableTxBufferCancellationFinishedInterrupt(g_multican.canNode[currentCanNode].node, (IfxCan_TxBufferId)k);
+            }
+
+            for (int k = GW_EGRESS_TX_BUFFERS; k < g_multican.canNodeConfig.txConfig.dedicatedTxBuffersNumber; k++)
+            {
+                IfxCan_Node_disableTxBufferTransmissionInterrupt(g_multican.canNode[currentCanNode].node, (IfxCan_TxBufferId)k);
+            }
+        }
+    }
+
+    /* =======================================================================================================
+     * Gateway filter element configuration:
+     * =======================================================================================================
+     *  - one filter element per filter entry, numbered in the order used to build the FIDX -> pair tables
+     *  - 11-bit entries use standard filter elements, 29-bit entries extended filter elements
+     *  - the element takes the entry's type (range, dual ID, classic ID/mask) and stores the frame in Rx FIFO 0
+     *  - entries left over once a node's list is full are handled by the software second stage only
+     * =======================================================================================================
+     */
+    for (currentCanNode = 0; currentCanNode < NUMBER_OF_CAN_NODES; currentCanNode++)
+    {
+        stdFilterCount[currentCanNode] = 0;
+        extFilterCount[currentCanNode] = 0;
+    }
+
+    for (int i = 0; i < NUM_GW_PAIRS; i++)
+    {
+        const MulticanGwPairConfig *pair = &gwPairs[i];
+
+        if (!canNodeEnabled[pair->srcNode] || ((pair->dstNodeMask & g_multican.nodeEnabledMask) == 0))
+        {
+            continue;
+        }
+
+        for (int j = 0; j < pair->numFilters; j++)
+        {
+            const MulticanGwFilter *entry = &pair->filters[j];
+            IfxCan_Filter           filter;
+
+            filter.elementConfiguration = IfxCan_FilterElementConfiguration_storeInRxFifo0;
+            filter.type                 = (IfxCan_FilterType)entry->type;
+            filter.id1                  = entry->id1;
+            filter.id2                  = entry->id2;
+            filter.rxBufferOffset       = IfxCan_RxBufferId_0;
+
+            if (entry->extended != 0)
+            {
+                if (extFilterCount[pair->srcNode] < g_multican.filterUsage[pair->srcNode].extElements)
+                {
+                    filter.number = extFilterCount[pair->srcNode]++;
+                    IfxCan_Can_setExtendedFilter(&g_multican.canNode[pair->srcNode], &filter);
+                }
+            }
+            else
+            {
+                if (stdFilterCount[pair->srcNode] < g_multican.filterUsage[pair->srcNode].stdElements)
+                {
+                    filter.number = stdFilterCount[pair->srcNode]++;
+                    IfxCan_Can_setStandardFilter(&g_multican.canNode[pair->srcNode], &filter);
+                }
+            }
+        }
     }
 }
@@ -31,97 +31,302 @@
 /*-----------------------------------------------------Includes------------------------------------------------------*/
 /*********************************************************************************************************************/
 #include "Ifx_Types.h"
-#include "IfxMultican_Can.h"
-#include "IfxMultican.h"
-#include "IfxPort.h"       
-                                      /* For GPIO Port Pin Control                        */
+#include "MULTICAN_GW_ROUTE.h"                                  /* Per-ID routes, NUMBER_OF_CAN_NODES, GW_NODE()     */
+#include "Can/Can/IfxCan_Can.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+#include "Stm/Std/IfxStm.h"
+#include "App_IpcRing.h"                                        /* Lock-free cross-core rings                        */
+#include "IfxPort.h"                                            /* For GPIO Port Pin Control                         */
 #include <stdint.h>
 /*********************************************************************************************************************/
 /*------------------------------------------------------Macros-------------------------------------------------------*/
 /*********************************************************************************************************************/
                                                                 /*            USER CONFIGURABLE VALUE                */
                                                                 /* ------------------------------------------------- */
-#define NUMBER_OF_CAN_MESSAGES      7                           /* Define the number of CAN messages to be sent      */
+#define CAN_NODES_PER_MODULE        4                           /* Number of MCMCAN nodes per CAN module             */
                                                                 /* ------------------------------------------------- */
 // Multi-pair gateway configuration
 
 
-#define MAX_FILTER_IDS_PER_PAIR 4
+#define MAX_FILTERS_PER_PAIR 8
 
+// One filter entry of a pair, compiled into one MCMCAN standard / extended filter element of the source node
 typedef struct {
-    uint8_t srcNode;                // CAN node index for source (e.g. 0 = CAN0)
-    uint8_t dstNode;                // CAN node index for destination (e.g. 1 = CAN1)
-    IfxMultican_MsgObjId srcMsgObjId; // Base message object ID for source node
-    IfxMultican_MsgObjId dstMsgObjId; // Message object ID for destination node
+    uint8_t type;                   // IfxCan_FilterType_range, IfxCan_FilterType_dualId or IfxCan_FilterType_classic
+    uint8_t extended;               // 0 = 11-bit IDs (standard filter element), 1 = 29-bit IDs (extended filter element)
+    uint32_t id1;                   // range: first ID, dual ID: first ID, classic: ID
+    uint32_t id2;                   // range: last ID,  dual ID: second ID, classic: mask (1 = bit must match)
+} MulticanGwFilter;
+
+// Filter entry initializers for gwPairs[]
+#define GW_FILTER_ID(id)                {IfxCan_FilterType_classic, 0, (id), 0x7FF}
+#define GW_FILTER_RANGE(first, last)    {IfxCan_FilterType_range, 0, (first), (last)}
+#define GW_FILTER_MASK(id, mask)        {IfxCan_FilterType_classic, 0, (id), (mask)}
+#define GW_FILTER_DUAL(id1, id2)        {IfxCan_FilterType_dualId, 0, (id1), (id2)}
+#define GW_FILTER_EXT_ID(id)            {IfxCan_FilterType_classic, 1, (id), 0x1FFFFFFF}
+#define GW_FILTER_EXT_RANGE(first, last) {IfxCan_FilterType_range, 1, (first), (last)}
+#define GW_FILTER_EXT_MASK(id, mask)    {IfxCan_FilterType_classic, 1, (id), (mask)}
+#define GW_FILTER_EXT_DUAL(id1, id2)    {IfxCan_FilterType_dualId, 1, (id1), (id2)}
+
+typedef struct {
+    uint8_t srcNode;                // Gateway node index for source (0..3 = CAN0 node 0..3, 4..7 = CAN1 node 0..3)
+    uint8_t dstNodeMask;            // Destination gateway nodes, GW_NODE(n) bits (several bits = multicast)
     // Place CAN ID filters at the end for clarity
-    uint8_t numFilterIds;           // Number of valid filter IDs in filterIds[]
-    uint32_t filterIds[MAX_FILTER_IDS_PER_PAIR]; // Array of CAN IDs to filter for this pair (one MO per ID)
+    uint8_t numFilters;             // Number of valid filter entries in filters[]
+    MulticanGwFilter filters[MAX_FILTERS_PER_PAIR]; // ID, range, mask or dual ID filters of this pair
 } MulticanGwPairConfig;
 
-// ISR plan: One shared ISR for all filtered MOs. ISR identifies pair and filter by node and MO ID.
+// ISR plan: one ISR per source node. Filtered frames land in Rx FIFO 0, the filter index (FIDX) of the stored
+// element identifies the pair. Non-matching frames land in Rx FIFO 1 and follow the node's first pair.
 
-#define NUM_GW_PAIRS 3
+#ifndef NUM_GW_PAIRS
+#define NUM_GW_PAIRS 3                                          /* Defined along with GW_PAIR_TABLE_FILE otherwise   */
+#endif
 extern const MulticanGwPairConfig gwPairs[NUM_GW_PAIRS];
 
+/* Frame aggregation (PDU multiplexing): classic frames forwarded from classicNode to fdNode are packed into CAN FD
+ * container frames, container frames received on fdNode are unpacked and sent on classicNode.
+ * Container layout: byte 0 = number of PDUs, then per PDU a 4 byte ID (little endian, bit 31 = XTD), a DLC byte and
+ * the DLC data bytes.
+ */
+#define NUM_GW_CONTAINERS           1
+#define GW_CONTAINER_HEADER_SIZE    1                           /* PDU count byte                                    */
+#define GW_CONTAINER_PDU_HEADER     5                           /* ID word + DLC byte per PDU                        */
+#define GW_CONTAINER_MAX_PDUS       12                          /* PDUs of one container (without payload)           */
+
+typedef struct {
+    uint8_t classicNode;            // Node of the classic frames (packed when forwarded to fdNode, unpacked frames go here)
+    uint8_t fdNode;                 // CAN FD node the container frames are sent and received on
+    uint8_t flushBytes;             // Size trigger: container is sent once this many bytes are used (up to 64)
+    uint8_t flushTimeMs;            // Time trigger: container is sent at most this long after its first PDU
+    uint32_t containerId;           // CAN ID of the container frame (IDs above 0x7FF are extended)
+    uint32_t urgentIdLimit;         // Priority trigger: a PDU with an ID up to this value sends the container at once
+} MulticanGwContainerConfig;
+
+extern const MulticanGwContainerConfig gwContainers[NUM_GW_CONTAINERS];
 
+/* Message RAM layout of one gateway node (byte offsets inside the node's slice of the module message RAM).
+ * All elements use a 64 byte data field so that CAN FD frames can be forwarded unchanged.
+ */
+#define GW_NODE_RAM_SIZE            0x1000                      /* Message RAM slice reserved per node               */
+#define GW_MAX_STD_FILTERS          32                          /* Standard filter elements per node (4 bytes each)  */
+#define GW_MAX_EXT_FILTERS          16                          /* Extended filter elements per node (8 bytes each)  */
+#define GW_MAX_SW_FILTERS           16                          /* Second stage (software) filters per node          */
+#define GW_RX_FIFO0_SIZE            16                          /* Filtered traffic FIFO depth                       */
+#define GW_RX_FIFO1_SIZE            8                           /* Catch-all (non-matching) traffic FIFO depth       */
+#define GW_EGRESS_TX_BUFFERS        8                           /* Dedicated Tx buffers fed by the egress scheduler  */
+#define GW_BYPASS_TX_BUFFERS        GW_RX_FIFO1_SIZE            /* DMA bypass Tx buffers, behind the egress buffers  */
+#define GW_ELEMENT_SIZE             (8 + 64)                    /* Header words + 64 byte data field                 */
+#define GW_RAM_STD_FILTER_OFFSET    0x000
+#define GW_RAM_EXT_FILTER_OFFSET    (GW_RAM_STD_FILTER_OFFSET + (GW_MAX_STD_FILTERS * 4))
+#define GW_RAM_RX_FIFO0_OFFSET      (GW_RAM_EXT_FILTER_OFFSET + (GW_MAX_EXT_FILTERS * 8))
+#define GW_RAM_RX_FIFO1_OFFSET      (GW_RAM_RX_FIFO0_OFFSET + (GW_RX_FIFO0_SIZE * GW_ELEMENT_SIZE))
+#define GW_RAM_TX_BUFFERS_OFFSET    (GW_RAM_RX_FIFO1_OFFSET + (GW_RX_FIFO1_SIZE * GW_ELEMENT_SIZE))
+#define GW_RAM_UNUSED_OFFSET        (GW_RAM_TX_BUFFERS_OFFSET + ((GW_EGRESS_TX_BUFFERS + GW_BYPASS_TX_BUFFERS) * GW_ELEMENT_SIZE))
 
+/* Priority egress: forwarded frames wait in a per-node software queue ordered by CAN ID priority, the highest
+ * priority ones occupy the node's egress Tx buffers. One frame copy is shared by all destinations of a multicast.
+ */
+#define GW_EGRESS_QUEUE_SIZE        16                          /* Frames waiting per node for an egress Tx buffer   */
+#define GW_FRAME_POOL_SIZE          64                          /* Frame copies per core, shared by its egress queues */
 
-#define SLAVE_MESSAGE_OBJECT_ID     (IfxMultican_MsgObjId)2     /* FIFO slave message object ID                      */
-#define SRC_MESSAGE_OBJECT_ID       (IfxMultican_MsgObjId)10    /* Source standard message object ID                 */
-#define DST_MESSAGE_OBJECT_ID       (IfxMultican_MsgObjId)20    /* Destination standard message object ID            */
-#define GTW_SRC_MESSAGE_ID          0x444                       /* Message ID that is used in arbitration phase      */
-#define SRC_MESSAGE_ID              GTW_SRC_MESSAGE_ID          /* Should be same value as gateway source ID         */
-#define GTW_DST_MESSAGE_ID          0x777                       /* Message ID that is used in arbitration phase      */
-#define DST_MESSAGE_ID              GTW_DST_MESSAGE_ID          /* Should be same value as gateway destination ID    */
-#define TX_FIFO_SIZE                2                           /* Number of slave message objects in FIFO structure */
-#define RX_INTERRUPT_SRC_ID         IfxMultican_SrcId_1         /* Receive interrupt service request ID              */
-#define PIN5                        5                           /* LED1 used in TX ISR is connected to this pin      */
-#define INVALID_DATA_VALUE          (uint32)0xDEADBEEF          /* Used to invalidate RX messages data content       */
-#define INVALID_ID_VALUE            (uint32)0xFFFFFFFF          /* Used to invalidate RX messages ID value           */
-#define INVALID_LENGTH_VALUE        (IfxMultican_DataLengthCode)0   /* Used to invalidate RX messages length value   */
-#define ISR_PRIORITY_CAN_RX         1                           /* Define the CAN RX interrupt priority              */
-#define NUMBER_OF_CAN_NODES         8                           /* Define the number of CAN nodes used in example    */
-#define EXPECTED_CUR_POINTER_VALUE  ( SLAVE_MESSAGE_OBJECT_ID + \
-                                        (NUMBER_OF_CAN_MESSAGES % TX_FIFO_SIZE) )   /* Define expected CUR pointer   */
+/* DMA bulk bypass of the catch-all path: every frame in Rx FIFO 1 of the source node is moved by a DMA linked list
+ * into a dedicated Tx buffer of one destination node, without CPU work per frame.
+ */
+#define NUM_GW_BYPASS               1
+#define GW_BYPASS_WATERMARK         4                           /* Frames moved per CPU interrupt, divides FIFO size */
+#define GW_BYPASS_MOVES             4                           /* Transactions per frame: flag, copy, TXBAR, ack    */
+#define GW_BYPASS_LINE_OFFSET       4                           /* DMA request line of a node: local node + offset   */
+
+typedef struct {
+    uint8_t srcNode;                // Gateway node whose unfiltered (Rx FIFO 1) traffic bypasses the CPU
+    uint8_t dstNode;                // Gateway node the traffic is sent on (dedicated Tx buffers)
+    uint8_t dmaChannel;             // DMA channel running the linked list (> 0, used as the request SRPN)
+} MulticanGwBypassConfig;
+
+extern const MulticanGwBypassConfig gwBypass[NUM_GW_BYPASS];
+
+/* Receive interrupt moderation: the gateway ISR of a node drains its Rx FIFOs once `watermark` frames are stored or
+ * `timeoutUs` after the first stored frame, whichever comes first. Tunable at runtime with canGatewaySetRxModeration().
+ * The timeouts of the nodes of one core share compare 1 of that core's STM (compare 0 is the FreeRTOS tick).
+ */
+#define GW_RX_MODERATION_CMP        IfxStm_Comparator_1         /* Compare register of the receive timeouts          */
+
+typedef struct {
+    uint8_t watermark;              // Rx FIFO 0 frames raising the interrupt (Rx FIFO 1: at most its depth), 1 = every frame
+    uint16_t timeoutUs;             // Longest time a frame waits for the drain, 0 = no moderation (every frame)
+} MulticanGwRxModerationConfig;
+
+extern const MulticanGwRxModerationConfig gwRxModeration[NUMBER_OF_CAN_NODES];
+
+/* Core partitioning: every node is owned by one CPU, which takes all interrupts of the node (receive, watermark,
+ * transmit, moderation timeout, DMA bypass watermark) and runs its forwarding and egress scheduler. Frames for a node
+ * of another CPU are handed over through a lock-free single producer / single consumer queue in LMU RAM per (source
+ * CPU, destination CPU) pair. Core numbers must be plain literals (they select the vector table of the ISRs); all
+ * nodes on core 0 gives the single core gateway.
+ */
+#define GW_NUM_CORES                3                           /* CPU0 (FreeRTOS), CPU1, CPU2                       */
+#ifndef GW_NODE0_CORE                                           /* Defined all eight by the build otherwise          */
+#define GW_NODE0_CORE               1                           /* CAN0 node 0                                       */
+#define GW_NODE1_CORE               1                           /* CAN0 node 1                                       */
+#define GW_NODE2_CORE               2                           /* CAN0 node 2                                       */
+#define GW_NODE3_CORE               2                           /* CAN0 node 3                                       */
+#define GW_NODE4_CORE               1                           /* CAN1 node 0                                       */
+#define GW_NODE5_CORE               1                           /* CAN1 node 1                                       */
+#define GW_NODE6_CORE               2                           /* CAN1 node 2                                       */
+#define GW_NODE7_CORE               2                           /* CAN1 node 3                                       */
+#endif
+#define GW_BYPASS0_CORE             GW_NODE2_CORE               /* Core of gwBypass[0].srcNode                       */
+#define GW_XCORE_QUEUE_SIZE         16                          /* Frames per cross-core queue (power of two)        */
+
+/* Interrupt priorities of the per-node gateway ISRs. Must be plain literals (used to build the vector section name)
+ * and must stay below configMAX_API_CALL_INTERRUPT_PRIORITY and above the FreeRTOS kernel priorities.
+ */
+#define ISR_PRIORITY_CAN_GW_NODE0   10
+#define ISR_PRIORITY_CAN_GW_NODE1   11
+#define ISR_PRIORITY_CAN_GW_NODE2   12
+#define ISR_PRIORITY_CAN_GW_NODE3   13
+#define ISR_PRIORITY_CAN_GW_NODE4   14
+#define ISR_PRIORITY_CAN_GW_NODE5   15
+#define ISR_PRIORITY_CAN_GW_NODE6   16
+#define ISR_PRIORITY_CAN_GW_NODE7   17
+#define ISR_PRIORITY_GW_BYPASS0     18                          /* DMA bypass watermark interrupt of gwBypass[0]     */
+#define ISR_PRIORITY_GW_RX_TIMEOUT  19                          /* Receive moderation timeout (STM compare per core) */
+
+#define GW_NO_PAIR                  0xFF                        /* Marks an unused filter index / catch-all slot     */
+#define GW_NO_FRAME                 0xFF                        /* Frame pool exhausted / end of the free list       */
 
 /*********************************************************************************************************************/
 /*--------------------------------------------------Data Structures--------------------------------------------------*/
 /*********************************************************************************************************************/
+/* Filter entry which did not fit into the node's filter element list, matched by software on Rx FIFO 1 frames */
 typedef struct
 {
-    IfxMultican_Can                 can;             /* CAN module handle to HW module SFR set                       */
-    IfxMultican_Can_Config          canConfig;       /* CAN module configuration structure                           */
-    IfxMultican_Can_Node            canNode[NUMBER_OF_CAN_NODES];        /* CAN node array structure                 */
-    IfxMultican_Can_NodeConfig      canNodeConfig;   /* CAN node configuration structure                             */
-    IfxMultican_Can_MsgObj          canGtwSrcMsgObj; /* CAN gateway source message object handle data structure      */
-    IfxMultican_Can_MsgObj          canGtwDstMsgObj; /* CAN gateway destination message object handle data structure */
-    IfxMultican_Can_MsgObj          canSrcMsgObj;    /* CAN source standard message object handle data structure     */
-    IfxMultican_Can_MsgObj          canDstMsgObj;    /* CAN destination standard message object handle data structure*/
-    IfxMultican_Can_MsgObjConfig    canMsgObjConfig; /* CAN message object configuration structure                   */
-    IfxMultican_Message             txMsg;           /* Transmitted CAN message structure                            */
-    IfxMultican_Message             rxMsg[NUMBER_OF_CAN_MESSAGES];       /* Received CAN messages array              */
-} multicanType;
+    const MulticanGwFilter         *filter;          /* Filter entry of gwPairs[]                                    */
+    uint8                           pairIdx;         /* Pair the filter belongs to                                   */
+} gwSwFilterType;
 
-typedef enum
+/* Filter usage report of one node, filled by initMultican() */
+typedef struct
 {
-    CanCommunicationStatus_Success = 0,
-    CanCommunicationStatus_Error_noNewDataReceived,
-    CanCommunicationStatus_Error_newDataButOneLost,
-    CanCommunicationStatus_Error_notExpectedFifoCurPointer,
-    CanCommunicationStatus_Error_notExpectedMessageId,
-    CanCommunicationStatus_Error_notExpectedLengthCode,
-    CanCommunicationStatus_Error_notExpectedData
-} canCommunicationStatusType;
+    uint8                           stdElements;     /* Standard filter elements used (of GW_MAX_STD_FILTERS)        */
+    uint8                           extElements;     /* Extended filter elements used (of GW_MAX_EXT_FILTERS)        */
+    uint16                          ramBytesUsed;    /* Filter list bytes used in the node's message RAM slice       */
+    uint16                          ramBytesReserved; /* Filter list bytes reserved in the node's message RAM slice  */
+    uint8                           swFilters;       /* Filters handled by the software second stage (overflow)      */
+} gwFilterUsageType;
+
+typedef struct
+{
+    uint32 rxFrames;                                 /* Frames taken from the node's Rx FIFOs                        */
+    uint32 rxDrains;                                 /* Rx FIFO drains (one per receive interrupt batch)             */
+    uint32 rxTimeouts;                               /* Drains started by the moderation timeout                     */
+    uint32 txFrames;                                 /* Frames transmitted from the node's egress Tx buffers         */
+    uint32 txDropped;                                /* Frames dropped: egress queue full or frame pool exhausted    */
+    uint32 txPreempted;                              /* Cancellation requests for a higher priority waiting frame    */
+    uint32 bypassFrames;                             /* Rx FIFO 1 frames moved by the DMA bypass (source node)       */
+    uint32 bypassLost;                               /* DMA bypass requests lost (source node)                       */
+    uint32 containerFrames;                          /* Container frames sent (classic node) or received (FD node)   */
+    uint32 containerPdus;                            /* PDUs packed into / unpacked from these containers            */
+    uint32 xcoreFrames;                              /* Frames queued for the node by another core                   */
+} gwNodeStatsType;
+
+/* Receive moderation state of one node */
+typedef struct
+{
+    uint8                           watermark;       /* Frames per drain, 1 = no moderation                          */
+    uint32                          timeoutTicks;    /* Timeout in STM ticks                                         */
+    uint32                          deadline;        /* STM lower word at which the armed timeout expires            */
+} gwRxModerationType;
+
+/* Packing state of one container */
+typedef struct
+{
+    uint32                          data[IFXCAN_CAN_MESSAGE_DATA_WORDS]; /* Container payload being packed           */
+    uint8                           used;            /* Container bytes used, including the PDU count byte           */
+    uint8                           ageMs;           /* Time since the first PDU was packed                          */
+} gwContainerStateType;
+
+/* Frame copy of the pool, shared by every egress queue / Tx buffer of a multicast */
+typedef struct
+{
+    Ifx_CAN_TXMSG                   element;         /* Tx element image: T0, T1 and data field                      */
+    uint8                           refCount;        /* Egress queue entries and Tx buffers holding the frame        */
+    uint8                           nextFree;        /* Free list link (GW_NO_FRAME: last free frame)                */
+} gwFrameType;
+
+/* Egress queue entry / loaded egress Tx buffer */
+typedef struct
+{
+    uint32                          key;             /* Arbitration key, the lower key wins the bus arbitration      */
+    uint8                           frame;           /* Index into the frame pool                                    */
+} gwEgressEntryType;
+
+/* Cross-core queue slot: one frame for the nodes of the consumer core */
+typedef struct
+{
+    Ifx_CAN_TXMSG                   element;         /* Tx element image: T0, T1 and data field                      */
+    uint8                           dstNodeMask;     /* GW_NODE(n) bits of the destination nodes (consumer core)     */
+} gwXcoreSlotType;
+
+/* Lock-free single producer / single consumer ring from one core to another: type gwXcoreRing and the functions
+ * gwXcoreReserve/Commit/Peek/Release (LMU RAM, accessed not cached)
+ */
+IPC_SPSC_RING_DEFINE(gwXcore, gwXcoreSlotType, GW_XCORE_QUEUE_SIZE)
+
+/* Priority egress scheduler state of one node */
+typedef struct
+{
+    gwEgressEntryType               queue[GW_EGRESS_QUEUE_SIZE];    /* Waiting frames, ascending key (queue[0] next) */
+    gwEgressEntryType               txBuffer[GW_EGRESS_TX_BUFFERS]; /* Frame loaded into egress Tx buffer k          */
+    uint8                           queued;          /* Frames in queue[]                                            */
+    uint32                          busyMask;        /* Egress Tx buffers holding a frame (bit k = Tx buffer k)      */
+    uint32                          cancelMask;      /* Egress Tx buffers with a cancellation request in flight      */
+} gwEgressType;
+
+typedef struct
+{
+    IfxCan_Can                      can[2];          /* CAN0 / CAN1 module handles                                   */
+    IfxCan_Can_Config               canConfig;       /* CAN module configuration structure                           */
+    IfxCan_Can_Node                 canNode[NUMBER_OF_CAN_NODES];        /* CAN node array structure                 */
+    IfxCan_Can_NodeConfig           canNodeConfig;   /* CAN node configuration structure                             */
+    uint8                           stdFilterPair[NUMBER_OF_CAN_NODES][GW_MAX_STD_FILTERS]; /* FIDX -> pair (std)   */
+    uint8                           extFilterPair[NUMBER_OF_CAN_NODES][GW_MAX_EXT_FILTERS]; /* FIDX -> pair (ext)   */
+    uint8                           catchAllPair[NUMBER_OF_CAN_NODES];   /* Pair used for Rx FIFO 1 traffic          */
+    uint8                           nodeEnabledMask; /* GW_NODE(n) bits of the initialized nodes                     */
+    gwSwFilterType                  swFilter[NUMBER_OF_CAN_NODES][GW_MAX_SW_FILTERS]; /* Second stage filters         */
+    gwFilterUsageType               filterUsage[NUMBER_OF_CAN_NODES];    /* Filter RAM usage report per node         */
+    IfxDma_Dma                      dma;             /* DMA module handle                                            */
+    IfxDma_Dma_Channel              bypassChannel[NUM_GW_BYPASS];        /* DMA bypass channels                      */
+    uint8                           bypassNodeMask;  /* GW_NODE(n) bits of the source nodes bypassed by DMA          */
+    uint8                           bypassTxMask;    /* GW_NODE(n) bits of the nodes with bypass Tx buffers          */
+    gwContainerStateType            container[NUM_GW_CONTAINERS];        /* Frame aggregation state                  */
+    gwFrameType                     frame[GW_NUM_CORES * GW_FRAME_POOL_SIZE]; /* Frame pools, core c owns frames  */
+                                                     /* c * GW_FRAME_POOL_SIZE .. (c + 1) * GW_FRAME_POOL_SIZE - 1   */
+    uint8                           freeFrame[GW_NUM_CORES];             /* Head of each core's pool free list       */
+    gwEgressType                    egress[NUMBER_OF_CAN_NODES];         /* Priority egress scheduler per node       */
+    gwRxModerationType              rxModeration[NUMBER_OF_CAN_NODES];   /* Receive moderation per node              */
+    uint8                           rxArmedMask[GW_NUM_CORES];           /* Nodes of the core with a running timeout */
+    uint8                           rxExpiredMask[GW_NUM_CORES];         /* Timed out nodes awaiting their drain     */
+    uint8                           coreNodeMask[GW_NUM_CORES];          /* GW_NODE(n) bits of the enabled nodes     */
+    volatile Ifx_SRC_SRCR          *doorbell[NUMBER_OF_CAN_NODES];       /* Service request of the node's gateway ISR */
+    uint32                          xcoreDropped[GW_NUM_CORES][GW_NUM_CORES]; /* [producer][consumer] frames dropped */
+                                                     /* on a full cross-core ring, counted by the producer core      */
+    gwNodeStatsType                 stats[NUMBER_OF_CAN_NODES];          /* Per node forwarding statistics           */
+} multicanType;
 
 /*********************************************************************************************************************/
 /*-----------------------------------------------Function Prototypes-------------------------------------------------*/
 /*********************************************************************************************************************/
-void canIsrRxHandler(void);
 void initMultican(void);
-void transmitCanMessages(void);
-void verifyCanMessages(void);
+void canGatewayForward(uint8 srcNode);
+void canGatewayContainerTick(void);
+boolean canGatewaySetRxModeration(uint8 node, uint8 watermark, uint16 timeoutUs);
 
 /* Node enable/disable configuration: 1 = enable, 0 = disable */
 extern const uint8_t canNodeEnabled[NUMBER_OF_CAN_NODES];
 
-#endif MULTICAN_GW_TX_FIFO_H_ */
+extern multicanType g_multican;
+extern gwXcoreRing g_gwXcoreQueue[GW_NUM_CORES][GW_NUM_CORES];
+
+#endif /* MULTICAN_GW_TX_FIFO_H_ */
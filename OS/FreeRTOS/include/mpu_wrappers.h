@@ -175,7 +175,10 @@
 #else /* portUSING_MPU_WRAPPERS */
 
     #define PRIVILEGED_FUNCTION
-    #define PRIVILEGED_DATA
+    /* The configuration may place the kernel data in a dedicated section. */
+    #ifndef PRIVILEGED_DATA
+        #define PRIVILEGED_DATA
+    #endif
     #define FREERTOS_SYSTEM_CALL
 
 #endif /* portUSING_MPU_WRAPPERS */
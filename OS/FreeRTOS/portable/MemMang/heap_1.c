@@ -46,6 +46,10 @@
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#if ( configUSE_APP_POOL_MALLOC == 1 )
+    #include "App_Pool.h"
+#endif
+
 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
     #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
@@ -60,18 +64,31 @@
 * heap - probably so it can be placed in a special segment or address. */
     extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
 #else
-    static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+    PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
 #endif /* configAPPLICATION_ALLOCATED_HEAP */
 
 /* Index into the ucHeap array. */
-static size_t xNextFreeByte = ( size_t ) 0;
+PRIVILEGED_DATA static size_t xNextFreeByte = ( size_t ) 0;
 
 /*-----------------------------------------------------------*/
 
 void * pvPortMalloc( size_t xWantedSize )
 {
     void * pvReturn = NULL;
-    static uint8_t * pucAlignedHeap = NULL;
+    PRIVILEGED_DATA static uint8_t * pucAlignedHeap = NULL;
+
+    #if ( configUSE_APP_POOL_MALLOC == 1 )
+    {
+        /* Small requests are served in O(1) by the fixed block pools of App_Pool.h. */
+        pvReturn = appPoolMalloc( ( uint32 ) xWantedSize );
+
+        if( pvReturn != NULL )
+        {
+            traceMALLOC( pvReturn, xWantedSize );
+            return pvReturn;
+        }
+    }
+    #endif /* configUSE_APP_POOL_MALLOC */
 
     /* Ensure that blocks are always aligned. */
     #if ( portBYTE_ALIGNMENT != 1 )
@@ -129,6 +146,16 @@ void * pvPortMalloc( size_t xWantedSize )
 
 void vPortFree( void * pv )
 {
+    #if ( configUSE_APP_POOL_MALLOC == 1 )
+    {
+        if( appPoolFree( pv ) != FALSE )
+        {
+            traceFREE( pv, 0 );
+            return;
+        }
+    }
+    #endif /* configUSE_APP_POOL_MALLOC */
+
     /* Memory cannot be freed using this scheme.  See heap_2.c, heap_3.c and
      * heap_4.c for alternative implementations, and the memory management pages of
      * https://www.FreeRTOS.org for more information. */
@@ -47,6 +47,10 @@
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#if ( configUSE_APP_POOL_MALLOC == 1 )
+    #include "App_Pool.h"
+#endif
+
 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
     #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
@@ -143,6 +147,19 @@ void * pvPortMalloc( size_t xWantedSize )
     void * pvReturn = NULL;
     size_t xAdditionalRequiredSize;
 
+    #if ( configUSE_APP_POOL_MALLOC == 1 )
+    {
+        /* Small requests are served in O(1) by the fixed block pools of App_Pool.h. */
+        pvReturn = appPoolMalloc( ( uint32 ) xWantedSize );
+
+        if( pvReturn != NULL )
+        {
+            traceMALLOC( pvReturn, xWantedSize );
+            return pvReturn;
+        }
+    }
+    #endif /* configUSE_APP_POOL_MALLOC */
+
     vTaskSuspendAll();
     {
         /* If this is the first call to malloc then the heap will require
@@ -291,6 +308,16 @@ void vPortFree( void * pv )
     uint8_t * puc = ( uint8_t * ) pv;
     BlockLink_t * pxLink;
 
+    #if ( configUSE_APP_POOL_MALLOC == 1 )
+    {
+        if( appPoolFree( pv ) != FALSE )
+        {
+            traceFREE( pv, 0 );
+            return;
+        }
+    }
+    #endif /* configUSE_APP_POOL_MALLOC */
+
     if( pv != NULL )
     {
         /* The memory being freed will have an BlockLink_t structure immediately
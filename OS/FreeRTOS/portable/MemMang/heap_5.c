@@ -67,6 +67,15 @@
  *
  * Note 0x80000000 is the lower address so appears in the array first.
  *
+ * With configHEAP_PER_CORE_REGIONS set to 1 the regions are sorted into
+ * portHEAP_GROUPS independent heaps by portHEAP_REGION_GROUP( address ), e.g.
+ * one per core local memory and one shared.  pvPortMalloc() allocates from the
+ * group of the calling core (portHEAP_CALLER_GROUP()) and falls back to the
+ * shared group (portHEAP_SHARED_GROUP), pvPortMallocGroup() from a given
+ * group, for memory mainly accessed by another core or by several cores.
+ * vPortFree() returns a block to the group it came from.  The address order
+ * rule applies within each group.
+ *
  */
 #include <stdlib.h>
 #include <string.h>
@@ -81,6 +90,10 @@
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#if ( configUSE_APP_POOL_MALLOC == 1 )
+    #include "App_Pool.h"
+#endif
+
 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
     #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
@@ -89,6 +102,24 @@
     #define configHEAP_CLEAR_MEMORY_ON_FREE    0
 #endif
 
+#ifndef configHEAP_PER_CORE_REGIONS
+    #define configHEAP_PER_CORE_REGIONS    0
+#endif
+
+#if ( configHEAP_PER_CORE_REGIONS == 1 )
+    #define heapNUM_GROUPS                  portHEAP_GROUPS
+    #define heapREGION_GROUP( xAddress )    portHEAP_REGION_GROUP( xAddress )
+    #define heapCALLER_GROUP()              portHEAP_CALLER_GROUP()
+    #define heapLOCK( pxGroup )             portHEAP_LOCK( &( ( pxGroup )->ulLock ) )
+    #define heapUNLOCK( pxGroup )           portHEAP_UNLOCK( &( ( pxGroup )->ulLock ) )
+#else
+    #define heapNUM_GROUPS                  1
+    #define heapREGION_GROUP( xAddress )    0
+    #define heapCALLER_GROUP()              0
+    #define heapLOCK( pxGroup )
+    #define heapUNLOCK( pxGroup )
+#endif
+
 /* Block sizes must not get too small. */
 #define heapMINIMUM_BLOCK_SIZE    ( ( size_t ) ( xHeapStructSize << 1 ) )
 
@@ -124,6 +155,18 @@ typedef struct A_BLOCK_LINK
     size_t xBlockSize;                     /*<< The size of the free block. */
 } BlockLink_t;
 
+/* One heap: the free list of its regions and its statistics. */
+typedef struct A_HEAP_GROUP
+{
+    BlockLink_t xStart;                    /*<< Marks the start of the list of free blocks. */
+    BlockLink_t * pxEnd;                   /*<< Marks the end of the list, in the last region of the group. */
+    size_t xFreeBytesRemaining;
+    size_t xMinimumEverFreeBytesRemaining;
+    size_t xNumberOfSuccessfulAllocations;
+    size_t xNumberOfSuccessfulFrees;
+    volatile uint32_t ulLock;              /*<< Spin lock against the other cores (configHEAP_PER_CORE_REGIONS). */
+} HeapGroup_t;
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -132,7 +175,21 @@ typedef struct A_BLOCK_LINK
  * the block in front it and/or the block behind it if the memory blocks are
  * adjacent to each other.
  */
-static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert );
+static void prvInsertBlockIntoFreeList( HeapGroup_t * pxGroup,
+                                        BlockLink_t * pxBlockToInsert );
+
+/*
+ * Allocates from the free list of one group, NULL if the group cannot serve
+ * the request.
+ */
+static void * prvHeapGroupMalloc( HeapGroup_t * pxGroup,
+                                  size_t xWantedSize );
+
+/*
+ * Fills the block statistics of one group.
+ */
+static void prvHeapGroupStats( HeapGroup_t * pxGroup,
+                               HeapStats_t * pxHeapStats );
 
 /*-----------------------------------------------------------*/
 
@@ -140,20 +197,82 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert );
  * block must by correctly byte aligned. */
 static const size_t xHeapStructSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
 
-/* Create a couple of list links to mark the start and end of the list. */
-static BlockLink_t xStart;
-static BlockLink_t * pxEnd = NULL;
-
-/* Keeps track of the number of calls to allocate and free memory as well as the
+/* The heaps, each with a couple of list links to mark the start and end of its
+ * list, and the number of calls to allocate and free memory as well as the
  * number of free bytes remaining, but says nothing about fragmentation. */
-static size_t xFreeBytesRemaining = 0U;
-static size_t xMinimumEverFreeBytesRemaining = 0U;
-static size_t xNumberOfSuccessfulAllocations = 0;
-static size_t xNumberOfSuccessfulFrees = 0;
+static HeapGroup_t xHeapGroups[ heapNUM_GROUPS ];
+
+/* Set once vPortDefineHeapRegions() has run. */
+static BaseType_t xHeapDefined = pdFALSE;
 
 /*-----------------------------------------------------------*/
 
 void * pvPortMalloc( size_t xWantedSize )
+{
+    void * pvReturn = NULL;
+
+    #if ( configUSE_APP_POOL_MALLOC == 1 )
+    {
+        /* Small requests are served in O(1) by the fixed block pools of App_Pool.h. */
+        pvReturn = appPoolMalloc( ( uint32 ) xWantedSize );
+
+        if( pvReturn != NULL )
+        {
+            traceMALLOC( pvReturn, xWantedSize );
+            return pvReturn;
+        }
+    }
+    #endif /* configUSE_APP_POOL_MALLOC */
+
+    /* The heap must be initialised before the first call to
+     * prvPortMalloc(). */
+    configASSERT( xHeapDefined );
+
+    pvReturn = prvHeapGroupMalloc( &( xHeapGroups[ heapCALLER_GROUP() ] ), xWantedSize );
+
+    #if ( configHEAP_PER_CORE_REGIONS == 1 )
+    {
+        /* The local memory of the core is exhausted, take shared memory. */
+        if( ( pvReturn == NULL ) && ( heapCALLER_GROUP() != portHEAP_SHARED_GROUP ) )
+        {
+            pvReturn = prvHeapGroupMalloc( &( xHeapGroups[ portHEAP_SHARED_GROUP ] ), xWantedSize );
+        }
+    }
+    #endif
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configHEAP_PER_CORE_REGIONS == 1 )
+
+    void * pvPortMallocGroup( BaseType_t xGroup,
+                              size_t xWantedSize )
+    {
+        configASSERT( xHeapDefined );
+        configASSERT( ( xGroup >= 0 ) && ( xGroup < heapNUM_GROUPS ) );
+
+        return prvHeapGroupMalloc( &( xHeapGroups[ xGroup ] ), xWantedSize );
+    }
+
+#endif /* configHEAP_PER_CORE_REGIONS */
+/*-----------------------------------------------------------*/
+
+static void * prvHeapGroupMalloc( HeapGroup_t * pxGroup,
+                                  size_t xWantedSize )
 {
     BlockLink_t * pxBlock;
     BlockLink_t * pxPreviousBlock;
@@ -161,11 +280,8 @@ void * pvPortMalloc( size_t xWantedSize )
     void * pvReturn = NULL;
     size_t xAdditionalRequiredSize;
 
-    /* The heap must be initialised before the first call to
-     * prvPortMalloc(). */
-    configASSERT( pxEnd );
-
     vTaskSuspendAll();
+    heapLOCK( pxGroup );
     {
         if( xWantedSize > 0 )
         {
@@ -194,12 +310,12 @@ void * pvPortMalloc( size_t xWantedSize )
          * the kernel, so it must be free. */
         if( heapBLOCK_SIZE_IS_VALID( xWantedSize ) != 0 )
         {
-            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+            if( ( xWantedSize > 0 ) && ( xWantedSize <= pxGroup->xFreeBytesRemaining ) )
             {
                 /* Traverse the list from the start (lowest address) block until
                  * one of adequate size is found. */
-                pxPreviousBlock = &xStart;
-                pxBlock = xStart.pxNextFreeBlock;
+                pxPreviousBlock = &( pxGroup->xStart );
+                pxBlock = pxGroup->xStart.pxNextFreeBlock;
 
                 while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
                 {
@@ -209,7 +325,7 @@ void * pvPortMalloc( size_t xWantedSize )
 
                 /* If the end marker was reached then a block of adequate size
                  * was not found. */
-                if( pxBlock != pxEnd )
+                if( pxBlock != pxGroup->pxEnd )
                 {
                     /* Return the memory space pointed to - jumping over the
                      * BlockLink_t structure at its start. */
@@ -235,18 +351,18 @@ void * pvPortMalloc( size_t xWantedSize )
                         pxBlock->xBlockSize = xWantedSize;
 
                         /* Insert the new block into the list of free blocks. */
-                        prvInsertBlockIntoFreeList( ( pxNewBlockLink ) );
+                        prvInsertBlockIntoFreeList( pxGroup, ( pxNewBlockLink ) );
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
 
-                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+                    pxGroup->xFreeBytesRemaining -= pxBlock->xBlockSize;
 
-                    if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                    if( pxGroup->xFreeBytesRemaining < pxGroup->xMinimumEverFreeBytesRemaining )
                     {
-                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                        pxGroup->xMinimumEverFreeBytesRemaining = pxGroup->xFreeBytesRemaining;
                     }
                     else
                     {
@@ -257,7 +373,7 @@ void * pvPortMalloc( size_t xWantedSize )
                      * by the application and has no "next" block. */
                     heapALLOCATE_BLOCK( pxBlock );
                     pxBlock->pxNextFreeBlock = NULL;
-                    xNumberOfSuccessfulAllocations++;
+                    pxGroup->xNumberOfSuccessfulAllocations++;
                 }
                 else
                 {
@@ -276,21 +392,9 @@ void * pvPortMalloc( size_t xWantedSize )
 
         traceMALLOC( pvReturn, xWantedSize );
     }
+    heapUNLOCK( pxGroup );
     ( void ) xTaskResumeAll();
 
-    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
-    {
-        if( pvReturn == NULL )
-        {
-            vApplicationMallocFailedHook();
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
-    }
-    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
-
     return pvReturn;
 }
 /*-----------------------------------------------------------*/
@@ -299,6 +403,17 @@ void vPortFree( void * pv )
 {
     uint8_t * puc = ( uint8_t * ) pv;
     BlockLink_t * pxLink;
+    HeapGroup_t * pxGroup;
+
+    #if ( configUSE_APP_POOL_MALLOC == 1 )
+    {
+        if( appPoolFree( pv ) != FALSE )
+        {
+            traceFREE( pv, 0 );
+            return;
+        }
+    }
+    #endif /* configUSE_APP_POOL_MALLOC */
 
     if( pv != NULL )
     {
@@ -325,14 +440,19 @@ void vPortFree( void * pv )
                 }
                 #endif
 
+                /* The block goes back to the heap it was taken from. */
+                pxGroup = &( xHeapGroups[ heapREGION_GROUP( puc ) ] );
+
                 vTaskSuspendAll();
+                heapLOCK( pxGroup );
                 {
                     /* Add this block to the list of free blocks. */
-                    xFreeBytesRemaining += pxLink->xBlockSize;
+                    pxGroup->xFreeBytesRemaining += pxLink->xBlockSize;
                     traceFREE( pv, pxLink->xBlockSize );
-                    prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
-                    xNumberOfSuccessfulFrees++;
+                    prvInsertBlockIntoFreeList( pxGroup, ( ( BlockLink_t * ) pxLink ) );
+                    pxGroup->xNumberOfSuccessfulFrees++;
                 }
+                heapUNLOCK( pxGroup );
                 ( void ) xTaskResumeAll();
             }
             else
@@ -350,13 +470,31 @@ void vPortFree( void * pv )
 
 size_t xPortGetFreeHeapSize( void )
 {
-    return xFreeBytesRemaining;
+    size_t xFreeBytes = 0;
+    BaseType_t x;
+
+    for( x = 0; x < heapNUM_GROUPS; x++ )
+    {
+        xFreeBytes += xHeapGroups[ x ].xFreeBytesRemaining;
+    }
+
+    return xFreeBytes;
 }
 /*-----------------------------------------------------------*/
 
 size_t xPortGetMinimumEverFreeHeapSize( void )
 {
-    return xMinimumEverFreeBytesRemaining;
+    size_t xMinimumEverFreeBytes = 0;
+    BaseType_t x;
+
+    /* With several groups the sum of their minima, which were not necessarily
+     * reached at the same time. */
+    for( x = 0; x < heapNUM_GROUPS; x++ )
+    {
+        xMinimumEverFreeBytes += xHeapGroups[ x ].xMinimumEverFreeBytesRemaining;
+    }
+
+    return xMinimumEverFreeBytes;
 }
 /*-----------------------------------------------------------*/
 
@@ -379,14 +517,15 @@ void * pvPortCalloc( size_t xNum,
 }
 /*-----------------------------------------------------------*/
 
-static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert )
+static void prvInsertBlockIntoFreeList( HeapGroup_t * pxGroup,
+                                        BlockLink_t * pxBlockToInsert )
 {
     BlockLink_t * pxIterator;
     uint8_t * puc;
 
     /* Iterate through the list until a block is found that has a higher address
      * than the block being inserted. */
-    for( pxIterator = &xStart; pxIterator->pxNextFreeBlock < pxBlockToInsert; pxIterator = pxIterator->pxNextFreeBlock )
+    for( pxIterator = &( pxGroup->xStart ); pxIterator->pxNextFreeBlock < pxBlockToInsert; pxIterator = pxIterator->pxNextFreeBlock )
     {
         /* Nothing to do here, just iterate to the right position. */
     }
@@ -411,7 +550,7 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert )
 
     if( ( puc + pxBlockToInsert->xBlockSize ) == ( uint8_t * ) pxIterator->pxNextFreeBlock )
     {
-        if( pxIterator->pxNextFreeBlock != pxEnd )
+        if( pxIterator->pxNextFreeBlock != pxGroup->pxEnd )
         {
             /* Form one big block from the two blocks. */
             pxBlockToInsert->xBlockSize += pxIterator->pxNextFreeBlock->xBlockSize;
@@ -419,7 +558,7 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert )
         }
         else
         {
-            pxBlockToInsert->pxNextFreeBlock = pxEnd;
+            pxBlockToInsert->pxNextFreeBlock = pxGroup->pxEnd;
         }
     }
     else
@@ -451,9 +590,11 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
     BaseType_t xDefinedRegions = 0;
     portPOINTER_SIZE_TYPE xAddress;
     const HeapRegion_t * pxHeapRegion;
+    HeapGroup_t * pxGroup;
+    BaseType_t x;
 
     /* Can only call once! */
-    configASSERT( pxEnd == NULL );
+    configASSERT( xHeapDefined == pdFALSE );
 
     pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
 
@@ -475,51 +616,51 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
 
         xAlignedHeap = xAddress;
 
+        /* The region joins the heap of the memory it lies in. */
+        pxGroup = &( xHeapGroups[ heapREGION_GROUP( xAlignedHeap ) ] );
+
         /* Set xStart if it has not already been set. */
-        if( xDefinedRegions == 0 )
+        if( pxGroup->pxEnd == NULL )
         {
             /* xStart is used to hold a pointer to the first item in the list of
              *  free blocks.  The void cast is used to prevent compiler warnings. */
-            xStart.pxNextFreeBlock = ( BlockLink_t * ) xAlignedHeap;
-            xStart.xBlockSize = ( size_t ) 0;
+            pxGroup->xStart.pxNextFreeBlock = ( BlockLink_t * ) xAlignedHeap;
+            pxGroup->xStart.xBlockSize = ( size_t ) 0;
         }
         else
         {
-            /* Should only get here if one region has already been added to the
-             * heap. */
-            configASSERT( pxEnd != NULL );
-
             /* Check blocks are passed in with increasing start addresses. */
-            configASSERT( xAddress > ( size_t ) pxEnd );
+            configASSERT( xAddress > ( size_t ) pxGroup->pxEnd );
         }
 
-        /* Remember the location of the end marker in the previous region, if
-         * any. */
-        pxPreviousFreeBlock = pxEnd;
+        /* Remember the location of the end marker in the previous region of
+         * the group, if any. */
+        pxPreviousFreeBlock = pxGroup->pxEnd;
 
         /* pxEnd is used to mark the end of the list of free blocks and is
          * inserted at the end of the region space. */
         xAddress = xAlignedHeap + xTotalRegionSize;
         xAddress -= xHeapStructSize;
         xAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
-        pxEnd = ( BlockLink_t * ) xAddress;
-        pxEnd->xBlockSize = 0;
-        pxEnd->pxNextFreeBlock = NULL;
+        pxGroup->pxEnd = ( BlockLink_t * ) xAddress;
+        pxGroup->pxEnd->xBlockSize = 0;
+        pxGroup->pxEnd->pxNextFreeBlock = NULL;
 
         /* To start with there is a single free block in this region that is
          * sized to take up the entire heap region minus the space taken by the
          * free block structure. */
         pxFirstFreeBlockInRegion = ( BlockLink_t * ) xAlignedHeap;
         pxFirstFreeBlockInRegion->xBlockSize = ( size_t ) ( xAddress - ( portPOINTER_SIZE_TYPE ) pxFirstFreeBlockInRegion );
-        pxFirstFreeBlockInRegion->pxNextFreeBlock = pxEnd;
+        pxFirstFreeBlockInRegion->pxNextFreeBlock = pxGroup->pxEnd;
 
-        /* If this is not the first region that makes up the entire heap space
-         * then link the previous region to this region. */
+        /* If this is not the first region of the group then link the previous
+         * region to this region. */
         if( pxPreviousFreeBlock != NULL )
         {
             pxPreviousFreeBlock->pxNextFreeBlock = pxFirstFreeBlockInRegion;
         }
 
+        pxGroup->xFreeBytesRemaining += pxFirstFreeBlockInRegion->xBlockSize;
         xTotalHeapSize += pxFirstFreeBlockInRegion->xBlockSize;
 
         /* Move onto the next HeapRegion_t structure. */
@@ -527,28 +668,33 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
         pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
     }
 
-    xMinimumEverFreeBytesRemaining = xTotalHeapSize;
-    xFreeBytesRemaining = xTotalHeapSize;
+    for( x = 0; x < heapNUM_GROUPS; x++ )
+    {
+        xHeapGroups[ x ].xMinimumEverFreeBytesRemaining = xHeapGroups[ x ].xFreeBytesRemaining;
+    }
 
     /* Check something was actually defined before it is accessed. */
     configASSERT( xTotalHeapSize );
+
+    xHeapDefined = pdTRUE;
 }
 /*-----------------------------------------------------------*/
 
-void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+static void prvHeapGroupStats( HeapGroup_t * pxGroup,
+                               HeapStats_t * pxHeapStats )
 {
     BlockLink_t * pxBlock;
     size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
 
     vTaskSuspendAll();
+    heapLOCK( pxGroup );
     {
-        pxBlock = xStart.pxNextFreeBlock;
+        pxBlock = pxGroup->xStart.pxNextFreeBlock;
 
-        /* pxBlock will be NULL if the heap has not been initialised.  The heap
-         * is initialised automatically when the first allocation is made. */
+        /* pxBlock will be NULL if the group has no region. */
         if( pxBlock != NULL )
         {
-            while( pxBlock != pxEnd )
+            while( pxBlock != pxGroup->pxEnd )
             {
                 /* Increment the number of blocks and record the largest block seen
                  * so far. */
@@ -575,20 +721,61 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
                 pxBlock = pxBlock->pxNextFreeBlock;
             }
         }
+
+        pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+        pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+        pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+        pxHeapStats->xAvailableHeapSpaceInBytes = pxGroup->xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = pxGroup->xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = pxGroup->xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = pxGroup->xMinimumEverFreeBytesRemaining;
     }
+    heapUNLOCK( pxGroup );
     ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    HeapStats_t xGroupStats;
+    BaseType_t x;
 
-    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
-    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
-    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+    ( void ) memset( pxHeapStats, 0, sizeof( HeapStats_t ) );
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = portMAX_DELAY;
 
-    taskENTER_CRITICAL();
+    /* The sum over all groups, the largest and smallest block of any group. */
+    for( x = 0; x < heapNUM_GROUPS; x++ )
     {
-        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
-        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
-        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
-        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+        prvHeapGroupStats( &( xHeapGroups[ x ] ), &xGroupStats );
+
+        if( xGroupStats.xSizeOfLargestFreeBlockInBytes > pxHeapStats->xSizeOfLargestFreeBlockInBytes )
+        {
+            pxHeapStats->xSizeOfLargestFreeBlockInBytes = xGroupStats.xSizeOfLargestFreeBlockInBytes;
+        }
+
+        if( xGroupStats.xSizeOfSmallestFreeBlockInBytes < pxHeapStats->xSizeOfSmallestFreeBlockInBytes )
+        {
+            pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xGroupStats.xSizeOfSmallestFreeBlockInBytes;
+        }
+
+        pxHeapStats->xNumberOfFreeBlocks += xGroupStats.xNumberOfFreeBlocks;
+        pxHeapStats->xAvailableHeapSpaceInBytes += xGroupStats.xAvailableHeapSpaceInBytes;
+        pxHeapStats->xNumberOfSuccessfulAllocations += xGroupStats.xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees += xGroupStats.xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining += xGroupStats.xMinimumEverFreeBytesRemaining;
     }
-    taskEXIT_CRITICAL();
 }
 /*-----------------------------------------------------------*/
+
+#if ( configHEAP_PER_CORE_REGIONS == 1 )
+
+    void vPortGetHeapGroupStats( BaseType_t xGroup,
+                                 HeapStats_t * pxHeapStats )
+    {
+        configASSERT( ( xGroup >= 0 ) && ( xGroup < heapNUM_GROUPS ) );
+
+        prvHeapGroupStats( &( xHeapGroups[ xGroup ] ), pxHeapStats );
+    }
+
+#endif /* configHEAP_PER_CORE_REGIONS */
+/*-----------------------------------------------------------*/
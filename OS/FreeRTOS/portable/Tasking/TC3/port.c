@@ -40,16 +40,10 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "porttickless.h"
+#include "portcsa.h"
 
-/* Prgoram status word macros */
-#define portINITIAL_SYSTEM_PSW \
-    ( 0x000008FFUL ) /* Supervisor Mode, MPU Register Set 0 and Call Depth Counting disabled. */
-
-/* Context save area macros */
-#define portCSA_FCX_MASK          ( 0x000FFFFFUL )
-#define portINITIAL_LOWER_PCXI    ( 0x00300000UL ) /* Set UL to upper and PIE to 1 */
-#define portINITIAL_UPPER_PCXI    ( 0x00200000UL ) /* Set UL to lower and PIE to 1 */
-#define portNUM_WORDS_IN_CSA      ( 16 )
+/* Program status word and context save area macros: portcsa.h */
 
 extern volatile unsigned long * pxCurrentTCB;
 
@@ -57,9 +51,19 @@ extern volatile unsigned long * pxCurrentTCB;
 #define portTICK_COUNT    ( configSTM_CLOCK_HZ / configTICK_RATE_HZ )
 
 /* Register defines */
+#if configPER_CORE_SCHEDULER != 0
+/* One scheduler per core: STM, STM service request and context GPSR of the executing core, the handlers are
+ * registered in the vector tables of all cores */
+    #define pxStm                        ( ( volatile uint32_t * ) configSTM )
+    #define pxStmSrc                     ( ( volatile uint32_t * ) configSTM_SRC )
+    #define pxContextSrc                 ( ( volatile uint32_t * ) configCONTEXT_SRC )
+    #define portVECTOR_TABLES            0, 1, 2
+#else
 static volatile uint32_t *const pxStm = configSTM;
 static volatile uint32_t *const pxStmSrc = configSTM_SRC;
 static volatile uint32_t *const pxContextSrc = configCONTEXT_SRC;
+    #define portVECTOR_TABLES            configCPU_NR
+#endif
 #define portSTM_TIM0                 0x10
 #define portSTM_CMP0                 0x30
 #define portSTM_COMCON               0x38
@@ -69,24 +73,61 @@ static volatile uint32_t *const pxContextSrc = configCONTEXT_SRC;
 
 #define portSTM_CMCON_MSTART0_OFF    8
 #define portSTM_CMCON_MSIZE0_OFF     0
+#define portSTM_CMCON_CMP1_MSK       0xFFFF0000
 #define portSTM_ICR_CMP0EN_OFF       0
 #define portSTM_ICR_CMP0OS_OFF       2
 #define portSTM_ISCR_CMP0IRR_OFF     0
 
+#if configUSE_TICKLESS_IDLE == 1
+/* Longest sleep the 32 bit compare can express, and the STM ticks a compare write needs to take effect before the
+ * timer reaches the new value (the compare only matches on equality) */
+    #define portMAX_SUPPRESSED_TICKS     ( ( TickType_t ) ( 0x7FFFFFFFUL / portTICK_COUNT ) )
+    #define portTICKLESS_MARGIN          ( 100UL )
+#endif
+
 static inline void vPortStartFirstTask( void );
 static inline void vPortInitContextSrc( void );
 static inline void vPortInitTickTimer( void );
 
-static inline void __attribute__( ( always_inline ) ) vPortLoadContext( unsigned char ucCallDepth );
-static inline void __attribute__( ( always_inline ) ) vPortSaveContext( unsigned char ucCallDepth );
+static inline uint32_t __attribute__( ( always_inline ) ) uxPortLoadContext( void );
+static inline void __attribute__( ( always_inline ) ) vPortSaveContext( uint32_t uxLowerCSA );
+static inline uint32_t * __attribute__( ( always_inline ) ) pxPortCallStackLink( unsigned char ucCallDepth );
+static inline void __attribute__( ( always_inline ) ) vPortSwitchContext( void );
 
-static inline uint32_t * __attribute__( ( always_inline ) ) pxPortCsaToAddress( uint32_t xCsa );
+#define portINITIAL_CRITICAL_NESTING    ( 0xaaaaaaaaUL )
 
-static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
+/* ISR entry and exit hooks of the tick handler, not part of the kernel trace macros of this FreeRTOS version */
+#ifndef traceISR_ENTER
+    #define traceISR_ENTER()
+#endif
+#ifndef traceISR_EXIT
+    #define traceISR_EXIT()
+#endif
+
+#if ( configPORT_SWITCH_CONTEXT_STATS == 1 )
+/* Outside the core local kernel data, so the debugger sees the figures of all cores */
+volatile PortSwitchContextStats_t xPortSwitchContextStats[ portSWITCH_CONTEXT_STATS_CORES ];
+#endif
+
+#if configPER_CORE_SCHEDULER != 0
+/* Core local like the rest of the kernel data, seeded by vPortInitCoreData() */
+PRIVILEGED_DATA static UBaseType_t uxCriticalNesting;
+
+/* Bounds of the core local kernel data, provided by the linker script */
+extern uint8_t __KERNEL_LOCAL_START[];
+extern uint8_t __KERNEL_LOCAL_END[];
+#else
+static UBaseType_t uxCriticalNesting = portINITIAL_CRITICAL_NESTING;
+#endif
 
 /* FreeRTOS required functions */
 BaseType_t xPortStartScheduler( void )
 {
+    #if ( configPORT_SWITCH_CONTEXT_STATS == 1 )
+        /* The cycle counter runs from here on */
+        __mtcr( portCPU_CCTRL, __mfcr( portCPU_CCTRL ) | portCPU_CCTRL_CE );
+    #endif
+
     vPortInitTickTimer();
     vPortInitContextSrc();
     vPortStartFirstTask();
@@ -100,13 +141,22 @@ void vPortEndScheduler()
     pxContextSrc[ 0 ] &= ~( 1 << portSRC_SRCR_SRE_OFF );
 }
 
+#if configPER_CORE_SCHEDULER != 0
+void vPortInitCoreData( void )
+{
+    /* The kernel data is linked at the core local DSPR alias, so this clears the copy of the executing core only.
+     * Must run on every core before its first kernel call, the startup code only initialises data on CPU0. */
+    memset( __KERNEL_LOCAL_START, 0, ( size_t ) ( __KERNEL_LOCAL_END - __KERNEL_LOCAL_START ) );
+    uxCriticalNesting = portINITIAL_CRITICAL_NESTING;
+}
+#endif
+
 StackType_t *pxPortInitialiseStack( StackType_t * pxTopOfStack,
                                     TaskFunction_t pxCode,
                                     void * pvParameters )
 {
-    uint32_t xLowerCsa = 0, xUpperCsa = 0;
-    uint32_t * pxUpperCSA = NULL;
-    uint32_t * pxLowerCSA = NULL;
+    uint32_t ulFcx;
+    uint32_t ulCsa[ portTASK_CSAS ] = { 0 }; /* Lower, upper and anchor CSA */
 
     /* Have to disable interrupts here because the CSAs are going to be
      * manipulated. */
@@ -115,22 +165,13 @@ StackType_t *pxPortInitialiseStack( StackType_t * pxTopOfStack,
         /* DSync to ensure that buffering is not a problem. */
         __dsync();
 
-        /* Consume two free CSAs. */
-        xLowerCsa = __mfcr( portCPU_FCX );
-        pxLowerCSA = pxPortCsaToAddress( xLowerCsa );
-
-        if( pxLowerCSA != NULL )
-        {
-            /* The Lower Links to the Upper. */
-            xUpperCsa = pxLowerCSA[ 0 ];
-            pxUpperCSA = pxPortCsaToAddress( pxLowerCSA[ 0 ] );
-        }
+        /* Consume three free CSAs. */
+        ulFcx = __mfcr( portCPU_FCX ) & portCSA_FCX_MASK;
 
-        /* Check that we have successfully reserved two CSAs. */
-        if( ( pxLowerCSA != NULL ) && ( pxUpperCSA != NULL ) )
+        if( ulPortCsaTake( &ulFcx, ulCsa, portTASK_CSAS ) != 0 )
         {
-            /* Remove the two consumed CSAs from the free CSA list. */
-            __mtcr( portCPU_FCX, pxUpperCSA[ 0 ] );
+            /* Remove the three consumed CSAs from the free CSA list. */
+            __mtcr( portCPU_FCX, ulFcx );
         }
         else
         {
@@ -140,48 +181,41 @@ StackType_t *pxPortInitialiseStack( StackType_t * pxTopOfStack,
     }
     __enable();
 
-    /* Upper Context. */
-    memset( pxUpperCSA, 0, portNUM_WORDS_IN_CSA * sizeof( uint32_t ) );
-    pxUpperCSA[ 2 ] = ( uint32_t ) pxTopOfStack; /* A10;    Stack Return aka Stack Pointer */
-    pxUpperCSA[ 1 ] = portINITIAL_SYSTEM_PSW;    /* PSW    */
-    pxUpperCSA[ 0 ] = portINITIAL_UPPER_PCXI;
-
-    /* Lower Context. */
-    memset( pxLowerCSA, 0, portNUM_WORDS_IN_CSA * sizeof( uint32_t ) );
-    pxLowerCSA[ 8 ] = ( uint32_t ) pvParameters;          /* A4;    Address Type Parameter Register    */
-    pxLowerCSA[ 1 ] = ( uint32_t ) pxCode;                /* A11;    Return Address aka RA */
-    pxLowerCSA[ 0 ] = portINITIAL_LOWER_PCXI | xUpperCsa; /* PCXI pointing to the Upper context. */
-
-    /* Initialize the uxCriticalNesting. */
-    pxTopOfStack--;
-    *pxTopOfStack = 0;
-    /* Save the link to the CSA to the top of stack. */
-    pxTopOfStack--;
-    *pxTopOfStack = xLowerCsa;
-
-    return pxTopOfStack;
+    return ( StackType_t * ) pulPortCsaInitTask( ( uint32_t * ) pxTopOfStack, ulCsa, ( uint32_t ) pxCode,
+                                                 ( uint32_t ) pvParameters );
 }
 
-void __interrupt( configCONTEXT_INTERRUPT_PRIORITY ) __vector_table( configCPU_NR )
+void __interrupt( configCONTEXT_INTERRUPT_PRIORITY ) __vector_table( portVECTOR_TABLES )
 vPortSystemContextHandler()
 {
+    volatile unsigned long * pxPreviousTCB;
+
     /* Disable interrupts to protect section*/
     __disable();
 
-    /* Do a save, switch, execute */
-    vPortSaveContext( 0 );
-    vTaskSwitchContext();
-    vPortLoadContext( 0 );
+    /* Do a save, switch, execute. The lower context of the task is the one saved on entry of this handler, the
+     * new one only has to be linked in if the scheduler picked another task. */
+    pxPreviousTCB = pxCurrentTCB;
+    __dsync();
+    vPortSaveContext( __mfcr( portCPU_PCXI ) );
+    vPortSwitchContext();
+
+    if( pxCurrentTCB != pxPreviousTCB )
+    {
+        __mtcr( portCPU_PCXI, uxPortLoadContext() );
+    }
 
     __enable();
 }
 
-void __interrupt( configTIMER_INTERRUPT_PRIORITY ) __vector_table( configCPU_NR )
+void __interrupt( configTIMER_INTERRUPT_PRIORITY ) __vector_table( portVECTOR_TABLES )
 vPortSystemTickHandler()
 {
     unsigned long ulSavedInterruptMask;
     BaseType_t xYieldRequired;
 
+    traceISR_ENTER();
+
     /* Increment compare value by tick count */
     pxStm[ portSTM_CMP0 >> 2 ] = pxStm[ portSTM_CMP0 >> 2 ] + portTICK_COUNT;
     pxStm[ portSTM_ISCR >> 2 ] |= ( 1 << portSTM_ISCR_CMP0IRR_OFF );
@@ -203,6 +237,8 @@ vPortSystemTickHandler()
     }
     portCLEAR_INTERRUPT_MASK_FROM_ISR( ulSavedInterruptMask );
 
+    traceISR_EXIT();
+
     portYIELD_FROM_ISR( xYieldRequired );
 }
 
@@ -210,7 +246,7 @@ void __attribute__( ( noinline ) ) vPortSyscallYield( void );
 
 int
 #if configPROVIDE_SYSCALL_TRAP != 0
-    __trap( configTIMER_INTERRUPT_PRIORITY ) __vector_table( configCPU_NR )
+    __trap( configTIMER_INTERRUPT_PRIORITY ) __vector_table( portVECTOR_TABLES )
 #endif
 vPortSyscallHandler( unsigned char id )
 {
@@ -229,7 +265,8 @@ vPortSyscallHandler( unsigned char id )
 
 void vPortInitTickTimer()
 {
-    pxStm[ portSTM_COMCON >> 2 ] =
+    /* Only compare 0 belongs to the tick, compare 1 (upper half of CMCON) is left to the application. */
+    pxStm[ portSTM_COMCON >> 2 ] = ( pxStm[ portSTM_COMCON >> 2 ] & portSTM_CMCON_CMP1_MSK ) |
         ( 0 << portSTM_CMCON_MSTART0_OFF ) | ( 31 << portSTM_CMCON_MSIZE0_OFF );
     pxStm[ portSTM_ICR >> 2 ] &= ~( 1 << portSTM_ICR_CMP0OS_OFF );
     pxStmSrc[ 0 ] = ( ( configCPU_NR > 0 ?
@@ -245,6 +282,72 @@ void vPortInitTickTimer()
     #endif
 }
 
+#if configUSE_TICKLESS_IDLE == 1
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+    uint32_t ulNextTick, ulNow;
+    TickType_t xModifiableIdleTime, xCompleteTicks;
+
+    if( xExpectedIdleTime > portMAX_SUPPRESSED_TICKS )
+    {
+        xExpectedIdleTime = portMAX_SUPPRESSED_TICKS;
+    }
+
+    /* The wait below still wakes up on a pending interrupt, it is taken after __enable() */
+    __disable();
+    __dsync();
+
+    ulNextTick = pxStm[ portSTM_CMP0 >> 2 ];
+
+    /* Stay in the normal tick if a task became ready, the tick is already pending or too close to move it */
+    if( ( eTaskConfirmSleepModeStatus() == eAbortSleep ) ||
+        ( ( pxStmSrc[ 0 ] & ( 1 << portSRC_SRCR_SRR_OFF ) ) != 0 ) ||
+        ( ( int32_t ) ( ulNextTick - pxStm[ portSTM_TIM0 >> 2 ] ) < ( int32_t ) portTICKLESS_MARGIN ) )
+    {
+        __enable();
+        return;
+    }
+
+    /* Move compare 0 to the tick the next task unblocks on. The STM keeps counting during the sleep, the skipped
+     * ticks are derived from it afterwards. */
+    pxStm[ portSTM_CMP0 >> 2 ] = ulNextTick + ( ( uint32_t ) xExpectedIdleTime - 1UL ) * portTICK_COUNT;
+
+    xModifiableIdleTime = xExpectedIdleTime;
+    configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+
+    if( xModifiableIdleTime > 0 )
+    {
+        __dsync();
+        __asm( "\twait" );
+    }
+
+    configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+    if( ( pxStmSrc[ 0 ] & ( 1 << portSRC_SRCR_SRR_OFF ) ) != 0 )
+    {
+        /* Slept until the compare matched, the pending tick interrupt counts the last tick and reloads compare 0 */
+        xCompleteTicks = xExpectedIdleTime - 1;
+    }
+    else
+    {
+        /* Woken early by another interrupt: count the tick instants already passed (plus the margin to reprogram)
+         * and resume the periodic tick on the next one */
+        ulNow = pxStm[ portSTM_TIM0 >> 2 ] + portTICKLESS_MARGIN;
+        xCompleteTicks = ( TickType_t ) ulPortTicklessCompleteTicks( ulNextTick, ulNow, ( uint32_t ) xExpectedIdleTime,
+                                                                     portTICK_COUNT );
+
+        if( xCompleteTicks < ( xExpectedIdleTime - 1 ) )
+        {
+            pxStm[ portSTM_CMP0 >> 2 ] = ulNextTick + ( uint32_t ) xCompleteTicks * portTICK_COUNT;
+        }
+    }
+
+    vTaskStepTick( xCompleteTicks );
+
+    __enable();
+}
+#endif /* configUSE_TICKLESS_IDLE */
+
 void vPortInitContextSrc()
 {
     pxContextSrc[ 0 ] =
@@ -259,7 +362,7 @@ void vPortStartFirstTask()
     /* Disable interrupts  */
     __disable();
 
-    vPortLoadContext( 0 );
+    __mtcr( portCPU_PCXI, uxPortLoadContext() );
 
     /* Reset the call stack counting, to avoid trap on rfe */
     unsigned long ulPsw = __mfcr( portCPU_PSW );
@@ -275,7 +378,8 @@ void vPortStartFirstTask()
     __nop();
 }
 
-void vPortLoadContext( unsigned char ucCallDepth )
+/* Pop the context of pxCurrentTCB, returns its lower context (PCXI value) */
+uint32_t uxPortLoadContext( void )
 {
     uint32_t ** ppxTopOfStack;
     uint32_t uxLowerCSA;
@@ -290,54 +394,15 @@ void vPortLoadContext( unsigned char ucCallDepth )
     uxCriticalNesting = **ppxTopOfStack;
     ( *ppxTopOfStack )++;
 
-    /* Store the lower context directly if inside the syscall or interrupt,
-     * else replace the lower context in the call stack. */
-    if( !ucCallDepth )
-    {
-        /* Update the link register */
-        __mtcr( portCPU_PCXI, uxLowerCSA );
-    }
-    else
-    {
-        /* Update previous lower context */
-        uint32_t * pxCSA = pxPortCsaToAddress( __mfcr( portCPU_PCXI ) );
-        int i;
-
-        for(i = 0; i < ucCallDepth - 1; i++)
-        {
-            pxCSA = pxPortCsaToAddress( pxCSA[ 0 ] );
-        }
-
-        pxCSA[ 0 ] = uxLowerCSA;
-    }
+    return uxLowerCSA;
 }
 
-void vPortSaveContext( unsigned char ucCallDepth )
+/* Push the context of pxCurrentTCB, uxLowerCSA is its lower context (PCXI value). The caller issues the DSYNC
+ * which makes the saved CSAs readable. */
+void vPortSaveContext( uint32_t uxLowerCSA )
 {
     uint32_t ** ppxTopOfStack;
     uint32_t * pxLowerCSA, * pxUpperCSA;
-    uint32_t uxLowerCSA;
-
-    /* Dsync is required for save CSA access */
-    __dsync();
-
-    /* Get the current context information. */
-    uxLowerCSA = __mfcr( portCPU_PCXI );
-
-    /* If this function is used inside a function from the syscall or interrupt,
-     * load the correct context from the call stack */
-    if( ucCallDepth )
-    {
-        uint32_t * pxCSA = pxPortCsaToAddress( uxLowerCSA );
-        int i;
-
-        for(i = 0; i < ucCallDepth - 1; i++)
-        {
-            pxCSA = pxPortCsaToAddress( pxCSA[ 0 ] );
-        }
-
-        uxLowerCSA = pxCSA[ 0 ];
-    }
 
     pxLowerCSA = pxPortCsaToAddress( uxLowerCSA );
     pxUpperCSA = pxPortCsaToAddress( pxLowerCSA[ 0 ] );
@@ -354,21 +419,63 @@ void vPortSaveContext( unsigned char ucCallDepth )
     **ppxTopOfStack = uxLowerCSA;
 }
 
+/* Link word of the call stack holding the lower context of the task, ucCallDepth frames below the current one.
+ * Inside the syscall the task context is replaced in the call stack instead of in the PCXI register. */
+uint32_t * pxPortCallStackLink( unsigned char ucCallDepth )
+{
+    uint32_t * pxCSA = pxPortCsaToAddress( __mfcr( portCPU_PCXI ) );
+    int i;
+
+    for(i = 0; i < ucCallDepth - 1; i++)
+    {
+        pxCSA = pxPortCsaToAddress( pxCSA[ 0 ] );
+    }
+
+    return &pxCSA[ 0 ];
+}
+
 void vPortSyscallYield()
 {
-    /* Do a save, switch, execute */
-    vPortSaveContext( configSYSCALL_CALL_DEPTH );
-    vTaskSwitchContext();
-    vPortLoadContext( configSYSCALL_CALL_DEPTH );
+    uint32_t * pxLink;
+    volatile unsigned long * pxPreviousTCB = pxCurrentTCB;
+
+    /* Do a save, switch, execute. The call stack is walked once, save and load share its link word. */
+    __dsync();
+    pxLink = pxPortCallStackLink( configSYSCALL_CALL_DEPTH );
+    vPortSaveContext( *pxLink );
+    vPortSwitchContext();
+
+    if( pxCurrentTCB != pxPreviousTCB )
+    {
+        *pxLink = uxPortLoadContext();
+    }
 }
 
-uint32_t * pxPortCsaToAddress( uint32_t xCsa )
+void vPortSwitchContext( void )
 {
-    uint32_t pxCsa;
+    #if ( configPORT_SWITCH_CONTEXT_STATS == 1 )
+        volatile PortSwitchContextStats_t * pxStats = &xPortSwitchContextStats[ portGET_CORE_ID() ];
+        uint32_t ulStart = __mfcr( portCPU_CCNT );
+        uint32_t ulCycles;
 
-    pxCsa = ( __extru( xCsa, 16, 4 ) << 28 );
-    pxCsa = __insert( pxCsa, xCsa, 6, 16 );
-    return ( uint32_t * ) pxCsa;
+        vTaskSwitchContext();
+
+        ulCycles = ( __mfcr( portCPU_CCNT ) - ulStart ) & portCPU_CCNT_MSK;
+        pxStats->ulCyclesLast = ulCycles;
+        pxStats->ulSamples++;
+
+        if( ( ulCycles < pxStats->ulCyclesMin ) || ( pxStats->ulCyclesMin == 0 ) )
+        {
+            pxStats->ulCyclesMin = ulCycles;
+        }
+
+        if( ulCycles > pxStats->ulCyclesMax )
+        {
+            pxStats->ulCyclesMax = ulCycles;
+        }
+    #else
+        vTaskSwitchContext();
+    #endif
 }
 
 void vPortEnterCritical( void )
@@ -406,46 +513,34 @@ void vPortExitCritical( void )
  * Stack. These CSAs can only be returned to the Globally Free Pool when
  * they are not part of the current Call Stack, hence, delaying the
  * reclamation until the IDLE task is freeing the task's other resources.
- * This function uses the head of the linked list of CSAs (from when the
- * task yielded for the last time) and finds the tail (the very bottom of
- * the call stack) and inserts this list at the head of the Free list,
- * attaching the existing Free List to the tail of the reclaimed call stack.
+ * The CSAs of the task form one list, from the head (the lower context
+ * saved when the task yielded for the last time) down to the anchor CSA
+ * allocated by pxPortInitialiseStack(). vPortCsaSplice() (portcsa.h) puts
+ * the whole list in front of the Free list in constant time.
  *
  * NOTE: In highly loaded systems the release of used CSAs might be delayed,
  * since it is executed es part of the calling tasks, if the deleted task is
  * different from the calling tasks, or as part of the idle task, if the deleted
  * tasks is the same as the calling task.
  */
-void vPortReclaimCSA( unsigned long ** pxTCB )
+void vPortReclaimCSA( unsigned long ** pxTCB,
+                      StackType_t * pxEndOfStack )
 {
-    uint32_t ulHeadCSA, ulFreeCSA;
-    uint32_t * pulNextCSA;
+    uint32_t ulHeadCSA;
+    uint32_t ulFcx;
 
     /* The lower context (PCXI value) to return to the task is stored as the
-     * current element on the stack. Mask off everything in the PCXI register
-     * other than the address. */
+     * current element on the stack, the anchor at the end of the stack. */
     ulHeadCSA = ( **pxTCB ) & portCSA_FCX_MASK;
 
-    /* Iterate over the CSAs that were consumed as part of the task. */
-    for(pulNextCSA = pxPortCsaToAddress( ulHeadCSA );
-        ( pulNextCSA[ 0 ] & portCSA_FCX_MASK ) != 0;
-        pulNextCSA = pxPortCsaToAddress( pulNextCSA[ 0 ] ) )
-    {
-        /* Mask off everything in the PCXI value other than the address. */
-        pulNextCSA[ 0 ] &= portCSA_FCX_MASK;
-    }
-
     __disable();
     {
-        /* Look up the current free CSA head. */
+        /* Join the current free onto the anchor, the tail of what is being
+         * reclaimed, and move the head of the reclaimed into the Free. */
         __dsync();
-        ulFreeCSA = __mfcr( portCPU_FCX );
-
-        /* Join the current free onto the tail of what is being reclaimed. */
-        pulNextCSA[ 0 ] = ulFreeCSA;
-
-        /* Move the head of the reclaimed into the Free. */
-        __mtcr( portCPU_FCX, ulHeadCSA );
+        ulFcx = __mfcr( portCPU_FCX ) & portCSA_FCX_MASK;
+        vPortCsaSplice( &ulFcx, ulHeadCSA, *pxEndOfStack );
+        __mtcr( portCPU_FCX, ulFcx );
     }
     __enable();
 }
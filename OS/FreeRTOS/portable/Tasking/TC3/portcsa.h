@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                               IMPORTANT NOTICE
+ *
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such
+ * terms of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or
+ * organization obtaining a copy of the software and accompanying
+ * documentation covered by this license (the "Software") to use, reproduce,
+ * display, distribute, execute, and transmit the Software, and to prepare
+ * derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef PORTCSA_H
+#define PORTCSA_H
+
+#include <stdint.h>
+#include <string.h>
+
+/* CSA lists of the port, free of register accesses so that they also build on the host.
+ *
+ * A CSA is named by bits 19:0 of a link word (segment 19:16, offset 15:0), 0 ends a list. The free list starts at
+ * FCX: the caller reads FCX into *pulFcx, hands it to these functions and writes it back, with interrupts disabled.
+ * The CSAs of a task form one list from the lower context saved when it last left the CPU down to its anchor CSA,
+ * which pulPortCsaInitTask() places below the first upper context and which stays with the task until it is
+ * deleted. A host model of the CSA memory defines portCSA_TO_ADDRESS() before including this file.
+ */
+#define portCSA_FCX_MASK          ( 0x000FFFFFUL )
+#define portINITIAL_SYSTEM_PSW \
+    ( 0x000008FFUL ) /* Supervisor Mode, MPU Register Set 0 and Call Depth Counting disabled. */
+#define portINITIAL_LOWER_PCXI    ( 0x00300000UL ) /* Set UL to upper and PIE to 1 */
+#define portINITIAL_UPPER_PCXI    ( 0x00200000UL ) /* Set UL to lower and PIE to 1 */
+#define portNUM_WORDS_IN_CSA      ( 16 )
+#define portANCHOR_STACK_WORDS    ( 2 )  /* Anchor CSA id at pxEndOfStack, keeps the stack pointer 8 byte aligned */
+#define portTASK_CSAS             ( 3 )  /* Lower, upper and anchor CSA of a new task */
+
+#ifndef portCSA_TO_ADDRESS
+    #define portCSA_TO_ADDRESS( xCsa ) \
+    ( ( uint32_t * ) ( ( ( ( xCsa ) & 0x000F0000UL ) << 12 ) | ( ( ( xCsa ) & 0x0000FFFFUL ) << 6 ) ) )
+#endif
+
+static inline uint32_t * pxPortCsaToAddress( uint32_t xCsa )
+{
+    return portCSA_TO_ADDRESS( xCsa & portCSA_FCX_MASK );
+}
+
+/* Takes ulCount CSAs from the head of the free list into pulCsa[], in list order. Returns 0 and leaves the free list
+ * as it is if it holds fewer. */
+static inline uint32_t ulPortCsaTake( uint32_t * pulFcx,
+                                      uint32_t * pulCsa,
+                                      uint32_t ulCount )
+{
+    uint32_t ulNext = *pulFcx & portCSA_FCX_MASK;
+    uint32_t i;
+
+    for( i = 0; i < ulCount; i++ )
+    {
+        if( ulNext == 0 )
+        {
+            return 0;
+        }
+
+        pulCsa[ i ] = ulNext;
+        ulNext = pxPortCsaToAddress( ulNext )[ 0 ] & portCSA_FCX_MASK;
+    }
+
+    *pulFcx = ulNext;
+
+    return ulCount;
+}
+
+/* First context of a task in the CSAs of ulPortCsaTake( ..., portTASK_CSAS ): the lower context runs pxCode with
+ * pvParameters in A4, its upper context starts the stack below the anchor id. Returns the top of stack, which holds
+ * the lower context and the critical nesting as the context switch pops them. */
+static inline uint32_t * pulPortCsaInitTask( uint32_t * pulTopOfStack,
+                                             const uint32_t * pulCsa,
+                                             uint32_t ulCode,
+                                             uint32_t ulParameters )
+{
+    uint32_t * pxLowerCSA = pxPortCsaToAddress( pulCsa[ 0 ] );
+    uint32_t * pxUpperCSA = pxPortCsaToAddress( pulCsa[ 1 ] );
+    uint32_t * pxAnchorCSA = pxPortCsaToAddress( pulCsa[ 2 ] );
+
+    /* Anchor: the bottom of the call stack of the task, every CSA the task ever links ends here. It stays allocated
+     * for the life of the task, so vPortCsaSplice() knows the tail of the chain without walking it. Its CSA id is
+     * kept in the highest word of the stack (pxEndOfStack), below which the stack pointer starts 8 byte aligned.
+     * The link to it is typed as lower context (UL = 0): a return from the task function traps. */
+    memset( pxAnchorCSA, 0, portNUM_WORDS_IN_CSA * sizeof( uint32_t ) );
+    *pulTopOfStack = pulCsa[ 2 ];
+    pulTopOfStack -= portANCHOR_STACK_WORDS;
+
+    /* Upper Context. */
+    memset( pxUpperCSA, 0, portNUM_WORDS_IN_CSA * sizeof( uint32_t ) );
+    pxUpperCSA[ 2 ] = ( uint32_t ) pulTopOfStack;             /* A10;    Stack Return aka Stack Pointer */
+    pxUpperCSA[ 1 ] = portINITIAL_SYSTEM_PSW;                 /* PSW    */
+    pxUpperCSA[ 0 ] = portINITIAL_UPPER_PCXI | pulCsa[ 2 ];   /* PCXI pointing to the Anchor. */
+
+    /* Lower Context. */
+    memset( pxLowerCSA, 0, portNUM_WORDS_IN_CSA * sizeof( uint32_t ) );
+    pxLowerCSA[ 8 ] = ulParameters;                           /* A4;    Address Type Parameter Register    */
+    pxLowerCSA[ 1 ] = ulCode;                                 /* A11;    Return Address aka RA */
+    pxLowerCSA[ 0 ] = portINITIAL_LOWER_PCXI | pulCsa[ 1 ];   /* PCXI pointing to the Upper context. */
+
+    /* Initialize the uxCriticalNesting. */
+    pulTopOfStack--;
+    *pulTopOfStack = 0;
+    /* Save the link to the CSA to the top of stack. */
+    pulTopOfStack--;
+    *pulTopOfStack = pulCsa[ 0 ];
+
+    return pulTopOfStack;
+}
+
+/* Returns the CSAs of a task, the list from ulHeadCSA down to ulAnchorCSA, to the free list in constant time: the
+ * anchor takes the old free head as link, the head of the task list becomes the free head. Only the link field of a
+ * free CSA is used by the hardware, the PCXI bits left in the links of the task list do not have to be cleared. */
+static inline void vPortCsaSplice( uint32_t * pulFcx,
+                                   uint32_t ulHeadCSA,
+                                   uint32_t ulAnchorCSA )
+{
+    pxPortCsaToAddress( ulAnchorCSA )[ 0 ] = *pulFcx & portCSA_FCX_MASK;
+    *pulFcx = ulHeadCSA & portCSA_FCX_MASK;
+}
+
+#endif /* PORTCSA_H */
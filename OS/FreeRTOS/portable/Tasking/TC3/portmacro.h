@@ -53,6 +53,10 @@
 #define portCPU_FCX              0xFE38
 #define portCPU_PCXI             0xFE00
 #define portCPU_CORE_ID          0xFE1C
+#define portCPU_CCTRL            0xFC00
+#define portCPU_CCTRL_CE         ( 0x00000002UL )
+#define portCPU_CCNT             0xFC04
+#define portCPU_CCNT_MSK         ( 0x7FFFFFFFUL )
 
 /* Register defintions */
 #define portSRC_SRCR_SRPN_OFF    0
@@ -97,6 +101,7 @@ typedef unsigned long        UBaseType_t;
 /* Instructions */
 #define portNOP()               __nop()
 #define portMEMORY_BARRIER()    __dsync()
+#define portGET_CORE_ID()       ( __mfcr( portCPU_CORE_ID ) & 0x7UL )
 
 /* Critical section management */
 extern void vPortEnterCritical( void );
@@ -145,13 +150,64 @@ extern void vPortExitCritical( void );
 
 #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 
+/* Cycles of vTaskSwitchContext() per core (configPORT_SWITCH_CONTEXT_STATS), taken from CCNT around the call in the
+ * context switch handler and the yield syscall, with or without the optimised task selection */
+#if ( configPORT_SWITCH_CONTEXT_STATS == 1 )
+    #define portSWITCH_CONTEXT_STATS_CORES    ( 3 )
+
+    typedef struct xPORT_SWITCH_CONTEXT_STATS
+    {
+        uint32_t ulSamples;    /* Calls measured */
+        uint32_t ulCyclesLast; /* Latest call */
+        uint32_t ulCyclesMin;  /* Shortest call */
+        uint32_t ulCyclesMax;  /* Longest call */
+    } PortSwitchContextStats_t;
+
+    extern volatile PortSwitchContextStats_t xPortSwitchContextStats[ portSWITCH_CONTEXT_STATS_CORES ];
+#endif
+
 /* Function prototypes */
 #define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
 #define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
 
 /* TCB handling */
-extern void vPortReclaimCSA( unsigned long ** pxTCB );
-#define portCLEAN_UP_TCB( pxTCB )    vPortReclaimCSA( ( unsigned long ** ) ( pxTCB ) )
+#if ( configRECORD_STACK_HIGH_ADDRESS != 1 )
+    #error "configRECORD_STACK_HIGH_ADDRESS must be 1, the CSA anchor of a task is kept at pxEndOfStack"
+#endif
+extern void vPortReclaimCSA( unsigned long ** pxTCB,
+                             StackType_t * pxEndOfStack );
+#define portCLEAN_UP_TCB( pxTCB )    vPortReclaimCSA( ( unsigned long ** ) ( pxTCB ), ( pxTCB )->pxEndOfStack )
+
+/* heap_5 with one heap per core (configHEAP_PER_CORE_REGIONS): groups 0..2 take the regions in the DSPR of CPU0..CPU2
+ * (global addresses 0x7xxxxxxx, 0x6xxxxxxx, 0x5xxxxxxx), group 3 every other region (LMU), shared by the cores.
+ * A group is guarded against the other cores by a CMPSWAP spin lock, against the own core by vTaskSuspendAll(). */
+#if ( configHEAP_PER_CORE_REGIONS == 1 )
+    #define portHEAP_GROUPS                      ( 4 )
+    #define portHEAP_SHARED_GROUP                ( 3 )
+    #define portHEAP_REGION_GROUP( xAddress )                                                   \
+    ( ( ( ( ( uint32_t ) ( xAddress ) >> 28 ) - 5UL ) <= 2UL ) ?                                \
+      ( BaseType_t ) ( 7UL - ( ( uint32_t ) ( xAddress ) >> 28 ) ) : portHEAP_SHARED_GROUP )
+    #define portHEAP_CALLER_GROUP()              ( ( BaseType_t ) portGET_CORE_ID() )
+    #define portHEAP_LOCK( pulLock )             while( __cmpswapw( ( pulLock ), 1, 0 ) != 0 ) {}
+    #define portHEAP_UNLOCK( pulLock )           do { __dsync(); *( pulLock ) = 0; } while( 0 )
+
+    struct xHeapStats;
+    extern void * pvPortMallocGroup( BaseType_t xGroup,
+                                     size_t xWantedSize );
+    extern void vPortGetHeapGroupStats( BaseType_t xGroup,
+                                        struct xHeapStats * pxHeapStats );
+#endif
+
+/* Tickless idle, the tick compare is moved to the next unblock time */
+#if ( configUSE_TICKLESS_IDLE == 1 )
+    extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+    #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )    vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+
+/* Per core scheduler instances, each core initialises its local kernel data before it uses the kernel */
+#if ( configPER_CORE_SCHEDULER != 0 )
+    extern void vPortInitCoreData( void );
+#endif
 
 
 /* ICR & CCPN modifying functions to enable and disable interrupts.
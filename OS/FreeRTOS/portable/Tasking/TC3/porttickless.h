@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                               IMPORTANT NOTICE
+ *
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such
+ * terms of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or
+ * organization obtaining a copy of the software and accompanying
+ * documentation covered by this license (the "Software") to use, reproduce,
+ * display, distribute, execute, and transmit the Software, and to prepare
+ * derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef PORTTICKLESS_H
+#define PORTTICKLESS_H
+
+#include <stdint.h>
+
+/* Tick arithmetic of vPortSuppressTicksAndSleep(), free of register accesses so that it also builds on the host.
+ *
+ * The tick instants of a sleep are ulNextTick + k * ulTickCount (k = 0, 1, ...), ulNextTick being the compare value
+ * of the first suppressed tick; the compare of the last one (k = ulExpectedIdleTime - 1) ends the sleep. After an
+ * early wake-up at ulNow (the STM time plus the margin to reprogram the compare) the returned count covers every
+ * instant up to ulNow, at most ulExpectedIdleTime - 1 of them: the tick interrupt counts the instant it matches on.
+ * Below that limit the periodic tick resumes at ulNextTick + count * ulTickCount, the first instant after ulNow.
+ * All times wrap modulo 2^32, the sleep is at most 2^31 STM ticks long.
+ */
+static inline uint32_t ulPortTicklessCompleteTicks( uint32_t ulNextTick,
+                                                    uint32_t ulNow,
+                                                    uint32_t ulExpectedIdleTime,
+                                                    uint32_t ulTickCount )
+{
+    uint32_t ulCompleteTicks;
+
+    if( ( int32_t ) ( ulNow - ulNextTick ) < 0 )
+    {
+        ulCompleteTicks = 0;
+    }
+    else
+    {
+        ulCompleteTicks = ( ( ulNow - ulNextTick ) / ulTickCount ) + 1;
+    }
+
+    if( ulCompleteTicks > ( ulExpectedIdleTime - 1 ) )
+    {
+        /* The sleep compare is about to match, leave it to the tick interrupt */
+        ulCompleteTicks = ulExpectedIdleTime - 1;
+    }
+
+    return ulCompleteTicks;
+}
+
+#endif /* PORTTICKLESS_H */
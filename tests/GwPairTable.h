@@ -0,0 +1,51 @@
+/**********************************************************************************************************************
+ * \file GwPairTable.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/* Pair table of Test_GwFilter (GW_PAIR_TABLE_FILE, built with NUM_GW_PAIRS 8): the configured pairs, then five pairs
+ * on CAN1 node 2 with every filter type. Pairs 3..6 fill the 32 standard filter elements of the node exactly, the last
+ * four entries of pair 7 overflow to the software second stage.
+ */
+const MulticanGwPairConfig gwPairs[NUM_GW_PAIRS] = {
+    {0, GW_NODE(1), 2, {GW_FILTER_ID(0x100), GW_FILTER_ID(0x101)}},
+    {2, GW_NODE(3), 2, {GW_FILTER_RANGE(0x200, 0x20F), GW_FILTER_DUAL(0x280, 0x290)}},
+    {4, GW_NODE(5) | GW_NODE(6) | GW_NODE(7), 2, {GW_FILTER_ID(0x300), GW_FILTER_EXT_MASK(0x18FF0000, 0x1FFF0000)}},
+    /* CAN1.N2 -> CAN1.N3, std elements 0..3 and ext elements 0..3; also the catch-all pair of the node */
+    {6, GW_NODE(7), 8, {GW_FILTER_ID(0x400), GW_FILTER_RANGE(0x410, 0x41F), GW_FILTER_MASK(0x420, 0x7F8),
+                        GW_FILTER_DUAL(0x431, 0x433), GW_FILTER_EXT_ID(0x1000400), GW_FILTER_EXT_RANGE(0x1000410, 0x100041F),
+                        GW_FILTER_EXT_MASK(0x1000420, 0x1FFFFFF8), GW_FILTER_EXT_DUAL(0x1000431, 0x1000433)}},
+    /* CAN1.N2 -> CAN1.N3, std elements 4..27 */
+    {6, GW_NODE(7), 8, {GW_FILTER_ID(0x500), GW_FILTER_ID(0x501), GW_FILTER_ID(0x502), GW_FILTER_ID(0x503),
+                        GW_FILTER_ID(0x504), GW_FILTER_ID(0x505), GW_FILTER_ID(0x506), GW_FILTER_ID(0x507)}},
+    {6, GW_NODE(7), 8, {GW_FILTER_ID(0x508), GW_FILTER_ID(0x509), GW_FILTER_ID(0x50A), GW_FILTER_ID(0x50B),
+                        GW_FILTER_ID(0x50C), GW_FILTER_ID(0x50D), GW_FILTER_ID(0x50E), GW_FILTER_ID(0x50F)}},
+    {6, GW_NODE(7), 8, {GW_FILTER_ID(0x510), GW_FILTER_ID(0x511), GW_FILTER_ID(0x512), GW_FILTER_ID(0x513),
+                        GW_FILTER_ID(0x514), GW_FILTER_ID(0x515), GW_FILTER_ID(0x516), GW_FILTER_ID(0x517)}},
+    /* CAN1.N2 -> CAN0.N3, std elements 28..31, then four second stage filters */
+    {6, GW_NODE(3), 8, {GW_FILTER_ID(0x600), GW_FILTER_ID(0x601), GW_FILTER_ID(0x602), GW_FILTER_ID(0x603),
+                        GW_FILTER_RANGE(0x610, 0x61F), GW_FILTER_MASK(0x620, 0x7F8), GW_FILTER_DUAL(0x631, 0x633),
+                        GW_FILTER_ID(0x640)}}
+};
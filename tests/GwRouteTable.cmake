@@ -0,0 +1,59 @@
+# Generates a routing table file for MULTICAN_GW_ROUTE.c (GW_ROUTE_TABLE_FILE): stdPerNode standard and extPerNode
+# extended routes on every gateway node, pseudo random IDs (fixed seed, the same table on every run).
+#   - standard IDs: (k * 643 + node * 97 + 5) mod 2048, distinct per node as 643 is odd
+#   - extended IDs: ascending per node (k * 0x7F3F1 plus a jitter below 0x100), so the list is in key order
+#   - destinations: one or two other nodes; every third route rewrites the ID, every fifth applies g_gwXfTestDlc
+function(gw_generate_route_table file stdPerNode extPerNode)
+    set(seed 12345)
+    set(text "/* Generated by tests/GwRouteTable.cmake: ${stdPerNode} standard and ${extPerNode} extended routes per node */\n")
+    string(APPEND text "static const gwTransformOpType g_gwXfTestDlc[] = {GW_XF_DLC(15), GW_XF_END()};\n\n")
+
+    foreach(kind STD EXT)
+        if(kind STREQUAL STD)
+            set(count ${stdPerNode})
+        else()
+            set(count ${extPerNode})
+        endif()
+
+        math(EXPR last "${count} - 1")
+        string(APPEND text "#define GW_${kind}_ROUTE_TABLE(GW_${kind}_ROUTE) \\\n")
+        set(route 0)
+
+        foreach(node RANGE 7)
+            foreach(k RANGE ${last})
+                math(EXPR seed "(${seed} * 1103515245 + 12345) % 2147483648")
+
+                if(kind STREQUAL STD)
+                    math(EXPR id "(${k} * 643 + ${node} * 97 + 5) % 2048" OUTPUT_FORMAT HEXADECIMAL)
+                    math(EXPR newId "((${seed} >> 8) % 2048)" OUTPUT_FORMAT HEXADECIMAL)
+                else()
+                    math(EXPR id "0x100000 + ${k} * 0x7F3F1 + ((${seed} >> 8) % 0x100)" OUTPUT_FORMAT HEXADECIMAL)
+                    math(EXPR newId "((${seed} >> 4) % 0x20000000)" OUTPUT_FORMAT HEXADECIMAL)
+                endif()
+
+                math(EXPR dst1 "(${node} + 1 + (${seed} >> 16) % 7) % 8")
+                math(EXPR dst2 "(${node} + 1 + (${seed} >> 20) % 7) % 8")
+                math(EXPR isRewrite "${route} % 3")
+                math(EXPR isTransform "${route} % 5")
+
+                if(NOT isRewrite EQUAL 0)
+                    set(newId "GW_ID_UNCHANGED")
+                endif()
+
+                if(isTransform EQUAL 0)
+                    set(xf "g_gwXfTestDlc")
+                else()
+                    set(xf "NULL_PTR")
+                endif()
+
+                string(APPEND text "    GW_${kind}_ROUTE(${node}, ${id}, GW_NODE(${dst1}) | GW_NODE(${dst2}), ${newId}, NULL_PTR, ${xf}) \\\n")
+                math(EXPR route "${route} + 1")
+            endforeach()
+        endforeach()
+
+        string(APPEND text "\n")
+    endforeach()
+
+    file(WRITE ${file}.tmp "${text}")
+    configure_file(${file}.tmp ${file} COPYONLY)
+endfunction()
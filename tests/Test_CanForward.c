@@ -0,0 +1,237 @@
+/**********************************************************************************************************************
+ * \file Test_CanForward.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "Can/Can/IfxCan_Can.h"
+#include "HostCan.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_FRAMES                 100000              /* Frames per forwarding path                                 */
+#define TEST_BURST                  8                   /* Frames in the Rx FIFO per forwarding pass                  */
+#define TEST_FIFO_SIZE              16                  /* Rx FIFO 0 of the source, Tx FIFO of the destination        */
+#define TEST_NODE_RAM               0x1000              /* Message RAM per node                                       */
+#define TEST_RX_FIFO0_OFFSET        0x0000
+#define TEST_TX_BUFFERS_OFFSET      0x0800
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* A forwarding path: moves the frames waiting in Rx FIFO 0 of src into the Tx FIFO of dst */
+typedef void (*TestForwardPath)(IfxCan_Can_Node *src, IfxCan_Can_Node *dst);
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static IfxCan_Can      g_testCan;
+static IfxCan_Can_Node g_testSrc;
+static IfxCan_Can_Node g_testDst;
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* CAN0 node 0 receives CAN FD frames of up to 64 bytes into Rx FIFO 0, CAN0 node 1 sends them from its Tx FIFO */
+static void testInit(void)
+{
+    IfxCan_Can_Config     canConfig;
+    IfxCan_Can_NodeConfig nodeConfig;
+
+    hostCanReset();
+    IfxCan_Can_initModuleConfig(&canConfig, &MODULE_CAN0);
+    IfxCan_Can_initModule(&g_testCan, &canConfig);
+
+    IfxCan_Can_initNodeConfig(&nodeConfig, &g_testCan);
+    nodeConfig.nodeId                               = IfxCan_NodeId_0;
+    nodeConfig.frame.type                           = IfxCan_FrameType_receive;
+    nodeConfig.frame.mode                           = IfxCan_FrameMode_fdLongAndFast;
+    nodeConfig.filterConfig.standardListSize        = 0;
+    nodeConfig.rxConfig.rxMode                      = IfxCan_RxMode_fifo0;
+    nodeConfig.rxConfig.rxFifo0DataFieldSize        = IfxCan_DataFieldSize_64;
+    nodeConfig.rxConfig.rxFifo0Size                 = TEST_FIFO_SIZE;
+    nodeConfig.messageRAM.rxFifo0StartAddress       = TEST_RX_FIFO0_OFFSET;
+    nodeConfig.messageRAM.txBuffersStartAddress     = TEST_TX_BUFFERS_OFFSET;
+    IfxCan_Can_initNode(&g_testSrc, &nodeConfig);
+
+    IfxCan_Can_initNodeConfig(&nodeConfig, &g_testCan);
+    nodeConfig.nodeId                               = IfxCan_NodeId_1;
+    nodeConfig.frame.type                           = IfxCan_FrameType_transmit;
+    nodeConfig.frame.mode                           = IfxCan_FrameMode_fdLongAndFast;
+    nodeConfig.txConfig.txMode                      = IfxCan_TxMode_fifo;
+    nodeConfig.txConfig.dedicatedTxBuffersNumber    = 0;
+    nodeConfig.txConfig.txFifoQueueSize             = TEST_FIFO_SIZE;
+    nodeConfig.txConfig.txBufferDataFieldSize       = IfxCan_DataFieldSize_64;
+    nodeConfig.messageRAM.rxFifo0StartAddress       = TEST_NODE_RAM + TEST_RX_FIFO0_OFFSET;
+    nodeConfig.messageRAM.txBuffersStartAddress     = TEST_NODE_RAM + TEST_TX_BUFFERS_OFFSET;
+    IfxCan_Can_initNode(&g_testDst, &nodeConfig);
+
+    hostCanStart();
+}
+
+/* Frame seq of a run: standard or extended ID, 64 byte CAN FD payload derived from seq */
+static void testFrame(HostCanFrame *frame, uint32 seq)
+{
+    uint32 i;
+
+    memset(frame, 0, sizeof(*frame));
+    frame->extended      = ((seq % 3) == 0) ? TRUE : FALSE;
+    frame->id            = frame->extended ? (0x18DA0000U | (seq & 0xFFFFU)) : (0x100U + (seq % 0x600U));
+    frame->fd            = TRUE;
+    frame->bitRateSwitch = TRUE;
+    frame->dlc           = IfxCan_DataLengthCode_64;
+
+    for (i = 0; i < 64; i++)
+    {
+        frame->data[i] = (uint8)((seq * 7U) + i);
+    }
+}
+
+/* readMessage() + sendMessage(): the element is unpacked into an IfxCan_Message and a data array, then packed again */
+static void testPathUnpackRepack(IfxCan_Can_Node *src, IfxCan_Can_Node *dst)
+{
+    IfxCan_Message message;
+    uint32         data[IFXCAN_CAN_MESSAGE_DATA_WORDS];
+
+    while (IfxCan_Node_getRxFifo0FillLevel(src->node) > 0)
+    {
+        IfxCan_Can_initMessage(&message);
+        message.readFromRxFifo0 = TRUE;
+        IfxCan_Can_readMessage(src, &message, data);
+
+        message.readFromRxFifo0    = FALSE;
+        message.storeInTxFifoQueue = TRUE;
+        (void)IfxCan_Can_sendMessage(dst, &message, data);
+    }
+}
+
+/* forwardMessage(): raw element copy per frame, the Rx element acknowledged one by one */
+static void testPathRaw(IfxCan_Can_Node *src, IfxCan_Can_Node *dst)
+{
+    while (IfxCan_Node_getRxFifo0FillLevel(src->node) > 0)
+    {
+        IfxCan_RxBufferId index   = IfxCan_Node_getRxFifo0GetIndex(src->node);
+        Ifx_CAN_RXMSG    *element = IfxCan_Node_getRxFifo0ElementAddress(src->node, src->messageRAM.baseAddress,
+                                                                         src->messageRAM.rxFifo0StartAddress, index);
+
+        (void)IfxCan_Can_forwardMessage(dst, element, IFXCAN_CAN_MESSAGE_ID_UNCHANGED);
+        IfxCan_Node_setRxFifo0AcknowledgeIndex(src->node, index);
+    }
+}
+
+/* forwardMessages(): raw copy of the whole batch, one TXBAR write and one acknowledge of the last element */
+static void testPathRawBatch(IfxCan_Can_Node *src, IfxCan_Can_Node *dst)
+{
+    Ifx_CAN_RXMSG    *elements[TEST_FIFO_SIZE];
+    uint8             fill  = IfxCan_Node_getRxFifo0FillLevel(src->node);
+    IfxCan_RxBufferId first = IfxCan_Node_getRxFifo0GetIndex(src->node);
+    uint8             count;
+    uint8             k;
+
+    for (k = 0; k < fill; k++)
+    {
+        elements[k] = IfxCan_Node_getRxFifo0ElementAddress(src->node, src->messageRAM.baseAddress, src->messageRAM.rxFifo0StartAddress,
+                                                           (IfxCan_RxBufferId)((first + k) % TEST_FIFO_SIZE));
+    }
+
+    count = IfxCan_Can_forwardMessages(dst, elements, NULL_PTR, fill);
+
+    if (count > 0)
+    {
+        IfxCan_Node_setRxFifo0AcknowledgeIndex(src->node, (IfxCan_RxBufferId)((first + count - 1) % TEST_FIFO_SIZE));
+    }
+}
+
+/* Run TEST_FRAMES frames through a path, bursts of TEST_BURST frames, and check every frame sent by the destination
+ * against the received one. Returns the nanoseconds spent in the path per frame (model time excluded).
+ */
+static double testRunPath(TestForwardPath path)
+{
+    HostCanFrame sent[TEST_BURST];
+    HostCanFrame frame;
+    uint64_t     pathTime = 0;
+    uint64_t     start;
+    uint32       forwarded = 0;
+    uint32       seq;
+    uint32       k;
+
+    testInit();
+
+    for (seq = 0; seq < TEST_FRAMES; seq += TEST_BURST)
+    {
+        for (k = 0; k < TEST_BURST; k++)
+        {
+            testFrame(&sent[k], seq + k);
+            HOST_CHECK(hostCanReceive(g_testSrc.node, &sent[k]) != FALSE);
+        }
+
+        start     = hostTestNanoseconds();
+        path(&g_testSrc, &g_testDst);
+        pathTime += hostTestNanoseconds() - start;
+
+        HOST_CHECK_EQ(IfxCan_Node_getRxFifo0FillLevel(g_testSrc.node), 0);
+
+        for (k = 0; hostCanTransmit(g_testDst.node, &frame) != FALSE; k++)
+        {
+            HOST_CHECK(k < TEST_BURST);
+            if (k < TEST_BURST)
+            {
+                HOST_CHECK_EQ(frame.id, sent[k].id);
+                HOST_CHECK_EQ(frame.extended, sent[k].extended);
+                HOST_CHECK_EQ(frame.fd, TRUE);
+                HOST_CHECK_EQ(frame.bitRateSwitch, TRUE);
+                HOST_CHECK_EQ(frame.dlc, sent[k].dlc);
+                HOST_CHECK(memcmp(frame.data, sent[k].data, 64) == 0);
+            }
+        }
+
+        forwarded += k;
+    }
+
+    HOST_CHECK_EQ(forwarded, TEST_FRAMES);
+
+    return (double)pathTime / (double)TEST_FRAMES;
+}
+
+/* The raw paths must deliver what the unpack/repack path delivers; the printed figures compare their cost per 64 byte
+ * CAN FD frame on the host (relative figures, not TC375 cycles).
+ */
+int main(void)
+{
+    double unpackRepack = testRunPath(testPathUnpackRepack);
+    double raw          = testRunPath(testPathRaw);
+    double rawBatch     = testRunPath(testPathRawBatch);
+
+    printf("Test_CanForward: readMessage+sendMessage %.1f ns/frame, forwardMessage %.1f ns/frame (%.2fx), "
+           "forwardMessages %.1f ns/frame (%.2fx)\n", unpackRepack, raw, unpackRepack / raw, rawBatch, unpackRepack / rawBatch);
+
+    return hostTestResult("Test_CanForward");
+}
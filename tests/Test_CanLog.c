@@ -0,0 +1,356 @@
+/**********************************************************************************************************************
+ * \file Test_CanLog.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "App_CanLog.h"
+#include "CanLogReader.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_FRAMES                 2000
+#define TEST_LOG_SIZE               (TEST_FRAMES * 64)  /* Records, headers and the injected garbage                  */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* A frame as the gateway received it, and what the log must show of it */
+typedef struct
+{
+    uint8  node;
+    uint32 timestamp;
+    uint32 r0;
+    uint32 dlc;
+    uint32 fdf;
+    uint32 brs;
+    uint8  payload[64];
+} TestFrame;
+
+/* A batch the log must contain */
+typedef struct
+{
+    uint32 first;                                       /* Index of its first frame                                   */
+    uint32 count;
+    uint32 sequence;
+    uint32 dropped;
+} TestBatch;
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static TestFrame g_testFrame[TEST_FRAMES];
+static TestBatch g_testBatch[TEST_FRAMES];
+static uint32    g_testBatchCount;
+static uint8     g_testLog[TEST_LOG_SIZE];
+static uint32    g_testLogSize;
+static uint32    g_testGarbage;                        /* Bytes of the log outside any complete batch                */
+static uint32    g_testRandom = 0x2545F491U;
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* xorshift32, a fixed sequence so that a failure reproduces */
+static uint32 testRandom(void)
+{
+    g_testRandom ^= g_testRandom << 13;
+    g_testRandom ^= g_testRandom >> 17;
+    g_testRandom ^= g_testRandom << 5;
+
+    return g_testRandom;
+}
+
+static void testAppend(const void *bytes, uint32 size)
+{
+    HOST_CHECK((g_testLogSize + size) <= TEST_LOG_SIZE);
+
+    if ((g_testLogSize + size) <= TEST_LOG_SIZE)
+    {
+        memcpy(&g_testLog[g_testLogSize], bytes, size);
+        g_testLogSize += size;
+    }
+}
+
+static void testAppendGarbage(uint32 size)
+{
+    uint32 i;
+
+    for (i = 0; i < size; i++)
+    {
+        uint8 byte = (uint8)testRandom();
+
+        testAppend(&byte, 1);
+    }
+
+    g_testGarbage += size;
+}
+
+/* Random frames of every kind: classic and FD, standard and extended, remote frames, all DLCs and nodes */
+static void testMakeFrames(void)
+{
+    uint32 f;
+    uint32 i;
+
+    for (f = 0; f < TEST_FRAMES; f++)
+    {
+        TestFrame *frame = &g_testFrame[f];
+        uint32     xtd   = testRandom() & 1;
+
+        frame->node      = (uint8)(testRandom() % 8);
+        frame->timestamp = testRandom();
+        frame->fdf       = ((testRandom() % 3) == 0) ? 1 : 0;
+        frame->brs       = (frame->fdf != 0) ? (testRandom() & 1) : 0;
+        frame->dlc       = testRandom() % 16;
+        frame->r0        = (xtd != 0) ? ((testRandom() & 0x1FFFFFFFU) | 0x40000000U) : ((testRandom() & 0x7FFU) << 18);
+
+        if ((frame->fdf == 0) && ((testRandom() % 8) == 0))
+        {
+            frame->r0 |= 0x20000000U;                   /* RTR */
+        }
+
+        for (i = 0; i < sizeof(frame->payload); i++)
+        {
+            frame->payload[i] = (uint8)testRandom();
+        }
+    }
+}
+
+/* Payload bytes the record of a frame carries */
+static uint32 testExpectedLength(const TestFrame *frame)
+{
+    static const uint32 fdLength[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+    uint32              length;
+
+    if (frame->fdf != 0)
+    {
+        length = fdLength[frame->dlc];
+    }
+    else
+    {
+        length = ((frame->r0 & 0x20000000U) != 0) ? 0 : ((frame->dlc > 8) ? 8 : frame->dlc);
+    }
+
+    return (length > APP_CANLOG_DATA_SIZE) ? APP_CANLOG_DATA_SIZE : length;
+}
+
+/* The byte stream of the target: batches encoded by App_CanLog.h, with lost bytes, a lost batch, a fake header and
+ * a log which starts in the middle of a batch and ends in the middle of one
+ */
+static void testMakeLog(void)
+{
+    struct
+    {
+        AppCanLogBatchHeader header;
+        AppCanLogRecord      record[APP_CANLOG_BATCH_RECORDS];
+    } batch;
+    static Ifx_CAN_RXMSG element;
+    AppCanLogBatchHeader fake;
+    uint32               sequence = 100;
+    uint32               dropped  = 0;
+    uint32               f        = 0;
+
+    /* tail of a batch the log missed the start of */
+    testAppendGarbage(3 * sizeof(AppCanLogRecord) + 5);
+
+    while (f < TEST_FRAMES)
+    {
+        uint32 count = 1 + (testRandom() % APP_CANLOG_BATCH_RECORDS);
+        uint32 size;
+        uint32 r;
+
+        if (count > (TEST_FRAMES - f))
+        {
+            count = TEST_FRAMES - f;
+        }
+
+        for (r = 0; r < count; r++)
+        {
+            const TestFrame *frame = &g_testFrame[f + r];
+
+            memset((void *)&element, 0, sizeof(element));
+            element.R0.U = frame->r0;
+            element.R1.B.DLC = frame->dlc;
+            element.R1.B.FDF = frame->fdf;
+            element.R1.B.BRS = frame->brs;
+            memcpy((uint8 *)&element + 8, frame->payload, sizeof(frame->payload));
+
+            memset(&batch.record[r], 0xEE, sizeof(batch.record[r]));      /* undefined rest of the data */
+            appCanLogEncodeRecord(&batch.record[r], frame->node, &element, frame->timestamp);
+        }
+
+        appCanLogEncodeHeader(&batch.header, count, sequence, dropped);
+        size = sizeof(batch.header) + (count * sizeof(AppCanLogRecord));
+
+        if ((f + count) == TEST_FRAMES)
+        {
+            /* the last batch is cut off by the end of the log */
+            testAppend(&batch, size - 7);
+            g_testGarbage += size - 7;
+            break;
+        }
+
+        testAppend(&batch, size);
+
+        g_testBatch[g_testBatchCount].first    = f;
+        g_testBatch[g_testBatchCount].count    = count;
+        g_testBatch[g_testBatchCount].sequence = sequence;
+        g_testBatch[g_testBatchCount].dropped  = dropped;
+        g_testBatchCount++;
+
+        f        += count;
+        sequence += ((testRandom() % 20) == 0) ? 2 : 1; /* now and then a batch lost on the link */
+        dropped  += testRandom() % 3;
+
+        switch (testRandom() % 10)
+        {
+        case 0:
+            testAppendGarbage(1 + (testRandom() % 40));  /* lost or corrupted bytes */
+            break;
+        case 1:
+            appCanLogEncodeHeader(&fake, 3, 0, 0);      /* magic with an info word of another format */
+            fake.info = (fake.info & ~0xFFU) | (APP_CANLOG_VERSION + 1);
+            testAppend(&fake, sizeof(fake));
+            g_testGarbage += sizeof(fake);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/* Every complete batch, record and byte comes back as encoded, the rest is skipped */
+static void testCheckReader(const CanLogReader *reader)
+{
+    uint32 b;
+
+    HOST_CHECK_EQ(reader->batchCount, g_testBatchCount);
+    HOST_CHECK_EQ(reader->skippedBytes, g_testGarbage);
+
+    for (b = 0; (b < reader->batchCount) && (b < g_testBatchCount); b++)
+    {
+        const CanLogBatch *batch    = &reader->batch[b];
+        const TestBatch   *expected = &g_testBatch[b];
+        uint32             r;
+
+        HOST_CHECK_EQ(batch->count, expected->count);
+        HOST_CHECK_EQ(batch->sequence, expected->sequence);
+        HOST_CHECK_EQ(batch->dropped, expected->dropped);
+
+        for (r = 0; (r < batch->count) && (r < expected->count); r++)
+        {
+            const TestFrame *frame  = &g_testFrame[expected->first + r];
+            uint32           length = testExpectedLength(frame);
+            uint32           flags  = 0;
+            CanLogRecord     record;
+
+            canLogGetRecord(reader, batch, r, &record);
+
+            flags |= (frame->fdf != 0) ? CANLOG_FLAG_FD : 0;
+            flags |= (frame->brs != 0) ? CANLOG_FLAG_BRS : 0;
+            flags |= ((frame->fdf != 0) && (frame->dlc > 11)) ? CANLOG_FLAG_TRUNCATED : 0;
+
+            HOST_CHECK_EQ(record.timestamp, frame->timestamp);
+            HOST_CHECK_EQ(record.id, frame->r0);
+            HOST_CHECK_EQ(record.node, frame->node);
+            HOST_CHECK_EQ(record.dlc, frame->dlc);
+            HOST_CHECK_EQ(record.flags, flags);
+            HOST_CHECK_EQ(record.length, length);
+            HOST_CHECK(memcmp(record.data, frame->payload, length) == 0);
+            HOST_CHECK_EQ(canLogCanId(record.id),
+                          ((frame->r0 & 0x40000000U) != 0) ? (frame->r0 & 0x1FFFFFFFU) : ((frame->r0 >> 18) & 0x7FFU));
+        }
+    }
+}
+
+/* The log as a file, through the mapping of canLogOpen() */
+static void testFileRoundTrip(void)
+{
+    char         path[] = "/tmp/Test_CanLogXXXXXX";
+    int          fd     = mkstemp(path);
+    CanLogReader reader;
+
+    HOST_CHECK(fd >= 0);
+
+    if (fd < 0)
+    {
+        return;
+    }
+
+    HOST_CHECK(write(fd, g_testLog, g_testLogSize) == (ssize_t)g_testLogSize);
+    close(fd);
+
+    HOST_CHECK(canLogOpen(&reader, path) == 0);
+    HOST_CHECK_EQ(reader.size, g_testLogSize);
+    testCheckReader(&reader);
+    canLogClose(&reader);
+
+    unlink(path);
+
+    HOST_CHECK(canLogOpen(&reader, path) != 0);
+}
+
+/* Empty logs and logs without a complete batch */
+static void testDegenerateLogs(void)
+{
+    CanLogReader         reader;
+    AppCanLogBatchHeader header;
+
+    HOST_CHECK(canLogIndex(&reader, g_testLog, 0) == 0);
+    HOST_CHECK_EQ(reader.batchCount, 0);
+    HOST_CHECK_EQ(reader.skippedBytes, 0);
+    canLogClose(&reader);
+
+    /* a header announcing records which are not there */
+    appCanLogEncodeHeader(&header, 1, 0, 0);
+    HOST_CHECK(canLogIndex(&reader, (const uint8_t *)&header, sizeof(header)) == 0);
+    HOST_CHECK_EQ(reader.batchCount, 0);
+    HOST_CHECK_EQ(reader.skippedBytes, sizeof(header));
+    canLogClose(&reader);
+}
+
+int main(void)
+{
+    CanLogReader reader;
+
+    testMakeFrames();
+    testMakeLog();
+
+    HOST_CHECK(canLogIndex(&reader, g_testLog, g_testLogSize) == 0);
+    testCheckReader(&reader);
+    canLogClose(&reader);
+
+    testFileRoundTrip();
+    testDegenerateLogs();
+
+    return hostTestResult("Test_CanLog");
+}
@@ -0,0 +1,267 @@
+/**********************************************************************************************************************
+ * \file Test_CanReadMessages.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <string.h>
+#include "Can/Can/IfxCan_Can.h"
+#include "HostCan.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_FIFO_SIZE              8                   /* Rx FIFO 0 of node 0, Rx FIFO 1 of node 1                   */
+#define TEST_MAX_MESSAGES           TEST_FIFO_SIZE
+#define TEST_NODE_RAM               0x0800              /* Message RAM per node                                       */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static IfxCan_Can      g_testCan;
+static IfxCan_Can_Node g_testNode[2];                   /* Node 0: Rx FIFO 0, node 1: Rx FIFO 1                       */
+static uint32          g_testNextSeq;                   /* Sequence of the next frame stored                          */
+static uint32          g_testReadSeq;                   /* Sequence of the next frame expected by the reader          */
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static void testInit(void)
+{
+    IfxCan_Can_Config     canConfig;
+    IfxCan_Can_NodeConfig nodeConfig;
+    uint8                 n;
+
+    hostCanReset();
+    IfxCan_Can_initModuleConfig(&canConfig, &MODULE_CAN0);
+    IfxCan_Can_initModule(&g_testCan, &canConfig);
+
+    for (n = 0; n < 2; n++)
+    {
+        IfxCan_Can_initNodeConfig(&nodeConfig, &g_testCan);
+        nodeConfig.nodeId                           = (IfxCan_NodeId)n;
+        nodeConfig.frame.type                       = IfxCan_FrameType_receive;
+        nodeConfig.frame.mode                       = IfxCan_FrameMode_fdLongAndFast;
+        nodeConfig.filterConfig.standardListSize    = 0;
+        nodeConfig.rxConfig.rxMode                  = (n == 0) ? IfxCan_RxMode_fifo0 : IfxCan_RxMode_fifo1;
+        nodeConfig.rxConfig.rxFifo0DataFieldSize    = IfxCan_DataFieldSize_64;
+        nodeConfig.rxConfig.rxFifo1DataFieldSize    = IfxCan_DataFieldSize_64;
+        nodeConfig.rxConfig.rxFifo0Size             = TEST_FIFO_SIZE;
+        nodeConfig.rxConfig.rxFifo1Size             = TEST_FIFO_SIZE;
+        nodeConfig.messageRAM.rxFifo0StartAddress   = (uint16)(n * TEST_NODE_RAM);
+        nodeConfig.messageRAM.rxFifo1StartAddress   = (uint16)(n * TEST_NODE_RAM);
+        nodeConfig.messageRAM.txBuffersStartAddress = (uint16)((n * TEST_NODE_RAM) + 0x400);
+        IfxCan_Can_initNode(&g_testNode[n], &nodeConfig);
+    }
+
+    hostCanStart();
+    g_testNextSeq = 0;
+    g_testReadSeq = 0;
+}
+
+/* Store count frames into the Rx FIFO; the ID and the payload carry the sequence number, the length varies */
+static void testStore(IfxCan_RxFifo rxFifo, uint32 count)
+{
+    IfxCan_Can_Node *node = &g_testNode[rxFifo == IfxCan_RxFifo_0 ? 0 : 1];
+    HostCanFrame     frame;
+    uint32           i;
+
+    for (i = 0; i < count; i++)
+    {
+        uint32 seq = g_testNextSeq++;
+
+        memset(&frame, 0, sizeof(frame));
+        frame.extended = ((seq & 1) != 0) ? TRUE : FALSE;
+        frame.id       = frame.extended ? (0x10000000U + seq) : (seq & 0x7FFU);
+        frame.fd       = TRUE;
+        frame.dlc      = (uint8)(IfxCan_DataLengthCode_8 + (seq % 8));
+        memcpy(frame.data, &seq, sizeof(seq));
+        frame.data[63] = (uint8)seq;
+        HOST_CHECK(hostCanStore(node->node, rxFifo, &frame, 0) != FALSE);
+    }
+}
+
+static uint8 testFillLevel(IfxCan_RxFifo rxFifo)
+{
+    return (rxFifo == IfxCan_RxFifo_0) ? IfxCan_Node_getRxFifo0FillLevel(g_testNode[0].node)
+                                       : IfxCan_Node_getRxFifo1FillLevel(g_testNode[1].node);
+}
+
+static uint8 testGetIndex(IfxCan_RxFifo rxFifo)
+{
+    return (rxFifo == IfxCan_RxFifo_0) ? IfxCan_Node_getRxFifo0GetIndex(g_testNode[0].node)
+                                       : IfxCan_Node_getRxFifo1GetIndex(g_testNode[1].node);
+}
+
+/* Read up to maxMessages frames with one call and check them against the sequence: the frames come in order, with the
+ * buffer numbers of the elements read, and a non-empty batch is released by exactly one acknowledge, the last buffer
+ * number read. Returns the frames read.
+ */
+static uint8 testRead(IfxCan_RxFifo rxFifo, uint8 maxMessages)
+{
+    IfxCan_Can_Node *node = &g_testNode[rxFifo == IfxCan_RxFifo_0 ? 0 : 1];
+    IfxCan_Message   messages[TEST_MAX_MESSAGES];
+    uint32           data[TEST_MAX_MESSAGES][IFXCAN_CAN_MESSAGE_DATA_WORDS];
+    uint8            fill     = testFillLevel(rxFifo);
+    uint8            getIndex = testGetIndex(rxFifo);
+    uint32           acks     = g_hostCanAcknowledgeWrites;
+    uint8            count;
+    uint8            k;
+
+    count = IfxCan_Can_readMessages(node, rxFifo, messages, data, maxMessages);
+
+    HOST_CHECK_EQ(count, (fill < maxMessages) ? fill : maxMessages);
+    HOST_CHECK_EQ(testFillLevel(rxFifo), fill - count);
+    HOST_CHECK_EQ(testGetIndex(rxFifo), (getIndex + count) % TEST_FIFO_SIZE);
+    HOST_CHECK_EQ(g_hostCanAcknowledgeWrites - acks, (count > 0) ? 1 : 0);
+
+    if (count > 0)
+    {
+        volatile Ifx_UReg_32Bit *ack = (rxFifo == IfxCan_RxFifo_0) ? &node->node->RX.F0A.U : &node->node->RX.F1A.U;
+        HOST_CHECK_EQ(*ack, (getIndex + count - 1) % TEST_FIFO_SIZE);
+    }
+
+    for (k = 0; k < count; k++)
+    {
+        uint32   seq = g_testReadSeq++;
+        uint32   got;
+        boolean  extended = ((seq & 1) != 0) ? TRUE : FALSE;
+        uint8   *bytes    = (uint8 *)data[k];
+
+        memcpy(&got, bytes, sizeof(got));
+        HOST_CHECK_EQ(got, seq);
+        HOST_CHECK_EQ(messages[k].messageId, extended ? (0x10000000U + seq) : (seq & 0x7FFU));
+        HOST_CHECK_EQ(messages[k].messageIdLength, extended ? IfxCan_MessageIdLength_extended : IfxCan_MessageIdLength_standard);
+        HOST_CHECK_EQ(messages[k].dataLengthCode, IfxCan_DataLengthCode_8 + (seq % 8));
+        HOST_CHECK_EQ(messages[k].bufferNumber, (getIndex + k) % TEST_FIFO_SIZE);
+        HOST_CHECK_EQ(messages[k].readFromRxFifo0, (rxFifo == IfxCan_RxFifo_0) ? TRUE : FALSE);
+        HOST_CHECK_EQ(messages[k].readFromRxFifo1, (rxFifo == IfxCan_RxFifo_1) ? TRUE : FALSE);
+
+        if (messages[k].dataLengthCode == IfxCan_DataLengthCode_64)
+        {
+            HOST_CHECK_EQ(bytes[63], (uint8)seq);
+        }
+    }
+
+    return count;
+}
+
+/* Empty FIFO: nothing read, no acknowledge written */
+static void testEmpty(IfxCan_RxFifo rxFifo)
+{
+    testInit();
+    HOST_CHECK_EQ(testRead(rxFifo, TEST_MAX_MESSAGES), 0);
+    HOST_CHECK_EQ(g_hostCanAcknowledgeWrites, 0);
+}
+
+/* Batches of every size from every get index: the get index wraps many times and every batch that crosses the end of
+ * the FIFO reads buffers size-1 and 0 in one call
+ */
+static void testGetIndexWrap(IfxCan_RxFifo rxFifo)
+{
+    uint8 start;
+    uint8 batch;
+
+    testInit();
+
+    for (start = 0; start < TEST_FIFO_SIZE; start++)
+    {
+        for (batch = 1; batch <= TEST_FIFO_SIZE; batch++)
+        {
+            testStore(rxFifo, batch);
+            HOST_CHECK_EQ(testRead(rxFifo, TEST_MAX_MESSAGES), batch);
+        }
+
+        /* move the start of the next round by one element */
+        testStore(rxFifo, 1);
+        HOST_CHECK_EQ(testRead(rxFifo, 1), 1);
+    }
+
+    HOST_CHECK_EQ(g_testReadSeq, g_testNextSeq);
+}
+
+/* A batch that crosses the end of the FIFO: get index size-3, six frames, buffers size-3..size-1 then 0..2 */
+static void testBatchAcrossEnd(IfxCan_RxFifo rxFifo)
+{
+    testInit();
+
+    testStore(rxFifo, TEST_FIFO_SIZE - 3);
+    HOST_CHECK_EQ(testRead(rxFifo, TEST_MAX_MESSAGES), TEST_FIFO_SIZE - 3);
+    HOST_CHECK_EQ(testGetIndex(rxFifo), TEST_FIFO_SIZE - 3);
+
+    testStore(rxFifo, 6);
+    HOST_CHECK_EQ(testRead(rxFifo, TEST_MAX_MESSAGES), 6);
+    HOST_CHECK_EQ(testGetIndex(rxFifo), 3);
+}
+
+/* A batch that ends on the last element: the single acknowledge writes index size-1 and the get index wraps to 0 */
+static void testAckAtLastIndex(IfxCan_RxFifo rxFifo)
+{
+    testInit();
+
+    testStore(rxFifo, 2);
+    HOST_CHECK_EQ(testRead(rxFifo, TEST_MAX_MESSAGES), 2);
+
+    testStore(rxFifo, TEST_FIFO_SIZE - 2);
+    HOST_CHECK_EQ(testRead(rxFifo, TEST_MAX_MESSAGES), TEST_FIFO_SIZE - 2);
+    HOST_CHECK_EQ(testGetIndex(rxFifo), 0);
+    HOST_CHECK_EQ(g_hostCanAcknowledgeWrites, 2);
+
+    /* full FIFO from index 0: one read of all of it, acknowledge at size-1 */
+    testStore(rxFifo, TEST_FIFO_SIZE);
+    HOST_CHECK_EQ(testRead(rxFifo, TEST_MAX_MESSAGES), TEST_FIFO_SIZE);
+    HOST_CHECK_EQ(testGetIndex(rxFifo), 0);
+}
+
+/* maxMessages below the fill level: the batch stops there, the rest stays in the FIFO for the next call */
+static void testPartialBatch(IfxCan_RxFifo rxFifo)
+{
+    testInit();
+
+    testStore(rxFifo, TEST_FIFO_SIZE - 1);
+    HOST_CHECK_EQ(testRead(rxFifo, 3), 3);
+    HOST_CHECK_EQ(testRead(rxFifo, 3), 3);
+    HOST_CHECK_EQ(testRead(rxFifo, 3), TEST_FIFO_SIZE - 7);
+    HOST_CHECK_EQ(testFillLevel(rxFifo), 0);
+}
+
+int main(void)
+{
+    IfxCan_RxFifo rxFifo;
+
+    for (rxFifo = IfxCan_RxFifo_0; rxFifo <= IfxCan_RxFifo_1; rxFifo++)
+    {
+        testEmpty(rxFifo);
+        testGetIndexWrap(rxFifo);
+        testBatchAcrossEnd(rxFifo);
+        testAckAtLastIndex(rxFifo);
+        testPartialBatch(rxFifo);
+    }
+
+    return hostTestResult("Test_CanReadMessages");
+}
@@ -0,0 +1,299 @@
+/**********************************************************************************************************************
+ * \file Test_CoreLoad.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include "App_Config.h"
+#include "App_IpcRing.h"
+#include "IfxCpu.h"
+#include "task.h"
+#include "queue.h"
+#include "HostKernel.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_TICKS_PER_US           (HOST_STM_FREQUENCY / 1000000U)
+#define TEST_PHASES                 4
+#define TEST_PHASE_MS               2000                /* Length of one load phase                                   */
+#define TEST_MSG_WORK_US            50                  /* Inbox task per message                                     */
+#define TEST_ISR_WORK_US            2                   /* Doorbell ISR per wake-up                                   */
+#define TEST_GAP_MIN_US             200                 /* Gaps between two bursts of the other cores: 200..1800 us   */
+#define TEST_GAP_RANGE_US           1600
+#define TEST_BURST_MAX              3                   /* Messages per burst: 1..3                                   */
+#define TEST_CONTROL_PRIORITY       (configMAX_PRIORITIES - 1)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32   workUs;                                    /* Work of the 1ms task per release                           */
+    uint64   busy;                                      /* Work done by the tasks, STM ticks                          */
+    uint64   busyIsr;                                   /* Work done by the doorbell ISR, STM ticks                   */
+    uint32   idle;                                      /* Idle time from g_ipcNotifyStats, STM ticks                 */
+    uint32   messages;                                  /* Messages received by the inbox task                        */
+    uint32   latencyMax;                                /* Push to inbox task, STM ticks                              */
+    uint64   latencyTotal;
+} TestPhase;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Inbox of the core under test (App_Cpu0_Kernel.c is not part of the host build) */
+appCpuInboxRing g_cpu1Inbox;
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static const uint32 g_testWorkUs[TEST_PHASES] = {0, 100, 300, 600};
+
+static TestPhase        g_testPhase[TEST_PHASES];
+static TestPhase       *g_testCurrent;
+static QueueHandle_t    g_testQueue;
+static volatile boolean g_testStalled;
+static uint32           g_testSent;                     /* Messages pushed by the other cores                         */
+static uint32           g_testReceived;
+static uint32           g_testRingFull;                 /* Pushes retried on a full inbox ring                        */
+static uint32           g_testStalls;                   /* Bridge stopped on a full queue                             */
+static uint32           g_testSeed = 12345;
+
+static StaticQueue_t    g_testQueueBuffer;
+static uint8            g_testQueueStorage[APP_CPU_INBOX_DEPTH * sizeof(AppCpuMsg)];
+static StaticTask_t     g_testTcb[3];
+static StackType_t      g_testStack[3][configMINIMAL_STACK_SIZE];
+
+/* Doorbell ISR of CPU1 (App_IpcRing.c), a plain function on the host */
+void ipcNotifyIsrCpu1(void);
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static uint32 testRandom(uint32 range)
+{
+    g_testSeed = g_testSeed * 1103515245U + 12345U;
+
+    return (g_testSeed >> 16) % range;
+}
+
+/* Work of a task of CPU1, accounted as busy time of the current phase */
+static void testWork(uint32 us)
+{
+    g_testCurrent->busy += (uint64)us * TEST_TICKS_PER_US;
+    hostKernelBusy(us * TEST_TICKS_PER_US);
+}
+
+/* Doorbell handler of CPU1 as in App_Cpu1_Compute.c: bridge the inbox ring into the local queue */
+static void testInboxHandler(void)
+{
+    BaseType_t woken = pdFALSE;
+
+    g_testCurrent->busyIsr += TEST_ISR_WORK_US * TEST_TICKS_PER_US;
+    hostKernelBusy(TEST_ISR_WORK_US * TEST_TICKS_PER_US);
+
+    if (appCpuInboxBridgeFromISR(&g_cpu1Inbox, g_testQueue, &woken))
+    {
+        g_testStalled = TRUE;
+        g_testStalls++;
+    }
+
+    portYIELD_FROM_ISR(woken);
+}
+
+static void testDoorbellIsr(void *arg)
+{
+    (void)arg;
+    ipcNotifyIsrCpu1();
+}
+
+/* CPU0 and CPU2 post a burst of messages to the inbox of CPU1 (id: sequence number, value: STM0 time of the push),
+ * then the next burst after a random gap. A message that finds the ring full is pushed with the next burst.
+ */
+static void testProducer(void *arg)
+{
+    uint32    burst = 1 + testRandom(TEST_BURST_MAX);
+    AppCpuMsg msg;
+
+    (void)arg;
+
+    while (burst > 0)
+    {
+        msg.id    = g_testSent;
+        msg.value = IfxStm_getLower(&MODULE_STM0);
+
+        if (!appCpuInboxPush(&g_cpu1Inbox, &msg))
+        {
+            g_testRingFull++;
+            break;
+        }
+
+        g_testSent++;
+        burst--;
+    }
+
+    hostKernelAlarm((TEST_GAP_MIN_US + testRandom(TEST_GAP_RANGE_US)) * TEST_TICKS_PER_US, testProducer, NULL_PTR);
+}
+
+/* Inbox task of CPU1 as in App_Cpu1_Compute.c, with the work of a message */
+static void testInboxTask(void *arg)
+{
+    AppCpuMsg msg;
+
+    (void)arg;
+
+    while (1)
+    {
+        if (xQueueReceive(g_testQueue, &msg, portMAX_DELAY) == pdTRUE)
+        {
+            uint32 latency = IfxStm_getLower(&MODULE_STM0) - msg.value;
+
+            HOST_CHECK_EQ(msg.id, g_testReceived);
+            g_testReceived++;
+            g_testCurrent->messages++;
+            g_testCurrent->latencyTotal += latency;
+            g_testCurrent->latencyMax    = (latency > g_testCurrent->latencyMax) ? latency
+                                                                                  : g_testCurrent->latencyMax;
+            testWork(TEST_MSG_WORK_US);
+
+            if (g_testStalled)
+            {
+                g_testStalled = FALSE;
+                ipcNotify(1);
+            }
+        }
+    }
+}
+
+/* 1ms task of CPU1, drift free, with the work of the current phase */
+static void test1msTask(void *arg)
+{
+    TickType_t lastWake = xTaskGetTickCount();
+
+    (void)arg;
+
+    while (1)
+    {
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(1));
+
+        if (g_testCurrent->workUs != 0)
+        {
+            testWork(g_testCurrent->workUs);
+        }
+    }
+}
+
+/* Runs the phases one after the other and takes the idle time of each from g_ipcNotifyStats */
+static void testControlTask(void *arg)
+{
+    uint32 i;
+
+    (void)arg;
+
+    for (i = 0; i < TEST_PHASES; i++)
+    {
+        uint32 idleStart = g_ipcNotifyStats[1].idleTicks;
+
+        g_testCurrent         = &g_testPhase[i];
+        g_testCurrent->workUs = g_testWorkUs[i];
+
+        vTaskDelay(pdMS_TO_TICKS(TEST_PHASE_MS));
+
+        g_testPhase[i].idle = g_ipcNotifyStats[1].idleTicks - idleStart;
+    }
+
+    vTaskEndScheduler();
+}
+
+/* CPU1 with its own scheduler instance (configPER_CORE_SCHEDULER) as in App_Cpu1_Compute.c: a 1ms task, the inbox
+ * task fed by the doorbell bridge and the idle hook in ipcNotifyIdle(). The other cores post bursts of messages at
+ * random times. Per phase the 1ms task does more work: the load derived from the idle time of g_ipcNotifyStats must
+ * match the work of the tasks, the doorbell ISR that woke the core counts as idle. It did not before the idle time
+ * ended at the switch to the task the wake-up readied (traceTASK_SWITCHED_OUT): the whole time up to the return of the
+ * idle task counted as idle. Every message arrives in order through the bridge. Printed per phase: load and the
+ * latency from the push to the inbox task, in simulated time (the work is modelled, the kernel itself takes no time).
+ */
+static void testCoreLoad(void)
+{
+    uint32 i;
+
+    g_hostCoreIndex      = 1;
+    g_hostKernelIdleHook = ipcNotifyIdle;
+    g_testCurrent        = &g_testPhase[0];
+
+    g_testQueue = xQueueCreateStatic(APP_CPU_INBOX_DEPTH, sizeof(AppCpuMsg), g_testQueueStorage, &g_testQueueBuffer);
+    (void)xTaskCreateStatic(test1msTask, "CPU1 1MS", configMINIMAL_STACK_SIZE, NULL_PTR, CPU12_1MS_TASK_PRIORITY,
+                            g_testStack[0], &g_testTcb[0]);
+    (void)xTaskCreateStatic(testInboxTask, "CPU1 INBOX", configMINIMAL_STACK_SIZE, NULL_PTR,
+                            CPU12_INBOX_TASK_PRIORITY, g_testStack[1], &g_testTcb[1]);
+    (void)xTaskCreateStatic(testControlTask, "CONTROL", configMINIMAL_STACK_SIZE, NULL_PTR, TEST_CONTROL_PRIORITY,
+                            g_testStack[2], &g_testTcb[2]);
+
+    ipcNotifyInit(testInboxHandler);
+    ipcRingAttach(&g_cpu1Inbox.ctrl);
+    hostKernelAttach(IPC_NOTIFY_SRC(1), testDoorbellIsr, NULL_PTR);
+    hostKernelAlarm(TEST_GAP_MIN_US * TEST_TICKS_PER_US, testProducer, NULL_PTR);
+
+    vTaskStartScheduler();
+
+    printf("Test_CoreLoad: CPU1 instance, messages %u..%u us apart in bursts of 1..%u, %u us work each\n",
+           (unsigned)TEST_GAP_MIN_US, (unsigned)(TEST_GAP_MIN_US + TEST_GAP_RANGE_US), (unsigned)TEST_BURST_MAX,
+           (unsigned)TEST_MSG_WORK_US);
+
+    for (i = 0; i < TEST_PHASES; i++)
+    {
+        const TestPhase *phase   = &g_testPhase[i];
+        double           elapsed = (double)TEST_PHASE_MS * 1000.0 * TEST_TICKS_PER_US;
+        double           load    = 100.0 * (1.0 - ((double)phase->idle / elapsed));
+        double           busy    = 100.0 * (double)phase->busy / elapsed;
+        double           busyIsr = 100.0 * (double)phase->busyIsr / elapsed;
+
+        printf("  1ms task %3u us: load %5.1f %% (tasks %5.1f %%, doorbell ISR %3.1f %%), %4u messages, push to inbox "
+               "task mean %6.1f us max %6.1f us\n", (unsigned)phase->workUs, load, busy, busyIsr,
+               (unsigned)phase->messages, (double)phase->latencyTotal / (double)phase->messages / TEST_TICKS_PER_US,
+               (double)phase->latencyMax / TEST_TICKS_PER_US);
+
+        HOST_CHECK(load > (busy - 0.01));
+        HOST_CHECK(load < (busy + busyIsr + 0.01));
+        HOST_CHECK(phase->messages > 0);
+    }
+
+    printf("  %u messages sent, %u received, %u pushes on a full ring, %u bridge stalls on a full queue\n",
+           (unsigned)g_testSent, (unsigned)g_testReceived, (unsigned)g_testRingFull, (unsigned)g_testStalls);
+
+    /* Whatever is still in flight when the scheduler ends is at most a ring and a queue */
+    HOST_CHECK(g_testSent - g_testReceived <= 2 * APP_CPU_INBOX_DEPTH);
+}
+
+int main(void)
+{
+    testCoreLoad();
+
+    return hostTestResult("Test_CoreLoad");
+}
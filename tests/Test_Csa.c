@@ -0,0 +1,317 @@
+/**********************************************************************************************************************
+ * \file Test_Csa.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_CSAS                   128                 /* CSA memory of the model, id 0 ends a list                  */
+#define TEST_STACK_WORDS            64
+#define TEST_DEEP_CALLS             40
+#define TEST_SYSCALL_FRAMES         2                   /* Handler frames of the yield syscall above the task context */
+
+/* CSA id n is entry n of the model memory */
+#define portCSA_TO_ADDRESS(xCsa)    (((xCsa) != 0) ? g_testCsa[(xCsa)] : NULL)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* A task as the port sees it: pxTopOfStack (the lower context and critical nesting when not running) and
+ * pxEndOfStack (the anchor id)
+ */
+typedef struct
+{
+    uint32_t *top;
+    uint32_t *end;
+    uint32_t  stack[TEST_STACK_WORDS];
+} TestTask;
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static uint32_t g_testCsa[TEST_CSAS][16];
+static uint32_t g_testFcx;                              /* FCX: head of the free list                                  */
+static uint32_t g_testPcxi;                             /* PCXI: head of the call stack of the running code            */
+
+#include "portcsa.h"
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Free list as the startup code links it: 1 -> 2 -> ... -> TEST_CSAS - 1 */
+static void testInitFreeList(void)
+{
+    uint32_t i;
+
+    memset(g_testCsa, 0, sizeof(g_testCsa));
+
+    for (i = 1; i < TEST_CSAS; i++)
+    {
+        g_testCsa[i][0] = (i + 1 < TEST_CSAS) ? (i + 1) : 0;
+    }
+
+    g_testFcx  = 1;
+    g_testPcxi = 0;
+}
+
+/* Marks the CSAs of the free list in free[], returns their number (TEST_CSAS on a cycle or a CSA listed twice) */
+static uint32_t testFreeList(uint8_t *free)
+{
+    uint32_t count = 0;
+    uint32_t csa   = g_testFcx & portCSA_FCX_MASK;
+
+    memset(free, 0, TEST_CSAS);
+
+    while (csa != 0)
+    {
+        if ((csa >= TEST_CSAS) || (free[csa] != 0))
+        {
+            return TEST_CSAS;
+        }
+
+        free[csa] = 1;
+        count++;
+        csa = g_testCsa[csa][0] & portCSA_FCX_MASK;
+    }
+
+    return count;
+}
+
+/* CALL, interrupt entry, SVLCX: the context goes to the head of the free list, which links the previous PCXI */
+static void testSave(void)
+{
+    uint32_t csa = g_testFcx & portCSA_FCX_MASK;
+
+    HOST_CHECK(csa != 0);
+
+    if (csa != 0)
+    {
+        g_testFcx        = g_testCsa[csa][0] & portCSA_FCX_MASK;
+        g_testCsa[csa][0] = g_testPcxi;
+        g_testPcxi        = csa;
+    }
+}
+
+/* RET, RFE, RSLCX: the context at PCXI goes back to the free list */
+static void testRestore(void)
+{
+    uint32_t csa = g_testPcxi & portCSA_FCX_MASK;
+
+    g_testPcxi        = g_testCsa[csa][0];
+    g_testCsa[csa][0] = g_testFcx;
+    g_testFcx         = csa;
+}
+
+static void testCreate(TestTask *task)
+{
+    uint32_t csa[portTASK_CSAS];
+
+    task->end = &task->stack[TEST_STACK_WORDS - 1];
+    HOST_CHECK_EQ(ulPortCsaTake(&g_testFcx, csa, portTASK_CSAS), portTASK_CSAS);
+    task->top = pulPortCsaInitTask(task->end, csa, 0x80001000U, 0x70000000U);
+}
+
+/* uxPortLoadContext(), then RSLCX and RFE to the task: its first run or the return from the interrupt that left it */
+static void testSwitchIn(TestTask *task)
+{
+    g_testPcxi = task->top[0];
+    task->top += 2;
+    testRestore();
+    testRestore();
+}
+
+/* vPortSaveContext(): the lower context at PCXI and the critical nesting onto the stack of the task */
+static void testSwitchOut(TestTask *task)
+{
+    task->top   -= 2;
+    task->top[1] = 0;
+    task->top[0] = g_testPcxi;
+    g_testPcxi   = 0;
+}
+
+/* Interrupt into the context handler: upper context by the interrupt entry, lower context by the handler prologue */
+static void testPreempt(TestTask *task)
+{
+    testSave();
+    testSave();
+    testSwitchOut(task);
+}
+
+/* vPortReclaimCSA() of the deleted task, from another task or the idle task */
+static void testDelete(TestTask *task)
+{
+    vPortCsaSplice(&g_testFcx, task->top[0] & portCSA_FCX_MASK, *task->end);
+}
+
+/* Deletes task, which holds held CSAs: exactly these go back, in front of the free list as it was */
+static void testDeleteChecked(TestTask *task, uint32_t held, const uint8_t *before)
+{
+    uint8_t  freeBefore[TEST_CSAS];
+    uint8_t  freeAfter[TEST_CSAS];
+    uint32_t countBefore = testFreeList(freeBefore);
+    uint32_t oldHead     = g_testFcx;
+    uint32_t csa;
+    uint32_t i;
+
+    testDelete(task);
+
+    HOST_CHECK_EQ(testFreeList(freeAfter), countBefore + held);
+
+    /* The first held CSAs of the free list are the ones the task had, then the old free list follows */
+    csa = g_testFcx;
+
+    for (i = 0; i < held; i++)
+    {
+        HOST_CHECK(freeBefore[csa] == 0);
+        csa = g_testCsa[csa][0] & portCSA_FCX_MASK;
+    }
+
+    HOST_CHECK_EQ(csa, oldHead);
+
+    /* Nothing else changed hands */
+    if (before != NULL)
+    {
+        HOST_CHECK_EQ(memcmp(freeAfter, before, TEST_CSAS), 0);
+    }
+}
+
+/* The CSAs of a deleted task all go back to the free list, whatever the state it was deleted in. Each case checks
+ * that exactly the CSAs the task held are spliced in front of the free list, and that the model ends up with the
+ * free list it started from (no CSA leaked, none listed twice).
+ */
+static void testCsa(void)
+{
+    static TestTask task[3];
+    uint8_t         initial[TEST_CSAS];
+    uint8_t         withOther[TEST_CSAS];
+    uint32_t        csa[portTASK_CSAS];
+    uint32_t        fcx;
+    uint32_t        i;
+
+    testInitFreeList();
+    HOST_CHECK_EQ(testFreeList(initial), TEST_CSAS - 1);
+
+    /* Created and deleted before it ever ran: its lower, upper and anchor CSA */
+    testCreate(&task[0]);
+    HOST_CHECK_EQ(*task[0].end, task[0].top[0] + 2);
+    HOST_CHECK_EQ(testFreeList(withOther), TEST_CSAS - 1 - portTASK_CSAS);
+    testDeleteChecked(&task[0], portTASK_CSAS, initial);
+
+    /* Preempted in a call by the tick while another task exists: anchor, two call frames, upper and lower context
+     * of the interrupt. The other task runs on and is deleted later.
+     */
+    testCreate(&task[0]);
+    testCreate(&task[1]);
+    testSwitchIn(&task[0]);
+    HOST_CHECK_EQ(g_testPcxi & portCSA_FCX_MASK, *task[0].end);    /* The task function returns into the anchor */
+    testSave();
+    testSave();
+    testPreempt(&task[0]);
+    testSwitchIn(&task[1]);
+    testSave();
+    testFreeList(withOther);
+    testDeleteChecked(&task[0], 1 + 2 + 2, NULL);
+    testRestore();
+    testPreempt(&task[1]);
+    testDeleteChecked(&task[1], 1 + 2, initial);
+
+    /* Deep in calls when the interrupt came */
+    testCreate(&task[2]);
+    testSwitchIn(&task[2]);
+
+    for (i = 0; i < TEST_DEEP_CALLS; i++)
+    {
+        testSave();
+    }
+
+    testPreempt(&task[2]);
+    testDeleteChecked(&task[2], 1 + TEST_DEEP_CALLS + 2, initial);
+
+    /* Deleted itself deep in calls: the yield syscall saves the context of the task below its handler frames and
+     * links the next task in their place (vPortSyscallYield()), the frames return into the next task. The idle task
+     * reclaims later.
+     */
+    testCreate(&task[0]);
+    testCreate(&task[1]);
+    testSwitchIn(&task[0]);
+
+    for (i = 0; i < 10; i++)
+    {
+        testSave();
+    }
+
+    testSave();                                         /* Trap entry: upper context                                  */
+    testSave();                                         /* Trap handler: lower context                                */
+    {
+        uint32_t lower = g_testPcxi;
+        uint32_t frame[TEST_SYSCALL_FRAMES];
+
+        for (i = 0; i < TEST_SYSCALL_FRAMES; i++)
+        {
+            testSave();
+            frame[i] = g_testPcxi;
+        }
+
+        /* The link word below the handler frames holds the task context, it now takes the next one */
+        g_testPcxi = lower;
+        testSwitchOut(&task[0]);
+        g_testPcxi = frame[TEST_SYSCALL_FRAMES - 1];
+        g_testCsa[frame[0]][0] = task[1].top[0];
+        task[1].top += 2;
+
+        for (i = 0; i < TEST_SYSCALL_FRAMES + 2; i++)
+        {
+            testRestore();
+        }
+    }
+    testDeleteChecked(&task[0], 1 + 10 + 2, NULL);
+    testPreempt(&task[1]);
+    testDeleteChecked(&task[1], 1 + 2, initial);
+
+    /* Free list too short for a new task: nothing taken */
+    fcx = 0;
+    HOST_CHECK_EQ(ulPortCsaTake(&fcx, csa, portTASK_CSAS), 0);
+    g_testCsa[5][0] = 6;
+    g_testCsa[6][0] = 0;
+    fcx = 5;
+    HOST_CHECK_EQ(ulPortCsaTake(&fcx, csa, portTASK_CSAS), 0);
+    HOST_CHECK_EQ(fcx, 5);
+}
+
+int main(void)
+{
+    testCsa();
+
+    return hostTestResult("Test_Csa");
+}
@@ -0,0 +1,385 @@
+/**********************************************************************************************************************
+ * \file Test_GwArbitration.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "MULTICAN_GW_TX_FIFO.h"
+#include "HostCan.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_SLOTS                  100000              /* Frame slots of the simulation                              */
+#define TEST_SLOT_US                270                 /* 8 byte classic frame at 500 kbit/s, worst case stuffing    */
+#define TEST_STREAMS                15                  /* Periodic IDs 0x18FF0000..0x18FF000E of pair 2              */
+#define TEST_INFLIGHT               64                  /* Frames of one ID between release and transmission, max    */
+#define TEST_FOREIGN_ID             0x080               /* Frame of another ECU on the destination bus               */
+#define TEST_FOREIGN_PERIOD         4                   /* Slots between two foreign frames                           */
+#define TEST_SRC_NODE               4
+#define TEST_DST_NODE               5                   /* Measured destination, same core as the source node         */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* A periodic ID sent by an ECU on the source bus, with a release jitter of up to a fifth of its period. Frames are numbered in release order, the sequence number is the
+ * payload; the slot rings are indexed by sequence number.
+ */
+typedef struct
+{
+    uint32 id;
+    uint32 period;                                      /* Slots                                                      */
+    uint32 nextRelease;                                 /* Slot of the next release: period, phase and jitter         */
+    uint32 released;
+    uint32 received;                                    /* Won the source bus and stored by the gateway node          */
+    uint32 sent;                                        /* Won the destination bus                                    */
+    uint32 releaseSlot[TEST_INFLIGHT];
+    uint32 rxSlot[TEST_INFLIGHT];
+    uint32 worstGateway;                                /* Slots from reception to transmission                      */
+    uint32 worstEndToEnd;                               /* Slots from release to transmission                        */
+    uint64_t totalGateway;
+} TestStream;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern __thread uint32 g_hostCoreIndex;
+
+static const uint8 g_testNodeCore[NUMBER_OF_CAN_NODES] = {
+    GW_NODE0_CORE, GW_NODE1_CORE, GW_NODE2_CORE, GW_NODE3_CORE, GW_NODE4_CORE, GW_NODE5_CORE, GW_NODE6_CORE, GW_NODE7_CORE
+};
+
+/* Ascending ID order: the first stream with a pending frame wins the source bus. 56 % load from the streams and 25 %
+ * from the foreign frame on the destination bus.
+ */
+static const uint32 g_testStreamPeriod[TEST_STREAMS] = {10, 10, 20, 20, 20, 25, 25, 40, 40, 50, 50, 100, 100, 100, 100};
+
+static TestStream g_testStream[TEST_STREAMS];
+static uint32     g_testSeed;
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Fresh MCMCAN model and gateway */
+static void testInit(void)
+{
+    hostCanReset();
+    memset((void *)&g_hostModuleSrc, 0, sizeof(g_hostModuleSrc));
+    initMultican();
+    hostCanStart();
+
+    /* initMultican() leaves the statistics to the startup code (zeroed .bss) */
+    memset(g_multican.stats, 0, sizeof(g_multican.stats));
+}
+
+/* Run the gateway ISRs of every node with a pending service request, on the core owning the node, until no request
+ * is left
+ */
+static void testRunIsrs(void)
+{
+    boolean ran;
+    uint8   node;
+
+    do
+    {
+        ran = FALSE;
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            if ((g_multican.doorbell[node] != NULL_PTR) && (g_multican.doorbell[node]->B.SRR != 0))
+            {
+                g_multican.doorbell[node]->B.SRR = 0;
+                g_hostCoreIndex                  = g_testNodeCore[node];
+                canGatewayForward(node);
+                ran = TRUE;
+            }
+        }
+    } while (ran != FALSE);
+}
+
+static uint32 testRandom(uint32 range)
+{
+    g_testSeed = g_testSeed * 1103515245U + 12345U;
+
+    return (g_testSeed >> 16) % range;
+}
+
+static void testInitStreams(void)
+{
+    uint32 i;
+
+    memset(g_testStream, 0, sizeof(g_testStream));
+    g_testSeed = 12345;
+
+    for (i = 0; i < TEST_STREAMS; i++)
+    {
+        g_testStream[i].id          = 0x18FF0000U + i;
+        g_testStream[i].period      = g_testStreamPeriod[i];
+        g_testStream[i].nextRelease = testRandom(g_testStreamPeriod[i]);
+    }
+}
+
+/* The frame on the destination bus: its stream, sequence number and per-ID order, and the latencies */
+static void testSent(const HostCanFrame *frame, uint32 slot)
+{
+    TestStream *stream = NULL_PTR;
+    uint32      latency;
+    uint32      seq;
+    uint32      i;
+
+    for (i = 0; i < TEST_STREAMS; i++)
+    {
+        if (g_testStream[i].id == frame->id)
+        {
+            stream = &g_testStream[i];
+        }
+    }
+
+    HOST_CHECK(stream != NULL_PTR);
+
+    if (stream == NULL_PTR)
+    {
+        return;
+    }
+
+    memcpy(&seq, frame->data, sizeof(seq));
+    HOST_CHECK_EQ(frame->dlc, 8);
+    HOST_CHECK_EQ(seq, stream->sent);
+    HOST_CHECK(seq < stream->received);
+
+    latency               = slot - stream->rxSlot[seq % TEST_INFLIGHT];
+    stream->totalGateway += latency;
+
+    if (latency > stream->worstGateway)
+    {
+        stream->worstGateway = latency;
+    }
+
+    latency = slot - stream->releaseSlot[seq % TEST_INFLIGHT];
+
+    if (latency > stream->worstEndToEnd)
+    {
+        stream->worstEndToEnd = latency;
+    }
+
+    stream->sent = seq + 1;
+}
+
+/* Periodic extended IDs of node 4 multicast by pair 2 to nodes 5, 6 and 7, one frame slot at a time: each slot the
+ * source bus carries its highest priority pending frame into the gateway and every destination bus its highest
+ * priority pending frame out of it. On node 5 a foreign standard frame always wins over the gateway's Tx buffers.
+ * Node 4 runs without receive moderation, so a frame received in one slot can be sent in the next one at the earliest
+ * and the latency on node 5 is the queuing alone. Every frame arrives once and in ID order, nothing is dropped, and
+ * the highest priority ID waits at most for the frame of the foreign ECU: the egress queue and the Tx buffer
+ * cancellation put it ahead of every lower priority frame the gateway has queued.
+ */
+static void testArbitrationLatency(void)
+{
+    HostCanFrame frame;
+    TestStream  *stream;
+    uint32       foreignPending = 0;
+    uint32       foreignSent    = 0;
+    uint32       releasedTotal  = 0;
+    uint32       sentTotal      = 0;
+    uint32       sentOther[2]   = {0, 0};
+    uint32       slot;
+    uint32       i;
+
+    testInit();
+    testInitStreams();
+    g_hostCoreIndex = GW_NODE4_CORE;                    /* task context of the core owning the source node            */
+    HOST_CHECK(canGatewaySetRxModeration(TEST_SRC_NODE, 1, 0) != FALSE);
+    testRunIsrs();
+
+    for (slot = 0; (slot < TEST_SLOTS) || (sentTotal < releasedTotal) || (sentOther[0] < releasedTotal) ||
+                   (sentOther[1] < releasedTotal); slot++)
+    {
+        for (i = 0; (i < TEST_STREAMS) && (slot < TEST_SLOTS); i++)
+        {
+            stream = &g_testStream[i];
+
+            if (slot == stream->nextRelease)
+            {
+                stream->nextRelease  = slot - (slot % stream->period) + stream->period;
+                stream->nextRelease += testRandom(stream->period / 5 + 1);
+                HOST_CHECK((stream->released - stream->sent) < TEST_INFLIGHT);
+                stream->releaseSlot[stream->released % TEST_INFLIGHT] = slot;
+                stream->released++;
+                releasedTotal++;
+            }
+        }
+
+        if ((slot < TEST_SLOTS) && ((slot % TEST_FOREIGN_PERIOD) == 0))
+        {
+            foreignPending++;
+        }
+
+        /* destination bus: frames the gateway queued in earlier slots */
+        if (foreignPending > 0)
+        {
+            foreignPending--;
+            foreignSent++;
+        }
+        else if (hostCanTransmit(g_multican.canNode[TEST_DST_NODE].node, &frame) != FALSE)
+        {
+            testSent(&frame, slot);
+            sentTotal++;
+            testRunIsrs();
+        }
+
+        /* nodes 6 and 7 (CPU2, through the cross-core queue) only carry the multicast copies */
+        for (i = 0; i < 2; i++)
+        {
+            if (hostCanTransmit(g_multican.canNode[6 + i].node, &frame) != FALSE)
+            {
+                sentOther[i]++;
+                testRunIsrs();
+            }
+        }
+
+        /* source bus: the lowest pending ID */
+        for (i = 0; i < TEST_STREAMS; i++)
+        {
+            stream = &g_testStream[i];
+
+            if (stream->released > stream->received)
+            {
+                memset(&frame, 0, sizeof(frame));
+                frame.id       = stream->id;
+                frame.extended = TRUE;
+                frame.dlc      = 8;
+                memcpy(frame.data, &stream->received, sizeof(stream->received));
+                HOST_CHECK(hostCanReceive(g_multican.canNode[TEST_SRC_NODE].node, &frame) != FALSE);
+
+                stream->rxSlot[stream->received % TEST_INFLIGHT] = slot;
+                stream->received++;
+                testRunIsrs();
+                break;
+            }
+        }
+
+        HOST_CHECK(slot < (TEST_SLOTS + 1000));
+
+        if (slot >= (TEST_SLOTS + 1000))
+        {
+            break;
+        }
+    }
+
+    HOST_CHECK_EQ(sentTotal, releasedTotal);
+    HOST_CHECK_EQ(foreignSent, (TEST_SLOTS + TEST_FOREIGN_PERIOD - 1) / TEST_FOREIGN_PERIOD);
+    HOST_CHECK_EQ(g_multican.stats[TEST_SRC_NODE].rxFrames, releasedTotal);
+    HOST_CHECK_EQ(g_multican.stats[TEST_DST_NODE].txFrames, releasedTotal);
+    HOST_CHECK_EQ(g_multican.stats[TEST_DST_NODE].txDropped, 0);
+    HOST_CHECK_EQ(sentOther[0], releasedTotal);
+    HOST_CHECK_EQ(sentOther[1], releasedTotal);
+    HOST_CHECK(g_testStream[0].worstGateway <= 2);
+
+    printf("Test_GwArbitration: %u slots of %u us, %u frames node %u -> node %u, foreign 0x%03X every %u slots\n",
+           (unsigned)slot, (unsigned)TEST_SLOT_US, (unsigned)sentTotal, (unsigned)TEST_SRC_NODE, (unsigned)TEST_DST_NODE,
+           (unsigned)TEST_FOREIGN_ID, (unsigned)TEST_FOREIGN_PERIOD);
+
+    for (i = 0; i < TEST_STREAMS; i++)
+    {
+        stream = &g_testStream[i];
+        HOST_CHECK_EQ(stream->sent, stream->released);
+        printf("  0x%08X every %3u slots: gateway worst %2u slots (%5u us) mean %.2f slots, release to bus worst %2u slots\n",
+               (unsigned)stream->id, (unsigned)stream->period, (unsigned)stream->worstGateway,
+               (unsigned)(stream->worstGateway * TEST_SLOT_US), (double)stream->totalGateway / (double)stream->sent,
+               (unsigned)stream->worstEndToEnd);
+    }
+}
+
+/* All Tx buffers of node 5 hold frames of the lowest priority ID and two more wait in the egress queue when a frame
+ * of the highest priority ID arrives. The buffer it preempts must hold the newest of the loaded frames: the cancelled
+ * frame is queued again and may only leave after the older frames of its ID.
+ */
+static void testPreemptionOrder(void)
+{
+    HostCanFrame frame;
+    uint32       lowId   = 0x18FF0000U + TEST_STREAMS - 1;
+    uint32       highId  = 0x18FF0000U;
+    uint32       frames  = GW_EGRESS_TX_BUFFERS + 2;
+    uint32       highAt  = frames;
+    uint32       sent    = 0;
+    uint32       nextSeq = 0;
+    uint32       seq;
+    uint32       i;
+
+    testInit();
+    g_hostCoreIndex = GW_NODE4_CORE;
+    HOST_CHECK(canGatewaySetRxModeration(TEST_SRC_NODE, 1, 0) != FALSE);
+    testRunIsrs();
+
+    for (i = 0; i <= frames; i++)
+    {
+        memset(&frame, 0, sizeof(frame));
+        frame.id       = (i < frames) ? lowId : highId;
+        frame.extended = TRUE;
+        frame.dlc      = 8;
+        memcpy(frame.data, &i, sizeof(i));
+        HOST_CHECK(hostCanReceive(g_multican.canNode[TEST_SRC_NODE].node, &frame) != FALSE);
+        testRunIsrs();
+    }
+
+    HOST_CHECK_EQ(g_multican.stats[TEST_DST_NODE].txPreempted, 1);
+
+    while (hostCanTransmit(g_multican.canNode[TEST_DST_NODE].node, &frame) != FALSE)
+    {
+        memcpy(&seq, frame.data, sizeof(seq));
+
+        if (frame.id == highId)
+        {
+            highAt = sent;
+        }
+        else
+        {
+            HOST_CHECK_EQ(frame.id, lowId);
+            HOST_CHECK_EQ(seq, nextSeq);
+            nextSeq = seq + 1;
+        }
+
+        sent++;
+        testRunIsrs();
+    }
+
+    HOST_CHECK_EQ(highAt, 0);
+    HOST_CHECK_EQ(nextSeq, frames);
+    HOST_CHECK_EQ(sent, frames + 1);
+    HOST_CHECK_EQ(g_multican.stats[TEST_DST_NODE].txDropped, 0);
+}
+
+int main(void)
+{
+    testPreemptionOrder();
+    testArbitrationLatency();
+
+    return hostTestResult("Test_GwArbitration");
+}
@@ -0,0 +1,251 @@
+/**********************************************************************************************************************
+ * \file Test_GwBypass.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "MULTICAN_GW_TX_FIFO.h"
+#include "HostCan.h"
+#include "HostDma.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_FRAMES                 2000                /* Frames of each case, a multiple of GW_BYPASS_WATERMARK     */
+#define TEST_BYPASS_ID              0x300               /* Not taken by a filter of node 2: Rx FIFO 1, the bypass     */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern __thread uint32 g_hostCoreIndex;
+
+void gwBypassIsr0(void);                                /* Gateway ISRs, not exported by MULTICAN_GW_TX_FIFO.h        */
+
+static const uint8 g_testNodeCore[NUMBER_OF_CAN_NODES] = {
+    GW_NODE0_CORE, GW_NODE1_CORE, GW_NODE2_CORE, GW_NODE3_CORE, GW_NODE4_CORE, GW_NODE5_CORE, GW_NODE6_CORE, GW_NODE7_CORE
+};
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Fresh MCMCAN and DMA models and gateway. initMultican() leaves the statistics to the startup code (zeroed .bss). */
+static void testInit(void)
+{
+    hostCanReset();
+    memset((void *)&g_hostModuleSrc, 0, sizeof(g_hostModuleSrc));
+    memset((void *)&g_hostModuleDma, 0, sizeof(g_hostModuleDma));
+    memset((void *)g_multican.stats, 0, sizeof(g_multican.stats));
+    initMultican();
+    hostCanStart();
+}
+
+/* Run the gateway ISRs of every node with a pending service request, on the core owning the node, until no request
+ * is left (an ISR may raise the requests of other nodes: cross-core doorbells, transmission completed).
+ */
+static void testRunIsrs(void)
+{
+    boolean ran;
+    uint8   node;
+
+    do
+    {
+        ran = FALSE;
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            if ((g_multican.doorbell[node] != NULL_PTR) && (g_multican.doorbell[node]->B.SRR != 0))
+            {
+                g_multican.doorbell[node]->B.SRR = 0;
+                g_hostCoreIndex                  = g_testNodeCore[node];
+                canGatewayForward(node);
+                ran = TRUE;
+            }
+        }
+    } while (ran != FALSE);
+}
+
+/* Run the watermark ISR of the bypass if its DMA channel requested it; returns TRUE if it ran */
+static boolean testRunBypassIsr(void)
+{
+    volatile Ifx_SRC_SRCR *src = IfxDma_getSrcPointer(&MODULE_DMA, (IfxDma_ChannelId)gwBypass[0].dmaChannel);
+
+    if (src->B.SRR == 0)
+    {
+        return FALSE;
+    }
+
+    src->B.SRR      = 0;
+    g_hostCoreIndex = GW_BYPASS0_CORE;
+    gwBypassIsr0();
+
+    return TRUE;
+}
+
+static void testFrame(HostCanFrame *frame, uint32 id, uint32 seq)
+{
+    memset(frame, 0, sizeof(*frame));
+    frame->id      = id;
+    frame->dlc     = 8;
+    memcpy(frame->data, &seq, sizeof(seq));
+    frame->data[7] = 0xA5;
+}
+
+/* Receive a frame on the source node of the bypass, the DMA reacts to its request at once */
+static void testReceive(uint32 id, uint32 seq)
+{
+    HostCanFrame frame;
+
+    testFrame(&frame, id, seq);
+    HOST_CHECK(hostCanReceive(g_multican.canNode[gwBypass[0].srcNode].node, &frame) != FALSE);
+    (void)hostDmaService();
+}
+
+/* Send every frame pending on a node (each completion runs the ISRs); checks the sequence of each ID in order, frames
+ * of TEST_BYPASS_ID unchanged, frames of 0x202 as converted by its route (12 byte CAN FD, received bytes at 4..11).
+ * The next expected sequence of each stream is updated, so it ends as the count of frames sent.
+ */
+static void testDrainNode(uint8 node, uint32 *nextBypass, uint32 *nextRouted)
+{
+    HostCanFrame frame;
+    uint32       seq;
+
+    while (hostCanTransmit(g_multican.canNode[node].node, &frame) != FALSE)
+    {
+        if (frame.id == TEST_BYPASS_ID)
+        {
+            memcpy(&seq, &frame.data[0], sizeof(seq));
+            HOST_CHECK_EQ(frame.dlc, 8);
+            HOST_CHECK_EQ(frame.fd, FALSE);
+            HOST_CHECK_EQ(seq, *nextBypass);
+            HOST_CHECK_EQ(frame.data[7], 0xA5);
+            *nextBypass = seq + 1;
+        }
+        else
+        {
+            memcpy(&seq, &frame.data[4], sizeof(seq));
+            HOST_CHECK_EQ(frame.id, 0x202);
+            HOST_CHECK_EQ(frame.dlc, 9);
+            HOST_CHECK_EQ(seq, *nextRouted);
+            HOST_CHECK_EQ(frame.data[11], 0xA5);
+            *nextRouted = seq + 1;
+        }
+
+        testRunIsrs();
+    }
+}
+
+/* Non-matching frames of node 2 reach node 3 through the DMA alone: every frame once and in order through the bypass
+ * Tx buffers, each Rx FIFO 1 element acknowledged, one CPU interrupt per GW_BYPASS_WATERMARK frames. The gateway ISR of
+ * node 2 is never requested, Rx FIFO 1 of a bypass node has no watermark interrupt (it would stay pending, as
+ * gwRxDrain() leaves the flags of that FIFO to the DMA).
+ */
+static void testBypassForward(void)
+{
+    Ifx_CAN_N *srcNode;
+    uint32     nextBypass = 0;
+    uint32     nextRouted = 0;
+    uint32     interrupts = 0;
+    uint32     i;
+
+    testInit();
+    srcNode = g_multican.canNode[gwBypass[0].srcNode].node;
+
+    HOST_CHECK((g_multican.bypassNodeMask & GW_NODE(gwBypass[0].srcNode)) != 0);
+    HOST_CHECK_EQ(srcNode->IE.U & (1U << IfxCan_Interrupt_rxFifo1WatermarkReached), 0);
+    HOST_CHECK_EQ(srcNode->RX.F1C.B.F1WM, 0);
+
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        testReceive(TEST_BYPASS_ID, i);
+        HOST_CHECK_EQ(IfxCan_Node_getRxFifo1FillLevel(srcNode), 0);
+        HOST_CHECK_EQ(g_multican.doorbell[gwBypass[0].srcNode]->B.SRR, 0);
+
+        if (((i + 1) % GW_BYPASS_WATERMARK) == 0)
+        {
+            HOST_CHECK(testRunBypassIsr() != FALSE);
+            interrupts++;
+            testDrainNode(gwBypass[0].dstNode, &nextBypass, &nextRouted);
+        }
+        else
+        {
+            HOST_CHECK(testRunBypassIsr() == FALSE);
+        }
+    }
+
+    HOST_CHECK_EQ(nextBypass, TEST_FRAMES);
+    HOST_CHECK_EQ(nextRouted, 0);
+    HOST_CHECK_EQ(interrupts, TEST_FRAMES / GW_BYPASS_WATERMARK);
+    HOST_CHECK_EQ(g_hostCanAcknowledgeWrites, TEST_FRAMES);
+    HOST_CHECK_EQ(g_multican.stats[gwBypass[0].srcNode].bypassFrames, TEST_FRAMES);
+    HOST_CHECK_EQ(g_multican.stats[gwBypass[0].srcNode].bypassLost, 0);
+}
+
+/* Routed frames of the same node (0x202, Rx FIFO 0, the gateway ISR) interleaved with bypass frames: both reach node 3,
+ * sharing its Tx buffers by arbitration, each stream in order. Node 1 gets the routed frames only.
+ */
+static void testBypassWithRoutedTraffic(void)
+{
+    uint32 nextBypass  = 0;
+    uint32 nextRouted3 = 0;
+    uint32 nextRouted1 = 0;
+    uint32 nextBypass1 = 0;
+    uint32 i;
+
+    testInit();
+
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        testReceive(0x202, i);
+        testReceive(TEST_BYPASS_ID, i);
+
+        if (((i + 1) % GW_BYPASS_WATERMARK) == 0)
+        {
+            testRunIsrs();
+            (void)testRunBypassIsr();
+            testDrainNode(gwBypass[0].dstNode, &nextBypass, &nextRouted3);
+            testDrainNode(1, &nextBypass1, &nextRouted1);
+        }
+    }
+
+    HOST_CHECK_EQ(nextBypass, TEST_FRAMES);
+    HOST_CHECK_EQ(nextRouted3, TEST_FRAMES);
+    HOST_CHECK_EQ(nextRouted1, TEST_FRAMES);
+    HOST_CHECK_EQ(nextBypass1, 0);
+    HOST_CHECK_EQ(g_multican.stats[gwBypass[0].srcNode].bypassFrames, TEST_FRAMES);
+    HOST_CHECK_EQ(g_multican.stats[gwBypass[0].dstNode].txDropped, 0);
+}
+
+int main(void)
+{
+    testBypassForward();
+    testBypassWithRoutedTraffic();
+
+    return hostTestResult("Test_GwBypass");
+}
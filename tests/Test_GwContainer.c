@@ -0,0 +1,406 @@
+/**********************************************************************************************************************
+ * \file Test_GwContainer.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "MULTICAN_GW_TX_FIFO.h"
+#include "HostCan.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_FRAMES                 400                 /* Classic frames of the round trip and bus load cases        */
+#define TEST_MAX_CONTAINERS         TEST_FRAMES         /* At least one PDU per container                             */
+#define TEST_ROUTED_ID              0x101               /* Route of node 0, forwarded as TEST_ROUTED_NEW_ID           */
+#define TEST_ROUTED_NEW_ID          0x181
+#define TEST_PAIR_ID                0x100               /* Filter of pair 0, node 0 -> node 1                         */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern __thread uint32 g_hostCoreIndex;
+
+void gwRxTimeoutIsrCpu1(void);                          /* Gateway ISRs, not exported by MULTICAN_GW_TX_FIFO.h        */
+
+static const uint8 g_testNodeCore[NUMBER_OF_CAN_NODES] = {
+    GW_NODE0_CORE, GW_NODE1_CORE, GW_NODE2_CORE, GW_NODE3_CORE, GW_NODE4_CORE, GW_NODE5_CORE, GW_NODE6_CORE, GW_NODE7_CORE
+};
+
+static HostCanFrame g_testSent[TEST_FRAMES];            /* Classic frames received on the classic node                */
+static HostCanFrame g_testContainer[TEST_MAX_CONTAINERS]; /* Container frames sent on the CAN FD node                 */
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Fresh MCMCAN model and gateway. initMultican() leaves the statistics to the startup code (zeroed .bss). */
+static void testInit(void)
+{
+    hostCanReset();
+    memset((void *)&g_hostModuleSrc, 0, sizeof(g_hostModuleSrc));
+    memset((void *)g_multican.stats, 0, sizeof(g_multican.stats));
+    initMultican();
+    hostCanStart();
+}
+
+/* Run the gateway ISRs of every node with a pending service request, on the core owning the node, until no request
+ * is left.
+ */
+static void testRunIsrs(void)
+{
+    boolean ran;
+    uint8   node;
+
+    do
+    {
+        ran = FALSE;
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            if ((g_multican.doorbell[node] != NULL_PTR) && (g_multican.doorbell[node]->B.SRR != 0))
+            {
+                g_multican.doorbell[node]->B.SRR = 0;
+                g_hostCoreIndex                  = g_testNodeCore[node];
+                canGatewayForward(node);
+                ran = TRUE;
+            }
+        }
+    } while (ran != FALSE);
+}
+
+/* Receive a frame on a node of CPU1 and let the gateway take it at once: the receive moderation timeout expires */
+static void testReceive(uint8 node, const HostCanFrame *frame)
+{
+    HOST_CHECK(hostCanReceive(g_multican.canNode[node].node, frame) != FALSE);
+    testRunIsrs();
+    MODULE_STM1.TIM0.U += IfxStm_getTicksFromMicroseconds(&MODULE_STM1, 2 * gwRxModeration[node].timeoutUs);
+    g_hostCoreIndex     = 1;
+    gwRxTimeoutIsrCpu1();
+    testRunIsrs();
+}
+
+/* Classic frame i of the round trip: 0x100 (pair) and 0x101 (route) in turn, every DLC 0..8, payload from i */
+static void testClassicFrame(HostCanFrame *frame, uint32 i, uint8 dlc)
+{
+    uint8 k;
+
+    memset(frame, 0, sizeof(*frame));
+    frame->id  = ((i % 2) == 0) ? TEST_PAIR_ID : TEST_ROUTED_ID;
+    frame->dlc = dlc;
+
+    for (k = 0; k < dlc; k++)
+    {
+        frame->data[k] = (uint8)(i + (k * 31));
+    }
+}
+
+/* Collect the container frames sent on the CAN FD node, from the next free slot of g_testContainer[] */
+static uint32 testCollectContainers(uint32 count)
+{
+    const MulticanGwContainerConfig *config = &gwContainers[0];
+    HostCanFrame                     frame;
+
+    while (hostCanTransmit(g_multican.canNode[config->fdNode].node, &frame) != FALSE)
+    {
+        HOST_CHECK_EQ(frame.id, config->containerId);
+        HOST_CHECK_EQ(frame.fd, TRUE);
+        HOST_CHECK_EQ(frame.bitRateSwitch, TRUE);
+        HOST_CHECK(count < TEST_MAX_CONTAINERS);
+
+        if (count < TEST_MAX_CONTAINERS)
+        {
+            g_testContainer[count] = frame;
+            count++;
+        }
+
+        testRunIsrs();
+    }
+
+    return count;
+}
+
+/* Send TEST_FRAMES classic frames on the classic node, each with dlcOf(i), and collect the containers the gateway
+ * sends on the CAN FD node, the last one sent by the time trigger. Returns the number of containers.
+ */
+static uint32 testPack(uint8 (*dlcOf)(uint32 i))
+{
+    const MulticanGwContainerConfig *config = &gwContainers[0];
+    uint32                           count  = 0;
+    uint32                           i;
+    uint8                            ms;
+
+    testInit();
+
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        testClassicFrame(&g_testSent[i], i, dlcOf(i));
+        testReceive(config->classicNode, &g_testSent[i]);
+        count = testCollectContainers(count);
+    }
+
+    for (ms = 0; ms < config->flushTimeMs; ms++)
+    {
+        g_hostCoreIndex = g_testNodeCore[config->classicNode];
+        canGatewayContainerTick();
+    }
+
+    return testCollectContainers(count);
+}
+
+static uint8 testDlcMixed(uint32 i)
+{
+    return (uint8)(i % 9);
+}
+
+static uint8 testDlc8(uint32 i)
+{
+    (void)i;
+    return 8;
+}
+
+static uint8 testDlc2(uint32 i)
+{
+    (void)i;
+    return 2;
+}
+
+/* Next frame of the same ID as a frame sent back on the classic node, from index next on (TEST_FRAMES if none) */
+static uint32 testNextOfId(uint32 next, uint32 id)
+{
+    uint32 sentId = (id == TEST_ROUTED_NEW_ID) ? TEST_ROUTED_ID : id;
+
+    while ((next < TEST_FRAMES) && (g_testSent[next].id != sentId))
+    {
+        next++;
+    }
+
+    return next;
+}
+
+/* Round trip: classic frames of every DLC packed on node 0 -> node 1, the container frames received back on node 1
+ * unpacked to node 0. Every frame comes back once with its DLC and data, 0x101 with the ID of its route. The frames of
+ * one ID keep their order; the unpacked frames of a container arbitrate for the bus, so 0x100 may overtake 0x181.
+ */
+static void testRoundTrip(void)
+{
+    const MulticanGwContainerConfig *config = &gwContainers[0];
+    HostCanFrame                     frame;
+    uint32                           containers;
+    uint32                           pdus     = 0;
+    uint32                           received = 0;
+    uint32                           next[2]  = {0, 0}; /* Next frame of TEST_PAIR_ID, of TEST_ROUTED_ID  */
+    uint32                           stream;
+    uint32                           i;
+
+    containers = testPack(testDlcMixed);
+
+    for (i = 0; i < containers; i++)
+    {
+        pdus += g_testContainer[i].data[0];
+    }
+
+    HOST_CHECK_EQ(pdus, TEST_FRAMES);
+    HOST_CHECK_EQ(g_multican.stats[config->classicNode].containerFrames, containers);
+    HOST_CHECK_EQ(g_multican.stats[config->classicNode].containerPdus, TEST_FRAMES);
+
+    for (i = 0; i < containers; i++)
+    {
+        testReceive(config->fdNode, &g_testContainer[i]);
+
+        while (hostCanTransmit(g_multican.canNode[config->classicNode].node, &frame) != FALSE)
+        {
+            HOST_CHECK((frame.id == TEST_PAIR_ID) || (frame.id == TEST_ROUTED_NEW_ID));
+            stream       = (frame.id == TEST_PAIR_ID) ? 0 : 1;
+            next[stream] = testNextOfId(next[stream], frame.id);
+            HOST_CHECK(next[stream] < TEST_FRAMES);
+
+            if (next[stream] < TEST_FRAMES)
+            {
+                const HostCanFrame *sent = &g_testSent[next[stream]];
+
+                HOST_CHECK_EQ(frame.extended, FALSE);
+                HOST_CHECK_EQ(frame.fd, FALSE);
+                HOST_CHECK_EQ(frame.dlc, sent->dlc);
+                HOST_CHECK(memcmp(frame.data, sent->data, sent->dlc) == 0);
+                next[stream]++;
+            }
+
+            received++;
+            testRunIsrs();
+        }
+    }
+
+    HOST_CHECK_EQ(received, TEST_FRAMES);
+    HOST_CHECK_EQ(testNextOfId(next[0], TEST_PAIR_ID), TEST_FRAMES);
+    HOST_CHECK_EQ(testNextOfId(next[1], TEST_ROUTED_NEW_ID), TEST_FRAMES);
+    HOST_CHECK_EQ(g_multican.stats[config->fdNode].containerFrames, containers);
+    HOST_CHECK_EQ(g_multican.stats[config->fdNode].containerPdus, TEST_FRAMES);
+}
+
+/* Time trigger: a single PDU stays in the container until flushTimeMs ticks of the core of the classic node have
+ * passed, then it is sent alone, in the shortest CAN FD length holding it (zero padded). The size trigger sends a
+ * container without any tick once flushBytes are used.
+ */
+static void testFlushOnTimeout(void)
+{
+    const MulticanGwContainerConfig *config = &gwContainers[0];
+    HostCanFrame                     frame;
+    HostCanFrame                     sent;
+    uint32                           used   = GW_CONTAINER_HEADER_SIZE + GW_CONTAINER_PDU_HEADER + 8;
+    uint32                           pdus;
+    uint32                           i;
+    uint8                            ms;
+
+    testInit();
+    testClassicFrame(&sent, 0, 8);
+    testReceive(config->classicNode, &sent);
+    HOST_CHECK(hostCanTransmit(g_multican.canNode[config->fdNode].node, &frame) == FALSE);
+
+    for (ms = 1; ms < config->flushTimeMs; ms++)
+    {
+        g_hostCoreIndex = g_testNodeCore[config->classicNode];
+        canGatewayContainerTick();
+        HOST_CHECK(hostCanTransmit(g_multican.canNode[config->fdNode].node, &frame) == FALSE);
+    }
+
+    canGatewayContainerTick();
+    HOST_CHECK(hostCanTransmit(g_multican.canNode[config->fdNode].node, &frame) != FALSE);
+    HOST_CHECK_EQ(frame.data[0], 1);
+    HOST_CHECK_EQ(IfxCan_Node_getDataLengthInBytes((IfxCan_DataLengthCode)frame.dlc), (used + 3) & ~3U);
+    HOST_CHECK(memcmp(&frame.data[GW_CONTAINER_HEADER_SIZE + GW_CONTAINER_PDU_HEADER], sent.data, 8) == 0);
+
+    for (i = used; i < IfxCan_Node_getDataLengthInBytes((IfxCan_DataLengthCode)frame.dlc); i++)
+    {
+        HOST_CHECK_EQ(frame.data[i], 0);
+    }
+
+    /* the next tick finds an empty container */
+    canGatewayContainerTick();
+    HOST_CHECK(hostCanTransmit(g_multican.canNode[config->fdNode].node, &frame) == FALSE);
+
+    /* size trigger: the PDUs of 8 byte frames needed to reach flushBytes */
+    pdus = (config->flushBytes - GW_CONTAINER_HEADER_SIZE + (GW_CONTAINER_PDU_HEADER + 8) - 1) / (GW_CONTAINER_PDU_HEADER + 8);
+
+    for (i = 0; i < pdus; i++)
+    {
+        testClassicFrame(&sent, i, 8);
+        HOST_CHECK(hostCanTransmit(g_multican.canNode[config->fdNode].node, &frame) == FALSE);
+        testReceive(config->classicNode, &sent);
+    }
+
+    HOST_CHECK(hostCanTransmit(g_multican.canNode[config->fdNode].node, &frame) != FALSE);
+    HOST_CHECK_EQ(frame.data[0], pdus);
+}
+
+/* Bus time of a frame in us, with worst case bit stuffing: classic frames at the nominal rate, CAN FD frames with BRS
+ * at the data rate from the ESI bit to the CRC (stuff count and fixed stuff bits included), the rest at the nominal
+ * rate. The 13 bits from the CRC delimiter to the end of the intermission are never stuffed.
+ */
+static double testFrameTimeUs(const HostCanFrame *frame, double nominalRate, double dataRate)
+{
+    uint32 bytes       = IfxCan_Node_getDataLengthInBytes((IfxCan_DataLengthCode)frame->dlc);
+    uint32 nominalBits;
+    uint32 dataBits    = 0;
+    uint32 crcBits;
+
+    if (frame->fd == FALSE)
+    {
+        nominalBits = (frame->extended ? 54 : 34) + (8 * bytes);
+        nominalBits = nominalBits + ((nominalBits - 1) / 4) + 13;
+    }
+    else
+    {
+        crcBits     = (bytes <= 16) ? 17 : 21;
+        nominalBits = frame->extended ? 36 : 17;
+        nominalBits = nominalBits + ((nominalBits - 1) / 4) + 13;
+        dataBits    = 5 + (8 * bytes);
+        dataBits    = dataBits + ((dataBits - 1) / 4) + 4 + crcBits + ((4 + crcBits + 3) / 4);
+
+        if (frame->bitRateSwitch == FALSE)
+        {
+            nominalBits += dataBits;
+            dataBits     = 0;
+        }
+    }
+
+    return ((double)nominalBits * 1e6 / nominalRate) + ((double)dataBits * 1e6 / dataRate);
+}
+
+/* Bus load on the CAN FD node: the containers the gateway sent against the same classic frames sent one by one, for
+ * 8 byte, 2 byte and mixed length frames (bus time of both and the reduction, printed).
+ */
+static void testBusLoad(void)
+{
+    static const struct
+    {
+        const char *name;
+        uint8       (*dlcOf)(uint32 i);
+    } loads[] = {{"8 byte frames", testDlc8}, {"2 byte frames", testDlc2}, {"DLC 0..8 mixed", testDlcMixed}};
+    double nominalRate;
+    double dataRate;
+    double individualUs;
+    double containerUs;
+    uint32 containers;
+    uint32 i;
+    uint32 k;
+
+    for (k = 0; k < (sizeof(loads) / sizeof(loads[0])); k++)
+    {
+        containers   = testPack(loads[k].dlcOf);
+        nominalRate  = (double)g_multican.canNodeConfig.baudRate.baudrate;
+        dataRate     = (double)g_multican.canNodeConfig.fastBaudRate.baudrate;
+        individualUs = 0;
+        containerUs  = 0;
+
+        for (i = 0; i < TEST_FRAMES; i++)
+        {
+            individualUs += testFrameTimeUs(&g_testSent[i], nominalRate, dataRate);
+        }
+
+        for (i = 0; i < containers; i++)
+        {
+            containerUs += testFrameTimeUs(&g_testContainer[i], nominalRate, dataRate);
+        }
+
+        HOST_CHECK(containerUs < individualUs);
+        printf("Test_GwContainer: %-14s %u frames one by one %.0f us, as %u containers %.0f us, bus load -%.0f %%\n",
+               loads[k].name, TEST_FRAMES, individualUs, (unsigned)containers, containerUs,
+               100.0 * (individualUs - containerUs) / individualUs);
+    }
+}
+
+int main(void)
+{
+    testRoundTrip();
+    testFlushOnTimeout();
+    testBusLoad();
+
+    return hostTestResult("Test_GwContainer");
+}
@@ -0,0 +1,357 @@
+/**********************************************************************************************************************
+ * \file Test_GwCores.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "MULTICAN_GW_TX_FIFO.h"
+#include "HostCan.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_FRAMES                 100000              /* Frames per source node                                     */
+#define TEST_BURST                  4                   /* Frames stored per source node between two ISR passes      */
+#define TEST_WINDOW                 16                  /* Frames of a source node not yet sent on all destinations  */
+#define TEST_STREAMS                3
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Traffic of one source node: one ID, sent by the pairs of the default configuration */
+typedef struct
+{
+    uint8   srcNode;
+    uint32  id;
+    boolean extended;
+    uint8   dstNodeMask;
+} TestStream;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern __thread uint32 g_hostCoreIndex;
+
+static const uint8 g_testNodeCore[NUMBER_OF_CAN_NODES] = {
+    GW_NODE0_CORE, GW_NODE1_CORE, GW_NODE2_CORE, GW_NODE3_CORE, GW_NODE4_CORE, GW_NODE5_CORE, GW_NODE6_CORE, GW_NODE7_CORE
+};
+
+/* Pair 0 packed into the containers of node 1, pair 1, and the multicast of pair 2 */
+static const TestStream g_testStream[TEST_STREAMS] = {
+    {0, 0x100,      FALSE, GW_NODE(1)},
+    {2, 0x200,      FALSE, GW_NODE(3)},
+    {4, 0x18FF0000, TRUE,  GW_NODE(5) | GW_NODE(6) | GW_NODE(7)}
+};
+
+static uint32   g_testFed[TEST_STREAMS];                /* Written by the core of the source node                     */
+static uint32   g_testDelivered[NUMBER_OF_CAN_NODES];   /* Written by the core of the destination node                */
+static uint64_t g_testBusyNs[GW_NUM_CORES];             /* Thread CPU time of the passes that did work               */
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static uint64_t testThreadNanoseconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+/* Run the gateway ISRs of the nodes of a core with a pending request until none is left. The request is taken
+ * atomically, the other cores set requests of the same registers (cross-core doorbells).
+ */
+static boolean testRunIsrs(uint8 core)
+{
+    Ifx_SRC_SRCR request;
+    boolean      ran = FALSE;
+    boolean      again;
+    uint8        node;
+
+    request.U     = 0;
+    request.B.SRR = 1;
+
+    do
+    {
+        again = FALSE;
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            if ((g_testNodeCore[node] == core) && (g_multican.doorbell[node] != NULL_PTR) &&
+                ((__atomic_fetch_and(&g_multican.doorbell[node]->U, ~request.U, __ATOMIC_SEQ_CST) & request.U) != 0))
+            {
+                canGatewayForward(node);
+                again = TRUE;
+                ran   = TRUE;
+            }
+        }
+    } while (again != FALSE);
+
+    return ran;
+}
+
+/* Frames sent on a destination node: the sequence numbers of its stream in order; a container frame of node 1
+ * carries the PDUs of node 0
+ */
+static void testSent(uint8 node, const HostCanFrame *frame)
+{
+    uint32 delivered = g_testDelivered[node];
+    uint32 pos;
+    uint32 seq;
+    uint8  i;
+
+    if (node == 1)
+    {
+        HOST_CHECK(frame->fd != FALSE);
+
+        for (i = 0, pos = 1; i < frame->data[0]; i++, pos += 5 + 8)
+        {
+            HOST_CHECK_EQ(frame->data[pos + 4], 8);
+            memcpy(&seq, &frame->data[pos + 5], sizeof(seq));
+            HOST_CHECK_EQ(seq, delivered);
+            delivered++;
+        }
+    }
+    else
+    {
+        memcpy(&seq, frame->data, sizeof(seq));
+        HOST_CHECK_EQ(seq, delivered);
+        delivered++;
+    }
+
+    __atomic_store_n(&g_testDelivered[node], delivered, __ATOMIC_RELEASE);
+}
+
+/* Store a burst of frames in a source node once all its destinations have sent enough of the frames before (the
+ * cross-core queues and egress queues never overflow)
+ */
+static boolean testFeed(uint8 stream)
+{
+    const TestStream *config = &g_testStream[stream];
+    HostCanFrame      frame;
+    uint32            fed    = g_testFed[stream];
+    uint32            seq;
+    uint8             node;
+
+    if (fed >= TEST_FRAMES)
+    {
+        return FALSE;
+    }
+
+    for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+    {
+        if (((config->dstNodeMask & GW_NODE(node)) != 0) &&
+            ((fed - __atomic_load_n(&g_testDelivered[node], __ATOMIC_ACQUIRE)) > (TEST_WINDOW - TEST_BURST)))
+        {
+            return FALSE;
+        }
+    }
+
+    for (seq = fed; seq < (fed + TEST_BURST); seq++)
+    {
+        memset(&frame, 0, sizeof(frame));
+        frame.id       = config->id;
+        frame.extended = config->extended;
+        frame.dlc      = 8;
+        memcpy(frame.data, &seq, sizeof(seq));
+        HOST_CHECK(hostCanReceive(g_multican.canNode[config->srcNode].node, &frame) != FALSE);
+    }
+
+    g_testFed[stream] = fed + TEST_BURST;
+
+    return TRUE;
+}
+
+/* One CPU: feeds its source nodes, runs its gateway ISRs and sends on its destination nodes until all their frames
+ * are through. Every MCMCAN node is only touched by the thread of its core; the cores meet in the cross-core queues
+ * and the service request registers. A pass without work yields (the host may have fewer CPUs than the threads).
+ */
+static void *testCore(void *arg)
+{
+    HostCanFrame frame;
+    uint8        core = (uint8)(uintptr_t)arg;
+    boolean      done = FALSE;
+    boolean      work;
+    uint64_t     start;
+    uint8        stream;
+    uint8        node;
+
+    g_hostCoreIndex = core;
+
+    while (done == FALSE)
+    {
+        start = testThreadNanoseconds();
+        work  = FALSE;
+        done  = TRUE;
+
+        for (stream = 0; stream < TEST_STREAMS; stream++)
+        {
+            if (g_testNodeCore[g_testStream[stream].srcNode] == core)
+            {
+                work |= testFeed(stream);
+                done &= (g_testFed[stream] >= TEST_FRAMES) ? TRUE : FALSE;
+            }
+        }
+
+        work |= testRunIsrs(core);
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            if (g_testNodeCore[node] != core)
+            {
+                continue;
+            }
+
+            while (hostCanTransmit(g_multican.canNode[node].node, &frame) != FALSE)
+            {
+                testSent(node, &frame);
+                (void)testRunIsrs(core);
+                work = TRUE;
+            }
+
+            if ((node == 1) || (node == 3) || (node >= 5))
+            {
+                done &= (g_testDelivered[node] >= TEST_FRAMES) ? TRUE : FALSE;
+            }
+        }
+
+        if (work != FALSE)
+        {
+            g_testBusyNs[core] += testThreadNanoseconds() - start;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL_PTR;
+}
+
+/* The default traffic with the node partitioning of this build, one thread per core owning nodes: every frame is
+ * sent once and in order on all its destinations without drops. Printed: frames sent per second of wall time and per
+ * second of the busiest core (thread CPU time of its working passes), the throughput the cores reach when each has a
+ * CPU of its own, whatever the number of host CPUs.
+ */
+static void testCoreScaling(void)
+{
+    pthread_t handle[GW_NUM_CORES];
+    uint64_t  start;
+    uint64_t  elapsed;
+    uint64_t  busiest = 0;
+    uint32    sent    = 0;
+    uint8     cores   = 0;
+    uint8     core;
+    uint8     node;
+
+    hostCanReset();
+    memset((void *)&g_hostModuleSrc, 0, sizeof(g_hostModuleSrc));
+    initMultican();
+    hostCanStart();
+
+    /* no receive moderation: the STM does not run, a batch below the watermark would wait for ever */
+    for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+    {
+        g_hostCoreIndex = g_testNodeCore[node];
+
+        if ((g_multican.bypassNodeMask & GW_NODE(node)) != 0)
+        {
+            /* the DMA bypass source keeps its Rx FIFO watermark, its ISR drains on every new frame all the same */
+            g_multican.rxModeration[node].watermark = 1;
+        }
+        else
+        {
+            HOST_CHECK(canGatewaySetRxModeration(node, 1, 0) != FALSE);
+        }
+    }
+
+    (void)testRunIsrs(0);
+    (void)testRunIsrs(1);
+    (void)testRunIsrs(2);
+
+    start = hostTestNanoseconds();
+
+    for (core = 0; core < GW_NUM_CORES; core++)
+    {
+        if (g_multican.coreNodeMask[core] != 0)
+        {
+            HOST_CHECK(pthread_create(&handle[core], NULL_PTR, testCore, (void *)(uintptr_t)core) == 0);
+            cores++;
+        }
+    }
+
+    for (core = 0; core < GW_NUM_CORES; core++)
+    {
+        if (g_multican.coreNodeMask[core] != 0)
+        {
+            pthread_join(handle[core], NULL_PTR);
+            busiest = (g_testBusyNs[core] > busiest) ? g_testBusyNs[core] : busiest;
+        }
+    }
+
+    elapsed = hostTestNanoseconds() - start;
+
+    for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+    {
+        sent += g_testDelivered[node];
+        HOST_CHECK_EQ(g_multican.stats[node].txDropped, 0);
+    }
+
+    for (core = 0; core < (GW_NUM_CORES * GW_NUM_CORES); core++)
+    {
+        HOST_CHECK_EQ(g_multican.xcoreDropped[core / GW_NUM_CORES][core % GW_NUM_CORES], 0);
+    }
+
+    HOST_CHECK_EQ(sent, 5 * TEST_FRAMES);
+
+    printf("Test_GwCores: %u core(s), %u frames sent, %.0f frames/s wall (%.1f ms), %.0f frames/s busiest core\n",
+           (unsigned)cores, (unsigned)sent, (double)sent * 1e9 / (double)elapsed, (double)elapsed / 1e6,
+           (double)sent * 1e9 / (double)busiest);
+
+    for (core = 0; core < GW_NUM_CORES; core++)
+    {
+        if (g_multican.coreNodeMask[core] != 0)
+        {
+            printf("  CPU%u nodes 0x%02X: %.1f ms busy\n", (unsigned)core, (unsigned)g_multican.coreNodeMask[core],
+                   (double)g_testBusyNs[core] / 1e6);
+        }
+    }
+}
+
+int main(void)
+{
+    testCoreScaling();
+
+    return hostTestResult("Test_GwCores");
+}
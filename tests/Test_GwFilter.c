@@ -0,0 +1,320 @@
+/**********************************************************************************************************************
+ * \file Test_GwFilter.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <string.h>
+#include "MULTICAN_GW_TX_FIFO.h"
+#include "HostCan.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_SRC_NODE               6                   /* Source node of the pairs of GwPairTable.h                  */
+#define TEST_FIFO1                  0xFF                /* Expected pair: non-matching frame, stored in Rx FIFO 1     */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Expected filter element: type, IDs and element configuration as written to the message RAM */
+typedef struct
+{
+    uint8  type;
+    uint32 id1;
+    uint32 id2;
+} TestElement;
+
+/* A received ID and the pair of its filter element (TEST_FIFO1: no element takes it) */
+typedef struct
+{
+    uint32  id;
+    boolean extended;
+    uint8   pair;
+} TestAcceptance;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern __thread uint32 g_hostCoreIndex;
+
+void gwRxTimeoutIsrCpu2(void);                          /* Gateway ISRs, not exported by MULTICAN_GW_TX_FIFO.h        */
+
+static const uint8 g_testNodeCore[NUMBER_OF_CAN_NODES] = {
+    GW_NODE0_CORE, GW_NODE1_CORE, GW_NODE2_CORE, GW_NODE3_CORE, GW_NODE4_CORE, GW_NODE5_CORE, GW_NODE6_CORE, GW_NODE7_CORE
+};
+
+/* Standard filter elements 0..3 and 28..31 of the source node */
+static const TestElement g_testStdElements[] = {
+    {IfxCan_FilterType_classic, 0x400, 0x7FF}, {IfxCan_FilterType_range, 0x410, 0x41F},
+    {IfxCan_FilterType_classic, 0x420, 0x7F8}, {IfxCan_FilterType_dualId, 0x431, 0x433},
+    {IfxCan_FilterType_classic, 0x600, 0x7FF}, {IfxCan_FilterType_classic, 0x601, 0x7FF},
+    {IfxCan_FilterType_classic, 0x602, 0x7FF}, {IfxCan_FilterType_classic, 0x603, 0x7FF}
+};
+
+/* Extended filter elements 0..3 of the source node */
+static const TestElement g_testExtElements[] = {
+    {IfxCan_FilterType_classic, 0x1000400, 0x1FFFFFFF}, {IfxCan_FilterType_range, 0x1000410, 0x100041F},
+    {IfxCan_FilterType_classic, 0x1000420, 0x1FFFFFF8}, {IfxCan_FilterType_dualId, 0x1000431, 0x1000433}
+};
+
+/* Acceptance filtering of the hardware: bounds of every range, mask and dual ID element and the IDs just outside */
+static const TestAcceptance g_testAcceptance[] = {
+    {0x400, FALSE, 3}, {0x401, FALSE, TEST_FIFO1},
+    {0x40F, FALSE, TEST_FIFO1}, {0x410, FALSE, 3}, {0x41F, FALSE, 3},
+    {0x420, FALSE, 3}, {0x427, FALSE, 3}, {0x428, FALSE, TEST_FIFO1}, {0x4A0, FALSE, TEST_FIFO1},
+    {0x431, FALSE, 3}, {0x432, FALSE, TEST_FIFO1}, {0x433, FALSE, 3},
+    {0x500, FALSE, 4}, {0x50C, FALSE, 5}, {0x517, FALSE, 6}, {0x603, FALSE, 7},
+    {0x610, FALSE, TEST_FIFO1}, {0x640, FALSE, TEST_FIFO1},
+    {0x1000400, TRUE, 3}, {0x1000401, TRUE, TEST_FIFO1}, {0x1000410, TRUE, 3}, {0x100041F, TRUE, 3},
+    {0x1000427, TRUE, 3}, {0x1000428, TRUE, TEST_FIFO1}, {0x1000433, TRUE, 3}, {0x1000432, TRUE, TEST_FIFO1},
+    {0x400, TRUE, TEST_FIFO1}
+};
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static void testInit(void)
+{
+    hostCanReset();
+    memset((void *)&g_hostModuleSrc, 0, sizeof(g_hostModuleSrc));
+    initMultican();
+    hostCanStart();
+}
+
+/* Run the gateway ISRs with a pending service request on the core owning their node until none is left */
+static void testRunIsrs(void)
+{
+    boolean ran;
+    uint8   node;
+
+    do
+    {
+        ran = FALSE;
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            if ((g_multican.doorbell[node] != NULL_PTR) && (g_multican.doorbell[node]->B.SRR != 0))
+            {
+                g_multican.doorbell[node]->B.SRR = 0;
+                g_hostCoreIndex                  = g_testNodeCore[node];
+                canGatewayForward(node);
+                ran = TRUE;
+            }
+        }
+    } while (ran != FALSE);
+}
+
+static void testFrame(HostCanFrame *frame, uint32 id, boolean extended)
+{
+    memset(frame, 0, sizeof(*frame));
+    frame->id       = id;
+    frame->extended = extended;
+    frame->dlc      = 8;
+    frame->data[0]  = (uint8)id;
+}
+
+/* Filter elements of the source node in the message RAM: every entry of the pairs became one element of its type,
+ * storing into Rx FIFO 0, numbered in table order; the overflow entries got none. The usage report counts them.
+ */
+static void testFilterElements(void)
+{
+    gwFilterUsageType *usage = &g_multican.filterUsage[TEST_SRC_NODE];
+    Ifx_CAN_N         *node;
+    uint32             base;
+    uint32             k;
+
+    testInit();
+    node = g_multican.canNode[TEST_SRC_NODE].node;
+    base = (uint32)(uintptr_t)hostCanModule(node);
+
+    HOST_CHECK_EQ(node->SIDFC.B.LSS, GW_MAX_STD_FILTERS);
+    HOST_CHECK_EQ(node->XIDFC.B.LSE, 4);
+    HOST_CHECK_EQ(node->GFC.B.ANFS, IfxCan_NonMatchingFrame_acceptToRxFifo1);
+    HOST_CHECK_EQ(node->GFC.B.ANFE, IfxCan_NonMatchingFrame_acceptToRxFifo1);
+
+    for (k = 0; k < 8; k++)
+    {
+        uint32          number  = (k < 4) ? k : (GW_MAX_STD_FILTERS - 8 + k);
+        Ifx_CAN_STDMSG *element = (Ifx_CAN_STDMSG *)(uintptr_t)(base + (node->SIDFC.B.FLSSA << 2) + (4 * number));
+
+        HOST_CHECK_EQ(element->S0.B.SFT, g_testStdElements[k].type);
+        HOST_CHECK_EQ(element->S0.B.SFEC, IfxCan_FilterElementConfiguration_storeInRxFifo0);
+        HOST_CHECK_EQ(element->S0.B.SFID1, g_testStdElements[k].id1);
+        HOST_CHECK_EQ(element->S0.B.SFID2, g_testStdElements[k].id2);
+    }
+
+    for (k = 0; k < 4; k++)
+    {
+        Ifx_CAN_EXTMSG *element = (Ifx_CAN_EXTMSG *)(uintptr_t)(base + (node->XIDFC.B.FLESA << 2) + (8 * k));
+
+        HOST_CHECK_EQ(element->F1.B.EFT, g_testExtElements[k].type);
+        HOST_CHECK_EQ(element->F0.B.EFEC, IfxCan_FilterElementConfiguration_storeInRxFifo0);
+        HOST_CHECK_EQ(element->F0.B.EFID1, g_testExtElements[k].id1);
+        HOST_CHECK_EQ(element->F1.B.EFID2, g_testExtElements[k].id2);
+    }
+
+    /* filter index -> pair of the elements, the overflow entries of pair 7 in the second stage */
+    HOST_CHECK_EQ(g_multican.stdFilterPair[TEST_SRC_NODE][0], 3);
+    HOST_CHECK_EQ(g_multican.stdFilterPair[TEST_SRC_NODE][4], 4);
+    HOST_CHECK_EQ(g_multican.stdFilterPair[TEST_SRC_NODE][27], 6);
+    HOST_CHECK_EQ(g_multican.stdFilterPair[TEST_SRC_NODE][31], 7);
+    HOST_CHECK_EQ(g_multican.extFilterPair[TEST_SRC_NODE][3], 3);
+    HOST_CHECK_EQ(g_multican.extFilterPair[TEST_SRC_NODE][4], GW_NO_PAIR);
+    HOST_CHECK_EQ(g_multican.catchAllPair[TEST_SRC_NODE], 3);
+
+    HOST_CHECK_EQ(usage->stdElements, GW_MAX_STD_FILTERS);
+    HOST_CHECK_EQ(usage->extElements, 4);
+    HOST_CHECK_EQ(usage->swFilters, 4);
+    HOST_CHECK_EQ(usage->ramBytesUsed, (GW_MAX_STD_FILTERS * 4) + (4 * 8));
+    HOST_CHECK_EQ(usage->ramBytesReserved, (GW_MAX_STD_FILTERS * 4) + (GW_MAX_EXT_FILTERS * 8));
+
+    for (k = 0; k < usage->swFilters; k++)
+    {
+        HOST_CHECK_EQ(g_multican.swFilter[TEST_SRC_NODE][k].pairIdx, 7);
+        HOST_CHECK(g_multican.swFilter[TEST_SRC_NODE][k].filter == &gwPairs[7].filters[4 + k]);
+    }
+
+    /* the configured pairs on the other nodes keep their elements */
+    HOST_CHECK_EQ(g_multican.filterUsage[2].stdElements, 2);
+    HOST_CHECK_EQ(g_multican.filterUsage[4].extElements, 1);
+    HOST_CHECK_EQ(g_multican.filterUsage[4].swFilters, 0);
+}
+
+/* Acceptance filtering by the compiled elements: the hardware stores a frame in Rx FIFO 0 with the filter index of
+ * the element of its pair, or as non-matching frame in Rx FIFO 1
+ */
+static void testHardwareAcceptance(void)
+{
+    HostCanFrame frame;
+    Ifx_CAN_N   *node;
+    uint32       i;
+
+    for (i = 0; i < (sizeof(g_testAcceptance) / sizeof(g_testAcceptance[0])); i++)
+    {
+        const TestAcceptance *expected = &g_testAcceptance[i];
+
+        testInit();
+        node = g_multican.canNode[TEST_SRC_NODE].node;
+        testFrame(&frame, expected->id, expected->extended);
+        HOST_CHECK(hostCanReceive(node, &frame) != FALSE);
+
+        if (expected->pair == TEST_FIFO1)
+        {
+            HOST_CHECK_EQ(IfxCan_Node_getRxFifo0FillLevel(node), 0);
+            HOST_CHECK_EQ(IfxCan_Node_getRxFifo1FillLevel(node), 1);
+        }
+        else
+        {
+            IfxCan_Can_Node  *canNode = &g_multican.canNode[TEST_SRC_NODE];
+            Ifx_CAN_RXMSG    *element = IfxCan_Node_getRxFifo0ElementAddress(node, canNode->messageRAM.baseAddress,
+                                                                             canNode->messageRAM.rxFifo0StartAddress,
+                                                                             IfxCan_RxBufferId_0);
+            uint8             pair    = expected->extended ? g_multican.extFilterPair[TEST_SRC_NODE][element->R1.B.FIDX]
+                                                           : g_multican.stdFilterPair[TEST_SRC_NODE][element->R1.B.FIDX];
+
+            HOST_CHECK_EQ(IfxCan_Node_getRxFifo0FillLevel(node), 1);
+            HOST_CHECK_EQ(pair, expected->pair);
+        }
+    }
+}
+
+/* Forward one frame of the source node (drained by the moderation timeout) and return the node it was sent on,
+ * NUMBER_OF_CAN_NODES if none. Every other node must stay silent.
+ */
+static uint8 testForward(uint32 id, boolean extended)
+{
+    HostCanFrame frame;
+    uint8        sentOn = NUMBER_OF_CAN_NODES;
+    uint8        node;
+
+    testFrame(&frame, id, extended);
+    HOST_CHECK(hostCanReceive(g_multican.canNode[TEST_SRC_NODE].node, &frame) != FALSE);
+    testRunIsrs();
+
+    MODULE_STM2.TIM0.U += IfxStm_getTicksFromMicroseconds(&MODULE_STM2, 2 * gwRxModeration[TEST_SRC_NODE].timeoutUs);
+    g_hostCoreIndex = g_testNodeCore[TEST_SRC_NODE];
+    gwRxTimeoutIsrCpu2();
+    testRunIsrs();
+
+    for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+    {
+        while (hostCanTransmit(g_multican.canNode[node].node, &frame) != FALSE)
+        {
+            HOST_CHECK_EQ(frame.id, id);
+            HOST_CHECK_EQ(frame.extended, extended);
+            HOST_CHECK_EQ(sentOn, NUMBER_OF_CAN_NODES);
+            sentOn = node;
+            testRunIsrs();
+        }
+    }
+
+    return sentOn;
+}
+
+/* Software second stage: the overflow entries of pair 7 (range, mask, dual ID, ID) only take the IDs they match from
+ * Rx FIFO 1; everything else the hardware accepts there as non-matching frame follows the catch-all pair (3, to N7)
+ */
+static void testSecondStage(void)
+{
+    static const uint32 taken[]    = {0x610, 0x618, 0x61F, 0x620, 0x627, 0x631, 0x633, 0x640};
+    static const uint32 rejected[] = {0x60F, 0x604, 0x628, 0x630, 0x632, 0x634, 0x641, 0x6E0};
+    uint32              i;
+
+    testInit();
+
+    for (i = 0; i < (sizeof(taken) / sizeof(taken[0])); i++)
+    {
+        HOST_CHECK_EQ(testForward(taken[i], FALSE), 3);
+    }
+
+    for (i = 0; i < (sizeof(rejected) / sizeof(rejected[0])); i++)
+    {
+        HOST_CHECK_EQ(testForward(rejected[i], FALSE), 7);
+    }
+
+    /* an extended frame with the ID of an overflow entry is no match of the standard entry */
+    HOST_CHECK_EQ(testForward(0x610, TRUE), 7);
+
+    /* frames of the hardware elements keep their pairs */
+    HOST_CHECK_EQ(testForward(0x603, FALSE), 3);
+    HOST_CHECK_EQ(testForward(0x415, FALSE), 7);
+    HOST_CHECK_EQ(testForward(0x1000432, TRUE), 7);
+
+    HOST_CHECK_EQ(g_multican.stats[3].txDropped, 0);
+    HOST_CHECK_EQ(g_multican.stats[7].txDropped, 0);
+}
+
+int main(void)
+{
+    testFilterElements();
+    testHardwareAcceptance();
+    testSecondStage();
+
+    return hostTestResult("Test_GwFilter");
+}
@@ -0,0 +1,259 @@
+/**********************************************************************************************************************
+ * \file Test_GwForward.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "MULTICAN_GW_TX_FIFO.h"
+#include "HostCan.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_FRAMES                 2000                /* Frames of the functional cases                             */
+#define TEST_BENCH_FRAMES           200000              /* Frames of the throughput run                               */
+#define TEST_BURST                  4                   /* Frames between two ISR passes, the moderation watermark    */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern __thread uint32 g_hostCoreIndex;
+
+void gwRxTimeoutIsrCpu1(void);                          /* Gateway ISRs, not exported by MULTICAN_GW_TX_FIFO.h        */
+
+static const uint8 g_testNodeCore[NUMBER_OF_CAN_NODES] = {
+    GW_NODE0_CORE, GW_NODE1_CORE, GW_NODE2_CORE, GW_NODE3_CORE, GW_NODE4_CORE, GW_NODE5_CORE, GW_NODE6_CORE, GW_NODE7_CORE
+};
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Fresh MCMCAN model and gateway */
+static void testInit(void)
+{
+    hostCanReset();
+    memset((void *)&g_hostModuleSrc, 0, sizeof(g_hostModuleSrc));
+    initMultican();
+    hostCanStart();
+}
+
+/* Run the gateway ISRs of every node with a pending service request, on the core owning the node, until no request
+ * is left (an ISR may raise the requests of other nodes: cross-core doorbells, transmission completed).
+ */
+static void testRunIsrs(void)
+{
+    boolean ran;
+    uint8   node;
+
+    do
+    {
+        ran = FALSE;
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            if ((g_multican.doorbell[node] != NULL_PTR) && (g_multican.doorbell[node]->B.SRR != 0))
+            {
+                g_multican.doorbell[node]->B.SRR = 0;
+                g_hostCoreIndex                  = g_testNodeCore[node];
+                canGatewayForward(node);
+                ran = TRUE;
+            }
+        }
+    } while (ran != FALSE);
+}
+
+static void testFrame(HostCanFrame *frame, uint32 id, boolean extended, uint32 seq)
+{
+    memset(frame, 0, sizeof(*frame));
+    frame->id       = id;
+    frame->extended = extended;
+    frame->dlc      = 8;
+    memcpy(frame->data, &seq, sizeof(seq));
+    frame->data[7]  = 0xA5;
+}
+
+/* Send every frame pending on a node (each completion runs the ISRs, which load the next frames); returns the frames
+ * sent and checks their ID, data length code and sequence (the payload of testFrame() at byte offset).
+ */
+static uint32 testDrainNode(uint8 node, uint32 id, uint8 dlc, uint32 offset, uint32 *nextSeq)
+{
+    HostCanFrame frame;
+    uint32       sent = 0;
+    uint32       seq;
+
+    while (hostCanTransmit(g_multican.canNode[node].node, &frame) != FALSE)
+    {
+        memcpy(&seq, &frame.data[offset], sizeof(seq));
+        HOST_CHECK_EQ(frame.id, id);
+        HOST_CHECK_EQ(frame.dlc, dlc);
+        HOST_CHECK_EQ(seq, *nextSeq);
+        HOST_CHECK_EQ(frame.data[offset + 7], 0xA5);
+        *nextSeq = seq + 1;
+        sent++;
+        testRunIsrs();
+    }
+
+    return sent;
+}
+
+/* Route 0x18FEF100 (extended) of node 4 to node 5 (both CPU1): every frame arrives once and in order. Node 0 to node 1
+ * is left to the container tests, it packs its frames into container frames.
+ */
+static void testSameCoreForward(void)
+{
+    HostCanFrame frame;
+    uint32       nextSeq = 0;
+    uint32       sent    = 0;
+    uint32       i;
+
+    testInit();
+
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        testFrame(&frame, 0x18FEF100, TRUE, i);
+        HOST_CHECK(hostCanReceive(g_multican.canNode[4].node, &frame) != FALSE);
+
+        if (((i + 1) % TEST_BURST) == 0)
+        {
+            testRunIsrs();
+            sent += testDrainNode(5, 0x18FEF100, 8, 0, &nextSeq);
+        }
+    }
+
+    HOST_CHECK_EQ(sent, TEST_FRAMES);
+    HOST_CHECK_EQ(g_multican.stats[5].txFrames, TEST_FRAMES);
+    HOST_CHECK_EQ(g_multican.stats[5].txDropped, 0);
+}
+
+/* Route 0x202 of node 2 (CPU2) to node 1 (CPU1, through the cross-core queue) and node 3 (CPU2), converted to a 12 byte
+ * CAN FD frame with the received bytes at 4..11
+ */
+static void testCrossCoreMulticast(void)
+{
+    HostCanFrame frame;
+    uint32       nextSeq1 = 0;
+    uint32       nextSeq3 = 0;
+    uint32       sent1    = 0;
+    uint32       sent3    = 0;
+    uint32       i;
+
+    testInit();
+
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        testFrame(&frame, 0x202, FALSE, i);
+        HOST_CHECK(hostCanReceive(g_multican.canNode[2].node, &frame) != FALSE);
+
+        if (((i + 1) % TEST_BURST) == 0)
+        {
+            testRunIsrs();
+            sent1 += testDrainNode(1, 0x202, 9, 4, &nextSeq1);
+            sent3 += testDrainNode(3, 0x202, 9, 4, &nextSeq3);
+        }
+    }
+
+    HOST_CHECK_EQ(sent1, TEST_FRAMES);
+    HOST_CHECK_EQ(sent3, TEST_FRAMES);
+    HOST_CHECK_EQ(g_multican.xcoreDropped[2][1], 0);
+}
+
+/* A frame of node 0 that no filter of its pairs and no route takes: accepted into Rx FIFO 1 as non-matching frame,
+ * node 0 has no catch-all pair, the frame is dropped and nothing is sent
+ */
+static void testUnroutedFrame(void)
+{
+    HostCanFrame frame;
+    uint8        node;
+
+    testInit();
+
+    testFrame(&frame, 0x555, FALSE, 0);
+    HOST_CHECK(hostCanReceive(g_multican.canNode[0].node, &frame) != FALSE);
+    HOST_CHECK_EQ(IfxCan_Node_getRxFifo1FillLevel(g_multican.canNode[0].node), 1);
+    testRunIsrs();                                      /* below the watermark: starts the timeout                    */
+    HOST_CHECK_EQ(IfxCan_Node_getRxFifo1FillLevel(g_multican.canNode[0].node), 1);
+
+    MODULE_STM1.TIM0.U += IfxStm_getTicksFromMicroseconds(&MODULE_STM1, 2 * gwRxModeration[0].timeoutUs);
+    g_hostCoreIndex = g_testNodeCore[0];
+    gwRxTimeoutIsrCpu1();
+    testRunIsrs();
+
+    HOST_CHECK_EQ(IfxCan_Node_getRxFifo1FillLevel(g_multican.canNode[0].node), 0);
+
+    for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+    {
+        HOST_CHECK(hostCanTransmit(g_multican.canNode[node].node, &frame) == FALSE);
+    }
+}
+
+/* Forwarding throughput of the gateway code on the host: frames received, routed, queued and loaded into Tx buffers
+ * per second, the MCMCAN model included. A relative figure to compare changes of the forwarding path, not the rate of
+ * the TC375.
+ */
+static void testForwardThroughput(void)
+{
+    HostCanFrame frame;
+    uint32       nextSeq = 0;
+    uint32       sent    = 0;
+    uint64_t     start;
+    uint64_t     elapsed;
+    uint32       i;
+
+    testInit();
+    start = hostTestNanoseconds();
+
+    for (i = 0; i < TEST_BENCH_FRAMES; i++)
+    {
+        testFrame(&frame, 0x18FEF100, TRUE, i);
+        (void)hostCanReceive(g_multican.canNode[4].node, &frame);
+
+        if (((i + 1) % TEST_BURST) == 0)
+        {
+            testRunIsrs();
+            sent += testDrainNode(5, 0x18FEF100, 8, 0, &nextSeq);
+        }
+    }
+
+    elapsed = hostTestNanoseconds() - start;
+
+    HOST_CHECK_EQ(sent, TEST_BENCH_FRAMES);
+    printf("Test_GwForward: %u frames forwarded in %.1f ms, %.0f frames/s, %.0f ns/frame\n", (unsigned)sent,
+           (double)elapsed / 1e6, (double)sent * 1e9 / (double)elapsed, (double)elapsed / (double)sent);
+}
+
+int main(void)
+{
+    testSameCoreForward();
+    testCrossCoreMulticast();
+    testUnroutedFrame();
+    testForwardThroughput();
+
+    return hostTestResult("Test_GwForward");
+}
@@ -0,0 +1,380 @@
+/**********************************************************************************************************************
+ * \file Test_GwMulticast.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "MULTICAN_GW_TX_FIFO.h"
+#include "HostCan.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_FRAMES                 3000                /* Frames per source of the fan-out case                      */
+#define TEST_ROUNDS                 20000               /* Rounds of the 8 node load                                  */
+#define TEST_BURST                  4                   /* Frames per source and round, the moderation watermark      */
+#define TEST_PDU_ID                 0x123               /* Classic frame packed into the containers received on N1    */
+#define TEST_MAX_STREAMS            4                   /* Streams (CAN IDs) checked per destination node             */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Frames of one CAN ID expected on a destination node: testFrame() payload at byte offset, in sequence */
+typedef struct
+{
+    uint32 id;
+    uint8  dlc;
+    uint8  offset;
+    uint32 nextSeq;
+} TestStream;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern __thread uint32 g_hostCoreIndex;
+
+static const uint8 g_testNodeCore[NUMBER_OF_CAN_NODES] = {
+    GW_NODE0_CORE, GW_NODE1_CORE, GW_NODE2_CORE, GW_NODE3_CORE, GW_NODE4_CORE, GW_NODE5_CORE, GW_NODE6_CORE, GW_NODE7_CORE
+};
+
+static TestStream g_testStream[NUMBER_OF_CAN_NODES][TEST_MAX_STREAMS];
+static uint32     g_testContainers;                     /* Container frames sent on N1                                */
+static uint64_t   g_testCoreNs[GW_NUM_CORES];           /* Time spent in the gateway ISRs per core                    */
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static void testInit(void)
+{
+    hostCanReset();
+    memset((void *)&g_hostModuleSrc, 0, sizeof(g_hostModuleSrc));
+    memset(g_testStream, 0, sizeof(g_testStream));
+    memset(g_testCoreNs, 0, sizeof(g_testCoreNs));
+    g_testContainers = 0;
+    initMultican();
+    hostCanStart();
+}
+
+static void testExpect(uint8 node, uint32 id, uint8 dlc, uint8 offset)
+{
+    uint8 k;
+
+    for (k = 0; (k < TEST_MAX_STREAMS) && (g_testStream[node][k].id != 0); k++)
+    {
+    }
+
+    HOST_CHECK(k < TEST_MAX_STREAMS);
+    if (k < TEST_MAX_STREAMS)
+    {
+        g_testStream[node][k].id     = id;
+        g_testStream[node][k].dlc    = dlc;
+        g_testStream[node][k].offset = offset;
+    }
+}
+
+/* Run the gateway ISRs with a pending service request on the core owning their node until none is left; the time
+ * spent in them is added to the core.
+ */
+static void testRunIsrs(void)
+{
+    boolean  ran;
+    uint64_t start;
+    uint8    node;
+
+    do
+    {
+        ran = FALSE;
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            if ((g_multican.doorbell[node] != NULL_PTR) && (g_multican.doorbell[node]->B.SRR != 0))
+            {
+                g_multican.doorbell[node]->B.SRR = 0;
+                g_hostCoreIndex                  = g_testNodeCore[node];
+                start                            = hostTestNanoseconds();
+                canGatewayForward(node);
+                g_testCoreNs[g_testNodeCore[node]] += hostTestNanoseconds() - start;
+                ran = TRUE;
+            }
+        }
+    } while (ran != FALSE);
+}
+
+static void testFrame(HostCanFrame *frame, uint32 id, boolean extended, uint32 seq)
+{
+    memset(frame, 0, sizeof(*frame));
+    frame->id       = id;
+    frame->extended = extended;
+    frame->dlc      = 8;
+    memcpy(frame->data, &seq, sizeof(seq));
+    frame->data[7]  = 0xA5;
+}
+
+/* Container frame as sent by the CAN FD side: PDUs of TEST_PDU_ID with the sequence numbers seq..seq+count-1 */
+static void testContainer(HostCanFrame *frame, uint32 seq, uint8 count)
+{
+    uint32 pos = GW_CONTAINER_HEADER_SIZE;
+    uint8  i;
+
+    memset(frame, 0, sizeof(*frame));
+    frame->id            = gwContainers[0].containerId;
+    frame->fd            = TRUE;
+    frame->bitRateSwitch = TRUE;
+    frame->dlc           = IfxCan_DataLengthCode_64;
+    frame->data[0]       = count;
+
+    for (i = 0; i < count; i++)
+    {
+        uint32 pduSeq = seq + i;
+
+        frame->data[pos + 0] = (uint8)TEST_PDU_ID;
+        frame->data[pos + 1] = (uint8)(TEST_PDU_ID >> 8);
+        frame->data[pos + 4] = 8;
+        memcpy(&frame->data[pos + GW_CONTAINER_PDU_HEADER], &pduSeq, sizeof(pduSeq));
+        frame->data[pos + GW_CONTAINER_PDU_HEADER + 7] = 0xA5;
+        pos += GW_CONTAINER_PDU_HEADER + 8;
+    }
+}
+
+/* Send everything pending on every node (each completion runs the ISRs, which load the next frames) and check each
+ * frame against the streams of its node; containers on N1 are only counted. Returns the frames sent.
+ */
+static uint32 testDrainAll(void)
+{
+    HostCanFrame frame;
+    uint32       sent = 0;
+    boolean      any;
+    uint8        node;
+    uint8        k;
+
+    do
+    {
+        any = FALSE;
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            while (hostCanTransmit(g_multican.canNode[node].node, &frame) != FALSE)
+            {
+                any = TRUE;
+                sent++;
+
+                if ((node == gwContainers[0].fdNode) && (frame.id == gwContainers[0].containerId))
+                {
+                    g_testContainers++;
+                }
+                else
+                {
+                    for (k = 0; (k < TEST_MAX_STREAMS) && (g_testStream[node][k].id != frame.id); k++)
+                    {
+                    }
+
+                    HOST_CHECK(k < TEST_MAX_STREAMS);
+                    if (k < TEST_MAX_STREAMS)
+                    {
+                        TestStream *stream = &g_testStream[node][k];
+                        uint32      seq;
+
+                        memcpy(&seq, &frame.data[stream->offset], sizeof(seq));
+                        HOST_CHECK_EQ(frame.dlc, stream->dlc);
+                        HOST_CHECK_EQ(seq, stream->nextSeq);
+                        HOST_CHECK_EQ(frame.data[stream->offset + 7], 0xA5);
+                        stream->nextSeq = seq + 1;
+                    }
+                }
+
+                testRunIsrs();
+            }
+        }
+    } while (any != FALSE);
+
+    return sent;
+}
+
+/* Frames of the pool free lists, per core: all GW_FRAME_POOL_SIZE once every multicast copy is sent */
+static uint32 testFreeFrames(uint8 core)
+{
+    uint32 count = 0;
+    uint8  frame = g_multican.freeFrame[core];
+
+    while ((frame != GW_NO_FRAME) && (count <= GW_FRAME_POOL_SIZE))
+    {
+        HOST_CHECK_EQ(g_multican.frame[frame].refCount, 0);
+        frame = g_multican.frame[frame].nextFree;
+        count++;
+    }
+
+    return count;
+}
+
+/* Pair 4 -> 5 | 6 | 7: each frame is received once (one Rx FIFO element, one filter) and sent on all three nodes,
+ * node 5 on the same core (CPU1), nodes 6 and 7 through the cross-core queue to CPU2; standard and extended filters
+ */
+static void testFanOut(void)
+{
+    HostCanFrame frame;
+    uint32       i;
+    uint8        node;
+    uint8        core;
+
+    testInit();
+
+    for (node = 5; node <= 7; node++)
+    {
+        testExpect(node, 0x300, 8, 0);
+        testExpect(node, 0x18FF1234, 8, 0);
+    }
+
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        boolean extended = ((i / TEST_BURST) % 2 != 0) ? TRUE : FALSE;
+
+        testFrame(&frame, extended ? 0x18FF1234 : 0x300, extended, (i / (2 * TEST_BURST)) * TEST_BURST + (i % TEST_BURST));
+        HOST_CHECK(hostCanReceive(g_multican.canNode[4].node, &frame) != FALSE);
+
+        if (((i + 1) % TEST_BURST) == 0)
+        {
+            testRunIsrs();
+            (void)testDrainAll();
+        }
+    }
+
+    HOST_CHECK_EQ(g_multican.stats[4].rxFrames, TEST_FRAMES);
+
+    for (node = 5; node <= 7; node++)
+    {
+        HOST_CHECK_EQ(g_multican.stats[node].txFrames, TEST_FRAMES);
+        HOST_CHECK_EQ(g_multican.stats[node].txDropped, 0);
+        HOST_CHECK_EQ(g_testStream[node][0].nextSeq + g_testStream[node][1].nextSeq, TEST_FRAMES);
+    }
+
+    HOST_CHECK_EQ(g_multican.stats[6].xcoreFrames + g_multican.stats[7].xcoreFrames, 2 * TEST_FRAMES);
+
+    for (core = 0; core < GW_NUM_CORES; core++)
+    {
+        HOST_CHECK_EQ(testFreeFrames(core), GW_FRAME_POOL_SIZE);
+    }
+}
+
+/* All 8 nodes at once: N4 multicasts 0x300 to N5/N6/N7, N2 sends 0x205 to N3 and route 0x202 (CAN FD) to N1 and N3,
+ * N0 packs 0x100 into containers on N1 and N1 unpacks received containers to N0. Every frame arrives once and in order;
+ * the gateway ISR time per core gives the frames/s each core handles (host figures, printed).
+ */
+static void testEightNodeLoad(void)
+{
+    HostCanFrame frame;
+    uint32       round;
+    uint32       k;
+    uint8        node;
+    uint8        core;
+    uint32       coreRx[GW_NUM_CORES] = {0};
+    uint32       coreTx[GW_NUM_CORES] = {0};
+
+    testInit();
+
+    for (node = 5; node <= 7; node++)
+    {
+        testExpect(node, 0x300, 8, 0);
+    }
+
+    testExpect(3, 0x205, 8, 0);
+    testExpect(3, 0x202, 9, 4);
+    testExpect(1, 0x202, 9, 4);
+    testExpect(0, TEST_PDU_ID, 8, 0);
+
+    for (round = 0; round < TEST_ROUNDS; round++)
+    {
+        for (k = 0; k < TEST_BURST; k++)
+        {
+            uint32 seq = (round * TEST_BURST) + k;
+
+            testFrame(&frame, 0x300, FALSE, seq);
+            HOST_CHECK(hostCanReceive(g_multican.canNode[4].node, &frame) != FALSE);
+            testFrame(&frame, ((k % 2) == 0) ? 0x205 : 0x202, FALSE, (round * (TEST_BURST / 2)) + (k / 2));
+            HOST_CHECK(hostCanReceive(g_multican.canNode[2].node, &frame) != FALSE);
+            testFrame(&frame, 0x100, FALSE, seq);
+            HOST_CHECK(hostCanReceive(g_multican.canNode[0].node, &frame) != FALSE);
+            testContainer(&frame, seq * 4, 4);
+            HOST_CHECK(hostCanReceive(g_multican.canNode[1].node, &frame) != FALSE);
+        }
+
+        testRunIsrs();
+        (void)testDrainAll();
+    }
+
+    /* time trigger: send the last partly filled container */
+    for (k = 0; k < gwContainers[0].flushTimeMs; k++)
+    {
+        g_hostCoreIndex = g_testNodeCore[gwContainers[0].classicNode];
+        canGatewayContainerTick();
+    }
+
+    testRunIsrs();
+    (void)testDrainAll();
+
+    for (node = 5; node <= 7; node++)
+    {
+        HOST_CHECK_EQ(g_testStream[node][0].nextSeq, TEST_ROUNDS * TEST_BURST);
+    }
+
+    HOST_CHECK_EQ(g_testStream[3][0].nextSeq, TEST_ROUNDS * TEST_BURST / 2);
+    HOST_CHECK_EQ(g_testStream[3][1].nextSeq, TEST_ROUNDS * TEST_BURST / 2);
+    HOST_CHECK_EQ(g_testStream[1][0].nextSeq, TEST_ROUNDS * TEST_BURST / 2);
+    HOST_CHECK_EQ(g_testStream[0][0].nextSeq, TEST_ROUNDS * TEST_BURST * 4);
+    HOST_CHECK_EQ(g_multican.stats[0].containerPdus, TEST_ROUNDS * TEST_BURST);
+    HOST_CHECK_EQ(g_multican.stats[0].containerFrames, g_testContainers);
+
+    for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+    {
+        HOST_CHECK_EQ(g_multican.stats[node].txDropped, 0);
+        coreRx[g_testNodeCore[node]] += g_multican.stats[node].rxFrames;
+        coreTx[g_testNodeCore[node]] += g_multican.stats[node].txFrames;
+    }
+
+    for (core = 0; core < GW_NUM_CORES; core++)
+    {
+        HOST_CHECK_EQ(testFreeFrames(core), GW_FRAME_POOL_SIZE);
+
+        if (g_testCoreNs[core] != 0)
+        {
+            printf("Test_GwMulticast: CPU%u %u frames received, %u sent in %.1f ms of gateway ISRs: %.0f received "
+                   "frames/s, %.0f sent frames/s\n", (unsigned)core, (unsigned)coreRx[core], (unsigned)coreTx[core],
+                   (double)g_testCoreNs[core] / 1e6, (double)coreRx[core] * 1e9 / (double)g_testCoreNs[core],
+                   (double)coreTx[core] * 1e9 / (double)g_testCoreNs[core]);
+        }
+    }
+}
+
+int main(void)
+{
+    testFanOut();
+    testEightNodeLoad();
+
+    return hostTestResult("Test_GwMulticast");
+}
@@ -0,0 +1,135 @@
+/**********************************************************************************************************************
+ * \file Test_GwRoute.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "MULTICAN_GW_ROUTE.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Routing table of MULTICAN_GW_ROUTE.c: every listed route is found with its own values */
+static void testConfiguredRoutes(void)
+{
+    const gwRouteType *route;
+
+    route = canGatewayLookupRoute(0, FALSE, 0x101);
+    HOST_CHECK(route != NULL_PTR);
+    if (route != NULL_PTR)
+    {
+        HOST_CHECK_EQ(route->srcNode, 0);
+        HOST_CHECK_EQ(route->canId, 0x101);
+        HOST_CHECK_EQ(route->dstNodeMask, GW_NODE(1));
+        HOST_CHECK_EQ(route->newId, 0x181);
+        HOST_CHECK(route->transform == NULL_PTR);
+    }
+
+    route = canGatewayLookupRoute(2, FALSE, 0x202);
+    HOST_CHECK(route != NULL_PTR);
+    if (route != NULL_PTR)
+    {
+        HOST_CHECK_EQ(route->srcNode, 2);
+        HOST_CHECK_EQ(route->dstNodeMask, GW_NODE(1) | GW_NODE(3));
+        HOST_CHECK_EQ(route->newId, GW_ID_UNCHANGED);
+        HOST_CHECK(route->transform != NULL_PTR);
+    }
+
+    route = canGatewayLookupRoute(4, TRUE, 0x18FEF100);
+    HOST_CHECK(route != NULL_PTR);
+    if (route != NULL_PTR)
+    {
+        HOST_CHECK_EQ(route->srcNode, 4);
+        HOST_CHECK_EQ(route->canId, 0x18FEF100);
+        HOST_CHECK_EQ(route->dstNodeMask, GW_NODE(5));
+    }
+
+    /* the routing table passes its own sanity checks (sorted keys, transforms inside the data field) */
+    canGatewayCheckRoutes();
+}
+
+/* Every standard ID of every node: a route is only returned for its own (srcNode, ID), never for another one */
+static void testStandardIdSpace(void)
+{
+    uint32 found = 0;
+    uint8  node;
+    uint32 id;
+
+    for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+    {
+        for (id = 0; id < GW_STD_ID_COUNT; id++)
+        {
+            const gwRouteType *route = canGatewayLookupRoute(node, FALSE, id);
+
+            if (route != NULL_PTR)
+            {
+                HOST_CHECK_EQ(route->srcNode, node);
+                HOST_CHECK_EQ(route->canId, id);
+                found++;
+            }
+        }
+    }
+
+    HOST_CHECK_EQ(found, 2);
+}
+
+/* Extended lookups: exact (srcNode, ID) match only, the standard table is never consulted for extended frames */
+static void testExtendedIds(void)
+{
+    uint8 node;
+
+    HOST_CHECK(canGatewayLookupRoute(4, TRUE, 0x18FEF0FF) == NULL_PTR);
+    HOST_CHECK(canGatewayLookupRoute(4, TRUE, 0x18FEF101) == NULL_PTR);
+    HOST_CHECK(canGatewayLookupRoute(4, TRUE, 0x00000000) == NULL_PTR);
+    HOST_CHECK(canGatewayLookupRoute(4, TRUE, 0x1FFFFFFF) == NULL_PTR);
+
+    for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+    {
+        if (node != 4)
+        {
+            HOST_CHECK(canGatewayLookupRoute(node, TRUE, 0x18FEF100) == NULL_PTR);
+        }
+    }
+
+    /* same numeric ID, other frame format */
+    HOST_CHECK(canGatewayLookupRoute(0, TRUE, 0x101) == NULL_PTR);
+    HOST_CHECK(canGatewayLookupRoute(2, TRUE, 0x202) == NULL_PTR);
+    HOST_CHECK(canGatewayLookupRoute(4, FALSE, 0x18FEF100 & (GW_STD_ID_COUNT - 1)) == NULL_PTR);
+
+    /* only the 29 ID bits take part in the key */
+    HOST_CHECK(canGatewayLookupRoute(4, TRUE, 0xE0000000U | 0x18FEF100) == canGatewayLookupRoute(4, TRUE, 0x18FEF100));
+}
+
+int main(void)
+{
+    testConfiguredRoutes();
+    testStandardIdSpace();
+    testExtendedIds();
+
+    return hostTestResult("Test_GwRoute");
+}
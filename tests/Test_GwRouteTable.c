@@ -0,0 +1,276 @@
+/**********************************************************************************************************************
+ * \file Test_GwRouteTable.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include "MULTICAN_GW_ROUTE.h"
+#include "HostTest.h"
+
+/* The generated routing table MULTICAN_GW_ROUTE.c is built with, expanded here once more as the expected routes */
+#include GW_ROUTE_TABLE_FILE
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_ROUTE(src, id, dst, newId, handler, xf)    {src, dst, id, newId, handler, xf},
+#define TEST_COUNT(src, id, dst, newId, handler, xf)    +1
+
+#define TEST_NUM_STD_ROUTES         (0 GW_STD_ROUTE_TABLE(TEST_COUNT))
+#define TEST_NUM_EXT_ROUTES         (0 GW_EXT_ROUTE_TABLE(TEST_COUNT))
+#define TEST_RANDOM_KEYS            200000              /* Random extended keys of the miss sweep                     */
+#define TEST_BENCH_ROUNDS           2000                /* Passes over the lookup sets of the timing                  */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static const gwRouteType g_testStdRoutes[] = {GW_STD_ROUTE_TABLE(TEST_ROUTE)};
+static const gwRouteType g_testExtRoutes[] = {GW_EXT_ROUTE_TABLE(TEST_ROUTE)};
+
+/* Expected standard lookup: route index + 1 per (node, ID), 0 = no route */
+static uint16 g_testStdIndex[NUMBER_OF_CAN_NODES][GW_STD_ID_COUNT];
+
+static volatile uintptr_t g_testSink;                   /* Keeps the timed lookups                                    */
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static uint32 testRandom(uint32 *state)
+{
+    *state = (*state * 1664525U) + 1013904223U;
+    return *state;
+}
+
+/* Expected extended route of (node, ID), NULL_PTR if the generated table has none */
+static const gwRouteType *testExpectedExt(uint8 node, uint32 canId)
+{
+    uint32 i;
+
+    for (i = 0; i < TEST_NUM_EXT_ROUTES; i++)
+    {
+        if ((g_testExtRoutes[i].srcNode == node) && (g_testExtRoutes[i].canId == canId))
+        {
+            return &g_testExtRoutes[i];
+        }
+    }
+
+    return NULL_PTR;
+}
+
+static void testCheckRoute(const gwRouteType *route, const gwRouteType *expected)
+{
+    HOST_CHECK(route != NULL_PTR);
+
+    if (route != NULL_PTR)
+    {
+        HOST_CHECK_EQ(route->srcNode, expected->srcNode);
+        HOST_CHECK_EQ(route->canId, expected->canId);
+        HOST_CHECK_EQ(route->dstNodeMask, expected->dstNodeMask);
+        HOST_CHECK_EQ(route->newId, expected->newId);
+        HOST_CHECK_EQ(route->transform != NULL_PTR, expected->transform != NULL_PTR);
+    }
+}
+
+/* Extended lookup of (node, ID) against the generated table: the route if it has one, NULL_PTR otherwise */
+static void testCheckExt(uint8 node, uint32 canId)
+{
+    const gwRouteType *expected = testExpectedExt(node, canId);
+    const gwRouteType *route    = canGatewayLookupRoute(node, TRUE, canId);
+
+    if (expected != NULL_PTR)
+    {
+        testCheckRoute(route, expected);
+    }
+    else
+    {
+        HOST_CHECK(route == NULL_PTR);
+    }
+}
+
+/* Every generated route is found with its own values, the table passes its sanity checks */
+static void testHits(void)
+{
+    uint32 i;
+
+    HOST_CHECK((TEST_NUM_STD_ROUTES + TEST_NUM_EXT_ROUTES) >= 500);
+
+    for (i = 0; i < TEST_NUM_STD_ROUTES; i++)
+    {
+        testCheckRoute(canGatewayLookupRoute(g_testStdRoutes[i].srcNode, FALSE, g_testStdRoutes[i].canId), &g_testStdRoutes[i]);
+    }
+
+    for (i = 0; i < TEST_NUM_EXT_ROUTES; i++)
+    {
+        testCheckRoute(canGatewayLookupRoute(g_testExtRoutes[i].srcNode, TRUE, g_testExtRoutes[i].canId), &g_testExtRoutes[i]);
+    }
+
+    canGatewayCheckRoutes();
+}
+
+/* The whole standard ID space of every node: a route exactly where the table has one */
+static void testStandardMisses(void)
+{
+    uint32 found = 0;
+    uint8  node;
+    uint32 id;
+
+    for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+    {
+        for (id = 0; id < GW_STD_ID_COUNT; id++)
+        {
+            const gwRouteType *route = canGatewayLookupRoute(node, FALSE, id);
+
+            if (g_testStdIndex[node][id] != 0)
+            {
+                testCheckRoute(route, &g_testStdRoutes[g_testStdIndex[node][id] - 1]);
+                found++;
+            }
+            else
+            {
+                HOST_CHECK(route == NULL_PTR);
+            }
+        }
+    }
+
+    HOST_CHECK_EQ(found, TEST_NUM_STD_ROUTES);
+}
+
+/* Extended misses: the neighbours of every key, every key on the other nodes and in the other frame format, and random
+ * keys, each checked against the expected table (the binary search must neither miss a route nor invent one)
+ */
+static void testExtendedMisses(void)
+{
+    uint32 state = 1;
+    uint32 i;
+    uint8  node;
+
+    for (i = 0; i < TEST_NUM_EXT_ROUTES; i++)
+    {
+        const gwRouteType *route = &g_testExtRoutes[i];
+
+        testCheckExt(route->srcNode, route->canId - 1);
+        testCheckExt(route->srcNode, route->canId + 1);
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            testCheckExt(node, route->canId);
+        }
+
+        /* the same ID as a standard frame only finds a standard route */
+        if (g_testStdIndex[route->srcNode][route->canId & (GW_STD_ID_COUNT - 1)] == 0)
+        {
+            HOST_CHECK(canGatewayLookupRoute(route->srcNode, FALSE, route->canId & (GW_STD_ID_COUNT - 1)) == NULL_PTR);
+        }
+    }
+
+    for (i = 0; i < TEST_RANDOM_KEYS; i++)
+    {
+        uint8  n  = (uint8)(testRandom(&state) % NUMBER_OF_CAN_NODES);
+        uint32 id = testRandom(&state) & 0x1FFFFFFFU;
+
+        testCheckExt(n, id);
+    }
+}
+
+/* Lookup cost on the host with the generated table: standard hit/miss (one indexed load) and extended hit/miss (binary
+ * search over all extended keys). Relative figures, printed.
+ */
+static void testLookupTime(void)
+{
+    uint64_t  start;
+    double    stdHit;
+    double    stdMiss;
+    double    extHit;
+    double    extMiss;
+    uintptr_t sink = 0;
+    uint32    round;
+    uint32    i;
+
+    start = hostTestNanoseconds();
+    for (round = 0; round < TEST_BENCH_ROUNDS; round++)
+    {
+        for (i = 0; i < TEST_NUM_STD_ROUTES; i++)
+        {
+            sink += (uintptr_t)canGatewayLookupRoute(g_testStdRoutes[i].srcNode, FALSE, g_testStdRoutes[i].canId);
+        }
+    }
+    stdHit = (double)(hostTestNanoseconds() - start) / ((double)TEST_BENCH_ROUNDS * TEST_NUM_STD_ROUTES);
+
+    start = hostTestNanoseconds();
+    for (round = 0; round < TEST_BENCH_ROUNDS; round++)
+    {
+        for (i = 0; i < TEST_NUM_STD_ROUTES; i++)
+        {
+            sink += (uintptr_t)canGatewayLookupRoute(g_testStdRoutes[i].srcNode, FALSE, g_testStdRoutes[i].canId ^ 0x400U);
+        }
+    }
+    stdMiss = (double)(hostTestNanoseconds() - start) / ((double)TEST_BENCH_ROUNDS * TEST_NUM_STD_ROUTES);
+
+    start = hostTestNanoseconds();
+    for (round = 0; round < TEST_BENCH_ROUNDS; round++)
+    {
+        for (i = 0; i < TEST_NUM_EXT_ROUTES; i++)
+        {
+            sink += (uintptr_t)canGatewayLookupRoute(g_testExtRoutes[i].srcNode, TRUE, g_testExtRoutes[i].canId);
+        }
+    }
+    extHit = (double)(hostTestNanoseconds() - start) / ((double)TEST_BENCH_ROUNDS * TEST_NUM_EXT_ROUTES);
+
+    start = hostTestNanoseconds();
+    for (round = 0; round < TEST_BENCH_ROUNDS; round++)
+    {
+        for (i = 0; i < TEST_NUM_EXT_ROUTES; i++)
+        {
+            sink += (uintptr_t)canGatewayLookupRoute(g_testExtRoutes[i].srcNode, TRUE, g_testExtRoutes[i].canId + 1);
+        }
+    }
+    extMiss = (double)(hostTestNanoseconds() - start) / ((double)TEST_BENCH_ROUNDS * TEST_NUM_EXT_ROUTES);
+
+    g_testSink = sink;
+
+    printf("Test_GwRouteTable: %u standard + %u extended routes, lookup standard hit %.1f ns, miss %.1f ns, "
+           "extended hit %.1f ns, miss %.1f ns\n", (unsigned)TEST_NUM_STD_ROUTES, (unsigned)TEST_NUM_EXT_ROUTES,
+           stdHit, stdMiss, extHit, extMiss);
+}
+
+int main(void)
+{
+    uint32 i;
+
+    for (i = 0; i < TEST_NUM_STD_ROUTES; i++)
+    {
+        g_testStdIndex[g_testStdRoutes[i].srcNode][g_testStdRoutes[i].canId] = (uint16)(i + 1);
+    }
+
+    testHits();
+    testStandardMisses();
+    testExtendedMisses();
+    testLookupTime();
+
+    return hostTestResult("Test_GwRouteTable");
+}
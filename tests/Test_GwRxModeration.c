@@ -0,0 +1,310 @@
+/**********************************************************************************************************************
+ * \file Test_GwRxModeration.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "MULTICAN_GW_TX_FIFO.h"
+#include "HostCan.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_TRACE_US               1000000             /* Length of every trace                                      */
+#define TEST_FRAME_US               270                 /* 8 byte classic frame at 500 kbit/s: closest frame spacing  */
+#define TEST_TICKS_PER_US           (HOST_STM_FREQUENCY / 1000000U)
+#define TEST_SRC_NODE               4                   /* Route 0x18FEF100 -> node 5, both CPU1 (STM1)              */
+#define TEST_DST_NODE               5
+#define TEST_SETTINGS               6
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef enum
+{
+    TestTrace_periodic,                                 /* One frame every 300 us                                     */
+    TestTrace_bursty,                                   /* 8 back to back frames every 5 ms                           */
+    TestTrace_random,                                   /* Random gaps of 270..870 us                                 */
+    TestTrace_count
+} TestTrace;
+
+typedef struct
+{
+    uint8  watermark;
+    uint16 timeoutUs;
+} TestSetting;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern __thread uint32  g_hostCoreIndex;
+extern __thread boolean g_hostInterruptsEnabled;
+
+void gwRxTimeoutIsrCpu1(void);                          /* Gateway ISRs, not exported by MULTICAN_GW_TX_FIFO.h        */
+
+static const uint8 g_testNodeCore[NUMBER_OF_CAN_NODES] = {
+    GW_NODE0_CORE, GW_NODE1_CORE, GW_NODE2_CORE, GW_NODE3_CORE, GW_NODE4_CORE, GW_NODE5_CORE, GW_NODE6_CORE, GW_NODE7_CORE
+};
+
+static const char *const g_testTraceName[TestTrace_count] = {"periodic", "bursty", "random"};
+
+static const TestSetting g_testSetting[TEST_SETTINGS] = {{1, 0}, {2, 500}, {4, 500}, {4, 2000}, {8, 2000}, {8, 5000}};
+
+static uint32 g_testIsrRuns;                            /* Gateway ISR runs of the source node and moderation timeouts */
+static uint32 g_testSeed;
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Fresh MCMCAN model and gateway, STM1 at 0 */
+static void testInit(void)
+{
+    hostCanReset();
+    memset((void *)&g_hostModuleSrc, 0, sizeof(g_hostModuleSrc));
+    MODULE_STM1.TIM0.U = 0;
+    initMultican();
+    hostCanStart();
+
+    /* initMultican() leaves the statistics to the startup code (zeroed .bss) */
+    memset(g_multican.stats, 0, sizeof(g_multican.stats));
+}
+
+/* Run the gateway ISRs of every node with a pending and enabled service request, on the core owning the node, until
+ * no request is left; counts the runs of the source node
+ */
+static void testRunIsrs(void)
+{
+    boolean ran;
+    uint8   node;
+
+    do
+    {
+        ran = FALSE;
+
+        for (node = 0; node < NUMBER_OF_CAN_NODES; node++)
+        {
+            volatile Ifx_SRC_SRCR *doorbell = g_multican.doorbell[node];
+
+            if ((doorbell != NULL_PTR) && (doorbell->B.SRR != 0) && (doorbell->B.SRE != 0))
+            {
+                doorbell->B.SRR = 0;
+                g_hostCoreIndex = g_testNodeCore[node];
+                canGatewayForward(node);
+                ran             = TRUE;
+                g_testIsrRuns  += (node == TEST_SRC_NODE) ? 1 : 0;
+            }
+        }
+    } while (ran != FALSE);
+}
+
+static uint32 testRandom(uint32 range)
+{
+    g_testSeed = g_testSeed * 1103515245U + 12345U;
+
+    return (g_testSeed >> 16) % range;
+}
+
+/* Arrival of the frame after the one at `now` (us), TEST_TRACE_US at the end of the trace */
+static uint32 testNextArrival(TestTrace trace, uint32 now, uint32 index)
+{
+    uint32 next;
+
+    switch (trace)
+    {
+    case TestTrace_periodic:
+        next = now + 300;
+        break;
+    case TestTrace_bursty:
+        next = ((index % 8) == 7) ? (now - (7 * TEST_FRAME_US) + 5000) : now + TEST_FRAME_US;
+        break;
+    default:
+        next = now + TEST_FRAME_US + testRandom(601);
+        break;
+    }
+
+    return (next < TEST_TRACE_US) ? next : TEST_TRACE_US;
+}
+
+/* Take every frame the gateway loaded into the Tx buffers of the destination node: its latency is the time since it
+ * was received (the payload)
+ */
+static void testDrainDestination(uint32 *sent, uint32 *worstUs, uint64_t *totalUs)
+{
+    HostCanFrame frame;
+    uint32       arrival;
+    uint32       latency;
+
+    while (hostCanTransmit(g_multican.canNode[TEST_DST_NODE].node, &frame) != FALSE)
+    {
+        memcpy(&arrival, frame.data, sizeof(arrival));
+        latency   = (MODULE_STM1.TIM0.U - arrival) / TEST_TICKS_PER_US;
+        *totalUs += latency;
+        *worstUs  = (latency > *worstUs) ? latency : *worstUs;
+        (*sent)++;
+        testRunIsrs();
+    }
+}
+
+/* Play one trace on the source node with one moderation setting, set at runtime from task context on CPU1: STM1 jumps
+ * from event to event, the next frame or the armed moderation compare, whichever is first. The destination bus takes
+ * every frame at once, so the latency printed is the one the moderation adds. Every frame is forwarded, no frame waits
+ * longer than the timeout and without moderation every frame takes one interrupt.
+ */
+static void testPlay(TestTrace trace, const TestSetting *setting)
+{
+    HostCanFrame frame;
+    uint32       arrivalUs = 0;
+    uint32       received  = 0;
+    uint32       sent      = 0;
+    uint32       timeouts  = 0;
+    uint32       worstUs   = 0;
+    uint64_t     totalUs   = 0;
+    uint32       compare;
+    uint32       now;
+
+    testInit();
+    g_testSeed    = 12345;
+    g_testIsrRuns = 0;
+
+    g_hostCoreIndex         = GW_NODE4_CORE;
+    g_hostInterruptsEnabled = TRUE;
+    HOST_CHECK(canGatewaySetRxModeration(TEST_SRC_NODE, setting->watermark, setting->timeoutUs) != FALSE);
+    HOST_CHECK_EQ(g_multican.rxModeration[TEST_SRC_NODE].watermark, setting->watermark);
+    HOST_CHECK_EQ(g_multican.doorbell[TEST_SRC_NODE]->B.SRE, 1);
+    testRunIsrs();
+    g_testIsrRuns = 0;
+
+    while (arrivalUs < TEST_TRACE_US)
+    {
+        now     = arrivalUs * TEST_TICKS_PER_US;
+        compare = MODULE_STM1.CMP[GW_RX_MODERATION_CMP].U;
+
+        if ((g_multican.rxArmedMask[GW_NODE4_CORE] != 0) && ((sint32)(compare - now) <= 0))
+        {
+            /* the moderation timeout comes first */
+            MODULE_STM1.TIM0.U = compare;
+            g_hostCoreIndex    = GW_NODE4_CORE;
+            gwRxTimeoutIsrCpu1();
+            timeouts++;
+        }
+        else
+        {
+            MODULE_STM1.TIM0.U = now;
+            memset(&frame, 0, sizeof(frame));
+            frame.id       = 0x18FEF100;
+            frame.extended = TRUE;
+            frame.dlc      = 8;
+            memcpy(frame.data, &now, sizeof(now));
+            HOST_CHECK(hostCanReceive(g_multican.canNode[TEST_SRC_NODE].node, &frame) != FALSE);
+            arrivalUs = testNextArrival(trace, arrivalUs, received);
+            received++;
+        }
+
+        testRunIsrs();
+        testDrainDestination(&sent, &worstUs, &totalUs);
+    }
+
+    /* the last batch */
+    while (g_multican.rxArmedMask[GW_NODE4_CORE] != 0)
+    {
+        MODULE_STM1.TIM0.U = MODULE_STM1.CMP[GW_RX_MODERATION_CMP].U;
+        g_hostCoreIndex    = GW_NODE4_CORE;
+        gwRxTimeoutIsrCpu1();
+        timeouts++;
+        testRunIsrs();
+        testDrainDestination(&sent, &worstUs, &totalUs);
+    }
+
+    HOST_CHECK_EQ(sent, received);
+    HOST_CHECK_EQ(g_multican.stats[TEST_DST_NODE].txDropped, 0);
+    HOST_CHECK(worstUs <= setting->timeoutUs);
+
+    if (setting->watermark == 1)
+    {
+        HOST_CHECK_EQ(g_testIsrRuns, received);
+        HOST_CHECK_EQ(worstUs, 0);
+    }
+
+    printf("  %-8s %5u frames/s  watermark %u timeout %4u us: %6u interrupts/s, latency mean %6.1f us worst %4u us\n",
+           g_testTraceName[trace], (unsigned)received, (unsigned)setting->watermark, (unsigned)setting->timeoutUs,
+           (unsigned)(g_testIsrRuns + timeouts), (double)totalUs / (double)sent, (unsigned)worstUs);
+}
+
+/* Interrupt rate against added latency: every trace with every moderation setting */
+static void testRateAgainstLatency(void)
+{
+    uint32 trace;
+    uint32 k;
+
+    printf("Test_GwRxModeration: node %u -> node %u, %u s per trace\n", (unsigned)TEST_SRC_NODE, (unsigned)TEST_DST_NODE,
+           (unsigned)(TEST_TRACE_US / 1000000));
+
+    for (trace = 0; trace < TestTrace_count; trace++)
+    {
+        for (k = 0; k < TEST_SETTINGS; k++)
+        {
+            testPlay((TestTrace)trace, &g_testSetting[k]);
+        }
+    }
+}
+
+/* A watermark change is refused from another core, with interrupts disabled (ISR) and on the DMA bypass source node;
+ * a timeout change is accepted from any core. The refused calls leave the node's interrupt line enabled.
+ */
+static void testSetRules(void)
+{
+    testInit();
+
+    g_hostInterruptsEnabled = TRUE;
+    g_hostCoreIndex         = 0;
+    HOST_CHECK(canGatewaySetRxModeration(TEST_SRC_NODE, 2, 100) == FALSE);
+    HOST_CHECK(canGatewaySetRxModeration(TEST_SRC_NODE, gwRxModeration[TEST_SRC_NODE].watermark, 100) != FALSE);
+    HOST_CHECK_EQ(g_multican.rxModeration[TEST_SRC_NODE].timeoutTicks, 100 * TEST_TICKS_PER_US);
+
+    g_hostCoreIndex         = GW_NODE4_CORE;
+    g_hostInterruptsEnabled = FALSE;
+    HOST_CHECK(canGatewaySetRxModeration(TEST_SRC_NODE, 2, 100) == FALSE);
+    g_hostInterruptsEnabled = TRUE;
+
+    g_hostCoreIndex = GW_NODE2_CORE;
+    HOST_CHECK(canGatewaySetRxModeration(gwBypass[0].srcNode, 2, 100) == FALSE);
+
+    HOST_CHECK_EQ(g_multican.rxModeration[TEST_SRC_NODE].watermark, gwRxModeration[TEST_SRC_NODE].watermark);
+    HOST_CHECK_EQ(g_multican.doorbell[TEST_SRC_NODE]->B.SRE, 1);
+    HOST_CHECK_EQ(g_multican.doorbell[gwBypass[0].srcNode]->B.SRE, 1);
+}
+
+int main(void)
+{
+    testSetRules();
+    testRateAgainstLatency();
+
+    return hostTestResult("Test_GwRxModeration");
+}
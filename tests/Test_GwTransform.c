@@ -0,0 +1,424 @@
+/**********************************************************************************************************************
+ * \file Test_GwTransform.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "MULTICAN_GW_ROUTE.h"
+#include "Can/Std/IfxCan.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_PAYLOAD_OFFSET         8                   /* Data field offset in the Rx element (after R0, R1)        */
+#define TEST_BENCH_FRAMES           1000000             /* Frames per path and case of the benchmark                  */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* A benchmark case: the route parameters the gateway path applies, the naive path does the same rewrite by hand */
+typedef enum
+{
+    TEST_CASE_ID_ONLY = 0,                              /* route 0x101 of node 0: ID rewrite to 0x181, no transform   */
+    TEST_CASE_FD_FRAME,                                 /* route 0x202 of node 2: CAN FD 12 bytes, payload moved by 4 */
+    TEST_CASE_SWAP_HALVES,                              /* byte repack: the two 4 byte halves of a classic frame      */
+    TEST_CASES
+} TestCase;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static const gwTransformOpType g_testSwapHalves[] = {GW_XF_COPY(0, 4, 4), GW_XF_COPY(4, 0, 4), GW_XF_END()};
+
+static const char *const g_testCaseName[TEST_CASES] = {"ID rewrite", "classic to FD", "byte repack"};
+
+static volatile uint32 g_testSink;                      /* Keeps the benchmark loops from being optimised away        */
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static uint8 *testPayload(Ifx_CAN_RXMSG *element)
+{
+    return (uint8 *)element + TEST_PAYLOAD_OFFSET;
+}
+
+/* Classic 8 byte frame, data field filled with 0x10, 0x11, ... */
+static void testInitElement(Ifx_CAN_RXMSG *element, uint32 dlc)
+{
+    uint8 *payload = testPayload(element);
+    uint32 i;
+
+    memset((void *)element, 0, sizeof(*element));
+    element->R0.B.ID  = 0x202 << 18;
+    element->R1.B.DLC = dlc;
+
+    for (i = 0; i < GW_DATA_FIELD_SIZE; i++)
+    {
+        payload[i] = (uint8)(0x10 + i);
+    }
+}
+
+/* Transform of the configured 0x202 route: CAN FD with BRS, 12 bytes, header cleared, payload moved up by 4 */
+static void testRouteFdFrame(void)
+{
+    const gwRouteType *route = canGatewayLookupRoute(2, FALSE, 0x202);
+    Ifx_CAN_RXMSG      element;
+    uint8             *payload = testPayload(&element);
+    uint32             i;
+
+    HOST_CHECK(route != NULL_PTR);
+    if ((route == NULL_PTR) || (route->transform == NULL_PTR))
+    {
+        return;
+    }
+
+    testInitElement(&element, 8);
+    canGatewayApplyTransform(&element, route->transform);
+
+    HOST_CHECK_EQ(element.R1.B.FDF, 1);
+    HOST_CHECK_EQ(element.R1.B.BRS, 1);
+    HOST_CHECK_EQ(element.R1.B.DLC, 9);
+    HOST_CHECK_EQ(element.R0.B.ID, 0x202 << 18);
+
+    for (i = 0; i < 4; i++)
+    {
+        HOST_CHECK_EQ(payload[i], 0);
+    }
+
+    for (i = 4; i < 12; i++)
+    {
+        HOST_CHECK_EQ(payload[i], 0x10 + i - 4);
+    }
+
+    for (i = 12; i < GW_DATA_FIELD_SIZE; i++)
+    {
+        HOST_CHECK_EQ(payload[i], 0x10 + i);
+    }
+}
+
+/* A short frame on the 0x202 route: the received 3 bytes move up by 4, the 5 bytes the copy reads behind the DLC
+ * come out as 0 instead of the stale message RAM contents of an earlier frame
+ */
+static void testRouteFdFrameShort(void)
+{
+    const gwRouteType *route = canGatewayLookupRoute(2, FALSE, 0x202);
+    Ifx_CAN_RXMSG      element;
+    uint8             *payload = testPayload(&element);
+    uint32             i;
+
+    HOST_CHECK(route != NULL_PTR);
+    if ((route == NULL_PTR) || (route->transform == NULL_PTR))
+    {
+        return;
+    }
+
+    testInitElement(&element, 3);
+    canGatewayApplyTransform(&element, route->transform);
+
+    HOST_CHECK_EQ(element.R1.B.DLC, 9);
+
+    for (i = 0; i < 4; i++)
+    {
+        HOST_CHECK_EQ(payload[i], 0);
+    }
+
+    for (i = 4; i < 7; i++)
+    {
+        HOST_CHECK_EQ(payload[i], 0x10 + i - 4);
+    }
+
+    for (i = 7; i < 12; i++)
+    {
+        HOST_CHECK_EQ(payload[i], 0);
+    }
+}
+
+/* TO_CLASSIC limits the DLC to 8 and clears the FD bits, shorter frames keep their DLC */
+static void testToClassic(void)
+{
+    static const gwTransformOpType toClassic[] = {GW_XF_TO_CLASSIC(), GW_XF_END()};
+    Ifx_CAN_RXMSG                  element;
+    uint32                         dlc;
+
+    for (dlc = 0; dlc <= GW_DLC_MAX; dlc++)
+    {
+        testInitElement(&element, dlc);
+        element.R1.B.FDF = 1;
+        element.R1.B.BRS = 1;
+        canGatewayApplyTransform(&element, toClassic);
+
+        HOST_CHECK_EQ(element.R1.B.FDF, 0);
+        HOST_CHECK_EQ(element.R1.B.BRS, 0);
+        HOST_CHECK_EQ(element.R1.B.DLC, (dlc > GW_DLC_CLASSIC_MAX) ? GW_DLC_CLASSIC_MAX : dlc);
+    }
+}
+
+/* COPY reads the frame as received: overlapping operations see the original bytes, not earlier results */
+static void testCopyReadsReceivedData(void)
+{
+    static const gwTransformOpType swapHalves[] = {GW_XF_COPY(0, 4, 4), GW_XF_COPY(4, 0, 4), GW_XF_END()};
+    static const gwTransformOpType shiftUp[]    = {GW_XF_COPY(1, 0, 7), GW_XF_FILL(0, 1, 0xA5), GW_XF_END()};
+    Ifx_CAN_RXMSG                  element;
+    uint8                         *payload = testPayload(&element);
+    uint32                         i;
+
+    testInitElement(&element, 8);
+    canGatewayApplyTransform(&element, swapHalves);
+
+    for (i = 0; i < 4; i++)
+    {
+        HOST_CHECK_EQ(payload[i], 0x14 + i);
+        HOST_CHECK_EQ(payload[4 + i], 0x10 + i);
+    }
+
+    testInitElement(&element, 8);
+    canGatewayApplyTransform(&element, shiftUp);
+
+    HOST_CHECK_EQ(payload[0], 0xA5);
+
+    for (i = 1; i < 8; i++)
+    {
+        HOST_CHECK_EQ(payload[i], 0x10 + i - 1);
+    }
+
+    /* the whole data field can be moved */
+    {
+        static const gwTransformOpType fullCopy[] = {GW_XF_COPY(0, 0, GW_DATA_FIELD_SIZE), GW_XF_END()};
+
+        testInitElement(&element, GW_DLC_MAX);
+        canGatewayApplyTransform(&element, fullCopy);
+
+        for (i = 0; i < GW_DATA_FIELD_SIZE; i++)
+        {
+            HOST_CHECK_EQ(payload[i], 0x10 + i);
+        }
+    }
+}
+
+/* Header only transforms and the empty transform leave the data field and the other header bits alone */
+static void testHeaderOnly(void)
+{
+    static const gwTransformOpType setDlc[] = {GW_XF_DLC(3), GW_XF_END()};
+    static const gwTransformOpType none[]   = {GW_XF_END()};
+    Ifx_CAN_RXMSG                  element;
+    Ifx_CAN_RXMSG                  reference;
+
+    testInitElement(&element, 8);
+    element.R1.B.RXTS = 0x1234;
+    element.R1.B.FIDX = 5;
+    canGatewayApplyTransform(&element, setDlc);
+
+    testInitElement(&reference, 3);
+    reference.R1.B.RXTS = 0x1234;
+    reference.R1.B.FIDX = 5;
+    HOST_CHECK(memcmp((const void *)&element, (const void *)&reference, sizeof(element)) == 0);
+
+    canGatewayApplyTransform(&element, none);
+    HOST_CHECK(memcmp((const void *)&element, (const void *)&reference, sizeof(element)) == 0);
+}
+
+/* Gateway path of a frame, as gwForwardBurst() does it: the transform on the Rx element, the element copy of the iLLD,
+ * the ID rewrite as a single header store
+ */
+static void testGatewayPath(Ifx_CAN_RXMSG *rx, Ifx_CAN_TXMSG *tx, uint32 newId, const gwTransformOpType *transform)
+{
+    if (transform != NULL_PTR)
+    {
+        canGatewayApplyTransform(rx, transform);
+    }
+
+    IfxCan_Node_copyRxElementToTxElement(rx, tx);
+
+    if (newId != GW_ID_UNCHANGED)
+    {
+        IfxCan_Node_setMsgId(tx, newId, (IfxCan_MessageIdLength)tx->T0.B.XTD);
+    }
+}
+
+/* Naive path: every header field read into a variable and the payload byte by byte into a buffer (as a
+ * readMessage()/sendMessage() based gateway holds a frame), the rewrite done on those, every field written back
+ */
+static void testNaivePath(Ifx_CAN_RXMSG *rx, Ifx_CAN_TXMSG *tx, TestCase testCase)
+{
+    const uint8 *rxBytes = testPayload(rx);
+    uint8       *txBytes = (uint8 *)tx + TEST_PAYLOAD_OFFSET;
+    uint8        data[GW_DATA_FIELD_SIZE];
+    uint8        out[GW_DATA_FIELD_SIZE];
+    uint32       id      = rx->R0.B.ID;
+    uint32       xtd     = rx->R0.B.XTD;
+    uint32       rtr     = rx->R0.B.RTR;
+    uint32       esi     = rx->R0.B.ESI;
+    uint32       dlc     = rx->R1.B.DLC;
+    uint32       fdf     = rx->R1.B.FDF;
+    uint32       brs     = rx->R1.B.BRS;
+    uint32       length  = IfxCan_Node_getDataLengthInBytes((IfxCan_DataLengthCode)dlc);
+    uint32       i;
+
+    for (i = 0; i < length; i++)
+    {
+        data[i] = rxBytes[i];
+        out[i]  = data[i];
+    }
+
+    switch (testCase)
+    {
+    case TEST_CASE_ID_ONLY:
+        id = 0x181 << 18;
+        break;
+    case TEST_CASE_FD_FRAME:
+        fdf = 1;
+        brs = 1;
+        dlc = 9;
+
+        for (i = 0; i < 4; i++)
+        {
+            out[i] = 0;
+        }
+
+        for (i = 0; i < 8; i++)
+        {
+            out[4 + i] = data[i];
+        }
+
+        length = 12;
+        break;
+    default:
+        for (i = 0; i < 4; i++)
+        {
+            out[i]     = data[4 + i];
+            out[4 + i] = data[i];
+        }
+
+        break;
+    }
+
+    tx->T0.U     = 0;
+    tx->T0.B.ID  = id;
+    tx->T0.B.XTD = xtd;
+    tx->T0.B.RTR = rtr;
+    tx->T0.B.ESI = esi;
+    tx->T1.U     = 0;
+    tx->T1.B.DLC = dlc;
+    tx->T1.B.FDF = fdf;
+    tx->T1.B.BRS = brs;
+
+    for (i = 0; i < length; i++)
+    {
+        txBytes[i] = out[i];
+    }
+}
+
+/* The route transforms against a naive field by field copy, per case: both paths produce the same Tx element, then
+ * the host ns/frame of each (printed, relative figures, not the rate of the TC375). Both paths start from a fresh Rx
+ * element every frame, as the gateway path rewrites it in place.
+ */
+static void testTransformBenchmark(void)
+{
+    const gwRouteType *idRoute = canGatewayLookupRoute(0, FALSE, 0x101);
+    const gwRouteType *fdRoute = canGatewayLookupRoute(2, FALSE, 0x202);
+    uint32             newId[TEST_CASES];
+    const gwTransformOpType *transform[TEST_CASES];
+    Ifx_CAN_RXMSG      received;
+    Ifx_CAN_RXMSG      rx;
+    Ifx_CAN_TXMSG      gatewayTx;
+    Ifx_CAN_TXMSG      naiveTx;
+    uint64_t           start;
+    uint64_t           gatewayNs;
+    uint64_t           naiveNs;
+    uint32             testCase;
+    uint32             i;
+
+    HOST_CHECK((idRoute != NULL_PTR) && (fdRoute != NULL_PTR));
+    if ((idRoute == NULL_PTR) || (fdRoute == NULL_PTR))
+    {
+        return;
+    }
+
+    newId[TEST_CASE_ID_ONLY]         = idRoute->newId;
+    transform[TEST_CASE_ID_ONLY]     = idRoute->transform;
+    newId[TEST_CASE_FD_FRAME]        = fdRoute->newId;
+    transform[TEST_CASE_FD_FRAME]    = fdRoute->transform;
+    newId[TEST_CASE_SWAP_HALVES]     = GW_ID_UNCHANGED;
+    transform[TEST_CASE_SWAP_HALVES] = g_testSwapHalves;
+    HOST_CHECK_EQ(newId[TEST_CASE_ID_ONLY], 0x181);
+    HOST_CHECK(transform[TEST_CASE_ID_ONLY] == NULL_PTR);
+
+    testInitElement(&received, 8);
+    received.R1.B.RXTS = 0x1234;
+
+    for (testCase = 0; testCase < TEST_CASES; testCase++)
+    {
+        memset((void *)&gatewayTx, 0, sizeof(gatewayTx));
+        memset((void *)&naiveTx, 0, sizeof(naiveTx));
+        rx = received;
+        testGatewayPath(&rx, &gatewayTx, newId[testCase], transform[testCase]);
+        rx = received;
+        testNaivePath(&rx, &naiveTx, (TestCase)testCase);
+        HOST_CHECK_EQ(gatewayTx.T0.U, naiveTx.T0.U);
+        HOST_CHECK_EQ(gatewayTx.T1.U, naiveTx.T1.U);
+        HOST_CHECK(memcmp((const void *)&gatewayTx, (const void *)&naiveTx, sizeof(gatewayTx)) == 0);
+
+        start = hostTestNanoseconds();
+
+        for (i = 0; i < TEST_BENCH_FRAMES; i++)
+        {
+            rx = received;
+            testGatewayPath(&rx, &gatewayTx, newId[testCase], transform[testCase]);
+            g_testSink += gatewayTx.T0.U;
+        }
+
+        gatewayNs = hostTestNanoseconds() - start;
+        start     = hostTestNanoseconds();
+
+        for (i = 0; i < TEST_BENCH_FRAMES; i++)
+        {
+            rx = received;
+            testNaivePath(&rx, &naiveTx, (TestCase)testCase);
+            g_testSink += naiveTx.T0.U;
+        }
+
+        naiveNs = hostTestNanoseconds() - start;
+
+        printf("Test_GwTransform: %-14s route path %.1f ns/frame, naive field copy %.1f ns/frame\n",
+               g_testCaseName[testCase], (double)gatewayNs / TEST_BENCH_FRAMES, (double)naiveNs / TEST_BENCH_FRAMES);
+    }
+}
+
+int main(void)
+{
+    testRouteFdFrame();
+    testRouteFdFrameShort();
+    testToClassic();
+    testCopyReadsReceivedData();
+    testHeaderOnly();
+    testTransformBenchmark();
+
+    return hostTestResult("Test_GwTransform");
+}
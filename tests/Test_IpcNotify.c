@@ -0,0 +1,289 @@
+/**********************************************************************************************************************
+ * \file Test_IpcNotify.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include "App_IpcRing.h"
+#include "App_Trace.h"
+#include "IfxCpu.h"
+#include "Stm/Std/IfxStm.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_INBOX_DEPTH            16
+#define TEST_MESSAGES               10000
+#define TEST_GAP_MIN_US             20                  /* Gaps between two messages of CPU0: 20..220 us              */
+#define TEST_GAP_RANGE_US           200
+#define TEST_TICKS_PER_US           (HOST_STM_FREQUENCY / 1000000U)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 seq;
+    uint32 postTime;                                    /* STM0 time of the push                                      */
+} TestMsg;
+
+IPC_SPSC_RING_DEFINE(testInbox, TestMsg, TEST_INBOX_DEPTH)
+
+/* Receive side of one run */
+typedef struct
+{
+    uint32   received;
+    uint32   latencyMax;                                /* Push to handler, STM ticks                                 */
+    uint64_t latencyTotal;
+} TestResult;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Trace ring of the doorbell ISR (App_Trace.c is not part of the host build) */
+static AppTraceRing g_testTraceRing;
+AppTraceRing *const g_appTraceRing[APP_TRACE_NUM_CORES] = {&g_testTraceRing, &g_testTraceRing, &g_testTraceRing};
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static testInboxRing    g_testInbox;
+static TestResult       g_testResult;
+static volatile boolean g_testDone;
+
+/* Doorbell ISRs (App_IpcRing.c), plain functions on the host */
+void ipcNotifyIsrCpu1(void);
+void ipcNotifyIsrCpu2(void);
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Interrupt dispatch of the cores: the doorbell of the core, taken atomically (other threads ring it) */
+static boolean testInterrupt(uint32 core)
+{
+    volatile Ifx_SRC_SRCR *src = IPC_NOTIFY_SRC(core);
+    Ifx_SRC_SRCR           request;
+
+    request.U     = 0;
+    request.B.SRR = 1;
+
+    if ((src->B.SRE == 0) || ((__atomic_fetch_and(&src->U, ~request.U, __ATOMIC_SEQ_CST) & request.U) == 0))
+    {
+        return FALSE;
+    }
+
+    if (core == 1)
+    {
+        ipcNotifyIsrCpu1();
+    }
+    else
+    {
+        ipcNotifyIsrCpu2();
+    }
+
+    return TRUE;
+}
+
+/* Take every message of the inbox: in order, and the time since its push */
+static void testInboxDrain(void)
+{
+    TestMsg msg;
+    uint32  latency;
+
+    while (testInboxPop(&g_testInbox, &msg) != FALSE)
+    {
+        latency = IfxStm_getLower(&MODULE_STM0) - msg.postTime;
+
+        HOST_CHECK_EQ(msg.seq, g_testResult.received);
+        g_testResult.received++;
+        g_testResult.latencyTotal += latency;
+        g_testResult.latencyMax    = (latency > g_testResult.latencyMax) ? latency : g_testResult.latencyMax;
+    }
+}
+
+/* CPU1 with the doorbell: the handler drains the inbox, the core sleeps in ipcNotifyIdle() in between */
+static void *testCpu1Doorbell(void *arg)
+{
+    (void)arg;
+    g_hostCoreIndex = 1;
+
+    ipcNotifyInit(testInboxDrain);
+    ipcRingAttach(&g_testInbox.ctrl);
+
+    while (g_testResult.received < TEST_MESSAGES)
+    {
+        ipcNotifyIdle();
+    }
+
+    return NULL_PTR;
+}
+
+/* CPU1 before the doorbells: polls the inbox (the host yields between two polls) */
+static void *testCpu1Polling(void *arg)
+{
+    (void)arg;
+    g_hostCoreIndex = 1;
+
+    while (g_testResult.received < TEST_MESSAGES)
+    {
+        testInboxDrain();
+        sched_yield();
+    }
+
+    return NULL_PTR;
+}
+
+/* CPU2 without messages: its doorbell is only rung to stop it */
+static void *testCpu2(void *arg)
+{
+    (void)arg;
+    g_hostCoreIndex = 2;
+
+    ipcNotifyInit(NULL_PTR);
+
+    while (g_testDone == FALSE)
+    {
+        ipcNotifyIdle();
+    }
+
+    return NULL_PTR;
+}
+
+/* CPU0 pushes the messages with random gaps; returns the elapsed STM0 ticks */
+static uint32 testProduce(void)
+{
+    TestMsg msg;
+    uint32  seed  = 12345;
+    uint32  start = IfxStm_getLower(&MODULE_STM0);
+    uint32  next  = start;
+    uint32  seq;
+
+    g_hostCoreIndex = 0;
+
+    for (seq = 0; seq < TEST_MESSAGES; seq++)
+    {
+        seed  = seed * 1103515245U + 12345U;
+        next += (TEST_GAP_MIN_US + ((seed >> 16) % TEST_GAP_RANGE_US)) * TEST_TICKS_PER_US;
+
+        while ((sint32)(IfxStm_getLower(&MODULE_STM0) - next) < 0)
+        {
+            sched_yield();
+        }
+
+        msg.seq      = seq;
+        msg.postTime = IfxStm_getLower(&MODULE_STM0);
+
+        while (testInboxPush(&g_testInbox, &msg) == FALSE)
+        {
+            sched_yield();
+        }
+    }
+
+    return IfxStm_getLower(&MODULE_STM0) - start;
+}
+
+static void testReset(void)
+{
+    memset(&g_testInbox, 0, sizeof(g_testInbox));
+    memset(&g_testResult, 0, sizeof(g_testResult));
+    memset((void *)g_ipcNotifyStats, 0, sizeof(g_ipcNotifyStats));
+    memset((void *)&g_hostModuleSrc, 0, sizeof(g_hostModuleSrc));
+    g_testDone = FALSE;
+}
+
+static void testPrint(const char *name, uint32 elapsed, uint32 idleTicks, uint32 wakeups)
+{
+    printf("  %-8s CPU1: %5u wake-ups, push to handler mean %6.1f us max %7.1f us, idle %6.2f %%\n", name,
+           (unsigned)wakeups, (double)g_testResult.latencyTotal / (double)g_testResult.received / TEST_TICKS_PER_US,
+           (double)g_testResult.latencyMax / TEST_TICKS_PER_US, 100.0 * (double)idleTicks / (double)elapsed);
+}
+
+/* CPU0 sends messages at random times to the inbox of CPU1, once with the doorbell and once with CPU1 polling as it
+ * did before, while CPU2 sleeps. With the doorbell every message arrives in order, only CPU1 is woken, never more
+ * often than there are messages, and CPU1 spends its time between the messages in WAIT (idle, the power proxy);
+ * polling never idles. Printed: wake-ups, push to handler latency and the idle share of CPU1 for both. The figures
+ * are host thread switches, on the target g_ipcNotifyStats records the same quantities.
+ */
+static void testWakeLatency(void)
+{
+    pthread_t cpu1;
+    pthread_t cpu2;
+    uint32    elapsed;
+
+    g_hostStmRunning   = TRUE;
+    g_hostCpuInterrupt = testInterrupt;
+
+    printf("Test_IpcNotify: %u messages CPU0 -> CPU1, gaps %u..%u us\n", (unsigned)TEST_MESSAGES,
+           (unsigned)TEST_GAP_MIN_US, (unsigned)(TEST_GAP_MIN_US + TEST_GAP_RANGE_US - 1));
+
+    testReset();
+    HOST_CHECK(pthread_create(&cpu2, NULL_PTR, testCpu2, NULL_PTR) == 0);
+    HOST_CHECK(pthread_create(&cpu1, NULL_PTR, testCpu1Doorbell, NULL_PTR) == 0);
+
+    while (g_testInbox.ctrl.notifyCore == 0)
+    {
+        sched_yield();                                  /* CPU1 attached: every push rings its doorbell               */
+    }
+
+    elapsed = testProduce();
+    pthread_join(cpu1, NULL_PTR);
+    g_testDone = TRUE;
+    ipcNotify(2);
+    pthread_join(cpu2, NULL_PTR);
+
+    HOST_CHECK_EQ(g_testResult.received, TEST_MESSAGES);
+    HOST_CHECK(g_ipcNotifyStats[1].wakeups <= (TEST_MESSAGES + 1));
+    HOST_CHECK(g_ipcNotifyStats[1].idleCount > 0);
+    HOST_CHECK(g_ipcNotifyStats[1].idleTicks > 0);
+    HOST_CHECK_EQ(g_ipcNotifyStats[2].wakeups, 1);      /* the stop                                                   */
+    testPrint("doorbell", elapsed, g_ipcNotifyStats[1].idleTicks, g_ipcNotifyStats[1].wakeups);
+    printf("           CPU1: doorbell ipcNotify() to ISR entry max %.1f us (g_ipcNotifyStats)\n",
+           (double)g_ipcNotifyStats[1].wakeLatencyMax / TEST_TICKS_PER_US);
+
+    testReset();
+    HOST_CHECK(pthread_create(&cpu1, NULL_PTR, testCpu1Polling, NULL_PTR) == 0);
+    elapsed = testProduce();
+    pthread_join(cpu1, NULL_PTR);
+
+    HOST_CHECK_EQ(g_testResult.received, TEST_MESSAGES);
+    testPrint("polling", elapsed, 0, 0);
+
+    g_hostCpuInterrupt = NULL_PTR;
+    g_hostStmRunning   = FALSE;
+}
+
+int main(void)
+{
+    testWakeLatency();
+
+    return hostTestResult("Test_IpcNotify");
+}
@@ -0,0 +1,323 @@
+/**********************************************************************************************************************
+ * \file Test_IpcRing.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include "App_IpcRing.h"
+#include "App_Trace.h"
+#include "IfxCpu.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_SPSC_DEPTH             64
+#define TEST_MPSC_DEPTH             16                  /* Small, so the producers keep lapping the consumer          */
+#define TEST_MPSC_PRODUCERS         4
+#define TEST_MESSAGES               1000000             /* Per producer                                               */
+#define TEST_WRAP_START             0xFFFFFF00U         /* head/tail start just below the 2^32 wrap                   */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 producer;
+    uint32 seq;
+    uint32 check;                                       /* ~seq, catches a slot read before it was complete           */
+} TestMsg;
+
+IPC_SPSC_RING_DEFINE(testSpsc, TestMsg, TEST_SPSC_DEPTH)
+IPC_MPSC_RING_DEFINE(testMpsc, TestMsg, TEST_MPSC_DEPTH)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Trace ring of the doorbell ISR (App_Trace.c is not part of the host build) */
+static AppTraceRing g_testTraceRing;
+AppTraceRing *const g_appTraceRing[APP_TRACE_NUM_CORES] = {&g_testTraceRing, &g_testTraceRing, &g_testTraceRing};
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static testSpscRing g_testSpscRing;
+static testMpscRing g_testMpscRing;
+static uint32       g_testDoorbellCalls;
+
+/* Doorbell ISR of CPU2 (App_IpcRing.c), a plain function on the host */
+void ipcNotifyIsrCpu2(void);
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static void testMsgInit(TestMsg *msg, uint32 producer, uint32 seq)
+{
+    msg->producer = producer;
+    msg->seq      = seq;
+    msg->check    = ~seq;
+}
+
+/* Single thread: full and empty detection, overflow status, FIFO order across the 2^32 wrap of head and tail */
+static void testSpscFullEmpty(void)
+{
+    TestMsg msg;
+    uint32  lap;
+    uint32  i;
+
+    g_testSpscRing.ctrl.head = TEST_WRAP_START;
+    g_testSpscRing.ctrl.tail = TEST_WRAP_START;
+
+    HOST_CHECK(testSpscPop(&g_testSpscRing, &msg) == FALSE);
+    HOST_CHECK(testSpscPeek(&g_testSpscRing) == NULL_PTR);
+
+    for (lap = 0; lap < 10; lap++)
+    {
+        for (i = 0; i < TEST_SPSC_DEPTH; i++)
+        {
+            testMsgInit(&msg, 0, (lap * TEST_SPSC_DEPTH) + i);
+            HOST_CHECK(testSpscPush(&g_testSpscRing, &msg) != FALSE);
+        }
+
+        HOST_CHECK_EQ(ipcRingTakeStatus(&g_testSpscRing.ctrl), 0);
+        HOST_CHECK(testSpscPush(&g_testSpscRing, &msg) == FALSE);
+        HOST_CHECK(testSpscReserve(&g_testSpscRing) == NULL_PTR);
+        HOST_CHECK_EQ(ipcRingTakeStatus(&g_testSpscRing.ctrl), IPC_RING_STATUS_OVERFLOW);
+        HOST_CHECK_EQ(ipcRingTakeStatus(&g_testSpscRing.ctrl), 0);
+
+        for (i = 0; i < TEST_SPSC_DEPTH; i++)
+        {
+            HOST_CHECK(testSpscPop(&g_testSpscRing, &msg) != FALSE);
+            HOST_CHECK_EQ(msg.seq, (lap * TEST_SPSC_DEPTH) + i);
+        }
+
+        HOST_CHECK(testSpscPop(&g_testSpscRing, &msg) == FALSE);
+    }
+
+    HOST_CHECK(g_testSpscRing.ctrl.head < TEST_WRAP_START);          /* wrapped */
+}
+
+/* SPSC producer thread, zero copy and copying pushes alternate */
+static void *testSpscProducer(void *arg)
+{
+    uint32 seq;
+
+    (void)arg;
+    g_hostCoreIndex = 1;
+
+    for (seq = 0; seq < TEST_MESSAGES; seq++)
+    {
+        if ((seq & 1) != 0)
+        {
+            TestMsg *slot;
+
+            while ((slot = testSpscReserve(&g_testSpscRing)) == NULL_PTR)
+            {
+                sched_yield();
+            }
+
+            testMsgInit(slot, 1, seq);
+            testSpscCommit(&g_testSpscRing);
+        }
+        else
+        {
+            TestMsg msg;
+
+            testMsgInit(&msg, 1, seq);
+
+            while (testSpscPush(&g_testSpscRing, &msg) == FALSE)
+            {
+                sched_yield();
+            }
+        }
+    }
+
+    return NULL_PTR;
+}
+
+/* Two threads: every message arrives once, complete and in order */
+static void testSpscStress(void)
+{
+    pthread_t producer;
+    uint32    expected = 0;
+
+    g_testSpscRing.ctrl.head = TEST_WRAP_START;
+    g_testSpscRing.ctrl.tail = TEST_WRAP_START;
+    g_hostCoreIndex          = 0;
+
+    HOST_CHECK(pthread_create(&producer, NULL_PTR, testSpscProducer, NULL_PTR) == 0);
+
+    while (expected < TEST_MESSAGES)
+    {
+        const TestMsg *slot = testSpscPeek(&g_testSpscRing);
+
+        if (slot == NULL_PTR)
+        {
+            sched_yield();
+            continue;
+        }
+
+        HOST_CHECK_EQ(slot->producer, 1);
+        HOST_CHECK_EQ(slot->seq, expected);
+        HOST_CHECK_EQ(slot->check, ~expected);
+        testSpscRelease(&g_testSpscRing);
+        expected++;
+    }
+
+    pthread_join(producer, NULL_PTR);
+
+    HOST_CHECK(testSpscPeek(&g_testSpscRing) == NULL_PTR);
+}
+
+/* MPSC producer thread arg, the producer number 0..TEST_MPSC_PRODUCERS-1 */
+static void *testMpscProducer(void *arg)
+{
+    uint32  producer = (uint32)(uintptr_t)arg;
+    TestMsg msg;
+    uint32  seq;
+
+    g_hostCoreIndex = producer % IPC_NUM_CORES;
+
+    for (seq = 0; seq < TEST_MESSAGES; seq++)
+    {
+        testMsgInit(&msg, producer, seq);
+
+        while (testMpscPush(&g_testMpscRing, &msg) == FALSE)
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL_PTR;
+}
+
+/* Several producer threads and one consumer across the 2^32 wrap: every message arrives once and complete, the
+ * messages of one producer in the order it pushed them.
+ */
+static void testMpscStress(void)
+{
+    pthread_t producer[TEST_MPSC_PRODUCERS];
+    uint32    expected[TEST_MPSC_PRODUCERS] = {0};
+    uint32    received                      = 0;
+    TestMsg   msg;
+    uint32    i;
+
+    /* an empty ring at TEST_WRAP_START: every slot free for the lap of that position */
+    g_testMpscRing.ctrl.head = TEST_WRAP_START;
+    g_testMpscRing.ctrl.tail = TEST_WRAP_START;
+
+    for (i = 0; i < TEST_MPSC_DEPTH; i++)
+    {
+        g_testMpscRing.slot[i].turn = TEST_WRAP_START;
+    }
+
+    g_hostCoreIndex = 0;
+
+    for (i = 0; i < TEST_MPSC_PRODUCERS; i++)
+    {
+        HOST_CHECK(pthread_create(&producer[i], NULL_PTR, testMpscProducer, (void *)(uintptr_t)i) == 0);
+    }
+
+    while (received < (TEST_MPSC_PRODUCERS * TEST_MESSAGES))
+    {
+        if (testMpscPop(&g_testMpscRing, &msg) == FALSE)
+        {
+            sched_yield();
+            continue;
+        }
+
+        HOST_CHECK(msg.producer < TEST_MPSC_PRODUCERS);
+
+        if (msg.producer < TEST_MPSC_PRODUCERS)
+        {
+            HOST_CHECK_EQ(msg.seq, expected[msg.producer]);
+            HOST_CHECK_EQ(msg.check, ~msg.seq);
+            expected[msg.producer] = msg.seq + 1;
+        }
+
+        received++;
+    }
+
+    for (i = 0; i < TEST_MPSC_PRODUCERS; i++)
+    {
+        pthread_join(producer[i], NULL_PTR);
+        HOST_CHECK_EQ(expected[i], TEST_MESSAGES);
+    }
+
+    HOST_CHECK(testMpscPop(&g_testMpscRing, &msg) == FALSE);
+    HOST_CHECK(g_testMpscRing.ctrl.head < TEST_WRAP_START);          /* wrapped */
+}
+
+static void testDoorbellHandler(void)
+{
+    g_testDoorbellCalls++;
+}
+
+/* An attached consumer core gets its doorbell on attach and on every commit, its ISR runs the handler */
+static void testDoorbell(void)
+{
+    volatile Ifx_SRC_SRCR *src = IPC_NOTIFY_SRC(2);
+    TestMsg                msg;
+
+    g_testSpscRing.ctrl.head = 0;
+    g_testSpscRing.ctrl.tail = 0;
+    g_hostCoreIndex          = 2;
+
+    ipcNotifyInit(testDoorbellHandler);
+    HOST_CHECK_EQ(src->B.SRE, 1);
+    HOST_CHECK_EQ(src->B.TOS, IfxSrc_Tos_cpu2);
+    HOST_CHECK_EQ(src->B.SRPN, ISR_PRIORITY_IPC_NOTIFY);
+
+    ipcRingAttach(&g_testSpscRing.ctrl);
+    HOST_CHECK_EQ(g_testSpscRing.ctrl.notifyCore, 3);
+    HOST_CHECK_EQ(src->B.SRR, 1);
+
+    src->B.SRR = 0;
+    g_hostCoreIndex = 1;
+    testMsgInit(&msg, 1, 0);
+    HOST_CHECK(testSpscPush(&g_testSpscRing, &msg) != FALSE);
+    HOST_CHECK_EQ(src->B.SRR, 1);
+    HOST_CHECK_EQ(IPC_NOTIFY_SRC(1)->B.SRR, 0);
+
+    ipcNotifyIsrCpu2();
+    HOST_CHECK_EQ(g_testDoorbellCalls, 1);
+    HOST_CHECK_EQ(g_ipcNotifyStats[2].wakeups, 1);
+
+    g_testSpscRing.ctrl.notifyCore = 0;
+}
+
+int main(void)
+{
+    testSpscFullEmpty();
+    testSpscStress();
+    testMpscStress();
+    testDoorbell();
+
+    return hostTestResult("Test_IpcRing");
+}
@@ -0,0 +1,265 @@
+/**********************************************************************************************************************
+ * \file Test_Periodic.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include "App_Config.h"
+#include "task.h"
+#include "semphr.h"
+#include "HostKernel.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_TICKS_PER_US           (HOST_STM_FREQUENCY / 1000000U)
+#define TEST_TICKS_PER_MS           (HOST_STM_FREQUENCY / 1000U)
+#define TEST_RATES                  CPU0_PERIODIC_TASK_COUNT
+#define TEST_PHASE_MS               10000               /* Length of the run of each scheme                           */
+#define TEST_CONTROL_PRIORITY       (configMAX_PRIORITIES - 1)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Starts of the jobs of one rate, against the nominal release: phase start + offset + n * period */
+typedef struct
+{
+    uint32 releases;                                    /* Jobs started                                               */
+    uint64 lastStart;                                   /* Start of the previous job, STM ticks                       */
+    uint64 latencyMax;                                  /* Start behind the nominal release, STM ticks                */
+    uint64 latencyTotal;
+    uint64 intervalJitterMax;                           /* Start to start deviation from the period, STM ticks        */
+} TestRate;
+
+/* One scheme of the periodic tasks of CPU0 */
+typedef struct
+{
+    const char *name;
+    uint64      start;                                  /* Phase start, STM ticks                                     */
+    uint32      offsetMs[TEST_RATES];                   /* Nominal first release per rate                             */
+    TestRate    rate[TEST_RATES];
+} TestScheme;
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static const uint32 g_testPeriodMs[TEST_RATES] = {1, 10, 100, 1000};
+static const uint32 g_testWorkUs[TEST_RATES]   = {200, 1500, 8000, 30000};  /* 46 % load in total                 */
+
+/* Priorities of the shared semaphore scheme before the task table (1ms lowest) */
+static const UBaseType_t g_testLegacyPriority[TEST_RATES] = {3, 4, 5, 6};
+
+static TestScheme  g_testLegacy = {"g_cpu0TickSem + vTaskDelay()", 0, {0, 0, 0, 0}, {{0}}};
+static TestScheme  g_testTable  = {"task table + xTaskDelayUntil()", 0,
+                                   {CPU0_1MS_TASK_OFFSET, CPU0_10MS_TASK_OFFSET, CPU0_100MS_TASK_OFFSET,
+                                    CPU0_1000MS_TASK_OFFSET}, {{0}}};
+static TestScheme *g_testCurrent;
+
+static SemaphoreHandle_t g_testTickSem;
+static StaticSemaphore_t g_testTickSemBuffer;
+static TaskHandle_t      g_testLegacyTask[TEST_RATES];
+static StaticTask_t      g_testTcb[2 * TEST_RATES + 1];
+static StackType_t       g_testStack[2 * TEST_RATES + 1][configMINIMAL_STACK_SIZE];
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* The statistics of the task table as on CPU0 (App_Cpu0_Kernel.c is not part of the host build) */
+AppPeriodicTaskStats g_cpu0PeriodicStats[CPU0_PERIODIC_TASK_COUNT];
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Job of a rate: the start against its nominal release, then the work */
+static void testJob(uint32 rate)
+{
+    TestRate *stats   = &g_testCurrent->rate[rate];
+    uint64    now     = hostKernelTime();
+    uint64    period  = (uint64)g_testPeriodMs[rate] * TEST_TICKS_PER_MS;
+    uint64    nominal = g_testCurrent->start + ((uint64)g_testCurrent->offsetMs[rate] * TEST_TICKS_PER_MS)
+                        + (stats->releases * period);
+    uint64    latency = (now > nominal) ? (now - nominal) : 0;
+
+    HOST_CHECK(now >= nominal);
+
+    if (stats->releases > 0)
+    {
+        uint64 interval = now - stats->lastStart;
+        uint64 jitter   = (interval > period) ? (interval - period) : (period - interval);
+
+        stats->intervalJitterMax = (jitter > stats->intervalJitterMax) ? jitter : stats->intervalJitterMax;
+    }
+
+    stats->releases++;
+    stats->lastStart     = now;
+    stats->latencyTotal += latency;
+    stats->latencyMax    = (latency > stats->latencyMax) ? latency : stats->latencyMax;
+
+    hostKernelBusy(g_testWorkUs[rate] * TEST_TICKS_PER_US);
+}
+
+static void testJob1ms(void)    { testJob(0); }
+static void testJob10ms(void)   { testJob(1); }
+static void testJob100ms(void)  { testJob(2); }
+static void testJob1000ms(void) { testJob(3); }
+
+/* The CPU0 task table with the jobs of the test */
+static const AppPeriodicTaskCfg g_testTasks[TEST_RATES] = {
+    {testJob1ms,    "CPU0 1MS",    1,    CPU0_1MS_TASK_OFFSET,    1,    configMINIMAL_STACK_SIZE, CPU0_1MS_TASK_PRIORITY,
+     g_testStack[0], &g_testTcb[0], &g_cpu0PeriodicStats[0]},
+    {testJob10ms,   "CPU0 10MS",   10,   CPU0_10MS_TASK_OFFSET,   10,   configMINIMAL_STACK_SIZE, CPU0_10MS_TASK_PRIORITY,
+     g_testStack[1], &g_testTcb[1], &g_cpu0PeriodicStats[1]},
+    {testJob100ms,  "CPU0 100MS",  100,  CPU0_100MS_TASK_OFFSET,  100,  configMINIMAL_STACK_SIZE, CPU0_100MS_TASK_PRIORITY,
+     g_testStack[2], &g_testTcb[2], &g_cpu0PeriodicStats[2]},
+    {testJob1000ms, "CPU0 1000MS", 1000, CPU0_1000MS_TASK_OFFSET, 1000, configMINIMAL_STACK_SIZE, CPU0_1000MS_TASK_PRIORITY,
+     g_testStack[3], &g_testTcb[3], &g_cpu0PeriodicStats[3]},
+};
+
+/* Periodic task of CPU0 before the task table: the job under the shared g_cpu0TickSem, then vTaskDelay() */
+static void testLegacyTask(void *arg)
+{
+    uint32 rate = (uint32)(uintptr_t)arg;
+
+    while (1)
+    {
+        if (xSemaphoreTake(g_testTickSem, portMAX_DELAY) == pdTRUE)
+        {
+            testJob(rate);
+            xSemaphoreGive(g_testTickSem);
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(g_testPeriodMs[rate]));
+    }
+}
+
+/* Runs the old scheme, suspends it, then runs the task table (app_periodic_start()) */
+static void testControlTask(void *arg)
+{
+    uint32 i;
+
+    (void)arg;
+
+    g_testCurrent        = &g_testLegacy;
+    g_testLegacy.start   = hostKernelTime();
+    g_testTickSem        = xSemaphoreCreateBinaryStatic(&g_testTickSemBuffer);
+    (void)xSemaphoreGive(g_testTickSem);
+
+    for (i = 0; i < TEST_RATES; i++)
+    {
+        g_testLegacyTask[i] = xTaskCreateStatic(testLegacyTask, "LEGACY", configMINIMAL_STACK_SIZE,
+                                                (void *)(uintptr_t)i, g_testLegacyPriority[i],
+                                                g_testStack[TEST_RATES + i], &g_testTcb[TEST_RATES + i]);
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(TEST_PHASE_MS));
+
+    for (i = 0; i < TEST_RATES; i++)
+    {
+        vTaskSuspend(g_testLegacyTask[i]);
+    }
+
+    g_testCurrent     = &g_testTable;
+    g_testTable.start = hostKernelTime();
+    app_periodic_start(g_testTasks, TEST_RATES);
+
+    vTaskDelay(pdMS_TO_TICKS(TEST_PHASE_MS));
+
+    vTaskEndScheduler();
+}
+
+static void testPrint(const TestScheme *scheme)
+{
+    uint32 i;
+
+    printf("  %s\n", scheme->name);
+
+    for (i = 0; i < TEST_RATES; i++)
+    {
+        const TestRate *rate = &scheme->rate[i];
+
+        printf("    %4u ms: %5u releases, release latency mean %8.1f us max %8.1f us, period jitter max %8.1f us\n",
+               (unsigned)g_testPeriodMs[i], (unsigned)rate->releases,
+               (double)rate->latencyTotal / (double)rate->releases / TEST_TICKS_PER_US,
+               (double)rate->latencyMax / TEST_TICKS_PER_US, (double)rate->intervalJitterMax / TEST_TICKS_PER_US);
+    }
+}
+
+/* Release jitter per rate of the CPU0 periodic tasks, the old scheme against the task table of App_Periodic.c, both
+ * with the same work per job (46 % load). The old tasks serialise on one semaphore, so a long job delays every rate,
+ * and vTaskDelay() after the job drifts each period by the job time. The task table releases every rate on time: the
+ * 1ms task with no latency at all, every other rate behind the pending work of the higher rates only, and no deadline
+ * miss. Printed per rate and scheme: latency of the start behind the nominal release and the
+ * period jitter, in simulated time (the work is modelled, the kernel itself takes no time).
+ */
+static void testPeriodic(void)
+{
+    uint32 i;
+
+    (void)xTaskCreateStatic(testControlTask, "CONTROL", configMINIMAL_STACK_SIZE, NULL_PTR, TEST_CONTROL_PRIORITY,
+                            g_testStack[2 * TEST_RATES], &g_testTcb[2 * TEST_RATES]);
+
+    vTaskStartScheduler();
+
+    printf("Test_Periodic: CPU0 periodic tasks, %u ms per scheme, work per job 200 us / 1.5 ms / 8 ms / 30 ms\n",
+           (unsigned)TEST_PHASE_MS);
+    testPrint(&g_testLegacy);
+    testPrint(&g_testTable);
+
+    for (i = 0; i < TEST_RATES; i++)
+    {
+        const TestRate             *table    = &g_testTable.rate[i];
+        const TestRate             *legacy   = &g_testLegacy.rate[i];
+        const AppPeriodicTaskStats *stats    = &g_cpu0PeriodicStats[i];
+        uint32                      expected = (TEST_PHASE_MS - g_testTable.offsetMs[i] + g_testPeriodMs[i] - 1)
+                                               / g_testPeriodMs[i];
+
+        /* Drift free: one release per period. The old scheme loses releases to the drift */
+        HOST_CHECK_EQ(table->releases, expected);
+        HOST_CHECK_EQ(stats->releases, expected);
+        HOST_CHECK(legacy->releases <= TEST_PHASE_MS / g_testPeriodMs[i]);
+        HOST_CHECK_EQ(stats->deadlineMisses, 0);
+        HOST_CHECK_EQ(stats->overruns, 0);
+
+        /* The period jitter of App_Periodic.c is the one the test sees */
+        HOST_CHECK_EQ(stats->jitterMax, (uint32)table->intervalJitterMax);
+        HOST_CHECK(table->latencyMax < legacy->latencyMax);
+    }
+
+    /* The highest rate preempts everything else, the next one waits for it only */
+    HOST_CHECK_EQ(g_testTable.rate[0].latencyMax, 0);
+    HOST_CHECK_EQ(g_testTable.rate[1].latencyMax, (uint64)g_testWorkUs[0] * TEST_TICKS_PER_US);
+    HOST_CHECK(g_testLegacy.rate[1].releases < g_testTable.rate[1].releases);
+}
+
+int main(void)
+{
+    testPeriodic();
+
+    return hostTestResult("Test_Periodic");
+}
@@ -0,0 +1,336 @@
+/**********************************************************************************************************************
+ * \file Test_Pool.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include "App_Pool.h"
+#include "IfxCpu_Intrinsics.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_THREADS                4
+#define TEST_ITERATIONS             500000              /* Per thread                                                 */
+#define TEST_HELD_MAX               8                   /* Blocks a thread holds at once                              */
+#define TEST_NO_CLASS               APP_POOL_CLASS_COUNT
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Stamp a thread writes into the blocks it holds, a block handed out twice is overwritten by the other owner */
+typedef struct
+{
+    uint32 owner;
+    uint32 seq;
+    uint32 check;
+    uint32 owner2;
+} TestStamp;
+
+/* Result of one stress thread */
+typedef struct
+{
+    uint32 thread;
+    uint32 allocs[APP_POOL_CLASS_COUNT];
+} TestThread;
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+/* Blocks the preempting "ISR" of testPreemptedPop() allocates and returns */
+static void *g_testIsrBlock[2];
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Class of a block, TEST_NO_CLASS if it is no block start of any class */
+static uint32 testClassOf(const void *block)
+{
+    uint32 i;
+
+    for (i = 0; i < APP_POOL_CLASS_COUNT; i++)
+    {
+        const AppPoolClass *cls   = &g_appPoolClass[i];
+        const uint8        *start = cls->storage;
+
+        if (((const uint8 *)block >= start) && ((const uint8 *)block < (start + (cls->blockCount * cls->blockSize))))
+        {
+            return ((((const uint8 *)block - start) % cls->blockSize) == 0) ? i : TEST_NO_CLASS;
+        }
+    }
+
+    return TEST_NO_CLASS;
+}
+
+static void testStamp(void *block, uint32 owner, uint32 seq)
+{
+    volatile TestStamp *stamp = (volatile TestStamp *)block;
+
+    stamp->owner  = owner;
+    stamp->seq    = seq;
+    stamp->check  = ~seq;
+    stamp->owner2 = owner;
+}
+
+static boolean testStampIntact(const void *block, uint32 owner, uint32 seq)
+{
+    const volatile TestStamp *stamp = (const volatile TestStamp *)block;
+
+    return (stamp->owner == owner) && (stamp->seq == seq) && (stamp->check == ~seq) && (stamp->owner2 == owner);
+}
+
+/* Take every block of the smallest class: each block once, then the class spills into the next one */
+static void testDrainSmallestClass(void)
+{
+    static void        *blocks[APP_POOL_16_COUNT];
+    const AppPoolClass *cls = &g_appPoolClass[0];
+    void               *spill;
+    uint32              i;
+    uint32              j;
+
+    for (i = 0; i < APP_POOL_16_COUNT; i++)
+    {
+        blocks[i] = appPoolAlloc(APP_POOL_16_SIZE);
+        HOST_CHECK_EQ(testClassOf(blocks[i]), 0);
+        HOST_CHECK_EQ((uint32)(uintptr_t)blocks[i] & 7U, 0);
+        testStamp(blocks[i], 0xD0, i);
+    }
+
+    for (i = 0; i < APP_POOL_16_COUNT; i++)
+    {
+        for (j = i + 1; j < APP_POOL_16_COUNT; j++)
+        {
+            HOST_CHECK(blocks[i] != blocks[j]);
+        }
+
+        HOST_CHECK(testStampIntact(blocks[i], 0xD0, i) != FALSE);
+    }
+
+    HOST_CHECK_EQ(cls->ctrl->inUse, APP_POOL_16_COUNT);
+
+    spill = appPoolAlloc(1);
+    HOST_CHECK_EQ(testClassOf(spill), 1);
+    HOST_CHECK(appPoolFree(spill) != FALSE);
+
+    for (i = 0; i < APP_POOL_16_COUNT; i++)
+    {
+        HOST_CHECK(appPoolFree(blocks[i]) != FALSE);
+    }
+
+    HOST_CHECK_EQ(cls->ctrl->inUse, 0);
+}
+
+/* Class selection, malloc front end limits and addresses which are no pool block */
+static void testClasses(void)
+{
+    static uint32 foreign[4];
+    void         *block;
+
+    block = appPoolAlloc(APP_POOL_16_SIZE + 1);
+    HOST_CHECK_EQ(testClassOf(block), 1);
+    HOST_CHECK(appPoolFree(block) != FALSE);
+
+    block = appPoolAlloc(APP_POOL_1536_SIZE);
+    HOST_CHECK_EQ(testClassOf(block), 3);
+    HOST_CHECK(appPoolFree(block) != FALSE);
+
+    HOST_CHECK(appPoolAlloc(APP_POOL_1536_SIZE + 1) == NULL_PTR);
+
+    block = appPoolMalloc(APP_POOL_MALLOC_MAX);
+    HOST_CHECK_EQ(testClassOf(block), 2);
+    HOST_CHECK(appPoolFree(block) != FALSE);
+    HOST_CHECK(appPoolMalloc(APP_POOL_MALLOC_MAX + 1) == NULL_PTR);
+
+    HOST_CHECK(appPoolFree(&foreign[1]) == FALSE);
+    HOST_CHECK(appPoolFree(NULL_PTR) == FALSE);
+}
+
+/* "ISR" preempting the pop of the smallest class just before its CMPSWAP on the list head: takes the block the pop
+ * is about to take and the one behind it, and returns the first one. The head index is the same again, the link
+ * the preempted pop read is stale.
+ */
+static void testIsrAbaOnHead(volatile void *address)
+{
+    if (address != (volatile void *)&g_appPoolClass[0].ctrl->head)
+    {
+        g_hostPreemptHook = testIsrAbaOnHead;        /* not the list head yet, wait for the next CMPSWAP */
+        return;
+    }
+
+    g_testIsrBlock[0] = appPoolAlloc(APP_POOL_16_SIZE);
+    g_testIsrBlock[1] = appPoolAlloc(APP_POOL_16_SIZE);
+    HOST_CHECK(appPoolFree(g_testIsrBlock[0]) != FALSE);
+}
+
+/* A pop preempted by a pop, pop, push of the same blocks (ABA) must not hand out the block the "ISR" still holds */
+static void testPreemptedPop(void)
+{
+    void  *a = appPoolAlloc(APP_POOL_16_SIZE);
+    void  *b = appPoolAlloc(APP_POOL_16_SIZE);
+    void  *c = appPoolAlloc(APP_POOL_16_SIZE);
+    void  *taken;
+    void  *next;
+
+    /* free list: a -> b -> c -> ... */
+    HOST_CHECK(appPoolFree(c) != FALSE);
+    HOST_CHECK(appPoolFree(b) != FALSE);
+    HOST_CHECK(appPoolFree(a) != FALSE);
+
+    g_hostPreemptHook = testIsrAbaOnHead;
+    taken             = appPoolAlloc(APP_POOL_16_SIZE);
+    HOST_CHECK(g_hostPreemptHook == NULL_PTR);
+
+    HOST_CHECK(g_testIsrBlock[0] == a);
+    HOST_CHECK(g_testIsrBlock[1] == b);
+    HOST_CHECK(taken == a);
+
+    /* b is still held by the "ISR": the list must continue with c */
+    next = appPoolAlloc(APP_POOL_16_SIZE);
+    HOST_CHECK(next != b);
+    HOST_CHECK(next == c);
+
+    HOST_CHECK(appPoolFree(next) != FALSE);
+    HOST_CHECK(appPoolFree(taken) != FALSE);
+    HOST_CHECK(appPoolFree(g_testIsrBlock[1]) != FALSE);
+    HOST_CHECK_EQ(g_appPoolClass[0].ctrl->inUse, 0);
+}
+
+/* Stress thread: allocate, stamp and hold up to TEST_HELD_MAX blocks, check the stamps and free them out of order */
+static void *testStressThread(void *arg)
+{
+    TestThread *self = (TestThread *)arg;
+    void       *held[TEST_HELD_MAX];
+    uint32      heldSeq[TEST_HELD_MAX];
+    uint32      count = 0;
+    uint32      seq;
+
+    for (seq = 0; seq < TEST_ITERATIONS; seq++)
+    {
+        if ((count < TEST_HELD_MAX) && (((seq * 7) % 3) != 0))
+        {
+            void  *block = appPoolAlloc(APP_POOL_16_SIZE);
+            uint32 cls   = testClassOf(block);
+
+            if (block != NULL_PTR)
+            {
+                HOST_CHECK(cls < APP_POOL_CLASS_COUNT);
+
+                if (cls < APP_POOL_CLASS_COUNT)
+                {
+                    self->allocs[cls]++;
+                }
+
+                testStamp(block, self->thread, seq);
+                held[count]    = block;
+                heldSeq[count] = seq;
+                count++;
+            }
+        }
+        else if (count > 0)
+        {
+            uint32 i = seq % count;
+
+            HOST_CHECK(testStampIntact(held[i], self->thread, heldSeq[i]) != FALSE);
+            HOST_CHECK(appPoolFree(held[i]) != FALSE);
+            count--;
+            held[i]    = held[count];
+            heldSeq[i] = heldSeq[count];
+        }
+
+        if ((seq % 64) == 0)
+        {
+            sched_yield();
+        }
+    }
+
+    while (count > 0)
+    {
+        count--;
+        HOST_CHECK(testStampIntact(held[count], self->thread, heldSeq[count]) != FALSE);
+        HOST_CHECK(appPoolFree(held[count]) != FALSE);
+    }
+
+    return NULL_PTR;
+}
+
+/* Threads racing on the free lists: no block handed out twice, counters consistent, no block lost afterwards */
+static void testStress(void)
+{
+    static TestThread thread[TEST_THREADS];
+    pthread_t         handle[TEST_THREADS];
+    uint32            allocsBefore[APP_POOL_CLASS_COUNT];
+    uint32            i;
+    uint32            c;
+
+    for (c = 0; c < APP_POOL_CLASS_COUNT; c++)
+    {
+        allocsBefore[c] = g_appPoolClass[c].ctrl->allocs;
+    }
+
+    for (i = 0; i < TEST_THREADS; i++)
+    {
+        thread[i].thread = 0x100 + i;
+        HOST_CHECK(pthread_create(&handle[i], NULL_PTR, testStressThread, &thread[i]) == 0);
+    }
+
+    for (i = 0; i < TEST_THREADS; i++)
+    {
+        pthread_join(handle[i], NULL_PTR);
+    }
+
+    for (c = 0; c < APP_POOL_CLASS_COUNT; c++)
+    {
+        const AppPoolCtrl *ctrl   = g_appPoolClass[c].ctrl;
+        uint32             allocs = 0;
+
+        for (i = 0; i < TEST_THREADS; i++)
+        {
+            allocs += thread[i].allocs[c];
+        }
+
+        HOST_CHECK_EQ(ctrl->inUse, 0);
+        HOST_CHECK_EQ(ctrl->allocs - allocsBefore[c], allocs);
+        HOST_CHECK(ctrl->inUseMax <= g_appPoolClass[c].blockCount);
+        HOST_CHECK(ctrl->carved <= g_appPoolClass[c].blockCount);
+    }
+
+    /* the free list still holds every block exactly once */
+    testDrainSmallestClass();
+}
+
+int main(void)
+{
+    testDrainSmallestClass();
+    testClasses();
+    testPreemptedPop();
+    testStress();
+
+    return hostTestResult("Test_Pool");
+}
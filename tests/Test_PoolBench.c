@@ -0,0 +1,389 @@
+/**********************************************************************************************************************
+ * \file Test_PoolBench.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "App_Pool.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_STEPS                  200000              /* Frames arriving, one per step                              */
+#define TEST_SLOTS                  256                 /* Frames in flight at most                                   */
+#define TEST_BURST_PERIOD           2000                /* Steps between two bursts of CAN frames                     */
+#define TEST_BURST_FRAMES           48
+#define TEST_LONG_PERIOD            200                 /* One in this many messages is held long                     */
+#define TEST_OPS_MAX                (2 * (TEST_STEPS + ((TEST_STEPS / TEST_BURST_PERIOD) * TEST_BURST_FRAMES)))
+#define TEST_RUNS                   5                   /* Timed replays per allocator, the fastest counts            */
+
+#define TEST_POOL                   0
+#define TEST_HEAP                   1
+#define TEST_ALLOCATORS             2
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* One allocator call of the workload: size > 0 allocates size bytes for slot, 0 frees the buffer of slot */
+typedef struct
+{
+    uint16 slot;
+    uint16 size;
+} TestOp;
+
+/* A frame in flight while the workload is generated */
+typedef struct
+{
+    uint32 size;
+    uint32 due;
+} TestFrame;
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static uint32    g_testRandom = 0x2468ACE1U;
+static TestOp    g_testOp[TEST_OPS_MAX];
+static uint32    g_testOpCount;
+static TestFrame g_testFrame[TEST_SLOTS];
+static uint8    *g_testBlock[TEST_SLOTS];
+static uint32    g_testSize[TEST_SLOTS];
+
+static const char *const g_testAllocatorName[TEST_ALLOCATORS] = {"pools ", "heap_4"};
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* heap_4 locks with the scheduler and critical sections, there is neither here */
+void vTaskSuspendAll(void)
+{
+}
+
+BaseType_t xTaskResumeAll(void)
+{
+    return pdFALSE;
+}
+
+void vPortEnterCritical(void)
+{
+}
+
+void vPortExitCritical(void)
+{
+}
+
+void vPortAssert(const char *pcFile, int iLine)
+{
+    hostTestFail(pcFile, iLine, "configASSERT", 0, 0, 0);
+}
+
+/* xorshift32, a fixed sequence so that a failure reproduces */
+static uint32 testRandom(uint32 range)
+{
+    g_testRandom ^= g_testRandom << 13;
+    g_testRandom ^= g_testRandom >> 17;
+    g_testRandom ^= g_testRandom << 5;
+
+    return g_testRandom % range;
+}
+
+/* A frame arrives for hold steps: its allocation goes into the workload. FALSE: no free slot. */
+static boolean testArrive(uint32 step, uint32 size, uint32 hold)
+{
+    uint32 slot;
+
+    for (slot = 0; slot < TEST_SLOTS; slot++)
+    {
+        if (g_testFrame[slot].size == 0)
+        {
+            g_testFrame[slot].size = size;
+            g_testFrame[slot].due  = step + hold;
+            g_testOp[g_testOpCount].slot = (uint16)slot;
+            g_testOp[g_testOpCount].size = (uint16)size;
+            g_testOpCount++;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+static void testRelease(uint32 slot)
+{
+    g_testFrame[slot].size = 0;
+    g_testOp[g_testOpCount].slot = (uint16)slot;
+    g_testOp[g_testOpCount].size = 0;
+    g_testOpCount++;
+}
+
+/* The frame buffers of a synthetic gateway: CAN frames (55 %), CAN FD frames (30 %), messages up to 256 bytes (10 %)
+ * and Ethernet frames up to 1536 bytes (5 %), each held for a few steps while it is routed, a burst of CAN frames
+ * every TEST_BURST_PERIOD steps and one message in TEST_LONG_PERIOD held for thousands of steps (a log or diagnostic
+ * buffer). Returns the frames that found no slot.
+ */
+static uint32 testGenerateWorkload(void)
+{
+    uint32 dropped = 0;
+    uint32 step;
+    uint32 slot;
+    uint32 i;
+
+    for (step = 0; step < TEST_STEPS; step++)
+    {
+        uint32 kind = testRandom(100);
+        uint32 size;
+        uint32 hold;
+
+        for (slot = 0; slot < TEST_SLOTS; slot++)
+        {
+            if ((g_testFrame[slot].size != 0) && (g_testFrame[slot].due <= step))
+            {
+                testRelease(slot);
+            }
+        }
+
+        if (kind < 55)
+        {
+            size = 16;
+            hold = 1 + testRandom(32);
+        }
+        else if (kind < 85)
+        {
+            size = 16 + testRandom(49);
+            hold = 1 + testRandom(32);
+        }
+        else if (kind < 95)
+        {
+            size = 65 + testRandom(192);
+            hold = (testRandom(TEST_LONG_PERIOD) == 0) ? (2000 + testRandom(18000)) : (1 + testRandom(64));
+        }
+        else
+        {
+            size = 257 + testRandom(1280);
+            hold = 1 + testRandom(8);
+        }
+
+        dropped += testArrive(step, size, hold) ? 0 : 1;
+
+        if ((step % TEST_BURST_PERIOD) == (TEST_BURST_PERIOD - 1))
+        {
+            for (i = 0; i < TEST_BURST_FRAMES; i++)
+            {
+                dropped += testArrive(step, 16, 1 + testRandom(200)) ? 0 : 1;
+            }
+        }
+    }
+
+    for (slot = 0; slot < TEST_SLOTS; slot++)
+    {
+        if (g_testFrame[slot].size != 0)
+        {
+            testRelease(slot);
+        }
+    }
+
+    return dropped;
+}
+
+static uint8 *testAlloc(uint32 allocator, uint32 size)
+{
+    return (allocator == TEST_POOL) ? (uint8 *)appPoolAlloc(size) : (uint8 *)pvPortMalloc(size);
+}
+
+static void testFree(uint32 allocator, uint8 *block)
+{
+    if (allocator == TEST_POOL)
+    {
+        (void)appPoolFree(block);
+    }
+    else
+    {
+        vPortFree(block);
+    }
+}
+
+/* The workload on one allocator with checks: every buffer keeps the stamps of its frame at both ends until it is
+ * freed (no other frame got it). heap_4 also reports the longest free list an allocation found, which its first fit
+ * walks in the worst case, and the largest free block at the worst point. Returns the allocations which failed.
+ */
+static uint32 testReplayChecked(uint32 allocator)
+{
+    HeapStats_t heap;
+    size_t      maxFreeBlocks    = 0;
+    size_t      minLargestBlock  = configTOTAL_HEAP_SIZE;
+    size_t      freeAtMinLargest = 0;
+    uint32      failures         = 0;
+    uint32      i;
+
+    for (i = 0; i < g_testOpCount; i++)
+    {
+        const TestOp *op    = &g_testOp[i];
+        uint8       **block = &g_testBlock[op->slot];
+        uint32        stamp = i;
+
+        if (op->size != 0)
+        {
+            if (allocator == TEST_HEAP)
+            {
+                vPortGetHeapStats(&heap);
+
+                if (heap.xNumberOfFreeBlocks > maxFreeBlocks)
+                {
+                    maxFreeBlocks = heap.xNumberOfFreeBlocks;
+                }
+
+                if ((heap.xAvailableHeapSpaceInBytes != 0) && (heap.xSizeOfLargestFreeBlockInBytes < minLargestBlock))
+                {
+                    minLargestBlock  = heap.xSizeOfLargestFreeBlockInBytes;
+                    freeAtMinLargest = heap.xAvailableHeapSpaceInBytes;
+                }
+            }
+
+            *block               = testAlloc(allocator, op->size);
+            g_testSize[op->slot] = op->size;
+
+            if (*block != NULL_PTR)
+            {
+                HOST_CHECK_EQ((uint32)*block & 7U, 0);
+                memcpy(*block, &stamp, 4);
+                memcpy(&(*block)[op->size - 4], &stamp, 4);
+            }
+            else
+            {
+                failures++;
+            }
+        }
+        else if (*block != NULL_PTR)
+        {
+            memcpy(&stamp, *block, 4);
+            HOST_CHECK(memcmp(&(*block)[g_testSize[op->slot] - 4], &stamp, 4) == 0);
+            HOST_CHECK_EQ(g_testOp[stamp].slot, op->slot);
+            testFree(allocator, *block);
+            *block = NULL_PTR;
+        }
+    }
+
+    if (allocator == TEST_HEAP)
+    {
+        printf("Test_PoolBench: heap_4 free list up to %u blocks, largest free block down to %u of %u free bytes\n",
+               (unsigned)maxFreeBlocks, (unsigned)minLargestBlock, (unsigned)freeAtMinLargest);
+    }
+
+    return failures;
+}
+
+/* The workload on one allocator without checks, host ns of the whole run */
+static uint64 testReplayTimed(uint32 allocator)
+{
+    uint64 start = hostTestNanoseconds();
+    uint32 i;
+
+    for (i = 0; i < g_testOpCount; i++)
+    {
+        const TestOp *op = &g_testOp[i];
+
+        if (op->size != 0)
+        {
+            g_testBlock[op->slot] = testAlloc(allocator, op->size);
+        }
+        else if (g_testBlock[op->slot] != NULL_PTR)
+        {
+            testFree(allocator, g_testBlock[op->slot]);
+            g_testBlock[op->slot] = NULL_PTR;
+        }
+    }
+
+    return hostTestNanoseconds() - start;
+}
+
+/* The block pools against heap_4 (configTOTAL_HEAP_SIZE, 16K against the 15K of the pools) on the same gateway
+ * workload. Checked: both hand out every buffer to one frame at a time and get everything back, the pools take every
+ * frame. Printed: frames not taken, host ns per call of the fastest of TEST_RUNS runs (relative figures, not the rate
+ * of the TC375; the pools pay their locked CMPSWAPs here, heap_4 runs without the scheduler lock it takes on target),
+ * the heap_4 free list and fragmentation and the high water mark and empty class hits of each pool.
+ */
+static void testPoolAgainstHeap4(void)
+{
+    HeapStats_t heap;
+    uint32      failures[TEST_ALLOCATORS];
+    uint64      best[TEST_ALLOCATORS];
+    uint32      a;
+    uint32      run;
+    uint32      i;
+
+    HOST_CHECK_EQ(testGenerateWorkload(), 0);
+
+    for (a = 0; a < TEST_ALLOCATORS; a++)
+    {
+        failures[a] = testReplayChecked(a);
+        best[a]     = UINT64_MAX;
+
+        for (run = 0; run < TEST_RUNS; run++)
+        {
+            uint64 ns = testReplayTimed(a);
+
+            best[a] = (ns < best[a]) ? ns : best[a];
+        }
+    }
+
+    /* Everything back: one free block in heap_4, no block in use in the pools */
+    vPortGetHeapStats(&heap);
+    HOST_CHECK_EQ(heap.xNumberOfFreeBlocks, 1);
+
+    for (i = 0; i < APP_POOL_CLASS_COUNT; i++)
+    {
+        HOST_CHECK_EQ(g_appPoolClass[i].ctrl->inUse, 0);
+    }
+
+    /* An empty class spills into the next larger one, no frame is refused */
+    HOST_CHECK_EQ(failures[TEST_POOL], 0);
+
+    for (a = 0; a < TEST_ALLOCATORS; a++)
+    {
+        printf("Test_PoolBench: %s %u calls, %u allocations failed, %.1f ns per call\n", g_testAllocatorName[a],
+               g_testOpCount, failures[a], (double)best[a] / g_testOpCount);
+    }
+
+    for (i = 0; i < APP_POOL_CLASS_COUNT; i++)
+    {
+        const AppPoolCtrl *ctrl = g_appPoolClass[i].ctrl;
+
+        printf("Test_PoolBench: pool %4u bytes: %u of %u blocks at most, found empty %u times\n",
+               g_appPoolClass[i].blockSize, ctrl->inUseMax, g_appPoolClass[i].blockCount, ctrl->failures);
+    }
+}
+
+int main(void)
+{
+    testPoolAgainstHeap4();
+
+    return hostTestResult("Test_PoolBench");
+}
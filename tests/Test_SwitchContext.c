@@ -0,0 +1,155 @@
+/**********************************************************************************************************************
+ * \file Test_SwitchContext.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "HostKernel.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_SWITCHES               1000000             /* vTaskSwitchContext() calls per run                         */
+#define TEST_RUNS                   5                   /* The fastest run counts                                     */
+#define TEST_PRIORITY               1                   /* Measuring task, alone at its priority                      */
+#define TEST_TOP_PRIORITY           (configMAX_PRIORITIES - 1)
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static StackType_t     g_testStack[2][configMINIMAL_STACK_SIZE];
+static StaticTask_t    g_testTcb[2];
+static TaskHandle_t    g_testTop;
+static TaskHandle_t    g_testMeasure;
+static volatile uint32 g_testTopRuns;
+static uint64          g_testSwitchNs = UINT64_MAX; /* Per TEST_SWITCHES calls                                     */
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Task at the top priority: runs once per resume */
+static void testTopTask(void *arg)
+{
+    (void)arg;
+
+    for (;;)
+    {
+        g_testTopRuns++;
+        vTaskSuspend(NULL);
+    }
+}
+
+/* TEST_SWITCHES times: the top priority task gets ready and leaves again, then optionally the selection of the next
+ * task. Host ns of the run.
+ */
+static uint64 testRun(boolean switchContext)
+{
+    uint64 start = hostTestNanoseconds();
+    uint32 i;
+
+    for (i = 0; i < TEST_SWITCHES; i++)
+    {
+        vTaskResume(g_testTop);
+        vTaskSuspend(g_testTop);
+
+        if (switchContext)
+        {
+            vTaskSwitchContext();
+        }
+    }
+
+    return hostTestNanoseconds() - start;
+}
+
+/* In a critical section, so that the readied top priority task is never switched in: vTaskSwitchContext() selects
+ * this task again after each round, which the linear scan finds TEST_TOP_PRIORITY - TEST_PRIORITY priorities down
+ * from the top one it last recorded, CLZ in one step.
+ */
+static void testMeasureTask(void *arg)
+{
+    uint32 runs = g_testTopRuns;
+    uint32 run;
+
+    (void)arg;
+
+    /* The selection is right: the readied top priority task preempts at once */
+    vTaskResume(g_testTop);
+    HOST_CHECK_EQ(g_testTopRuns, runs + 1);
+
+    taskENTER_CRITICAL();
+
+    for (run = 0; run < TEST_RUNS; run++)
+    {
+        uint64 bare     = testRun(FALSE);
+        uint64 switched = testRun(TRUE);
+
+        if ((switched > bare) && ((switched - bare) < g_testSwitchNs))
+        {
+            g_testSwitchNs = switched - bare;
+        }
+
+        HOST_CHECK(xTaskGetCurrentTaskHandle() == g_testMeasure);
+    }
+
+    taskEXIT_CRITICAL();
+
+    HOST_CHECK_EQ(g_testTopRuns, runs + 1);
+    vTaskEndScheduler();
+}
+
+/* Host ns of vTaskSwitchContext() after the task at the top priority left the ready list, for the configMAX_PRIORITIES
+ * and configUSE_PORT_OPTIMISED_TASK_SELECTION this build sets (tests/CMakeLists.txt builds 10 and 32 priorities with
+ * each selection). Printed (relative figures, not the cycles of the TC375): the linear scan grows with the
+ * priorities it steps down, the CLZ selection does not.
+ */
+static void testSwitchContext(void)
+{
+    g_testTop = xTaskCreateStatic(testTopTask, "TOP", configMINIMAL_STACK_SIZE, NULL_PTR, TEST_TOP_PRIORITY,
+                                  g_testStack[0], &g_testTcb[0]);
+    vTaskSuspend(g_testTop);
+    g_testMeasure = xTaskCreateStatic(testMeasureTask, "MEASURE", configMINIMAL_STACK_SIZE, NULL_PTR, TEST_PRIORITY,
+                                      g_testStack[1], &g_testTcb[1]);
+
+    vTaskStartScheduler();
+
+    HOST_CHECK(g_testSwitchNs != UINT64_MAX);
+    printf("Test_SwitchContext: %2u priorities, %s selection: vTaskSwitchContext() %.1f ns stepping down %u "
+           "priorities\n",
+           (unsigned)configMAX_PRIORITIES, (configUSE_PORT_OPTIMISED_TASK_SELECTION != 0) ? "CLZ   " : "linear",
+           (double)g_testSwitchNs / TEST_SWITCHES, (unsigned)(TEST_TOP_PRIORITY - TEST_PRIORITY));
+}
+
+int main(void)
+{
+    testSwitchContext();
+
+    return hostTestResult("Test_SwitchContext");
+}
@@ -0,0 +1,141 @@
+/**********************************************************************************************************************
+ * \file Test_Tickless.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "porttickless.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_TICK_COUNT             100000U             /* portTICK_COUNT: 100 MHz STM, 1 kHz tick                    */
+#define TEST_MAX_IDLE_TICKS         (0x7FFFFFFFU / TEST_TICK_COUNT)     /* portMAX_SUPPRESSED_TICKS               */
+#define TEST_RANDOM_CASES           1000000
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static uint32_t g_testRandom = 0x12345678U;
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* xorshift32, a fixed sequence so that a failure reproduces */
+static uint32_t testRandom(void)
+{
+    g_testRandom ^= g_testRandom << 13;
+    g_testRandom ^= g_testRandom >> 17;
+    g_testRandom ^= g_testRandom << 5;
+
+    return g_testRandom;
+}
+
+/* The invariants vPortSuppressTicksAndSleep() relies on, for one early wake-up */
+static void testCheckWakeup(uint32_t ulNextTick, uint32_t ulNow, uint32_t ulExpectedIdleTime)
+{
+    uint32_t ulTicks = ulPortTicklessCompleteTicks(ulNextTick, ulNow, ulExpectedIdleTime, TEST_TICK_COUNT);
+    uint32_t ulResume;
+
+    /* the tick interrupt of the sleep compare counts the last tick */
+    HOST_CHECK(ulTicks <= (ulExpectedIdleTime - 1));
+
+    /* every counted tick instant has passed */
+    if (ulTicks > 0)
+    {
+        HOST_CHECK((int32_t)(ulNow - (ulNextTick + ((ulTicks - 1) * TEST_TICK_COUNT))) >= 0);
+    }
+
+    /* below the limit the resumed tick is the first instant after ulNow: no tick lost, none counted twice */
+    if (ulTicks < (ulExpectedIdleTime - 1))
+    {
+        ulResume = ulNextTick + (ulTicks * TEST_TICK_COUNT);
+        HOST_CHECK((int32_t)(ulResume - ulNow) > 0);
+        HOST_CHECK((int32_t)(ulResume - ulNow) <= (int32_t)TEST_TICK_COUNT);
+    }
+}
+
+/* Wake-ups on and around the tick instants */
+static void testExactInstants(void)
+{
+    const uint32_t ulNextTick = 0x40000000U;
+
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick - 1, 10, TEST_TICK_COUNT), 0);
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick, 10, TEST_TICK_COUNT), 1);
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick + TEST_TICK_COUNT - 1, 10, TEST_TICK_COUNT), 1);
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick + TEST_TICK_COUNT, 10, TEST_TICK_COUNT), 2);
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick + (7 * TEST_TICK_COUNT), 10, TEST_TICK_COUNT), 8);
+
+    /* one instant before the sleep compare: the limit, the compare is left alone */
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick + (8 * TEST_TICK_COUNT), 10, TEST_TICK_COUNT), 9);
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick + (9 * TEST_TICK_COUNT), 10, TEST_TICK_COUNT), 9);
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick + (20 * TEST_TICK_COUNT), 10, TEST_TICK_COUNT), 9);
+
+    /* a sleep of two ticks never counts more than one */
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick, 2, TEST_TICK_COUNT), 1);
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick - 1, 2, TEST_TICK_COUNT), 0);
+}
+
+/* The same results across the 2^32 wrap of the STM */
+static void testWrap(void)
+{
+    const uint32_t ulNextTick = 0xFFFFFFF0U;
+
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick - 1, 10, TEST_TICK_COUNT), 0);
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, 0x00000005U, 10, TEST_TICK_COUNT), 1);
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(ulNextTick, ulNextTick + (3 * TEST_TICK_COUNT), 10, TEST_TICK_COUNT), 4);
+    HOST_CHECK_EQ(ulPortTicklessCompleteTicks(0x7FFFFFF0U, 0x80000010U, 10, TEST_TICK_COUNT), 1);
+
+    testCheckWakeup(ulNextTick, ulNextTick + (3 * TEST_TICK_COUNT) + 17, 10);
+    testCheckWakeup(ulNextTick, ulNextTick + ((TEST_MAX_IDLE_TICKS - 2) * TEST_TICK_COUNT), TEST_MAX_IDLE_TICKS);
+}
+
+/* Random sleeps up to portMAX_SUPPRESSED_TICKS, woken anywhere from before the first instant to past the end */
+static void testRandomWakeups(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < TEST_RANDOM_CASES; i++)
+    {
+        uint32_t ulNextTick         = testRandom();
+        uint32_t ulExpectedIdleTime = 2 + (testRandom() % (TEST_MAX_IDLE_TICKS - 1));
+        uint32_t ulSpan             = ulExpectedIdleTime * TEST_TICK_COUNT;
+        uint32_t ulNow              = ulNextTick - TEST_TICK_COUNT + (testRandom() % ulSpan);
+
+        testCheckWakeup(ulNextTick, ulNow, ulExpectedIdleTime);
+    }
+}
+
+int main(void)
+{
+    testExactInstants();
+    testWrap();
+    testRandomWakeups();
+
+    return hostTestResult("Test_Tickless");
+}
@@ -0,0 +1,299 @@
+/**********************************************************************************************************************
+ * \file Test_Trace.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "App_Trace.h"
+#include "IfxCpu.h"
+#include "TraceReader.h"
+#include "HostTest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TEST_TICKS                  2000                /* Run of the producer, 1 ms ticks                            */
+#define TEST_TICK_START             (0x1000000U - 800U) /* The 24 bit tick count wraps 0.8 s into the run              */
+#define TEST_CYCLES_PER_US          (configCPU_CLOCK_HZ / 1000000U)
+#define TEST_CCNT_START             (TRACE_CCNT_MASK - (700000U * TEST_CYCLES_PER_US))  /* CCNT wraps 0.7 s in        */
+#define TEST_SLEEP_CYCLE            50                  /* CPU2: awake 3 ticks, then tickless idle up to tick 50       */
+#define TEST_SLEEP_AWAKE            3
+#define TEST_EVENTS_MAX             (TEST_TICKS * 8)
+#define TEST_TICK_HZ                1000                /* configTICK_RATE_HZ                                         */
+#define TEST_NS_PER_TICK            (1000000000LL / TEST_TICK_HZ)
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+static TraceEvent g_testExpected[APP_TRACE_NUM_CORES][TEST_EVENTS_MAX];  /* Every event recorded, per core      */
+static uint32     g_testRecorded[APP_TRACE_NUM_CORES];
+static uint32     g_testTickCcnt[APP_TRACE_NUM_CORES];  /* CCNT of the core at the current tick                   */
+static uint64     g_testTick;                          /* Current tick, unfolded                                    */
+static uint8      g_testDump[APP_TRACE_NUM_CORES][sizeof(AppTraceRing)];
+static uint32     g_testRandom = 0x7A3C11E5U;
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* xorshift32, a fixed sequence so that a failure reproduces */
+static uint32 testRandom(void)
+{
+    g_testRandom ^= g_testRandom << 13;
+    g_testRandom ^= g_testRandom >> 17;
+    g_testRandom ^= g_testRandom << 5;
+
+    return g_testRandom;
+}
+
+/* Records an event on core at us after the current tick through the recorder of App_Trace.h, CCNT running since the
+ * tick, and keeps what the timeline must show of it
+ */
+static void testRecord(uint32 core, sint32 us, uint32 id, uint32 arg)
+{
+    TraceEvent *expected = &g_testExpected[core][g_testRecorded[core]];
+
+    g_hostCoreIndex   = core;
+    g_hostCcnt[core]  = (g_testTickCcnt[core] + (uint32)(us * (sint32)TEST_CYCLES_PER_US)) & TRACE_CCNT_MASK;
+    appTraceEvent(id, arg);
+
+    expected->time      = ((sint64)g_testTick * TEST_NS_PER_TICK) + ((sint64)us * 1000);
+    expected->sequence  = g_testRecorded[core];
+    expected->timestamp = g_hostCcnt[core];
+    expected->core      = (uint8)core;
+    expected->id        = (uint8)id;
+    expected->arg       = arg & APP_TRACE_ARG_MASK;
+    g_testRecorded[core]++;
+}
+
+/* A few events of a task at random times within the tick, after the tick event */
+static void testRecordWork(uint32 core, uint32 events)
+{
+    sint32 us = 1;
+    uint32 i;
+
+    for (i = 0; i < events; i++)
+    {
+        static const uint32 id[] = {APP_TRACE_TASK_SWITCHED_IN, APP_TRACE_QUEUE_SEND, APP_TRACE_QUEUE_RECEIVE,
+                                    APP_TRACE_ISR_ENTER, APP_TRACE_ISR_EXIT, APP_TRACE_QUEUE_BLOCK_RECEIVE};
+
+        us += 1 + (sint32)(testRandom() % 150);
+        testRecord(core, us, id[testRandom() % 6], testRandom() & 0xFFFFFFU);
+    }
+}
+
+static int testCompare(const void *a, const void *b)
+{
+    const TraceEvent *x = (const TraceEvent *)a;
+    const TraceEvent *y = (const TraceEvent *)b;
+
+    if (x->time != y->time)
+    {
+        return (x->time < y->time) ? -1 : 1;
+    }
+
+    if (x->core != y->core)
+    {
+        return (x->core < y->core) ? -1 : 1;
+    }
+
+    return (x->sequence < y->sequence) ? -1 : ((x->sequence > y->sequence) ? 1 : 0);
+}
+
+/* Synthetic producer: three cores record through appTraceEvent() for TEST_TICKS ticks. CPU0 is busy and overwrites
+ * its ring many times, CPU1 records its tick and an ISR now and then, CPU2 sleeps in tickless idle most of the time
+ * with its CCNT standing still. The tick count wraps its 24 bits and CCNT its 31 bits during the run.
+ */
+static void testProduce(void)
+{
+    uint32 t;
+    uint32 c;
+
+    for (c = 0; c < APP_TRACE_NUM_CORES; c++)
+    {
+        g_hostCoreIndex = c;
+        appTraceInit();
+        g_testTickCcnt[c] = TEST_CCNT_START + (c * 1000U);
+    }
+
+    g_testTick = TEST_TICK_START;
+
+    /* The tasks are created before the first tick: placed back from it */
+    for (c = 0; c < APP_TRACE_NUM_CORES; c++)
+    {
+        testRecord(c, -300, APP_TRACE_TASK_CREATE, 1);
+        testRecord(c, -200, APP_TRACE_TASK_CREATE, 2);
+    }
+
+    for (t = 0; t < TEST_TICKS; t++)
+    {
+        uint32 sleep = t % TEST_SLEEP_CYCLE;
+
+        if (t > 0)
+        {
+            g_testTick++;
+            g_testTickCcnt[0] += 1000U * TEST_CYCLES_PER_US;
+            g_testTickCcnt[1] += 1000U * TEST_CYCLES_PER_US;
+
+            if (sleep < TEST_SLEEP_AWAKE)
+            {
+                /* CCNT of CPU2 ran up to the tick, or stood still since it went to sleep */
+                g_testTickCcnt[2] = (sleep == 0) ? g_hostCcnt[2] : (g_testTickCcnt[2] + (1000U * TEST_CYCLES_PER_US));
+            }
+        }
+
+        testRecord(0, 0, APP_TRACE_TICK, (uint32)g_testTick);
+        testRecordWork(0, testRandom() % 6);
+
+        testRecord(1, 0, APP_TRACE_TICK, (uint32)g_testTick);
+
+        if ((t % 4) == 0)
+        {
+            testRecord(1, 20, APP_TRACE_ISR_ENTER, 40);
+            testRecord(1, 25, APP_TRACE_QUEUE_SEND_ISR, 0x7001A0);
+            testRecord(1, 27, APP_TRACE_ISR_EXIT, 40);
+        }
+
+        if (sleep < TEST_SLEEP_AWAKE)
+        {
+            testRecord(2, 0, APP_TRACE_TICK, (uint32)g_testTick);
+
+            if ((sleep == 0) && (t > 0))
+            {
+                testRecord(2, 3, APP_TRACE_IDLE_END, 0);
+            }
+
+            testRecordWork(2, 1 + (testRandom() % 2));
+
+            if (sleep == (TEST_SLEEP_AWAKE - 1))
+            {
+                testRecord(2, 990, APP_TRACE_IDLE_BEGIN, 0);
+            }
+        }
+    }
+}
+
+/* The rings of a synthetic producer, dumped as the debugger does (the bytes of g_appTraceRing[core]) and decoded by
+ * tools/trace: every event still in a ring is on the timeline once, in time order, at the time it was recorded (the
+ * tick plus the CCNT since the tick, also across the CCNT wrap, the 24 bit tick wrap and the tickless sleep of CPU2),
+ * the overwritten ones are counted as lost.
+ */
+static void testTrace(void)
+{
+    TraceRing      ring[APP_TRACE_NUM_CORES];
+    TraceTimeline  timeline;
+    TraceEvent    *expected;
+    size_t         count = 0;
+    sint64         offset;
+    uint32         c;
+    size_t         e;
+
+    /* The reader shares the format of App_Trace.h */
+    HOST_CHECK_EQ(TRACE_MAGIC, APP_TRACE_MAGIC);
+    HOST_CHECK_EQ(sizeof(AppTraceRing), TRACE_HEADER_SIZE + (APP_TRACE_DEPTH * TRACE_EVENT_SIZE));
+    HOST_CHECK_EQ(TRACE_TICK, APP_TRACE_TICK);
+    HOST_CHECK_EQ(TRACE_QUEUE_BLOCK_RECEIVE, APP_TRACE_QUEUE_BLOCK_RECEIVE);
+
+    testProduce();
+
+    expected = (TraceEvent *)malloc(APP_TRACE_NUM_CORES * APP_TRACE_DEPTH * sizeof(TraceEvent));
+
+    for (c = 0; c < APP_TRACE_NUM_CORES; c++)
+    {
+        uint32 kept = (g_testRecorded[c] < APP_TRACE_DEPTH) ? g_testRecorded[c] : APP_TRACE_DEPTH;
+
+        memcpy(g_testDump[c], g_appTraceRing[c], sizeof(AppTraceRing));
+        HOST_CHECK_EQ(traceRingLoad(&ring[c], g_testDump[c], sizeof(g_testDump[c])), 0);
+        HOST_CHECK_EQ(ring[c].count, kept);
+        HOST_CHECK_EQ(ring[c].lost, g_testRecorded[c] - kept);
+        HOST_CHECK_EQ(ring[c].cpuClockHz, configCPU_CLOCK_HZ);
+
+        memcpy(&expected[count], &g_testExpected[c][g_testRecorded[c] - kept], kept * sizeof(TraceEvent));
+        count += kept;
+    }
+
+    /* CPU0 and CPU1 lost most of their events, CPU2 none */
+    HOST_CHECK(ring[0].lost > 0);
+    HOST_CHECK(ring[1].lost > 0);
+    HOST_CHECK_EQ(ring[2].lost, 0);
+
+    qsort(expected, count, sizeof(TraceEvent), testCompare);
+    HOST_CHECK_EQ(traceTimelineBuild(&timeline, ring, APP_TRACE_NUM_CORES, TEST_TICK_HZ), 0);
+    HOST_CHECK_EQ(timeline.count, count);
+    HOST_CHECK_EQ(timeline.unplaced, 0);
+
+    /* The reader knows the tick count modulo 2^24 only */
+    offset = (count > 0) ? (timeline.event[0].time - expected[0].time) : 0;
+    HOST_CHECK_EQ(offset % (0x1000000LL * TEST_NS_PER_TICK), 0);
+
+    for (e = 0; (e < count) && (e < timeline.count); e++)
+    {
+        const TraceEvent *got  = &timeline.event[e];
+        const TraceEvent *want = &expected[e];
+
+        HOST_CHECK_EQ(got->core, want->core);
+        HOST_CHECK_EQ(got->sequence, want->sequence);
+        HOST_CHECK_EQ(got->id, want->id);
+        HOST_CHECK_EQ(got->arg, want->arg);
+        HOST_CHECK_EQ(got->timestamp, want->timestamp);
+        HOST_CHECK_EQ(got->time - offset, want->time);
+    }
+
+    printf("Test_Trace: %u/%u/%u events recorded, %zu on the timeline, %u/%u/%u lost\n", (unsigned)g_testRecorded[0],
+           (unsigned)g_testRecorded[1], (unsigned)g_testRecorded[2], timeline.count, (unsigned)ring[0].lost,
+           (unsigned)ring[1].lost, (unsigned)ring[2].lost);
+
+    /* A ring without tick cannot be placed */
+    {
+        TraceRing     lone = ring[2];
+        TraceTimeline none;
+
+        lone.count = 2;                                 /* the two task creations before the first tick */
+        lone.lost  = 0;
+        HOST_CHECK_EQ(traceTimelineBuild(&none, &lone, 1, TEST_TICK_HZ), 0);
+        HOST_CHECK_EQ(none.count, 0);
+        HOST_CHECK_EQ(none.unplaced, 2);
+        traceTimelineFree(&none);
+    }
+
+    /* A dump that is no ring */
+    g_testDump[0][0] ^= 0xFF;
+    HOST_CHECK(traceRingLoad(&ring[0], g_testDump[0], sizeof(g_testDump[0])) != 0);
+    HOST_CHECK(traceRingLoad(&ring[1], g_testDump[1], TRACE_HEADER_SIZE) != 0);
+
+    traceTimelineFree(&timeline);
+    free(expected);
+}
+
+int main(void)
+{
+    testTrace();
+
+    return hostTestResult("Test_Trace");
+}
@@ -0,0 +1,66 @@
+/**********************************************************************************************************************
+ * \file IfxCan.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef HOST_IFXCAN_H
+#define HOST_IFXCAN_H 1
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* The real iLLD header, next on the include path after host/ */
+#include_next "Can/Std/IfxCan.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* The iLLD writes IR, TXBAR, TXBCR and RXFnA with plain stores: the MCMCAN clears IR bits written with 1, adds and
+ * cancels the requested Tx buffers and moves the FIFO get index. On plain memory these stores would lose flags and
+ * requests, so the host sends them to the MCMCAN model (HostCan.c).
+ */
+#define IfxCan_Node_clearInterruptFlag(node, interrupt) \
+    hostCanClearInterruptFlagMask((node), 1U << (interrupt))
+#define IfxCan_Node_setTxBufferAddRequest(node, txBufferId) \
+    hostCanSetTxBufferAddRequestMask((node), 1U << (txBufferId))
+#define IfxCan_Node_setTxBufferAddRequestMask(node, txBufferMask) \
+    hostCanSetTxBufferAddRequestMask((node), (txBufferMask))
+#define IfxCan_Node_setTxBufferCancellationRequest(node, txBufferId) \
+    hostCanSetTxBufferCancellationRequestMask((node), 1U << (txBufferId))
+#define IfxCan_Node_setTxBufferCancellationRequestMask(node, txBufferMask) \
+    hostCanSetTxBufferCancellationRequestMask((node), (txBufferMask))
+#define IfxCan_Node_setRxFifo0AcknowledgeIndex(node, rxBufferNumber) \
+    hostCanSetRxFifoAcknowledgeIndex((node), IfxCan_RxFifo_0, (rxBufferNumber))
+#define IfxCan_Node_setRxFifo1AcknowledgeIndex(node, rxBufferNumber) \
+    hostCanSetRxFifoAcknowledgeIndex((node), IfxCan_RxFifo_1, (rxBufferNumber))
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+void hostCanClearInterruptFlagMask(Ifx_CAN_N *node, uint32 mask);
+void hostCanSetTxBufferAddRequestMask(Ifx_CAN_N *node, uint32 mask);
+void hostCanSetTxBufferCancellationRequestMask(Ifx_CAN_N *node, uint32 mask);
+void hostCanSetRxFifoAcknowledgeIndex(Ifx_CAN_N *node, IfxCan_RxFifo rxFifo, uint32 index);
+
+#endif /* HOST_IFXCAN_H */
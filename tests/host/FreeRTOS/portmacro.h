@@ -0,0 +1,139 @@
+/**********************************************************************************************************************
+ * \file portmacro.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdint.h>
+#include "FreeRTOSConfig.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Host port of the kernel (HostKernel.c): one simulated core, its tasks are ucontext coroutines of one host thread
+ * and time is simulated in STM ticks. It only passes when a task reports work (hostKernelBusy()) or the core sleeps
+ * in the idle task, so a run is deterministic and independent of the host load. The tick and the interrupts of the
+ * test are served between two steps of the time, a yield requested in a critical section or an ISR is taken when it
+ * ends, like the context switch interrupt of the TC3 port.
+ */
+#define portCHAR                 char
+#define portSHORT                short
+#define portLONG                 long
+#define portFLOAT                float
+#define portDOUBLE               double
+#define portSTACK_TYPE           uintptr_t             /* A stack word holds the host context of the task        */
+#define portBASE_TYPE            long
+#define portPOINTER_SIZE_TYPE    uintptr_t
+
+typedef portSTACK_TYPE       StackType_t;
+typedef long                 BaseType_t;
+typedef unsigned long        UBaseType_t;
+
+#if ( configUSE_16_BIT_TICKS == 1 )
+    typedef unsigned short   TickType_t;
+    #define portMAX_DELAY    ( TickType_t ) 0xffff
+#else
+    typedef unsigned int     TickType_t;
+    #define portMAX_DELAY    ( TickType_t ) 0xffffffffUL
+#endif
+
+/* FreeRTOS parameters */
+#define portTICK_TYPE_IS_ATOMIC        1
+#define portSTACK_GROWTH               ( -1 )
+#define portTICK_PERIOD_MS             ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT             8
+#define portCRITICAL_NESTING_IN_TCB    0
+
+/* Attributes */
+#define portDONT_DISCARD               __attribute__( ( used ) )
+#define portNORETURN                   __attribute__( ( noreturn ) )
+
+/* Instructions */
+#define portNOP()                      __asm__ __volatile__ ( "" )
+#define portMEMORY_BARRIER()           __sync_synchronize()
+#define portGET_CORE_ID()              ( ( UBaseType_t ) g_hostCoreIndex )
+
+/* Critical section management, a yield requested inside is taken by the exit of the outermost one */
+extern void vPortEnterCritical( void );
+extern void vPortExitCritical( void );
+extern void vPortSetInterrupts( BaseType_t xEnable );
+#define portENTER_CRITICAL()                                     vPortEnterCritical()
+#define portEXIT_CRITICAL()                                      vPortExitCritical()
+#define portENABLE_INTERRUPTS()                                  vPortSetInterrupts( pdTRUE )
+#define portDISABLE_INTERRUPTS()                                 vPortSetInterrupts( pdFALSE )
+#define portASSERT_IF_IN_ISR()                                   configASSERT( xPortInIsr() == pdFALSE )
+#define portSET_INTERRUPT_MASK_FROM_ISR()                        0
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( ulSavedMaskValue )    ( void ) ( ulSavedMaskValue )
+
+/* Yield: at once from a task outside a critical section, otherwise when the critical section or the ISR ends */
+extern void vPortYield( void );
+extern void vPortYieldFromIsr( BaseType_t xHigherPriorityTaskWoken );
+extern BaseType_t xPortInIsr( void );
+#define portYIELD()                                              vPortYield()
+#define portYIELD_FROM_ISR( xHigherPriorityTaskWoken )           vPortYieldFromIsr( xHigherPriorityTaskWoken )
+#define portEND_SWITCHING_ISR( xSwitchRequired )                 vPortYieldFromIsr( xSwitchRequired )
+
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+    #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+#endif
+
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+
+/* Check the configuration. */
+    #if ( configMAX_PRIORITIES > 32 )
+        #error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.
+    #endif
+
+/* The ready priority bitmap of the TC3 port, CLZ is the count leading zeros of the host compiler */
+    #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )      ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+    #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )       ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+    #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ( 31UL - ( ( uint32_t ) __builtin_clz( ( uint32_t ) ( uxReadyPriorities ) ) ) )
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+/* Function prototypes */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
+
+/* TCB handling: the host context and stack of a task are freed with its TCB */
+extern void vPortCleanUpTCB( void * pxTCB );
+#define portCLEAN_UP_TCB( pxTCB )    vPortCleanUpTCB( pxTCB )
+
+/* Per core scheduler instances: the host runs the instance of the core g_hostCoreIndex plays */
+#if ( configPER_CORE_SCHEDULER != 0 )
+    extern void vPortInitCoreData( void );
+#endif
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern __thread unsigned int g_hostCoreIndex;
+
+#endif /* PORTMACRO_H */
@@ -0,0 +1,580 @@
+/**********************************************************************************************************************
+ * \file HostCan.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include "HostCan.h"
+#include "IfxPort.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define HOST_CAN_MODULES            2
+#define HOST_CAN_GROUP(group)       ((group) + 1)       /* Flag routed by a group, 0: flag without service request    */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+Ifx_CAN g_hostModuleCan0;
+Ifx_CAN g_hostModuleCan1;
+
+uint32  g_hostCanAcknowledgeWrites;                     /* RXF0A/RXF1A writes since hostCanReset()                    */
+
+static Ifx_CAN *const g_hostCanModules[HOST_CAN_MODULES] = {&g_hostModuleCan0, &g_hostModuleCan1};
+
+/* Interrupt group of the IR flags the gateway uses, GRINT1/2 route a group to a service request line */
+static const uint8 g_hostCanFlagGroup[32] = {
+    [IfxCan_Interrupt_rxFifo0NewMessage]                = HOST_CAN_GROUP(IfxCan_InterruptGroup_rxf0n),
+    [IfxCan_Interrupt_rxFifo0WatermarkReached]          = HOST_CAN_GROUP(IfxCan_InterruptGroup_wati),
+    [IfxCan_Interrupt_rxFifo0Full]                      = HOST_CAN_GROUP(IfxCan_InterruptGroup_rxf0f),
+    [IfxCan_Interrupt_rxFifo0MessageLost]               = HOST_CAN_GROUP(IfxCan_InterruptGroup_rxf0f),
+    [IfxCan_Interrupt_rxFifo1NewMessage]                = HOST_CAN_GROUP(IfxCan_InterruptGroup_rxf1n),
+    [IfxCan_Interrupt_rxFifo1WatermarkReached]          = HOST_CAN_GROUP(IfxCan_InterruptGroup_wati),
+    [IfxCan_Interrupt_rxFifo1Full]                      = HOST_CAN_GROUP(IfxCan_InterruptGroup_rxf1f),
+    [IfxCan_Interrupt_rxFifo1MessageLost]               = HOST_CAN_GROUP(IfxCan_InterruptGroup_rxf1f),
+    [IfxCan_Interrupt_transmissionCompleted]            = HOST_CAN_GROUP(IfxCan_InterruptGroup_traco),
+    [IfxCan_Interrupt_transmissionCancellationFinished] = HOST_CAN_GROUP(IfxCan_InterruptGroup_traco),
+};
+
+/* Tx FIFO state of a node, the MCMCAN keeps it behind TXFQS */
+static struct
+{
+    uint8 getIndex;
+    uint8 putIndex;
+    uint8 fillLevel;
+} g_hostCanTxFifo[HOST_CAN_MODULES][4];
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+Ifx_CAN *hostCanModule(Ifx_CAN_N *node)
+{
+    uintptr_t address = (uintptr_t)node;
+
+    if ((address >= (uintptr_t)&g_hostModuleCan1) && (address < (uintptr_t)(&g_hostModuleCan1 + 1)))
+    {
+        return &g_hostModuleCan1;
+    }
+
+    return &g_hostModuleCan0;
+}
+
+static uint32 hostCanModuleIndex(Ifx_CAN_N *node)
+{
+    return (hostCanModule(node) == &g_hostModuleCan1) ? 1 : 0;
+}
+
+static uint32 hostCanNodeIndex(Ifx_CAN_N *node)
+{
+    return (uint32)(node - hostCanModule(node)->N);
+}
+
+/* Set an interrupt flag. A flag that rises while enabled raises the service request of the line its group is routed
+ * to (the MCMCAN signals on the edge of the flag, a flag which is already set does not request again).
+ */
+static void hostCanSetInterruptFlag(Ifx_CAN_N *node, IfxCan_Interrupt interrupt)
+{
+    uint32 bit   = 1U << interrupt;
+    uint32 group = g_hostCanFlagGroup[interrupt];
+    uint32 line;
+
+    if ((node->IR.U & bit) != 0)
+    {
+        return;
+    }
+
+    node->IR.U |= bit;
+
+    if (((node->IE.U & bit) != 0) && (group != 0))
+    {
+        group = group - 1;
+        line  = (group <= IfxCan_InterruptGroup_loi) ? (node->GRINT1.U >> (group * 4)) : (node->GRINT2.U >> ((group % 8) * 4));
+
+        IfxSrc_setRequest(IfxCan_getSrcPointer(hostCanModule(node), (IfxCan_InterruptLine)(line & 0xFU)));
+    }
+}
+
+/* Buffer number range of the Tx FIFO/queue of a node */
+static uint32 hostCanTxFifoFirst(Ifx_CAN_N *node)
+{
+    return node->TX.BC.B.NDTB;
+}
+
+static void hostCanTxFifoUpdateStatus(Ifx_CAN_N *node)
+{
+    uint32 m    = hostCanModuleIndex(node);
+    uint32 n    = hostCanNodeIndex(node);
+    uint32 size = node->TX.BC.B.TFQS;
+
+    node->TX.FQS.U       = 0;
+    node->TX.FQS.B.TFFL  = size - g_hostCanTxFifo[m][n].fillLevel;
+    node->TX.FQS.B.TFGI  = g_hostCanTxFifo[m][n].getIndex;
+    node->TX.FQS.B.TFQPI = g_hostCanTxFifo[m][n].putIndex;
+    node->TX.FQS.B.TFQF  = (g_hostCanTxFifo[m][n].fillLevel >= size) ? 1 : 0;
+}
+
+/* Clear the message RAM, the registers and the model state of both modules (registers at their reset values). */
+void hostCanReset(void)
+{
+    uint32 m;
+
+    uint32 n;
+
+    for (m = 0; m < HOST_CAN_MODULES; m++)
+    {
+        memset((void *)g_hostCanModules[m], 0, sizeof(Ifx_CAN));
+
+        for (n = 0; n < 4; n++)
+        {
+            g_hostCanModules[m]->N[n].XIDAM.U = 0x1FFFFFFFU;  /* reset value, the iLLD leaves it                       */
+        }
+    }
+
+    memset(g_hostCanTxFifo, 0, sizeof(g_hostCanTxFifo));
+    g_hostCanAcknowledgeWrites = 0;
+}
+
+/* Take over the node configuration, as clearing CCCR.INIT does: empty Tx FIFO/queue with the put index on its first
+ * buffer. Call after the nodes are initialised.
+ */
+void hostCanStart(void)
+{
+    uint32 m;
+    uint32 n;
+
+    for (m = 0; m < HOST_CAN_MODULES; m++)
+    {
+        for (n = 0; n < 4; n++)
+        {
+            Ifx_CAN_N *node = &g_hostCanModules[m]->N[n];
+
+            g_hostCanTxFifo[m][n].getIndex  = (uint8)hostCanTxFifoFirst(node);
+            g_hostCanTxFifo[m][n].putIndex  = (uint8)hostCanTxFifoFirst(node);
+            g_hostCanTxFifo[m][n].fillLevel = 0;
+            hostCanTxFifoUpdateStatus(node);
+        }
+    }
+}
+
+/* Store a frame in an Rx FIFO of a node at the put index, or lose it if the FIFO is full (blocking mode), as after
+ * acceptance filtering by the filter element filterIndex (HOST_CAN_NON_MATCHING: accepted by GFC). Returns FALSE if the
+ * frame is lost. RXF0C/RXF1C and RXF0S/RXF1S share their layout, both FIFOs are handled through the raw values.
+ */
+boolean hostCanStore(Ifx_CAN_N *node, IfxCan_RxFifo rxFifo, const HostCanFrame *frame, uint32 filterIndex)
+{
+    volatile Ifx_UReg_32Bit *config = (rxFifo == IfxCan_RxFifo_0) ? &node->RX.F0C.U : &node->RX.F1C.U;
+    volatile Ifx_UReg_32Bit *status = (rxFifo == IfxCan_RxFifo_0) ? &node->RX.F0S.U : &node->RX.F1S.U;
+    uint32                   size   = (*config >> 16) & 0x7FU;
+    uint32                   mark   = (*config >> 24) & 0x7FU;
+    uint32                   start  = *config & 0xFFFCU;
+    uint32                   fill   = *status & 0x7FU;
+    uint32                   put    = (*status >> 16) & 0x3FU;
+    uint32                   base   = (uint32)(uintptr_t)hostCanModule(node);
+    IfxCan_Interrupt         first  = (rxFifo == IfxCan_RxFifo_0) ? IfxCan_Interrupt_rxFifo0NewMessage : IfxCan_Interrupt_rxFifo1NewMessage;
+    Ifx_CAN_RXMSG           *element;
+    uint32                   length;
+    uint32                   i;
+
+    if (fill >= size)
+    {
+        *status |= 1U << 25;
+        hostCanSetInterruptFlag(node, (IfxCan_Interrupt)(first + 3));
+        return FALSE;
+    }
+
+    element = (rxFifo == IfxCan_RxFifo_0) ? IfxCan_Node_getRxFifo0ElementAddress(node, base, (uint16)start, (IfxCan_RxBufferId)put)
+                                          : IfxCan_Node_getRxFifo1ElementAddress(node, base, (uint16)start, (IfxCan_RxBufferId)put);
+
+    element->R0.U      = 0;
+    element->R0.B.XTD  = frame->extended ? 1 : 0;
+    element->R0.B.RTR  = frame->remote ? 1 : 0;
+    element->R0.B.ID   = frame->extended ? frame->id : (frame->id << 18);
+    element->R1.U      = 0;
+    element->R1.B.DLC  = frame->dlc;
+    element->R1.B.FDF  = frame->fd ? 1 : 0;
+    element->R1.B.BRS  = frame->bitRateSwitch ? 1 : 0;
+    element->R1.B.FIDX = (filterIndex != HOST_CAN_NON_MATCHING) ? filterIndex : 0;
+    element->R1.B.ANMF = (filterIndex != HOST_CAN_NON_MATCHING) ? 0 : 1;
+    length             = IfxCan_Node_getDataLengthInBytes((IfxCan_DataLengthCode)frame->dlc);
+
+    for (i = 0; i < length; i++)
+    {
+        ((volatile uint8 *)element)[8 + i] = frame->data[i];
+    }
+
+    put  = (put + 1) % size;
+    fill = fill + 1;
+    *status = (*status & ~((0x3FU << 16) | 0x7FU | (1U << 24))) | (put << 16) | fill | ((fill >= size) ? (1U << 24) : 0);
+
+    hostCanSetInterruptFlag(node, first);
+
+    if ((mark != 0) && (fill == mark))
+    {
+        hostCanSetInterruptFlag(node, (IfxCan_Interrupt)(first + 1));
+    }
+
+    if (fill >= size)
+    {
+        hostCanSetInterruptFlag(node, (IfxCan_Interrupt)(first + 2));
+    }
+
+    return TRUE;
+}
+
+/* Acceptance filtering of a received frame by the filter lists of the node (SIDFC/XIDFC, XIDAM) and GFC, the first
+ * matching enabled element decides. Priority filter elements count as store elements, storage into dedicated Rx
+ * buffers is not modelled (rejected). Returns FALSE if the frame is rejected or lost.
+ */
+boolean hostCanReceive(Ifx_CAN_N *node, const HostCanFrame *frame)
+{
+    uint32  base  = (uint32)(uintptr_t)hostCanModule(node);
+    uint32  count = frame->extended ? node->XIDFC.B.LSE : node->SIDFC.B.LSS;
+    uint32  id    = frame->extended ? (frame->id & node->XIDAM.B.EIDM) : frame->id;
+    uint32  config;
+    uint32  type;
+    uint32  id1;
+    uint32  id2;
+    uint32  filterId;
+    boolean match;
+    uint32  k;
+
+    if (frame->remote && (frame->extended ? node->GFC.B.RRFE : node->GFC.B.RRFS))
+    {
+        return FALSE;
+    }
+
+    for (k = 0; k < count; k++)
+    {
+        if (frame->extended)
+        {
+            Ifx_CAN_EXTMSG *element = (Ifx_CAN_EXTMSG *)(uintptr_t)(base + (node->XIDFC.B.FLESA << 2) + (8 * k));
+
+            config   = element->F0.B.EFEC;
+            type     = element->F1.B.EFT;
+            id1      = element->F0.B.EFID1;
+            id2      = element->F1.B.EFID2;
+            filterId = (type == 3) ? frame->id : id;
+        }
+        else
+        {
+            Ifx_CAN_STDMSG *element = (Ifx_CAN_STDMSG *)(uintptr_t)(base + (node->SIDFC.B.FLSSA << 2) + (4 * k));
+
+            config   = element->S0.B.SFEC;
+            type     = element->S0.B.SFT;
+            id1      = element->S0.B.SFID1;
+            id2      = element->S0.B.SFID2;
+            filterId = id;
+
+            if (type == 3)
+            {
+                continue;                               /* standard filter element disabled                           */
+            }
+        }
+
+        if (config == 0)
+        {
+            continue;
+        }
+
+        switch (type)
+        {
+            case 1:
+                match = (filterId == id1) || (filterId == id2);
+                break;
+            case 2:
+                match = (filterId & id2) == (id1 & id2);
+                break;
+            default:
+                match = (filterId >= id1) && (filterId <= id2);
+                break;
+        }
+
+        if (match)
+        {
+            if ((config == 1) || (config == 5))
+            {
+                return hostCanStore(node, IfxCan_RxFifo_0, frame, k);
+            }
+
+            if ((config == 2) || (config == 6))
+            {
+                return hostCanStore(node, IfxCan_RxFifo_1, frame, k);
+            }
+
+            return FALSE;
+        }
+    }
+
+    switch (frame->extended ? node->GFC.B.ANFE : node->GFC.B.ANFS)
+    {
+        case 0:
+            return hostCanStore(node, IfxCan_RxFifo_0, frame, HOST_CAN_NON_MATCHING);
+        case 1:
+            return hostCanStore(node, IfxCan_RxFifo_1, frame, HOST_CAN_NON_MATCHING);
+        default:
+            return FALSE;
+    }
+}
+
+/* Arbitration field of a Tx element, a lower value wins the bus: base ID, then RTR (standard) or SRR (extended,
+ * recessive), then IDE, then the ID extension and RTR of an extended frame.
+ */
+static uint32 hostCanArbitration(Ifx_CAN_TXMSG *element)
+{
+    uint32 id = element->T0.B.ID;
+
+    if (element->T0.B.XTD == 0)
+    {
+        return ((id >> 18) << 21) | ((uint32)element->T0.B.RTR << 20);
+    }
+
+    return ((id >> 18) << 21) | (1U << 20) | (1U << 19) | ((id & 0x3FFFFU) << 1) | element->T0.B.RTR;
+}
+
+/* The node wins the bus with its highest priority pending Tx buffer (equal IDs: lowest buffer number; of a Tx FIFO
+ * only the element at the get index takes part) and sends it. Returns FALSE if no buffer is pending.
+ */
+boolean hostCanTransmit(Ifx_CAN_N *node, HostCanFrame *frame)
+{
+    uint32         m       = hostCanModuleIndex(node);
+    uint32         n       = hostCanNodeIndex(node);
+    uint32         base    = (uint32)(uintptr_t)hostCanModule(node);
+    uint16         start   = (uint16)(node->TX.BC.U & 0xFFFCU);
+    uint32         pending = node->TX.BRP.U;
+    uint32         fifo    = ((node->TX.BC.B.TFQS != 0) && (node->TX.BC.B.TFQM == 0)) ? (uint32)node->TX.BC.B.TFQS : 0;
+    uint32         first   = hostCanTxFifoFirst(node);
+    uint32         winner  = 32;
+    uint32         best    = 0;
+    uint32         length;
+    uint32         k;
+    Ifx_CAN_TXMSG *element;
+
+    for (k = 0; k < 32; k++)
+    {
+        if ((pending & (1U << k)) == 0)
+        {
+            continue;
+        }
+
+        if ((fifo != 0) && (k >= first) && (k < first + fifo) && (k != g_hostCanTxFifo[m][n].getIndex))
+        {
+            continue;
+        }
+
+        element = IfxCan_Node_getTxBufferElementAddress(node, base, start, (IfxCan_TxBufferId)k);
+
+        if ((winner == 32) || (hostCanArbitration(element) < best))
+        {
+            winner = k;
+            best   = hostCanArbitration(element);
+        }
+    }
+
+    if (winner == 32)
+    {
+        return FALSE;
+    }
+
+    element              = IfxCan_Node_getTxBufferElementAddress(node, base, start, (IfxCan_TxBufferId)winner);
+    frame->extended      = element->T0.B.XTD;
+    frame->remote        = element->T0.B.RTR;
+    frame->id            = frame->extended ? element->T0.B.ID : (element->T0.B.ID >> 18);
+    frame->fd            = element->T1.B.FDF;
+    frame->bitRateSwitch = element->T1.B.BRS;
+    frame->dlc           = element->T1.B.DLC;
+    length               = IfxCan_Node_getDataLengthInBytes((IfxCan_DataLengthCode)frame->dlc);
+
+    for (k = 0; k < length; k++)
+    {
+        frame->data[k] = ((volatile uint8 *)element)[8 + k];
+    }
+
+    node->TX.BRP.U &= ~(1U << winner);
+    node->TX.BTO.U |= 1U << winner;
+
+    if ((fifo != 0) && (winner >= first) && (winner < first + fifo))
+    {
+        g_hostCanTxFifo[m][n].getIndex = (uint8)(first + ((winner - first + 1) % fifo));
+        g_hostCanTxFifo[m][n].fillLevel--;
+        hostCanTxFifoUpdateStatus(node);
+    }
+
+    if ((node->TX.BTIE.U & (1U << winner)) != 0)
+    {
+        hostCanSetInterruptFlag(node, IfxCan_Interrupt_transmissionCompleted);
+    }
+
+    return TRUE;
+}
+
+/*------------------------------------------------Register writes----------------------------------------------------*/
+/* IR: bits written with 1 are cleared */
+void hostCanClearInterruptFlagMask(Ifx_CAN_N *node, uint32 mask)
+{
+    node->IR.U &= ~mask;
+}
+
+/* TXBAR: the buffers become pending, their occurred and cancellation finished bits are reset. Requests at the put
+ * index of a Tx FIFO/queue advance it.
+ */
+void hostCanSetTxBufferAddRequestMask(Ifx_CAN_N *node, uint32 mask)
+{
+    uint32 m     = hostCanModuleIndex(node);
+    uint32 n     = hostCanNodeIndex(node);
+    uint32 size  = node->TX.BC.B.TFQS;
+    uint32 first = hostCanTxFifoFirst(node);
+
+    node->TX.BRP.U |= mask;
+    node->TX.BTO.U &= ~mask;
+    node->TX.BCF.U &= ~mask;
+
+    while ((size != 0) && (g_hostCanTxFifo[m][n].fillLevel < size) && ((mask & (1U << g_hostCanTxFifo[m][n].putIndex)) != 0))
+    {
+        mask                          &= ~(1U << g_hostCanTxFifo[m][n].putIndex);
+        g_hostCanTxFifo[m][n].putIndex = (uint8)(first + ((g_hostCanTxFifo[m][n].putIndex - first + 1) % size));
+        g_hostCanTxFifo[m][n].fillLevel++;
+    }
+
+    if (size != 0)
+    {
+        hostCanTxFifoUpdateStatus(node);
+    }
+}
+
+/* TXBCR: pending buffers are cancelled at once (the model never has a frame on the bus between two calls) */
+void hostCanSetTxBufferCancellationRequestMask(Ifx_CAN_N *node, uint32 mask)
+{
+    uint32 cancelled = node->TX.BRP.U & mask;
+
+    if (cancelled == 0)
+    {
+        return;
+    }
+
+    node->TX.BRP.U &= ~cancelled;
+    node->TX.BCF.U |= cancelled;
+
+    if ((node->TX.BCIE.U & cancelled) != 0)
+    {
+        hostCanSetInterruptFlag(node, IfxCan_Interrupt_transmissionCancellationFinished);
+    }
+}
+
+/* RXFnA: the elements up to the acknowledged index are free, the get index moves behind it */
+void hostCanSetRxFifoAcknowledgeIndex(Ifx_CAN_N *node, IfxCan_RxFifo rxFifo, uint32 index)
+{
+    volatile Ifx_UReg_32Bit *config = (rxFifo == IfxCan_RxFifo_0) ? &node->RX.F0C.U : &node->RX.F1C.U;
+    volatile Ifx_UReg_32Bit *status = (rxFifo == IfxCan_RxFifo_0) ? &node->RX.F0S.U : &node->RX.F1S.U;
+    uint32                   size   = (*config >> 16) & 0x7FU;
+    uint32                   fill   = *status & 0x7FU;
+    uint32                   get    = (*status >> 8) & 0x3FU;
+    uint32                   freed  = ((index + size - get) % size) + 1;
+
+    __atomic_fetch_add(&g_hostCanAcknowledgeWrites, 1, __ATOMIC_RELAXED);
+
+    if (rxFifo == IfxCan_RxFifo_0)
+    {
+        node->RX.F0A.U = index;
+    }
+    else
+    {
+        node->RX.F1A.U = index;
+    }
+
+    if (freed > fill)
+    {
+        freed = fill;
+    }
+
+    get  = (get + freed) % size;
+    fill = fill - freed;
+    *status = (*status & ~((0x3FU << 8) | 0x7FU | (1U << 24))) | (get << 8) | fill;
+}
+
+/* A register write of the host DMA model: IR, TXBAR, TXBCR and RXFnA of a node go through the MCMCAN semantics, every
+ * other address is plain memory.
+ */
+void hostCanWriteRegister(volatile uint32 *address, uint32 value)
+{
+    uint32 m;
+    uint32 n;
+
+    for (m = 0; m < HOST_CAN_MODULES; m++)
+    {
+        for (n = 0; n < 4; n++)
+        {
+            Ifx_CAN_N *node = &g_hostCanModules[m]->N[n];
+
+            if (address == &node->IR.U)
+            {
+                hostCanClearInterruptFlagMask(node, value);
+                return;
+            }
+            else if (address == &node->TX.BAR.U)
+            {
+                hostCanSetTxBufferAddRequestMask(node, value);
+                return;
+            }
+            else if (address == &node->TX.BCR.U)
+            {
+                hostCanSetTxBufferCancellationRequestMask(node, value);
+                return;
+            }
+            else if (address == &node->RX.F0A.U)
+            {
+                hostCanSetRxFifoAcknowledgeIndex(node, IfxCan_RxFifo_0, value);
+                return;
+            }
+            else if (address == &node->RX.F1A.U)
+            {
+                hostCanSetRxFifoAcknowledgeIndex(node, IfxCan_RxFifo_1, value);
+                return;
+            }
+        }
+    }
+
+    *address = value;
+}
+
+/*--------------------------------------------------Port pins--------------------------------------------------------*/
+/* The transceiver pins are not modelled, the pin setup of IfxCan_Node_initRxPin()/initTxPin() does nothing */
+void IfxPort_setPinMode(Ifx_P *port, uint8 pinIndex, IfxPort_Mode mode)
+{
+    (void)port;
+    (void)pinIndex;
+    (void)mode;
+}
+
+void IfxPort_setPinPadDriver(Ifx_P *port, uint8 pinIndex, IfxPort_PadDriver padDriver)
+{
+    (void)port;
+    (void)pinIndex;
+    (void)padDriver;
+}
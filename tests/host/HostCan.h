@@ -0,0 +1,79 @@
+/**********************************************************************************************************************
+ * \file HostCan.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef HOSTCAN_H_
+#define HOSTCAN_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <Can/Std/IfxCan.h>                            /* Through the include path: the host wrapper   */
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define HOST_CAN_NON_MATCHING       0xFFFFFFFFU         /* hostCanStore(): frame accepted as non-matching (GFC)       */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* A frame on the bus side of the MCMCAN model */
+typedef struct
+{
+    uint32  id;
+    boolean extended;
+    boolean remote;
+    boolean fd;
+    boolean bitRateSwitch;
+    uint8   dlc;
+    uint8   data[64];
+} HostCanFrame;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern uint32 g_hostCanAcknowledgeWrites;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Hardware side of the MCMCAN model. The message RAM and the node registers are plain memory, the model does what the
+ * MCMCAN does on its own: it filters received frames into the Rx FIFOs, picks the Tx buffer that wins arbitration,
+ * keeps the FIFO indices and raises the interrupt flags and the service requests routed by GRINT1/2.
+ */
+boolean   hostCanReceive(Ifx_CAN_N *node, const HostCanFrame *frame);
+boolean   hostCanStore(Ifx_CAN_N *node, IfxCan_RxFifo rxFifo, const HostCanFrame *frame, uint32 filterIndex);
+boolean   hostCanTransmit(Ifx_CAN_N *node, HostCanFrame *frame);
+Ifx_CAN  *hostCanModule(Ifx_CAN_N *node);
+void      hostCanReset(void);
+void      hostCanStart(void);
+
+/* Register write with set/clear semantics, for the DMA model of HostDma.c. The iLLD accessors of these registers reach the
+ * model through Can/Std/IfxCan.h of the host.
+ */
+void      hostCanWriteRegister(volatile uint32 *address, uint32 value);
+
+#endif /* HOSTCAN_H_ */
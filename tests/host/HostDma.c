@@ -0,0 +1,145 @@
+/**********************************************************************************************************************
+ * \file HostDma.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdint.h>
+#include "HostDma.h"
+#include "HostCan.h"
+#include "IfxDma_reg.h"
+#include "Dma/Std/IfxDma.h"
+#include "Src/Std/IfxSrc.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define HOST_DMA_CHAIN_LIMIT        1024                /* Transactions started by SCH per request, ends a looped list */
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* One transaction of a channel: TREL moves of 32 bit from SADR to DADR, each address stepped by its increment of
+ * ADICR. Writes go through hostCanWriteRegister(), so MCMCAN registers keep their set/clear semantics. Block mode,
+ * circular buffers and the other move sizes are not modelled (the gateway does not use them).
+ */
+static void hostDmaTransaction(Ifx_DMA_CH *channel)
+{
+    uint32 moves  = (channel->CHCFGR.B.TREL != 0) ? channel->CHCFGR.B.TREL : 1;
+    uint32 source = channel->SADR.U;
+    uint32 dest   = channel->DADR.U;
+    sint32 srcStep;
+    sint32 dstStep;
+    uint32 i;
+
+    srcStep = (sint32)(4U << channel->ADICR.B.SMF);
+    dstStep = (sint32)(4U << channel->ADICR.B.DMF);
+    srcStep = (channel->ADICR.B.INCS != 0) ? srcStep : -srcStep;
+    dstStep = (channel->ADICR.B.INCD != 0) ? dstStep : -dstStep;
+
+    for (i = 0; i < moves; i++)
+    {
+        hostCanWriteRegister((volatile uint32 *)(uintptr_t)dest, *(volatile uint32 *)(uintptr_t)source);
+        source += (uint32)srcStep;
+        dest   += (uint32)dstStep;
+    }
+}
+
+/* End of a transaction in linked list mode: the set at SHADR replaces the channel registers. A loaded SIT raises the
+ * channel interrupt, a loaded SCH starts the next transaction at once. Returns TRUE if it did. The write only bits
+ * are consumed, as the hardware does not keep them.
+ */
+static boolean hostDmaLoadNext(IfxDma_ChannelId channelId)
+{
+    Ifx_DMA_CH *channel = &MODULE_DMA.CH[channelId];
+    boolean     start;
+
+    if (channel->ADICR.B.SHCT != IfxDma_ChannelShadow_linkedList)
+    {
+        return FALSE;
+    }
+
+    *channel = *(Ifx_DMA_CH *)(uintptr_t)channel->SHADR.U;
+    start    = (channel->CHCSR.B.SCH != 0) ? TRUE : FALSE;
+
+    if (channel->CHCSR.B.SIT != 0)
+    {
+        volatile Ifx_SRC_SRCR *src = IfxDma_getSrcPointer(&MODULE_DMA, channelId);
+
+        channel->CHCSR.B.ICH = 1;
+
+        if (src->B.SRE != 0)
+        {
+            src->B.SRR = 1;
+        }
+    }
+
+    channel->CHCSR.B.SCH = 0;
+    channel->CHCSR.B.SIT = 0;
+
+    return start;
+}
+
+/* A DMA request of channel channelId: its transaction and the ones chained by SCH. The enable of the hardware request
+ * is kept in ECH (write only on the target, plain memory here), as IfxDma_Dma_initChannel() leaves it.
+ */
+static uint32 hostDmaRequest(IfxDma_ChannelId channelId)
+{
+    uint32 count = 0;
+
+    if (MODULE_DMA.TSR[channelId].B.ECH == 0)
+    {
+        return 0;
+    }
+
+    do
+    {
+        hostDmaTransaction(&MODULE_DMA.CH[channelId]);
+        count++;
+    } while ((hostDmaLoadNext(channelId) != FALSE) && (count < HOST_DMA_CHAIN_LIMIT));
+
+    return count;
+}
+
+uint32 hostDmaService(void)
+{
+    volatile Ifx_SRC_SRCR *src   = (volatile Ifx_SRC_SRCR *)&MODULE_SRC;
+    uint32                 lines = sizeof(Ifx_SRC) / sizeof(Ifx_SRC_SRCR);
+    uint32                 count = 0;
+    uint32                 i;
+
+    for (i = 0; i < lines; i++)
+    {
+        if ((src[i].B.TOS == IfxSrc_Tos_dma) && (src[i].B.SRE != 0) && (src[i].B.SRR != 0))
+        {
+            src[i].B.SRR = 0;
+            count       += hostDmaRequest((IfxDma_ChannelId)src[i].B.SRPN);
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,473 @@
+/**********************************************************************************************************************
+ * \file HostKernel.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+#include "HostKernel.h"
+#include "IfxCpu.h"
+#include "task.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define HOST_KERNEL_STACK_SIZE      (256U * 1024U)      /* Host stack of a task, the task stack only anchors it     */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Host context of a task, its address is the one word of the task stack the port uses (pxTopOfStack) */
+typedef struct
+{
+    ucontext_t      context;
+    TaskFunction_t  code;
+    void           *parameters;
+    void           *stack;
+} HostKernelTask;
+
+typedef struct
+{
+    uint64          time;                               /* Due time                                                 */
+    HostKernelIsr   isr;                                /* NULL: free                                               */
+    void           *arg;
+} HostKernelAlarm;
+
+typedef struct
+{
+    volatile Ifx_SRC_SRCR *src;
+    HostKernelIsr          isr;
+    void                  *arg;
+} HostKernelSource;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+void (*g_hostKernelIdleHook)(void);
+
+/* Running task, first word of its TCB is pxTopOfStack (tasks.c) */
+extern void *volatile pxCurrentTCB;
+
+static ucontext_t       g_hostKernelMain;               /* vTaskStartScheduler(), resumed by vTaskEndScheduler()    */
+static uint64           g_hostKernelTime;
+static uint64           g_hostKernelNextTick;
+static UBaseType_t      g_hostKernelNesting;            /* Critical sections entered by the running task            */
+static boolean          g_hostKernelInIsr;
+static boolean          g_hostKernelYieldPending;
+static HostKernelAlarm  g_hostKernelAlarm[HOST_KERNEL_ALARMS];
+static HostKernelSource g_hostKernelSource[HOST_KERNEL_SOURCES];
+static uint32           g_hostKernelSources;
+
+/* Idle and timer task memory of the instance */
+static StaticTask_t     g_hostKernelIdleTcb;
+static StackType_t      g_hostKernelIdleStack[configMINIMAL_STACK_SIZE];
+static StaticTask_t     g_hostKernelTimerTcb;
+static StackType_t      g_hostKernelTimerStack[configTIMER_TASK_STACK_DEPTH];
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static HostKernelTask *hostKernelTaskOf(void *tcb)
+{
+    return (HostKernelTask *)(**(StackType_t *volatile *)tcb);
+}
+
+/* The time of the STM stand-ins follows the simulated time */
+static void hostKernelSetTime(uint64 time)
+{
+    g_hostKernelTime        = time;
+    g_hostModuleStm0.TIM0.U = (uint32)time;
+    g_hostModuleStm1.TIM0.U = (uint32)time;
+    g_hostModuleStm2.TIM0.U = (uint32)time;
+}
+
+/* Earliest of the next tick and the pending alarms */
+static uint64 hostKernelNextEvent(void)
+{
+    uint64 next = g_hostKernelNextTick;
+    uint32 i;
+
+    for (i = 0; i < HOST_KERNEL_ALARMS; i++)
+    {
+        if ((g_hostKernelAlarm[i].isr != NULL_PTR) && (g_hostKernelAlarm[i].time < next))
+        {
+            next = g_hostKernelAlarm[i].time;
+        }
+    }
+
+    return next;
+}
+
+static void hostKernelIsr(HostKernelIsr isr, void *arg)
+{
+    boolean enabled = IfxCpu_disableInterrupts();
+
+    g_hostKernelInIsr = TRUE;
+    isr(arg);
+    g_hostKernelInIsr = FALSE;
+    IfxCpu_restoreInterrupts(enabled);
+}
+
+/* Serve one interrupt due at the current time: the tick first, then the alarms, then the attached lines by SRPN.
+ * Returns FALSE if nothing was due.
+ */
+static boolean hostKernelServeOne(void)
+{
+    HostKernelSource *source = NULL_PTR;
+    Ifx_SRC_SRCR      request;
+    uint32            i;
+
+    if (g_hostKernelTime >= g_hostKernelNextTick)
+    {
+        g_hostKernelNextTick += HOST_KERNEL_TICK;
+        g_hostKernelInIsr     = TRUE;
+
+        if (xTaskIncrementTick() != pdFALSE)
+        {
+            g_hostKernelYieldPending = TRUE;
+        }
+
+        g_hostKernelInIsr = FALSE;
+
+        return TRUE;
+    }
+
+    for (i = 0; i < HOST_KERNEL_ALARMS; i++)
+    {
+        HostKernelAlarm *alarm = &g_hostKernelAlarm[i];
+
+        if ((alarm->isr != NULL_PTR) && (alarm->time <= g_hostKernelTime))
+        {
+            HostKernelIsr isr = alarm->isr;
+
+            alarm->isr = NULL_PTR;
+            hostKernelIsr(isr, alarm->arg);
+
+            return TRUE;
+        }
+    }
+
+    for (i = 0; i < g_hostKernelSources; i++)
+    {
+        volatile Ifx_SRC_SRCR *src = g_hostKernelSource[i].src;
+
+        if ((src->B.SRE != 0) && (src->B.SRR != 0) &&
+            ((source == NULL_PTR) || (src->B.SRPN > source->src->B.SRPN)))
+        {
+            source = &g_hostKernelSource[i];
+        }
+    }
+
+    if (source == NULL_PTR)
+    {
+        return FALSE;
+    }
+
+    request.U     = 0;
+    request.B.SRR = 1;
+    __atomic_fetch_and(&source->src->U, ~request.U, __ATOMIC_SEQ_CST);
+    hostKernelIsr(source->isr, source->arg);
+
+    return TRUE;
+}
+
+/* Switch to the task the scheduler selects */
+static void hostKernelSwitch(void)
+{
+    HostKernelTask *from = hostKernelTaskOf(pxCurrentTCB);
+    HostKernelTask *to;
+
+    vTaskSwitchContext();
+    to = hostKernelTaskOf(pxCurrentTCB);
+
+    if (to != from)
+    {
+        (void)swapcontext(&from->context, &to->context);
+    }
+}
+
+/* Interrupts due and a pending yield, taken when the running task is outside of critical sections. A switch returns
+ * once the task runs again.
+ */
+static void hostKernelServe(void)
+{
+    if ((g_hostKernelNesting != 0) || g_hostKernelInIsr || (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED))
+    {
+        return;
+    }
+
+    while (hostKernelServeOne())
+    {
+    }
+
+    if (g_hostKernelYieldPending)
+    {
+        g_hostKernelYieldPending = FALSE;
+        hostKernelSwitch();
+    }
+}
+
+/* WAIT of the simulated core (hostCpuWait()): the time jumps to the next interrupt unless one is pending */
+static boolean hostKernelWait(uint32 core)
+{
+    uint64  next    = hostKernelNextEvent();
+    boolean pending = FALSE;
+    uint32  i;
+
+    (void)core;
+
+    for (i = 0; i < g_hostKernelSources; i++)
+    {
+        pending = pending || ((g_hostKernelSource[i].src->B.SRE != 0) && (g_hostKernelSource[i].src->B.SRR != 0));
+    }
+
+    if (!pending && (next > g_hostKernelTime))
+    {
+        hostKernelSetTime(next);
+    }
+
+    hostKernelServe();
+
+    return TRUE;
+}
+
+/* Entry of every task on its host stack */
+static void hostKernelTaskEntry(void)
+{
+    HostKernelTask *task = hostKernelTaskOf(pxCurrentTCB);
+
+    task->code(task->parameters);
+
+    /* A task must not return */
+    vPortAssert(__FILE__, __LINE__);
+}
+
+uint64 hostKernelTime(void)
+{
+    return g_hostKernelTime;
+}
+
+void hostKernelBusy(uint32 ticks)
+{
+    uint64 remaining = ticks;
+
+    if (g_hostKernelInIsr || (g_hostKernelNesting != 0))
+    {
+        hostKernelSetTime(g_hostKernelTime + ticks);
+
+        return;
+    }
+
+    for (;;)
+    {
+        uint64 step;
+
+        hostKernelServe();
+
+        if (remaining == 0)
+        {
+            break;
+        }
+
+        step      = hostKernelNextEvent() - g_hostKernelTime;
+        step      = (step < remaining) ? step : remaining;
+        remaining = remaining - step;
+        hostKernelSetTime(g_hostKernelTime + step);
+    }
+}
+
+void hostKernelAlarm(uint32 delay, HostKernelIsr isr, void *arg)
+{
+    uint32 i;
+
+    for (i = 0; i < HOST_KERNEL_ALARMS; i++)
+    {
+        if (g_hostKernelAlarm[i].isr == NULL_PTR)
+        {
+            g_hostKernelAlarm[i].time = g_hostKernelTime + delay;
+            g_hostKernelAlarm[i].arg  = arg;
+            g_hostKernelAlarm[i].isr  = isr;
+
+            return;
+        }
+    }
+
+    vPortAssert(__FILE__, __LINE__);
+}
+
+void hostKernelAttach(volatile Ifx_SRC_SRCR *src, HostKernelIsr isr, void *arg)
+{
+    configASSERT(g_hostKernelSources < HOST_KERNEL_SOURCES);
+
+    g_hostKernelSource[g_hostKernelSources].src = src;
+    g_hostKernelSource[g_hostKernelSources].isr = isr;
+    g_hostKernelSource[g_hostKernelSources].arg = arg;
+    g_hostKernelSources++;
+}
+
+/* Port layer */
+StackType_t *pxPortInitialiseStack(StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters)
+{
+    HostKernelTask *task = calloc(1, sizeof(HostKernelTask));
+
+    configASSERT(task != NULL_PTR);
+    task->code       = pxCode;
+    task->parameters = pvParameters;
+    task->stack      = malloc(HOST_KERNEL_STACK_SIZE);
+    configASSERT(task->stack != NULL_PTR);
+
+    (void)getcontext(&task->context);
+    task->context.uc_stack.ss_sp   = task->stack;
+    task->context.uc_stack.ss_size = HOST_KERNEL_STACK_SIZE;
+    task->context.uc_link          = NULL_PTR;
+    makecontext(&task->context, hostKernelTaskEntry, 0);
+
+    *pxTopOfStack = (StackType_t)task;
+
+    return pxTopOfStack;
+}
+
+BaseType_t xPortStartScheduler(void)
+{
+    g_hostKernelNextTick = g_hostKernelTime + HOST_KERNEL_TICK;
+    g_hostKernelNesting  = 0;
+    g_hostCpuInterrupt   = hostKernelWait;
+    IfxCpu_restoreInterrupts(TRUE);
+
+    (void)swapcontext(&g_hostKernelMain, &hostKernelTaskOf(pxCurrentTCB)->context);
+
+    g_hostCpuInterrupt = NULL_PTR;
+
+    return pdFALSE;
+}
+
+void vPortEndScheduler(void)
+{
+    g_hostKernelNesting = 0;
+    (void)swapcontext(&hostKernelTaskOf(pxCurrentTCB)->context, &g_hostKernelMain);
+}
+
+void vPortEnterCritical(void)
+{
+    IfxCpu_disableInterrupts();
+    g_hostKernelNesting++;
+}
+
+void vPortExitCritical(void)
+{
+    configASSERT(g_hostKernelNesting != 0);
+    g_hostKernelNesting--;
+
+    if (g_hostKernelNesting == 0)
+    {
+        IfxCpu_restoreInterrupts(TRUE);
+        hostKernelServe();
+    }
+}
+
+void vPortSetInterrupts(BaseType_t xEnable)
+{
+    IfxCpu_restoreInterrupts(xEnable != pdFALSE);
+}
+
+void vPortYield(void)
+{
+    g_hostKernelYieldPending = TRUE;
+    hostKernelServe();
+}
+
+void vPortYieldFromIsr(BaseType_t xHigherPriorityTaskWoken)
+{
+    if (xHigherPriorityTaskWoken != pdFALSE)
+    {
+        g_hostKernelYieldPending = TRUE;
+    }
+}
+
+BaseType_t xPortInIsr(void)
+{
+    return g_hostKernelInIsr ? pdTRUE : pdFALSE;
+}
+
+void vPortCleanUpTCB(void *pxTCB)
+{
+    HostKernelTask *task = hostKernelTaskOf(pxTCB);
+
+    free(task->stack);
+    free(task);
+}
+
+#if configPER_CORE_SCHEDULER != 0
+/* One instance per program, its data is the plain static data of the kernel */
+void vPortInitCoreData(void)
+{
+}
+#endif
+
+void vPortAssert(const char *pcFile, int iLine)
+{
+    fprintf(stderr, "%s:%d: kernel assertion failed\n", pcFile, iLine);
+    abort();
+}
+
+/* Application hooks of the kernel */
+void vApplicationIdleHook(void)
+{
+    if (g_hostKernelIdleHook != NULL_PTR)
+    {
+        g_hostKernelIdleHook();
+    }
+    else
+    {
+        hostCpuWait();
+    }
+}
+
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName)
+{
+    (void)xTask;
+    fprintf(stderr, "%s: stack overflow\n", pcTaskName);
+    abort();
+}
+
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer,
+                                   uint32_t *pulIdleTaskStackSize)
+{
+    *ppxIdleTaskTCBBuffer   = &g_hostKernelIdleTcb;
+    *ppxIdleTaskStackBuffer = g_hostKernelIdleStack;
+    *pulIdleTaskStackSize   = configMINIMAL_STACK_SIZE;
+}
+
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer,
+                                    uint32_t *pulTimerTaskStackSize)
+{
+    *ppxTimerTaskTCBBuffer   = &g_hostKernelTimerTcb;
+    *ppxTimerTaskStackBuffer = g_hostKernelTimerStack;
+    *pulTimerTaskStackSize   = configTIMER_TASK_STACK_DEPTH;
+}
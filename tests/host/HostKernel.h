@@ -0,0 +1,82 @@
+/**********************************************************************************************************************
+ * \file HostKernel.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef HOSTKERNEL_H_
+#define HOSTKERNEL_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Src/Std/IfxSrc.h"
+#include "Stm/Std/IfxStm.h"
+#include "FreeRTOS.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Host port of FreeRTOS (portmacro.h of host/FreeRTOS): the scheduler of one core on simulated time. The time runs in
+ * STM ticks and is written to the TIM0 of every STM stand-in, so the code under test reads it as usual. A kernel test
+ * builds the kernel with the target configuration (FreeRTOSConfig.h of host/FreeRTOS) and this file, creates its
+ * tasks and starts the scheduler; vTaskEndScheduler() from a task returns from vTaskStartScheduler().
+ */
+#define HOST_KERNEL_TICK            (HOST_STM_FREQUENCY / configTICK_RATE_HZ)   /* STM ticks per kernel tick     */
+#define HOST_KERNEL_ALARMS          16                                          /* Alarms pending at a time        */
+#define HOST_KERNEL_SOURCES         8                                           /* Service requests served         */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* ISR of the simulated core */
+typedef void (*HostKernelIsr)(void *arg);
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Idle hook of the test (ipcNotifyIdle() like the target), NULL: sleep until the next tick or interrupt */
+extern void (*g_hostKernelIdleHook)(void);
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Simulated time, STM ticks since the start of the program */
+uint64 hostKernelTime(void);
+
+/* Work of the running task: the time passes by ticks, the tick and the interrupts due meanwhile are served and may
+ * preempt the task, which then finishes the rest of its work once it runs again. From an ISR the time passes without
+ * serving anything, the ISR is not preempted.
+ */
+void hostKernelBusy(uint32 ticks);
+
+/* Interrupt from outside the core (another core, a peripheral): isr runs in interrupt context after delay ticks */
+void hostKernelAlarm(uint32 delay, HostKernelIsr isr, void *arg);
+
+/* Service request line of the core: isr runs in interrupt context whenever the line is enabled and requested, the
+ * request is cleared first. Lines with a higher SRPN are served first.
+ */
+void hostKernelAttach(volatile Ifx_SRC_SRCR *src, HostKernelIsr isr, void *arg);
+
+#endif /* HOSTKERNEL_H_ */
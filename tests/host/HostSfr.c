@@ -0,0 +1,81 @@
+/**********************************************************************************************************************
+ * \file HostSfr.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <sched.h>
+#include <time.h>
+#include "IfxCpu.h"
+#include "IfxDma_reg.h"
+#include "Src/Std/IfxSrc.h"
+#include "Stm/Std/IfxStm.h"
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+__thread uint32  g_hostCoreIndex;
+__thread boolean g_hostInterruptsEnabled = TRUE;
+__thread void    (*g_hostPreemptHook)(volatile void *address);
+uint32           g_hostCcnt[3];
+Ifx_SRC          g_hostModuleSrc;
+Ifx_STM          g_hostModuleStm0;
+Ifx_STM          g_hostModuleStm1;
+Ifx_STM          g_hostModuleStm2;
+Ifx_DMA          g_hostModuleDma;
+volatile boolean g_hostStmRunning;
+boolean          (*volatile g_hostCpuInterrupt)(uint32 core);
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* STM time of the running stand-in: the monotonic clock of the host at HOST_STM_FREQUENCY */
+uint32 hostStmNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32)((((uint64)now.tv_sec * 1000000000U) + (uint64)now.tv_nsec) / (1000000000U / HOST_STM_FREQUENCY));
+}
+
+void hostCpuWait(void)
+{
+    boolean (*dispatch)(uint32 core);
+
+    for (;;)
+    {
+        dispatch = g_hostCpuInterrupt;
+
+        if ((dispatch != NULL_PTR) && (dispatch(g_hostCoreIndex) != FALSE))
+        {
+            return;
+        }
+
+        sched_yield();
+    }
+}
@@ -0,0 +1,86 @@
+/**********************************************************************************************************************
+ * \file HostTest.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "HostTest.h"
+#include <stdio.h>
+#include <time.h>
+
+/*********************************************************************************************************************/
+/*--------------------------------------------Private Variables/Constants--------------------------------------------*/
+/*********************************************************************************************************************/
+/* Failed checks so far, checks may fail on several threads of a stress test */
+static volatile int g_hostTestFailures;
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Report a failed check, further failures of a run are still reported but only the first 50 are printed */
+void hostTestFail(const char *file, int line, const char *expr, int hasValues, uint64_t actual, uint64_t expected)
+{
+    int failures = __sync_add_and_fetch(&g_hostTestFailures, 1);
+
+    if (failures > 50)
+    {
+        return;
+    }
+
+    if (hasValues != 0)
+    {
+        fprintf(stderr, "%s:%d: check failed: %s (0x%llx, expected 0x%llx)\n", file, line, expr,
+                (unsigned long long)actual, (unsigned long long)expected);
+    }
+    else
+    {
+        fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+    }
+}
+
+/* Exit status of a test: 0 if every check passed */
+int hostTestResult(const char *name)
+{
+    if (g_hostTestFailures != 0)
+    {
+        fprintf(stderr, "%s: %d check(s) failed\n", name, g_hostTestFailures);
+        return 1;
+    }
+
+    printf("%s: passed\n", name);
+    return 0;
+}
+
+/* Monotonic time in nanoseconds, for the throughput and latency figures the benchmarks print */
+uint64_t hostTestNanoseconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
@@ -0,0 +1,69 @@
+/**********************************************************************************************************************
+ * \file HostTest.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef HOSTTEST_H_
+#define HOSTTEST_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdint.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Checks of the host tests: a failed check is reported with its location and fails the test, the test goes on so
+ * that one run shows every failed check. main() of a test returns hostTestResult().
+ */
+#define HOST_CHECK(expr)                                                                                              \
+    do                                                                                                                \
+    {                                                                                                                 \
+        if (!(expr))                                                                                                  \
+        {                                                                                                             \
+            hostTestFail(__FILE__, __LINE__, #expr, 0, 0, 0);                                                         \
+        }                                                                                                             \
+    } while (0)
+
+/* Equality check which also reports both values */
+#define HOST_CHECK_EQ(actual, expected)                                                                               \
+    do                                                                                                                \
+    {                                                                                                                 \
+        uint64_t hostActual   = (uint64_t)(actual);                                                                   \
+        uint64_t hostExpected = (uint64_t)(expected);                                                                 \
+        if (hostActual != hostExpected)                                                                               \
+        {                                                                                                             \
+            hostTestFail(__FILE__, __LINE__, #actual " == " #expected, 1, hostActual, hostExpected);                  \
+        }                                                                                                             \
+    } while (0)
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+void     hostTestFail(const char *file, int line, const char *expr, int hasValues, uint64_t actual, uint64_t expected);
+int      hostTestResult(const char *name);
+uint64_t hostTestNanoseconds(void);
+
+#endif /* HOSTTEST_H_ */
@@ -0,0 +1,116 @@
+/**********************************************************************************************************************
+ * \file IfxCpu.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef IFXCPU_H
+#define IFXCPU_H 1
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu_Intrinsics.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* The host has one address space, local and global DSPR addresses are the same */
+#define IFXCPU_GLB_ADDR_DSPR(cpu, address) ((void)(cpu), (unsigned)(address))
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef enum
+{
+    IfxCpu_Id_0 = 0,
+    IfxCpu_Id_1 = 1,
+    IfxCpu_Id_2 = 2,
+    IfxCpu_Id_none
+} IfxCpu_Id;
+
+typedef enum
+{
+    IfxCpu_CounterMode_normal = 0,
+    IfxCpu_CounterMode_task   = 1
+} IfxCpu_CounterMode;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Core a host thread plays, set by the test before it runs firmware code (HostSfr.c) */
+extern __thread uint32 g_hostCoreIndex;
+
+/* Interrupt enable (ICR.IE) of the core a host thread plays: only tracked, nothing preempts a host thread */
+extern __thread boolean g_hostInterruptsEnabled;
+
+/* Interrupt dispatch of a test for hostCpuWait(): serves one pending service request of the core, FALSE if none */
+extern boolean (*volatile g_hostCpuInterrupt)(uint32 core);
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+/* WAIT of the core a host thread plays: yields until g_hostCpuInterrupt() served a request of the core */
+void hostCpuWait(void);
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Inline Functions--------------------------------------------------*/
+/*********************************************************************************************************************/
+IFX_INLINE uint32 IfxCpu_getCoreIndex(void)
+{
+    return g_hostCoreIndex;
+}
+
+IFX_INLINE IfxCpu_Id IfxCpu_getCoreId(void)
+{
+    return (IfxCpu_Id)g_hostCoreIndex;
+}
+
+IFX_INLINE boolean IfxCpu_areInterruptsEnabled(void)
+{
+    return g_hostInterruptsEnabled;
+}
+
+IFX_INLINE boolean IfxCpu_disableInterrupts(void)
+{
+    boolean enabled = g_hostInterruptsEnabled;
+
+    g_hostInterruptsEnabled = FALSE;
+
+    return enabled;
+}
+
+IFX_INLINE void IfxCpu_restoreInterrupts(boolean enabled)
+{
+    g_hostInterruptsEnabled = enabled;
+}
+
+/* Of the performance counters only CCNT is modelled, a test moves it (g_hostCcnt) */
+IFX_INLINE void IfxCpu_resetAndStartCounters(IfxCpu_CounterMode mode)
+{
+    (void)mode;
+    g_hostCcnt[g_hostCoreIndex] = 0;
+}
+
+#endif /* IFXCPU_H */
@@ -0,0 +1,91 @@
+/**********************************************************************************************************************
+ * \file IfxCpu_Intrinsics.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef IFXCPU_INTRINSICS_H
+#define IFXCPU_INTRINSICS_H 1
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu_reg.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Host stand-in of the TriCore intrinsics used by the target independent modules. CMPSWAP.W and DSYNC map to the
+ * GCC atomics (full barriers) and the interrupt enable is a no-op. Of the core registers CORE_ID reads the core the
+ * thread plays and CCNT the clock counter a test sets for that core (g_hostCcnt), all others read as 0.
+ */
+#define __cmpAndSwap(address, value, condition) hostCmpAndSwap((address), (value), (condition))
+#define __dsync()                   __sync_synchronize()
+#define __mfcr(regaddr)             hostMfcr(regaddr)
+#define __disable()                 ((void)0)
+#define __enable()                  ((void)0)
+#define __abs(value)                ((value) < 0 ? -(value) : (value))
+#define __absf(value)               ((value) < 0.0f ? -(value) : (value))
+#define __getbit(address, bitoffset) ((*(address) >> (bitoffset)) & 1U)
+#define __clz(value)                (((value) != 0U) ? __builtin_clz(value) : 32)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Runs once before the next CMPSWAP of the calling thread, like an interrupt taken just before the instruction: a
+ * test preempts a lock-free update at its most exposed point with it (HostSfr.c). Cleared before it is called.
+ */
+extern __thread void (*g_hostPreemptHook)(volatile void *address);
+
+/* Core a host thread plays (IfxCpu.h), and CCNT of each core: it only moves when a test writes it (HostSfr.c) */
+extern __thread uint32 g_hostCoreIndex;
+extern uint32          g_hostCcnt[3];
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Inline Functions--------------------------------------------------*/
+/*********************************************************************************************************************/
+IFX_INLINE uint32 hostMfcr(uint32 regaddr)
+{
+    if (regaddr == CPU_CORE_ID)
+    {
+        return g_hostCoreIndex;
+    }
+
+    return (regaddr == CPU_CCNT) ? g_hostCcnt[g_hostCoreIndex] : 0U;
+}
+
+IFX_INLINE unsigned int hostCmpAndSwap(unsigned int volatile *address, unsigned int value, unsigned int condition)
+{
+    void (*hook)(volatile void *address) = g_hostPreemptHook;
+
+    if (hook != NULL_PTR)
+    {
+        g_hostPreemptHook = NULL_PTR;
+        hook(address);
+    }
+
+    return __sync_val_compare_and_swap(address, condition, value);
+}
+
+#endif /* IFXCPU_INTRINSICS_H */
@@ -0,0 +1,97 @@
+/**********************************************************************************************************************
+ * \file Ifx_Types.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef IFX_TYPES_H
+#define IFX_TYPES_H 1
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Host stand-in of the iLLD Ifx_Types.h for the host tests: the AUTOSAR base types with their TriCore widths
+ * (Platform_Types.h maps uint32 to unsigned long, which is 64 bit on the host) and the compiler keywords the target
+ * independent modules use.
+ */
+#define TRUE                        1
+#define FALSE                       0
+#define NULL_PTR                    ((void *)0)
+
+#define IFX_INLINE                  static inline
+#define IFX_STATIC                  static
+#define IFX_EXTERN                  extern
+#define IFX_CONST                   const
+#define IFX_ALIGN(n)                __attribute__((aligned(n)))
+#define IFX_UNUSED_PARAMETER(x)     ((void)(x))
+
+/* An ISR is a plain function on the host, the tests call it */
+#define IFX_INTERRUPT(isr, vectabNum, priority) void isr(void)
+
+/* The host has no not cached LMU alias (App_IpcRing.h): rings and pools are used at their own address */
+#define IPC_NOT_CACHED(address)     ((void *)(address))
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef unsigned char               boolean;
+typedef uint8_t                     uint8;
+typedef uint16_t                    uint16;
+typedef uint32_t                    uint32;
+typedef uint64_t                    uint64;
+typedef int8_t                      sint8;
+typedef int16_t                     sint16;
+typedef int32_t                     sint32;
+typedef int64_t                     sint64;
+typedef float                       float32;
+typedef double                      float64;
+
+typedef uint16                      Ifx_Priority;
+
+/* Pin input selection of the iLLD pin maps */
+typedef enum
+{
+    Ifx_RxSel_a,
+    Ifx_RxSel_b,
+    Ifx_RxSel_c,
+    Ifx_RxSel_d,
+    Ifx_RxSel_e,
+    Ifx_RxSel_f,
+    Ifx_RxSel_g,
+    Ifx_RxSel_h
+} Ifx_RxSel;
+
+/* Module address and index map of the iLLD module configurations */
+typedef struct
+{
+    volatile void *module;
+    sint32         index;
+} IfxModule_IndexMap;
+
+#endif /* IFX_TYPES_H */
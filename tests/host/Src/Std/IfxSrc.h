@@ -0,0 +1,91 @@
+/**********************************************************************************************************************
+ * \file IfxSrc.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef IFXSRC_H
+#define IFXSRC_H 1
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxSrc_regdef.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Host stand-in of the SRC module: the service request registers are plain memory (HostSfr.c), a test reads the
+ * requests set by the code under test from them.
+ */
+#define MODULE_SRC                  g_hostModuleSrc
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef enum
+{
+    IfxSrc_Tos_cpu0 = 0,
+    IfxSrc_Tos_dma  = 1,
+    IfxSrc_Tos_cpu1 = 2,
+    IfxSrc_Tos_cpu2 = 3
+} IfxSrc_Tos;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern Ifx_SRC g_hostModuleSrc;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Inline Functions--------------------------------------------------*/
+/*********************************************************************************************************************/
+IFX_INLINE void IfxSrc_init(volatile Ifx_SRC_SRCR *src, IfxSrc_Tos typOfService, Ifx_Priority priority)
+{
+    src->B.SRPN = priority;
+    src->B.TOS  = typOfService;
+}
+
+IFX_INLINE void IfxSrc_enable(volatile Ifx_SRC_SRCR *src)
+{
+    src->B.SRE = 1;
+}
+
+IFX_INLINE void IfxSrc_disable(volatile Ifx_SRC_SRCR *src)
+{
+    src->B.SRE = 0;
+}
+
+/* SETR is write only, the host keeps the request in SRR. Set atomically: a test running the cores as threads has
+ * other threads setting and clearing requests of the same register.
+ */
+IFX_INLINE void IfxSrc_setRequest(volatile Ifx_SRC_SRCR *src)
+{
+    Ifx_SRC_SRCR request;
+
+    request.U     = 0;
+    request.B.SRR = 1;
+    __atomic_fetch_or(&src->U, request.U, __ATOMIC_SEQ_CST);
+}
+
+#endif /* IFXSRC_H */
@@ -0,0 +1,166 @@
+/**********************************************************************************************************************
+ * \file IfxStm.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef IFXSTM_H
+#define IFXSTM_H 1
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxStm_regdef.h"
+#include "Src/Std/IfxSrc.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Host stand-in of STM0..2: plain memory (HostSfr.c), a timer only moves when a test writes its TIM0. A compare
+ * match raises nothing, a test checks CMP[] against the timer it moves. A test of threads playing the cores sets
+ * g_hostStmRunning instead: every STM then reads the monotonic clock of the host.
+ */
+#define MODULE_STM0                 g_hostModuleStm0
+#define MODULE_STM1                 g_hostModuleStm1
+#define MODULE_STM2                 g_hostModuleStm2
+
+/* STM clock of the default TC37x clock tree */
+#define HOST_STM_FREQUENCY          100000000U
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef enum
+{
+    IfxStm_Comparator_0 = 0,
+    IfxStm_Comparator_1
+} IfxStm_Comparator;
+
+typedef enum
+{
+    IfxStm_ComparatorInterrupt_ir0 = 0,
+    IfxStm_ComparatorInterrupt_ir1 = 1
+} IfxStm_ComparatorInterrupt;
+
+typedef enum
+{
+    IfxStm_ComparatorOffset_0 = 0
+} IfxStm_ComparatorOffset;
+
+typedef enum
+{
+    IfxStm_ComparatorSize_32Bits = 31
+} IfxStm_ComparatorSize;
+
+typedef struct
+{
+    IfxStm_Comparator          comparator;
+    IfxStm_ComparatorInterrupt comparatorInterrupt;
+    IfxStm_ComparatorOffset    compareOffset;
+    IfxStm_ComparatorSize      compareSize;
+    uint32                     ticks;
+    Ifx_Priority               triggerPriority;
+    IfxSrc_Tos                 typeOfService;
+} IfxStm_CompareConfig;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+extern Ifx_STM          g_hostModuleStm0;
+extern Ifx_STM          g_hostModuleStm1;
+extern Ifx_STM          g_hostModuleStm2;
+extern volatile boolean g_hostStmRunning;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+uint32 hostStmNow(void);
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Inline Functions--------------------------------------------------*/
+/*********************************************************************************************************************/
+IFX_INLINE uint32 IfxStm_getLower(Ifx_STM *stm)
+{
+    return (g_hostStmRunning != FALSE) ? hostStmNow() : stm->TIM0.U;
+}
+
+IFX_INLINE sint32 IfxStm_getTicksFromMicroseconds(Ifx_STM *stm, uint32 microSeconds)
+{
+    (void)stm;
+
+    return (sint32)(((uint64)microSeconds * HOST_STM_FREQUENCY) / 1000000U);
+}
+
+IFX_INLINE sint32 IfxStm_getTicksFromMilliseconds(Ifx_STM *stm, uint32 milliSeconds)
+{
+    (void)stm;
+
+    return (sint32)(((uint64)milliSeconds * HOST_STM_FREQUENCY) / 1000U);
+}
+
+IFX_INLINE void IfxStm_updateCompare(Ifx_STM *stm, IfxStm_Comparator comparator, uint32 ticks)
+{
+    stm->CMP[comparator].U = ticks;
+}
+
+IFX_INLINE void IfxStm_clearCompareFlag(Ifx_STM *stm, IfxStm_Comparator comparator)
+{
+    if (comparator == IfxStm_Comparator_0)
+    {
+        stm->ICR.B.CMP0IR = 0;
+    }
+    else
+    {
+        stm->ICR.B.CMP1IR = 0;
+    }
+}
+
+IFX_INLINE void IfxStm_initCompareConfig(IfxStm_CompareConfig *config)
+{
+    config->comparator          = IfxStm_Comparator_0;
+    config->comparatorInterrupt = IfxStm_ComparatorInterrupt_ir0;
+    config->compareOffset       = IfxStm_ComparatorOffset_0;
+    config->compareSize         = IfxStm_ComparatorSize_32Bits;
+    config->ticks               = 0xFFFFFFFFU;
+    config->triggerPriority     = 0;
+    config->typeOfService       = IfxSrc_Tos_cpu0;
+}
+
+IFX_INLINE boolean IfxStm_initCompare(Ifx_STM *stm, const IfxStm_CompareConfig *config)
+{
+    stm->CMP[config->comparator].U = stm->TIM0.U + config->ticks;
+
+    if (config->comparator == IfxStm_Comparator_0)
+    {
+        stm->ICR.B.CMP0EN = 1;
+    }
+    else
+    {
+        stm->ICR.B.CMP1EN = 1;
+    }
+
+    return TRUE;
+}
+
+#endif /* IFXSTM_H */
@@ -0,0 +1,205 @@
+/**********************************************************************************************************************
+ * \file CanLogReader.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "CanLogReader.h"
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static uint32_t canLogWord(const uint8_t *bytes)
+{
+    return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+/* Record count of a plausible batch header at offset which fits into the log, 0 if there is none */
+static uint32_t canLogBatchAt(const CanLogReader *reader, size_t offset)
+{
+    const uint8_t *header = &reader->data[offset];
+    uint32_t       info;
+    uint32_t       count;
+
+    if (((reader->size - offset) < CANLOG_HEADER_SIZE) || (canLogWord(header) != CANLOG_MAGIC))
+    {
+        return 0;
+    }
+
+    info  = canLogWord(&header[4]);
+    count = info >> 16;
+
+    if (((info & 0xFFU) != CANLOG_VERSION) || (((info >> 8) & 0xFFU) != CANLOG_RECORD_SIZE) || (count == 0))
+    {
+        return 0;
+    }
+
+    if (((reader->size - offset - CANLOG_HEADER_SIZE) / CANLOG_RECORD_SIZE) < count)
+    {
+        return 0;                                    /* cut off at the end of the log */
+    }
+
+    return count;
+}
+
+/* Indexes the log image data of size bytes, which must stay valid until canLogClose(). 0: done, -1: out of memory. */
+int canLogIndex(CanLogReader *reader, const uint8_t *data, size_t size)
+{
+    size_t capacity = 0;
+    size_t offset   = 0;
+
+    reader->data         = data;
+    reader->size         = size;
+    reader->batch        = NULL;
+    reader->batchCount   = 0;
+    reader->recordCount  = 0;
+    reader->skippedBytes = 0;
+
+    while (offset < size)
+    {
+        uint32_t     count = canLogBatchAt(reader, offset);
+        CanLogBatch *batch;
+
+        if (count == 0)
+        {
+            reader->skippedBytes++;
+            offset++;
+            continue;
+        }
+
+        if (reader->batchCount == capacity)
+        {
+            CanLogBatch *grown;
+
+            capacity = (capacity == 0) ? 64 : (capacity * 2);
+            grown    = (CanLogBatch *)realloc(reader->batch, capacity * sizeof(CanLogBatch));
+
+            if (grown == NULL)
+            {
+                return -1;
+            }
+
+            reader->batch = grown;
+        }
+
+        batch           = &reader->batch[reader->batchCount];
+        batch->offset   = offset;
+        batch->sequence = canLogWord(&data[offset + 8]);
+        batch->dropped  = canLogWord(&data[offset + 12]);
+        batch->count    = count;
+
+        reader->batchCount++;
+        reader->recordCount += count;
+        offset              += CANLOG_HEADER_SIZE + ((size_t)count * CANLOG_RECORD_SIZE);
+    }
+
+    return 0;
+}
+
+/* Maps the log file at path read only and indexes it. 0: done, -1: the file cannot be read (errno set). */
+int canLogOpen(CanLogReader *reader, const char *path)
+{
+    struct stat info;
+    void       *mapping = NULL;
+    int         fd      = open(path, O_RDONLY);
+
+    memset(reader, 0, sizeof(*reader));
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    if (info.st_size > 0)
+    {
+        mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            close(fd);
+            return -1;
+        }
+    }
+
+    close(fd);                                       /* the mapping stays valid */
+
+    reader->mapping = mapping;
+
+    if (canLogIndex(reader, (const uint8_t *)mapping, (size_t)info.st_size) != 0)
+    {
+        canLogClose(reader);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* Releases the index and the mapping of canLogOpen() */
+void canLogClose(CanLogReader *reader)
+{
+    if (reader->mapping != NULL)
+    {
+        munmap(reader->mapping, reader->size);
+    }
+
+    free(reader->batch);
+    memset(reader, 0, sizeof(*reader));
+}
+
+/* Decodes record index (0 .. batch->count - 1) of a batch of the index */
+void canLogGetRecord(const CanLogReader *reader, const CanLogBatch *batch, uint32_t index, CanLogRecord *record)
+{
+    const uint8_t *bytes = &reader->data[batch->offset + CANLOG_HEADER_SIZE + ((size_t)index * CANLOG_RECORD_SIZE)];
+
+    record->timestamp = canLogWord(&bytes[0]);
+    record->id        = canLogWord(&bytes[4]);
+    record->node      = bytes[8];
+    record->flags     = bytes[9];
+    record->dlc       = bytes[10];
+    record->length    = (bytes[11] > CANLOG_DATA_SIZE) ? CANLOG_DATA_SIZE : bytes[11];
+
+    memset(record->data, 0, sizeof(record->data));
+    memcpy(record->data, &bytes[12], record->length);
+}
+
+/* CAN identifier of an id word: 29 bit for extended frames, 11 bit for standard frames */
+uint32_t canLogCanId(uint32_t id)
+{
+    return ((id & CANLOG_ID_XTD) != 0) ? (id & CANLOG_ID_EXT_MASK) : ((id & CANLOG_ID_EXT_MASK) >> CANLOG_ID_STD_SHIFT);
+}
@@ -0,0 +1,110 @@
+/**********************************************************************************************************************
+ * \file CanLogReader.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef CANLOGREADER_H_
+#define CANLOGREADER_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Host reader of the CAN frame log of App_CanLog.c (format: see App_CanLog.h).
+ *
+ * The log file (or a memory image of it) is mapped once and indexed: the reader scans for the batch magic, accepts
+ * a batch whose info word is plausible and which fits into the log, and continues right behind it. Bytes between
+ * batches (a lost byte on the link, a log started in the middle of a batch) are skipped and counted, a batch cut
+ * off at the end of the log is left out. The records are decoded from the mapped bytes on access, all words little
+ * endian whatever the host byte order.
+ */
+#define CANLOG_MAGIC                0x31474C43U                 /* "CLG1" in memory order                            */
+#define CANLOG_VERSION              1
+#define CANLOG_HEADER_SIZE          16                          /* Bytes per batch header                            */
+#define CANLOG_RECORD_SIZE          32                          /* Bytes per record                                  */
+#define CANLOG_DATA_SIZE            20                          /* Payload bytes per record                          */
+#define CANLOG_BATCH_RECORDS_MAX    0xFFFF                      /* Record count field of the info word               */
+
+/* Record flags */
+#define CANLOG_FLAG_FD              0x01U                       /* CAN FD frame (FDF)                                */
+#define CANLOG_FLAG_BRS             0x02U                       /* Bit rate switch                                   */
+#define CANLOG_FLAG_TRUNCATED       0x04U                       /* Payload longer than CANLOG_DATA_SIZE              */
+
+/* Fields of the id word (R0 of the Rx element) */
+#define CANLOG_ID_XTD               0x40000000U                 /* Extended identifier                               */
+#define CANLOG_ID_RTR               0x20000000U                 /* Remote frame                                      */
+#define CANLOG_ID_EXT_MASK          0x1FFFFFFFU
+#define CANLOG_ID_STD_SHIFT         18                          /* Standard IDs in bits 28..18                       */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* One decoded record */
+typedef struct
+{
+    uint32_t                        timestamp;       /* STM0 lower word, 100 MHz                                     */
+    uint32_t                        id;              /* R0 of the Rx element                                         */
+    uint8_t                         node;            /* Source node                                                  */
+    uint8_t                         flags;           /* CANLOG_FLAG_xxx                                              */
+    uint8_t                         dlc;             /* DLC as received                                              */
+    uint8_t                         length;          /* Valid bytes in data                                          */
+    uint8_t                         data[CANLOG_DATA_SIZE];
+} CanLogRecord;
+
+/* One indexed batch */
+typedef struct
+{
+    size_t                          offset;          /* Of the batch header in the log                               */
+    uint32_t                        sequence;        /* Batch number                                                 */
+    uint32_t                        dropped;         /* Records dropped since start                                  */
+    uint32_t                        count;           /* Records in the batch                                         */
+} CanLogBatch;
+
+/* Mapped and indexed log */
+typedef struct
+{
+    const uint8_t                  *data;            /* Log bytes                                                    */
+    size_t                          size;
+    CanLogBatch                    *batch;           /* Batches in log order                                         */
+    size_t                          batchCount;
+    size_t                          recordCount;     /* Records of all batches                                       */
+    size_t                          skippedBytes;    /* Bytes outside any batch                                      */
+    void                           *mapping;         /* canLogOpen(): the file mapping, else NULL                    */
+} CanLogReader;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+int  canLogOpen(CanLogReader *reader, const char *path);
+int  canLogIndex(CanLogReader *reader, const uint8_t *data, size_t size);
+void canLogClose(CanLogReader *reader);
+void canLogGetRecord(const CanLogReader *reader, const CanLogBatch *batch, uint32_t index, CanLogRecord *record);
+uint32_t canLogCanId(uint32_t id);
+
+#endif /* CANLOGREADER_H_ */
@@ -0,0 +1,97 @@
+/**********************************************************************************************************************
+ * \file canlogdump.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include "CanLogReader.h"
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* canlogdump <log file>: one line per frame, then a summary with the lost batches and bytes */
+int main(int argc, char **argv)
+{
+    CanLogReader reader;
+    size_t       lostBatches = 0;
+    size_t       b;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <log file>\n", argv[0]);
+        return 2;
+    }
+
+    if (canLogOpen(&reader, argv[1]) != 0)
+    {
+        fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+        return 1;
+    }
+
+    for (b = 0; b < reader.batchCount; b++)
+    {
+        const CanLogBatch *batch = &reader.batch[b];
+        uint32_t           r;
+
+        if ((b > 0) && (batch->sequence != (reader.batch[b - 1].sequence + 1)))
+        {
+            lostBatches += batch->sequence - reader.batch[b - 1].sequence - 1;
+        }
+
+        for (r = 0; r < batch->count; r++)
+        {
+            CanLogRecord record;
+            uint32_t     i;
+
+            canLogGetRecord(&reader, batch, r, &record);
+            printf("%10u  %u  %*s%0*X  %s%s%s%s [%2u]", record.timestamp, record.node,
+                   ((record.id & CANLOG_ID_XTD) != 0) ? 0 : 5, "", ((record.id & CANLOG_ID_XTD) != 0) ? 8 : 3,
+                   canLogCanId(record.id), ((record.flags & CANLOG_FLAG_FD) != 0) ? "FD" : "  ",
+                   ((record.flags & CANLOG_FLAG_BRS) != 0) ? "B" : " ",
+                   ((record.id & CANLOG_ID_RTR) != 0) ? "R" : " ",
+                   ((record.flags & CANLOG_FLAG_TRUNCATED) != 0) ? "T" : " ", record.dlc);
+
+            for (i = 0; i < record.length; i++)
+            {
+                printf(" %02X", record.data[i]);
+            }
+
+            printf("\n");
+        }
+    }
+
+    printf("%zu records in %zu batches, %zu batches lost, %u records dropped by the target, %zu bytes skipped\n",
+           reader.recordCount, reader.batchCount, lostBatches,
+           (reader.batchCount > 0) ? reader.batch[reader.batchCount - 1].dropped : 0U, reader.skippedBytes);
+
+    canLogClose(&reader);
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+/**********************************************************************************************************************
+ * \file TraceReader.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "TraceReader.h"
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+static uint32_t traceWord(const uint8_t *bytes)
+{
+    return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+/* ns of a CCNT delta */
+static int64_t traceCycles(const TraceRing *ring, uint32_t cycles)
+{
+    return (int64_t)(((uint64_t)(cycles & TRACE_CCNT_MASK) * 1000000000U) / ring->cpuClockHz);
+}
+
+/* Time order, the order of recording within a core */
+static int traceCompare(const void *a, const void *b)
+{
+    const TraceEvent *x = (const TraceEvent *)a;
+    const TraceEvent *y = (const TraceEvent *)b;
+
+    if (x->time != y->time)
+    {
+        return (x->time < y->time) ? -1 : 1;
+    }
+
+    if (x->core != y->core)
+    {
+        return (x->core < y->core) ? -1 : 1;
+    }
+
+    return (x->sequence < y->sequence) ? -1 : ((x->sequence > y->sequence) ? 1 : 0);
+}
+
+/* Checks the dump of one ring of size bytes, which must stay valid while the ring is read. 0: done, -1: no ring. */
+int traceRingLoad(TraceRing *ring, const uint8_t *data, size_t size)
+{
+    memset(ring, 0, sizeof(*ring));
+
+    if ((size < TRACE_HEADER_SIZE) || (traceWord(data) != TRACE_MAGIC))
+    {
+        return -1;
+    }
+
+    ring->data       = data;
+    ring->depth      = traceWord(&data[4]);
+    ring->head       = traceWord(&data[8]);
+    ring->cpuClockHz = traceWord(&data[12]);
+
+    if ((ring->depth == 0) || ((ring->depth & (ring->depth - 1)) != 0) || (ring->cpuClockHz == 0) ||
+        (((size - TRACE_HEADER_SIZE) / TRACE_EVENT_SIZE) < ring->depth))
+    {
+        return -1;
+    }
+
+    ring->count = (ring->head < ring->depth) ? ring->head : ring->depth;
+    ring->lost  = ring->head - ring->count;
+
+    return 0;
+}
+
+/* Event index of the dump, 0 the oldest */
+void traceRingGetEvent(const TraceRing *ring, uint32_t index, uint32_t *timestamp, uint32_t *info)
+{
+    uint32_t       slot  = (ring->lost + index) & (ring->depth - 1);
+    const uint8_t *bytes = &ring->data[TRACE_HEADER_SIZE + ((size_t)slot * TRACE_EVENT_SIZE)];
+
+    *timestamp = traceWord(&bytes[0]);
+    *info      = traceWord(&bytes[4]);
+}
+
+/* Places the events of the rings of cores on one timeline, tickHz is the tick rate of the trace. 0: done, -1: out of
+ * memory.
+ */
+int traceTimelineBuild(TraceTimeline *timeline, const TraceRing *ring, size_t cores, uint32_t tickHz)
+{
+    size_t  total      = 0;
+    int     referenced = 0;
+    int64_t reference  = 0;                          /* Unfolded tick count of the first tick of the first core */
+    size_t  c;
+
+    memset(timeline, 0, sizeof(*timeline));
+
+    for (c = 0; c < cores; c++)
+    {
+        total += ring[c].count;
+    }
+
+    timeline->event = (TraceEvent *)malloc((total > 0) ? (total * sizeof(TraceEvent)) : 1);
+
+    if (timeline->event == NULL)
+    {
+        return -1;
+    }
+
+    for (c = 0; c < cores; c++)
+    {
+        const TraceRing *r         = &ring[c];
+        uint32_t         first     = r->count;
+        int64_t          tick      = 0;
+        int64_t          tickTime  = 0;
+        uint32_t         tickStamp = 0;
+        uint32_t         i;
+
+        for (i = 0; i < r->count; i++)
+        {
+            uint32_t timestamp;
+            uint32_t info;
+
+            traceRingGetEvent(r, i, &timestamp, &info);
+
+            if ((info >> 24) == TRACE_TICK)
+            {
+                first = i;
+                break;
+            }
+        }
+
+        if (first == r->count)
+        {
+            timeline->unplaced += r->count;
+            continue;
+        }
+
+        for (i = 0; i < r->count; i++)
+        {
+            /* The events before the first tick count back from it, so it is placed first */
+            uint32_t    index = (i <= first) ? (first - i) : i;
+            TraceEvent *event = &timeline->event[timeline->count + index];
+            uint32_t    timestamp;
+            uint32_t    info;
+
+            traceRingGetEvent(r, index, &timestamp, &info);
+
+            event->sequence  = r->lost + index;
+            event->timestamp = timestamp;
+            event->core      = (uint8_t)c;
+            event->id        = (uint8_t)(info >> 24);
+            event->arg       = info & TRACE_ARG_MASK;
+
+            if (index < first)
+            {
+                event->time = tickTime - traceCycles(r, tickStamp - timestamp);
+            }
+            else if (event->id == TRACE_TICK)
+            {
+                if (index == first)
+                {
+                    /* Lined up with the first core: within 2^23 ticks of its first tick */
+                    tick       = referenced ? (reference + ((int32_t)((event->arg - (uint32_t)reference) << 8) / 256))
+                                            : (int64_t)event->arg;
+                    reference  = referenced ? reference : tick;
+                    referenced = 1;
+                }
+                else
+                {
+                    tick += (event->arg - (uint32_t)tick) & TRACE_ARG_MASK;
+                }
+
+                tickTime    = (tick * 1000000000) / tickHz;
+                tickStamp   = timestamp;
+                event->time = tickTime;
+            }
+            else
+            {
+                event->time = tickTime + traceCycles(r, timestamp - tickStamp);
+            }
+        }
+
+        timeline->count += r->count;
+    }
+
+    qsort(timeline->event, timeline->count, sizeof(TraceEvent), traceCompare);
+
+    return 0;
+}
+
+void traceTimelineFree(TraceTimeline *timeline)
+{
+    free(timeline->event);
+    memset(timeline, 0, sizeof(*timeline));
+}
+
+/* Name of an event id, NULL if unknown */
+const char *traceEventName(uint32_t id)
+{
+    static const char *const name[] = {
+        NULL, "TASK_SWITCHED_IN", "TASK_CREATE", "TICK", "ISR_ENTER", "ISR_EXIT", "IDLE_BEGIN", "IDLE_END",
+        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+        "QUEUE_SEND", "QUEUE_SEND_FAILED", "QUEUE_RECEIVE", "QUEUE_RECEIVE_FAILED", "QUEUE_SEND_ISR",
+        "QUEUE_SEND_ISR_FAILED", "QUEUE_RECEIVE_ISR", "QUEUE_RECEIVE_ISR_FAILED", "QUEUE_BLOCK_SEND",
+        "QUEUE_BLOCK_RECEIVE"};
+
+    return (id < (sizeof(name) / sizeof(name[0]))) ? name[id] : NULL;
+}
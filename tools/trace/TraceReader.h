@@ -0,0 +1,108 @@
+/**********************************************************************************************************************
+ * \file TraceReader.h
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef TRACEREADER_H_
+#define TRACEREADER_H_
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Host reader of the event trace of App_Trace.c (format: see App_Trace.h).
+ *
+ * The input is a memory dump of the ring of each core (g_appTraceRing[core], sizeof(AppTraceRing) bytes). A ring is
+ * unrolled from head: the events still in it are head - count .. head - 1, the older ones were overwritten. The
+ * timeline places the events of every core on the tick: the APP_TRACE_TICK events give the time of a tick, the CCNT
+ * delta to the latest tick the time within it. Events older than the first tick of a ring count back from that tick.
+ * The cores are lined up on the tick count (24 bits, unfolded from the first tick of the first core). A ring without
+ * any tick cannot be placed, its events are left out and counted. All words are little endian.
+ */
+#define TRACE_MAGIC                 0x54524331U                 /* "TRC1"                                            */
+#define TRACE_NUM_CORES             3
+#define TRACE_HEADER_SIZE           16                          /* magic, depth, head, cpuClockHz                    */
+#define TRACE_EVENT_SIZE            8                           /* timestamp, info                                   */
+#define TRACE_CCNT_MASK             0x7FFFFFFFU                 /* CCNT counts 31 bits                               */
+#define TRACE_ARG_MASK              0x00FFFFFFU
+
+/* Event ids, as App_Trace.h */
+#define TRACE_TASK_SWITCHED_IN      0x01U
+#define TRACE_TASK_CREATE           0x02U
+#define TRACE_TICK                  0x03U
+#define TRACE_ISR_ENTER             0x04U
+#define TRACE_ISR_EXIT              0x05U
+#define TRACE_IDLE_BEGIN            0x06U
+#define TRACE_IDLE_END              0x07U
+#define TRACE_QUEUE_SEND            0x10U                       /* Queue events 0x10..0x19, argument: queue id       */
+#define TRACE_QUEUE_BLOCK_RECEIVE   0x19U
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Dump of the ring of one core */
+typedef struct
+{
+    const uint8_t                  *data;            /* Dump bytes                                                   */
+    uint32_t                        depth;           /* Events the ring holds                                        */
+    uint32_t                        head;            /* Events written since appTraceInit()                          */
+    uint32_t                        cpuClockHz;      /* CCNT frequency                                               */
+    uint32_t                        count;           /* Events in the dump                                           */
+    uint32_t                        lost;            /* Events overwritten                                           */
+} TraceRing;
+
+/* One event on the timeline */
+typedef struct
+{
+    int64_t                         time;            /* ns since tick 0                                              */
+    uint32_t                        sequence;        /* Event number on its core, from appTraceInit()                */
+    uint32_t                        timestamp;       /* CCNT as recorded                                             */
+    uint8_t                         core;
+    uint8_t                         id;              /* TRACE_xxx                                                    */
+    uint32_t                        arg;
+} TraceEvent;
+
+/* Events of all cores in time order */
+typedef struct
+{
+    TraceEvent                     *event;
+    size_t                          count;
+    size_t                          unplaced;        /* Events of rings without a tick                               */
+} TraceTimeline;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+int         traceRingLoad(TraceRing *ring, const uint8_t *data, size_t size);
+void        traceRingGetEvent(const TraceRing *ring, uint32_t index, uint32_t *timestamp, uint32_t *info);
+int         traceTimelineBuild(TraceTimeline *timeline, const TraceRing *ring, size_t cores, uint32_t tickHz);
+void        traceTimelineFree(TraceTimeline *timeline);
+const char *traceEventName(uint32_t id);
+
+#endif /* TRACEREADER_H_ */
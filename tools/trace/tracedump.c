@@ -0,0 +1,155 @@
+/**********************************************************************************************************************
+ * \file tracedump.c
+ * \copyright Copyright (C) Infineon Technologies AG 2025
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of
+ * machine-executable object code generated by a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "TraceReader.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TRACEDUMP_TICK_HZ           1000                        /* configTICK_RATE_HZ                                */
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+/* Reads the whole file at path, NULL if it cannot be read (errno set) */
+static uint8_t *traceDumpRead(const char *path, size_t *size)
+{
+    FILE    *file = fopen(path, "rb");
+    uint8_t *data = NULL;
+    long     length;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+
+    if ((fseek(file, 0, SEEK_END) == 0) && ((length = ftell(file)) >= 0) && (fseek(file, 0, SEEK_SET) == 0))
+    {
+        data = (uint8_t *)malloc((length > 0) ? (size_t)length : 1);
+
+        if ((data != NULL) && (fread(data, 1, (size_t)length, file) != (size_t)length))
+        {
+            free(data);
+            data = NULL;
+        }
+
+        *size = (size_t)length;
+    }
+
+    fclose(file);
+
+    return data;
+}
+
+/* tracedump <CPU0 dump> [<CPU1 dump> [<CPU2 dump>]]: the dump of g_appTraceRing[core] of each core, "-" for a core
+ * without dump. One line per event in time order (us since the first event), then the events per core and the lost
+ * ones.
+ */
+int main(int argc, char **argv)
+{
+    uint8_t      *data[TRACE_NUM_CORES] = {NULL, NULL, NULL};
+    TraceRing     ring[TRACE_NUM_CORES];
+    TraceTimeline timeline;
+    size_t        cores = (size_t)argc - 1;
+    size_t        c;
+    size_t        e;
+
+    if ((argc < 2) || (cores > TRACE_NUM_CORES))
+    {
+        fprintf(stderr, "usage: %s <CPU0 dump> [<CPU1 dump> [<CPU2 dump>]]\n", argv[0]);
+        return 2;
+    }
+
+    for (c = 0; c < cores; c++)
+    {
+        size_t size = 0;
+
+        memset(&ring[c], 0, sizeof(ring[c]));
+
+        if (strcmp(argv[c + 1], "-") == 0)
+        {
+            continue;
+        }
+
+        data[c] = traceDumpRead(argv[c + 1], &size);
+
+        if (data[c] == NULL)
+        {
+            fprintf(stderr, "%s: %s\n", argv[c + 1], strerror(errno));
+            return 1;
+        }
+
+        if (traceRingLoad(&ring[c], data[c], size) != 0)
+        {
+            fprintf(stderr, "%s: no trace ring\n", argv[c + 1]);
+            return 1;
+        }
+    }
+
+    if (traceTimelineBuild(&timeline, ring, cores, TRACEDUMP_TICK_HZ) != 0)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    for (e = 0; e < timeline.count; e++)
+    {
+        const TraceEvent *event = &timeline.event[e];
+        const char       *name  = traceEventName(event->id);
+
+        printf("%14.3f  CPU%u  %-24s", (double)(event->time - timeline.event[0].time) / 1000.0, event->core,
+               (name != NULL) ? name : "?");
+
+        if (event->id >= TRACE_QUEUE_SEND)
+        {
+            printf(" queue 0x%06X\n", event->arg);
+        }
+        else
+        {
+            printf(" %u\n", event->arg);
+        }
+    }
+
+    for (c = 0; c < cores; c++)
+    {
+        printf("CPU%u: %u events, %u lost\n", (unsigned)c, ring[c].count, ring[c].lost);
+        free(data[c]);
+    }
+
+    printf("%zu events on the timeline, %zu of rings without a tick left out\n", timeline.count, timeline.unplaced);
+
+    traceTimelineFree(&timeline);
+
+    return 0;
+}